@@ -0,0 +1,192 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Known-AP baseline. See ap-baseline.h.
+// (Portable; no Arduino dependencies.)
+
+#include <string.h>
+
+#include "ap-baseline.h"
+#include "stream-format.h"
+
+static const uint8_t BASELINE_MAGIC[4] = { 'W', 'B', 'S', 'L' };
+
+static inline uint64_t bssidKey(const uint8_t *bssid) {
+  uint64_t key = 1ULL << 48; // Never 0, even for an all-zero BSSID.
+  for (size_t i = 0; i < 6; i++) {
+    key |= static_cast<uint64_t>(bssid[i]) << (8 * (5 - i));
+  }
+
+  return key;
+}
+
+static inline uint32_t mixKey(uint64_t key) {
+  // Fold the 49-bit key to 32 bits and mix, so that sequential BSSIDs spread out.
+  uint32_t h = static_cast<uint32_t>(key) ^ static_cast<uint32_t>(key >> 32);
+  h ^= h >> 16;
+  h *= 0x7FEB352Du;
+  h ^= h >> 15;
+  return h;
+}
+
+ApBaseline::ApBaseline() {
+  clear();
+}
+
+void ApBaseline::clear() {
+  memset(_bssidKeys, 0, sizeof(_bssidKeys));
+  memset(_bssidSsids, 0, sizeof(_bssidSsids));
+  memset(_ssidKeys, 0, sizeof(_ssidKeys));
+  memset(_channels, 0, sizeof(_channels));
+  _numBssids = 0;
+  _numSsids = 0;
+}
+
+// FNV-1a of the SSID, or 0 for a hidden (empty) SSID.
+uint32_t ApBaseline::_ssidHash(const uint8_t *ssid) {
+  if (ssid[0] == '\0') {
+    return 0;
+  }
+
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < 32 && ssid[i] != '\0'; i++) {
+    hash = (hash ^ ssid[i]) * 16777619u;
+  }
+
+  return hash != 0 ? hash : 1;
+}
+
+// Linear probing: return the slot holding `key`, or the empty slot where it would go.
+size_t ApBaseline::_bssidSlot(uint64_t key) const {
+  size_t slot = mixKey(key) & (BASELINE_BSSID_SLOTS - 1);
+  while (_bssidKeys[slot] != 0 && _bssidKeys[slot] != key) {
+    slot = (slot + 1) & (BASELINE_BSSID_SLOTS - 1);
+  }
+
+  return slot;
+}
+
+size_t ApBaseline::_ssidSlot(uint32_t ssidHash) const {
+  size_t slot = ssidHash & (BASELINE_SSID_SLOTS - 1);
+  while (_ssidKeys[slot] != 0 && _ssidKeys[slot] != ssidHash) {
+    slot = (slot + 1) & (BASELINE_SSID_SLOTS - 1);
+  }
+
+  return slot;
+}
+
+bool ApBaseline::_addEntry(uint64_t key, uint32_t ssidHash) {
+  size_t slot = _bssidSlot(key);
+  if (_bssidKeys[slot] == 0) {
+    if (_numBssids >= BASELINE_MAX_BSSIDS) {
+      return false;
+    }
+    _bssidKeys[slot] = key;
+    _numBssids++;
+  }
+  _bssidSsids[slot] = ssidHash;
+
+  if (ssidHash != 0 && _numSsids < BASELINE_MAX_SSIDS) {
+    size_t ssidSlot = _ssidSlot(ssidHash);
+    if (_ssidKeys[ssidSlot] == 0) {
+      _ssidKeys[ssidSlot] = ssidHash;
+      _numSsids++;
+    }
+  }
+
+  return true;
+}
+
+void ApBaseline::_addChannel(int channel) {
+  if (channel >= 0 && channel <= BASELINE_MAX_CHANNEL) {
+    _channels[channel / 8] |= 1 << (channel % 8);
+  }
+}
+
+bool ApBaseline::_channelUsed(int channel) const {
+  if (channel < 0 || channel > BASELINE_MAX_CHANNEL) {
+    return false;
+  }
+
+  return (_channels[channel / 8] & (1 << (channel % 8))) != 0;
+}
+
+bool ApBaseline::add(const uint8_t *bssid, const uint8_t *ssid, int channel) {
+  if (!_addEntry(bssidKey(bssid), _ssidHash(ssid))) {
+    return false;
+  }
+
+  _addChannel(channel);
+  return true;
+}
+
+ApStatus ApBaseline::check(const uint8_t *bssid, const uint8_t *ssid, int channel) const {
+  uint32_t ssidHash = _ssidHash(ssid);
+  size_t slot = _bssidSlot(bssidKey(bssid));
+  bool protectedSsid = ssidHash != 0 && _ssidKeys[_ssidSlot(ssidHash)] != 0;
+
+  if (_bssidKeys[slot] != 0) {
+    // A known AP that now also claims another of our SSIDs is as suspect as an unknown one.
+    return _bssidSsids[slot] == ssidHash || !protectedSsid ? AP_KNOWN : AP_ROGUE;
+  } else if (protectedSsid) {
+    return AP_ROGUE;
+  } else if (!_channelUsed(channel)) {
+    return AP_NEW_CLEAN_CHANNEL;
+  }
+
+  return AP_NEW;
+}
+
+size_t ApBaseline::encode(uint8_t *buf) const {
+  memcpy(buf, BASELINE_MAGIC, sizeof(BASELINE_MAGIC));
+  buf[4] = BASELINE_FORMAT_VERSION;
+  buf[5] = 0;
+  buf[6] = _numBssids & 0xFF;
+  buf[7] = (_numBssids >> 8) & 0xFF;
+  memcpy(buf + 8, _channels, BASELINE_CHANNEL_BYTES);
+
+  size_t pos = BASELINE_HEADER_LEN;
+  for (size_t slot = 0; slot < BASELINE_BSSID_SLOTS; slot++) {
+    uint64_t key = _bssidKeys[slot];
+    if (key == 0) {
+      continue;
+    }
+
+    for (size_t i = 0; i < 6; i++) {
+      buf[pos++] = (key >> (8 * (5 - i))) & 0xFF;
+    }
+    uint32_t ssidHash = _bssidSsids[slot];
+    for (size_t i = 0; i < 4; i++) {
+      buf[pos++] = (ssidHash >> (8 * i)) & 0xFF;
+    }
+  }
+
+  uint16_t crc = streamCrc16(buf, pos);
+  buf[pos++] = crc & 0xFF;
+  buf[pos++] = (crc >> 8) & 0xFF;
+  return pos;
+}
+
+bool ApBaseline::decode(const uint8_t *buf, size_t len) {
+  clear();
+  if (len < BASELINE_HEADER_LEN + 2 || memcmp(buf, BASELINE_MAGIC, sizeof(BASELINE_MAGIC))
+      || buf[4] != BASELINE_FORMAT_VERSION) {
+    return false;
+  }
+
+  size_t count = buf[6] | (buf[7] << 8);
+  size_t bodyLen = BASELINE_HEADER_LEN + count * BASELINE_ENTRY_LEN;
+  if (count > BASELINE_MAX_BSSIDS || len < bodyLen + 2
+      || streamCrc16(buf, bodyLen) != (buf[bodyLen] | (buf[bodyLen + 1] << 8))) {
+    return false;
+  }
+
+  memcpy(_channels, buf + 8, BASELINE_CHANNEL_BYTES);
+  const uint8_t *entry = buf + BASELINE_HEADER_LEN;
+  for (size_t i = 0; i < count; i++, entry += BASELINE_ENTRY_LEN) {
+    uint32_t ssidHash = entry[6] | (entry[7] << 8) | (entry[8] << 16)
+        | (static_cast<uint32_t>(entry[9]) << 24);
+    _addEntry(bssidKey(entry), ssidHash);
+  }
+
+  return true;
+}
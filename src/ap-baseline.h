@@ -0,0 +1,85 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// A baseline of the access points known to be on site, to check new scans against for new and
+// rogue APs. (Portable; no Arduino dependencies.)
+
+#ifndef _AP_BASELINE_H
+#define _AP_BASELINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// How a station compares to the baseline.
+enum ApStatus : uint8_t {
+  AP_KNOWN = 0,             // Its BSSID is in the baseline.
+  AP_NEW = 1,               // Unknown BSSID on a channel that had stations in the baseline.
+  AP_NEW_CLEAN_CHANNEL = 2, // Unknown BSSID on a channel that had none.
+  AP_ROGUE = 3,             // Unknown BSSID (or a known one that changed SSID) broadcasting one
+                            // of the SSIDs in the baseline.
+};
+
+constexpr size_t BASELINE_MAX_BSSIDS = 192;
+constexpr size_t BASELINE_MAX_SSIDS = 64;
+constexpr int BASELINE_MAX_CHANNEL = 191;
+
+// Open-addressed hash set sizes; powers of two, and no more than 3/4 full.
+constexpr size_t BASELINE_BSSID_SLOTS = 256;
+constexpr size_t BASELINE_SSID_SLOTS = 128;
+
+// Encoded form, as persisted:
+//
+//   char[4]  magic = "WBSL"
+//   u8       format version (1)
+//   u8       reserved (0)
+//   u16      number of entries
+//   u8[24]   bitmap of the channels that had stations, bit (ch % 8) of byte (ch / 8)
+//   entries: u8[6] BSSID, u32 hash of its SSID (0 if hidden)
+//   u16      CRC-16/CCITT-FALSE of everything above
+//
+// Multi-byte fields are little-endian.
+constexpr uint8_t BASELINE_FORMAT_VERSION = 1;
+constexpr size_t BASELINE_CHANNEL_BYTES = (BASELINE_MAX_CHANNEL + 1) / 8;
+constexpr size_t BASELINE_HEADER_LEN = 8 + BASELINE_CHANNEL_BYTES;
+constexpr size_t BASELINE_ENTRY_LEN = 10;
+constexpr size_t BASELINE_MAX_ENCODED_LEN =
+    BASELINE_HEADER_LEN + BASELINE_MAX_BSSIDS * BASELINE_ENTRY_LEN + 2;
+
+// Known BSSIDs, each with the hash of the SSID it broadcast; the set of SSIDs they broadcast; and
+// the channels they occupied. Each check() is a constant number of hash probes, independent of
+// the baseline size. SSIDs are compared by a 32-bit hash, so the baseline doesn't store them.
+class ApBaseline {
+public:
+  ApBaseline();
+
+  void clear();
+  // Add a station; `ssid` is NUL-terminated (empty if hidden). Returns false if the baseline is
+  // full.
+  bool add(const uint8_t *bssid, const uint8_t *ssid, int channel);
+  ApStatus check(const uint8_t *bssid, const uint8_t *ssid, int channel) const;
+
+  size_t numBssids() const { return _numBssids; };
+  size_t numSsids() const { return _numSsids; };
+
+  // Encode to `buf` (at least BASELINE_MAX_ENCODED_LEN bytes). Returns the length written.
+  size_t encode(uint8_t *buf) const;
+  // Replace the contents with an encoded baseline. Returns false (and leaves the baseline empty)
+  // if `buf` doesn't hold a valid one.
+  bool decode(const uint8_t *buf, size_t len);
+
+private:
+  static uint32_t _ssidHash(const uint8_t *ssid);
+  size_t _bssidSlot(uint64_t key) const;
+  size_t _ssidSlot(uint32_t ssidHash) const;
+  bool _addEntry(uint64_t key, uint32_t ssidHash);
+  void _addChannel(int channel);
+  bool _channelUsed(int channel) const;
+
+  uint64_t _bssidKeys[BASELINE_BSSID_SLOTS];   // 48-bit BSSID | 1 << 48; 0 if empty.
+  uint32_t _bssidSsids[BASELINE_BSSID_SLOTS];  // SSID hash for each key.
+  uint32_t _ssidKeys[BASELINE_SSID_SLOTS];     // SSID hash; 0 if empty.
+  uint8_t _channels[BASELINE_CHANNEL_BYTES];
+  size_t _numBssids;
+  size_t _numSsids;
+};
+
+#endif
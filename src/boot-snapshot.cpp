@@ -0,0 +1,175 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Save the latest scan to SPI flash, and show it at the next boot while the radio starts up.
+
+#include "wifi-scanner.h"
+
+static const uint8_t SNAPSHOT_MAGIC[4] = { 'W', 'S', 'N', 'P' };
+
+static uint8_t snapshotBuf[SNAPSHOT_MAX_LEN];
+static wifi_ap_record_t snapshotRecords[MAX_STATIONS];
+
+static size_t nextSlot = 0;  // Slot that the next snapshot goes in.
+static uint32_t nextSeq = 1;
+
+// Scan being assembled for the next snapshot.
+static uint32_t saveTimestamp = 0;
+static size_t saveEntriesLen = 0;
+static uint8_t saveCount = 0;
+static bool saved = false;
+static uint32_t lastSaveMillis = 0;
+
+// Length of a slot: SNAPSHOT_MAX_LEN rounded up to whole erase blocks.
+static uint32_t slotLen(const sfud_flash *flash) {
+  uint32_t gran = flash->chip.erase_gran;
+  return (SNAPSHOT_MAX_LEN + gran - 1) / gran * gran;
+}
+
+static size_t numSlots(const sfud_flash *flash) {
+  return SNAPSHOT_FLASH_LEN / slotLen(flash);
+}
+
+static uint32_t slotAddr(const sfud_flash *flash, size_t slot) {
+  return SNAPSHOT_FLASH_BASE + slot * slotLen(flash);
+}
+
+// Read and validate the snapshot in `slot` into snapshotBuf. Returns its body length and
+// sequence number, or 0 if the slot holds no valid snapshot.
+static size_t readSnapshot(const sfud_flash *flash, size_t slot, uint32_t &seq) {
+  uint32_t addr = slotAddr(flash, slot);
+  if (sfud_read(flash, addr, SNAPSHOT_HEADER_LEN, snapshotBuf) != SFUD_SUCCESS
+      || memcmp(snapshotBuf, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC))) {
+    return 0;
+  }
+
+  seq = snapshotBuf[4] | (snapshotBuf[5] << 8) | (snapshotBuf[6] << 16)
+      | (static_cast<uint32_t>(snapshotBuf[7]) << 24);
+  size_t bodyLen = snapshotBuf[8] | (snapshotBuf[9] << 8);
+  uint16_t crc = snapshotBuf[10] | (snapshotBuf[11] << 8);
+  if (bodyLen < SCAN_LOG_BLOCK_PREFIX_LEN || bodyLen > SNAPSHOT_MAX_LEN - SNAPSHOT_HEADER_LEN) {
+    return 0;
+  }
+
+  uint8_t *body = snapshotBuf + SNAPSHOT_HEADER_LEN;
+  if (sfud_read(flash, addr + SNAPSHOT_HEADER_LEN, bodyLen, body) != SFUD_SUCCESS
+      || streamCrc16(body, bodyLen) != crc) {
+    return 0;
+  }
+
+  return bodyLen;
+}
+
+int snapshotLoad() {
+  const sfud_flash *flash = spiFlash();
+  if (flash == NULL || numSlots(flash) < 2) {
+    return -1;
+  }
+
+  // Find the newest valid snapshot.
+  bool found = false;
+  size_t newestSlot = 0;
+  uint32_t newestSeq = 0;
+  for (size_t slot = 0; slot < numSlots(flash); slot++) {
+    uint32_t seq;
+    if (readSnapshot(flash, slot, seq) > 0 && (!found || seq > newestSeq)) {
+      found = true;
+      newestSlot = slot;
+      newestSeq = seq;
+    }
+  }
+
+  if (!found) {
+    return -1;
+  }
+
+  nextSlot = (newestSlot + 1) % numSlots(flash);
+  nextSeq = newestSeq + 1;
+
+  uint32_t seq;
+  size_t bodyLen = readSnapshot(flash, newestSlot, seq);
+  const uint8_t *body = snapshotBuf + SNAPSHOT_HEADER_LEN;
+  size_t blockLen;
+  uint32_t timestamp;
+  uint8_t count;
+  if (bodyLen == 0 || scanLogDecodeBlockPrefix(body, bodyLen, blockLen, timestamp, count) == 0) {
+    return -1;
+  }
+
+  memset(snapshotRecords, 0, sizeof(snapshotRecords));
+  size_t pos = SCAN_LOG_BLOCK_PREFIX_LEN;
+  int n = 0;
+  for (uint8_t i = 0; i < count && n < static_cast<int>(MAX_STATIONS); i++) {
+    ScanLogStation station;
+    size_t consumed = scanLogDecodeStation(body + pos, bodyLen - pos, station);
+    if (consumed == 0) {
+      break;
+    }
+
+    scanLogStationToAPRecord(station, &snapshotRecords[n++]);
+    pos += consumed;
+  }
+
+  return n;
+}
+
+const wifi_ap_record_t *snapshotRecord(size_t wifiIdx) {
+  return &snapshotRecords[wifiIdx];
+}
+
+void snapshotStartScan(uint32_t timestamp) {
+  saveTimestamp = timestamp;
+  saveEntriesLen = 0;
+  saveCount = 0;
+}
+
+void snapshotAddStation(const wifi_ap_record_t *pWifiAPRecord) {
+  if (saveCount >= MAX_STATIONS) {
+    return;
+  }
+
+  ScanLogStation station;
+  scanLogStationFromAPRecord(pWifiAPRecord, station);
+  saveEntriesLen += scanLogEncodeStation(
+      snapshotBuf + SNAPSHOT_HEADER_LEN + SCAN_LOG_BLOCK_PREFIX_LEN + saveEntriesLen, station);
+  saveCount++;
+}
+
+bool snapshotFinishScan() {
+  if (saved && millis() - lastSaveMillis < SNAPSHOT_SAVE_INTERVAL_MILLIS) {
+    return false;
+  }
+
+  const sfud_flash *flash = spiFlash();
+  if (flash == NULL || numSlots(flash) < 2) {
+    return false;
+  }
+
+  uint8_t *body = snapshotBuf + SNAPSHOT_HEADER_LEN;
+  size_t bodyLen = scanLogEncodeBlockPrefix(body, saveTimestamp, saveCount, saveEntriesLen)
+      + saveEntriesLen;
+  uint16_t crc = streamCrc16(body, bodyLen);
+  memcpy(snapshotBuf, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+  snapshotBuf[4] = nextSeq & 0xFF;
+  snapshotBuf[5] = (nextSeq >> 8) & 0xFF;
+  snapshotBuf[6] = (nextSeq >> 16) & 0xFF;
+  snapshotBuf[7] = (nextSeq >> 24) & 0xFF;
+  snapshotBuf[8] = bodyLen & 0xFF;
+  snapshotBuf[9] = (bodyLen >> 8) & 0xFF;
+  snapshotBuf[10] = crc & 0xFF;
+  snapshotBuf[11] = (crc >> 8) & 0xFF;
+
+  // Writing to the next slot (rather than rewriting this one) means a power cut mid-write
+  // still leaves the previous snapshot intact.
+  uint32_t addr = slotAddr(flash, nextSlot);
+  if (sfud_erase(flash, addr, slotLen(flash)) != SFUD_SUCCESS
+      || sfud_write(flash, addr, SNAPSHOT_HEADER_LEN + bodyLen, snapshotBuf) != SFUD_SUCCESS) {
+    DBGPRINTI("Snapshot flash write failed at", addr);
+    return false;
+  }
+
+  nextSlot = (nextSlot + 1) % numSlots(flash);
+  nextSeq++;
+  saved = true;
+  lastSaveMillis = millis();
+  return true;
+}
@@ -0,0 +1,41 @@
+// (c) Copyright 2022 Aaron Kimball
+
+#ifndef _BOOT_SNAPSHOT_H
+#define _BOOT_SNAPSHOT_H
+
+#include "scan-log-format.h"
+#include "station-table.h"
+
+// With FAST_BOOT, the most recent scan is saved to the SPI flash (see spi-flash.h) so that the
+// next boot can show it before the radio is up. Snapshots rotate through the slots of a
+// SNAPSHOT_FLASH_LEN region to spread out flash wear. A slot is the fewest whole erase blocks
+// that hold SNAPSHOT_MAX_LEN (one 4 KiB block for a single scan's SCAN_MAX_NUMBER stations; two
+// for a MULTI_PASS_SCAN table). Each snapshot occupies the start of one slot:
+//
+//   char[4]  magic = "WSNP"
+//   u32      snapshot sequence number; the highest valid one is the newest
+//   u16      body length
+//   u16      CRC-16/CCITT-FALSE of the body
+//   u8[]     body: one scan block in the scan log encoding (see scan-log-format.h)
+constexpr uint32_t SNAPSHOT_FLASH_BASE = 0x000000;
+constexpr size_t SNAPSHOT_FLASH_LEN = 0x010000;
+constexpr size_t SNAPSHOT_HEADER_LEN = 12;
+constexpr size_t SNAPSHOT_MAX_LEN =
+    SNAPSHOT_HEADER_LEN + SCAN_LOG_BLOCK_PREFIX_LEN + MAX_STATIONS * SCAN_LOG_ENTRY_MAX_LEN;
+
+// Save a snapshot at most this often (in ms), to limit flash wear.
+constexpr uint32_t SNAPSHOT_SAVE_INTERVAL_MILLIS = 60000;
+
+// Load the newest snapshot. Returns the number of stations in it, or -1 if there is none.
+extern int snapshotLoad();
+// Return a station record from the loaded snapshot.
+extern const wifi_ap_record_t *snapshotRecord(size_t wifiIdx);
+
+// Offer a scan for the next snapshot: call snapshotStartScan(), then snapshotAddStation() for
+// each station, then snapshotFinishScan(). It's saved if SNAPSHOT_SAVE_INTERVAL_MILLIS have
+// passed since the last save; returns true if it was.
+extern void snapshotStartScan(uint32_t timestamp);
+extern void snapshotAddStation(const wifi_ap_record_t *pWifiAPRecord);
+extern bool snapshotFinishScan();
+
+#endif
@@ -0,0 +1,190 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Best-channel recommendations. See channel-advisor.h.
+// (Portable; no Arduino dependencies.)
+
+#include <string.h>
+
+#include "channel-advisor.h"
+
+// The 2.4 GHz channels that don't overlap one another.
+static const int nonOverlapping24GHzChannels[] = { 1, 6, 11 };
+
+// 40 MHz channel pairs on 5 GHz are fixed: 36+40, 44+48, ... and 149+153, 157+161, ...
+static constexpr int first40MHzPair50GHz = 36;
+static constexpr int first40MHzPairUNII3 = 149;
+
+// Neighbor counts are weighted by the linear gain of the spectral mask at their distance. Using
+// power_t for the weights lets the same tables convert them: a station at full power weighs
+// dbmToPower(NEIGHBOR_REF_DBM), one at -10 dB a tenth of that, etc.
+static constexpr int NEIGHBOR_REF_DBM = -30;
+
+ChannelAdvisor::ChannelAdvisor(bool is24GHz): _is24GHz(is24GHz) {
+  _minChannel = is24GHz ? min24GHzChannelNum : min50GHzChannelNum;
+  _maxChannel = is24GHz ? max24GHzChannelNum : max50GHzChannelNum;
+  _channelDelta = is24GHz ? ADJACENT_24_GHZ_CHAN_DELTA : ADJACENT_50_GHZ_CHAN_DELTA;
+  _numSlots = _maxChannel - _minChannel + 1;
+  memset(_candidate, 0, sizeof(_candidate));
+  clear();
+}
+
+int ChannelAdvisor::_slotForChannel(int channelNum) const {
+  if (channelNum < _minChannel || channelNum > _maxChannel) {
+    return -1;
+  }
+
+  return channelNum - _minChannel;
+}
+
+bool ChannelAdvisor::_isCandidate(int channelNum) const {
+  int slot = _slotForChannel(channelNum);
+  return slot >= 0 && _candidate[slot];
+}
+
+void ChannelAdvisor::defineChannel(int channelNum) {
+  int slot = _slotForChannel(channelNum);
+  if (slot >= 0) {
+    _candidate[slot] = true;
+  }
+}
+
+void ChannelAdvisor::clear() {
+  memset(_rxPower, 0, sizeof(_rxPower));
+  memset(_occupancy, 0, sizeof(_occupancy));
+}
+
+void ChannelAdvisor::_addRxPower(int channelNum, int rssi, void *advisor) {
+  ChannelAdvisor *self = static_cast<ChannelAdvisor*>(advisor);
+  int slot = self->_slotForChannel(channelNum);
+  if (slot >= 0) {
+    self->_rxPower[slot] += dbmToPower(rssi);
+  }
+}
+
+void ChannelAdvisor::addSignal(const SpectrumSignal &signal) {
+  if (spectrumIs24GHz(signal.primary) != _is24GHz) {
+    return;
+  }
+
+  spectrumForEachChannel(signal, _addRxPower, this);
+
+  SpectrumFootprint fp;
+  spectrumFootprint(signal, fp);
+  for (int chan = fp.lowerChannelNum; chan <= fp.upperChannelNum; chan += fp.channelDelta) {
+    int slot = _slotForChannel(chan);
+    if (slot >= 0) {
+      _occupancy[slot]++;
+    }
+  }
+}
+
+// Score an AP on `primary` with the given secondary channel position.
+void ChannelAdvisor::_score(int primary, uint8_t second, ChannelPick &pick) const {
+  // Assume the new AP is 802.11n (or newer), which uses the 802.11g mask at 20 MHz.
+  SpectrumSignal candidate = { primary, second, 0, false, true };
+  SpectrumFootprint fp;
+  spectrumFootprint(candidate, fp);
+
+  int lowerSlot = _slotForChannel(fp.lowerChannelNum);
+  int upperSlot = _slotForChannel(fp.upperChannelNum);
+
+  // Interference received: everything that lands inside our own passband.
+  power_t rxPower = dbmToPower(noiseFloorDBm);
+  power_t fullWeight = dbmToPower(NEIGHBOR_REF_DBM);
+  power_t neighbors = 0;
+  for (int slot = lowerSlot; slot <= upperSlot; slot += fp.channelDelta) {
+    rxPower += _rxPower[slot];
+    neighbors += fullWeight * _occupancy[slot];
+  }
+
+  // Interference caused: our spectral mask, applied to the stations on each channel nearby.
+  for (size_t m = 0; m < fp.maskLen; m++) {
+    power_t weight = dbmToPower(NEIGHBOR_REF_DBM + fp.mask[m]);
+    int offset = (m + 1) * fp.channelDelta;
+    int above = upperSlot + offset;
+    int below = lowerSlot - offset;
+    if (above < static_cast<int>(_numSlots)) {
+      neighbors += weight * _occupancy[above];
+    }
+    if (below >= 0) {
+      neighbors += weight * _occupancy[below];
+    }
+  }
+
+  pick.primary = primary;
+  pick.secondary = primary;
+  if (second == SPECTRUM_SECOND_ABOVE) {
+    pick.secondary = fp.upperChannelNum;
+  } else if (second == SPECTRUM_SECOND_BELOW) {
+    pick.secondary = fp.lowerChannelNum;
+  }
+  pick.rxDbm = powerToDbm(rxPower);
+  pick.neighborsMilli = neighbors * 1000 / fullWeight;
+  // 10*log10(1 + n) is the dB difference between (1 + n) and 1 reference weights.
+  int penaltyDeciDb = powerToDeciDbm(fullWeight + neighbors) - powerToDeciDbm(fullWeight);
+  pick.scoreDeciDb = powerToDeciDbm(rxPower) + penaltyDeciDb;
+}
+
+size_t ChannelAdvisor::recommend(int widthMhz, ChannelPolicy policy, ChannelPick *picks,
+    size_t maxPicks) const {
+  ChannelPick candidates[ADVISOR_MAX_CANDIDATES];
+  size_t numCandidates = 0;
+
+  for (size_t slot = 0; slot < _numSlots; slot++) {
+    int primary = _minChannel + slot;
+    if (!_candidate[slot]) {
+      continue;
+    }
+
+    if (_is24GHz && policy == CHANNEL_POLICY_1_6_11) {
+      bool allowed = false;
+      for (int chan : nonOverlapping24GHzChannels) {
+        allowed = allowed || chan == primary;
+      }
+      if (!allowed) {
+        continue;
+      }
+    }
+
+    if (widthMhz != 40) {
+      _score(primary, SPECTRUM_SECOND_NONE, candidates[numCandidates++]);
+    } else if (_is24GHz) {
+      // The secondary channel is 20 MHz above or below, if that's in the band plan.
+      if (_isCandidate(primary + 4 * ADJACENT_24_GHZ_CHAN_DELTA)) {
+        _score(primary, SPECTRUM_SECOND_ABOVE, candidates[numCandidates++]);
+      }
+      if (_isCandidate(primary - 4 * ADJACENT_24_GHZ_CHAN_DELTA)) {
+        _score(primary, SPECTRUM_SECOND_BELOW, candidates[numCandidates++]);
+      }
+    } else {
+      // Only the lower channel of each fixed 5 GHz pair starts a candidate.
+      int pairBase = primary >= first40MHzPairUNII3 ? first40MHzPairUNII3 : first40MHzPair50GHz;
+      int pairSpacing = 2 * ADJACENT_50_GHZ_CHAN_DELTA;
+      if (primary >= pairBase && (primary - pairBase) % pairSpacing == 0
+          && _isCandidate(primary + ADJACENT_50_GHZ_CHAN_DELTA)) {
+        _score(primary, SPECTRUM_SECOND_ABOVE, candidates[numCandidates++]);
+      }
+    }
+  }
+
+  // Selection sort just the top few; ties go to the lower channel.
+  size_t numPicks = 0;
+  while (numPicks < maxPicks && numPicks < numCandidates) {
+    size_t best = numPicks;
+    for (size_t i = numPicks + 1; i < numCandidates; i++) {
+      if (candidates[i].scoreDeciDb < candidates[best].scoreDeciDb
+          || (candidates[i].scoreDeciDb == candidates[best].scoreDeciDb
+              && candidates[i].primary < candidates[best].primary)) {
+        best = i;
+      }
+    }
+
+    ChannelPick tmp = candidates[numPicks];
+    candidates[numPicks] = candidates[best];
+    candidates[best] = tmp;
+    picks[numPicks] = candidates[numPicks];
+    numPicks++;
+  }
+
+  return numPicks;
+}
@@ -0,0 +1,79 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Recommend channels for a new access point, using the same spectral mask model as the
+// heatmaps. (Portable; no Arduino dependencies.)
+
+#ifndef _CHANNEL_ADVISOR_H
+#define _CHANNEL_ADVISOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "linear-power.h"
+#include "spectrum.h"
+
+// Per-channel totals are indexed by channel number within the band. (Not every number is a
+// channel; U-NII-3 channels are offset by one from U-NII-1's spacing, for instance.)
+constexpr size_t ADVISOR_MAX_SLOTS = max50GHzChannelNum - min50GHzChannelNum + 1;
+
+// Max candidates evaluated for one width: each 2.4 GHz channel, twice (secondary above or
+// below), or each 5 GHz channel.
+constexpr size_t ADVISOR_MAX_CANDIDATES =
+    (max50GHzChannelNum - min50GHzChannelNum) / ADJACENT_50_GHZ_CHAN_DELTA + 2;
+
+enum ChannelPolicy : uint8_t {
+  CHANNEL_POLICY_ANY = 0,    // Any channel in the band plan.
+  CHANNEL_POLICY_1_6_11 = 1, // 2.4 GHz: primary channel must be 1, 6 or 11. (No effect on 5 GHz.)
+};
+
+// A candidate AP channel and its score. Lower scores are better.
+struct ChannelPick {
+  int primary;
+  int secondary;    // Secondary channel for 40 MHz; same as `primary` for 20 MHz.
+  int rxDbm;        // Total power that the candidate would receive from existing stations.
+  // Existing stations it would interfere with, weighted by spectral mask; in thousandths.
+  uint32_t neighborsMilli;
+  int scoreDeciDb;  // rxDbm plus a penalty of 10*log10(1 + neighbors) dB; in tenths of a dB.
+};
+
+// Scores every candidate channel in a band against the most recent scan.
+//
+// addSignal() folds each station into two per-channel totals: the linear power received on
+// each channel (the same footprint the heatmap draws, as power_t), and the number of stations
+// occupying each channel. Candidates are then scored by convolving those totals with the
+// candidate's own footprint, so the cost of recommend() depends on the size of the band plan
+// and not on the number of stations heard.
+class ChannelAdvisor {
+public:
+  ChannelAdvisor(bool is24GHz);
+
+  // Add a channel from the band plan as a candidate.
+  void defineChannel(int channelNum);
+  // Discard signal data from the previous scan. (The candidate channels are kept.)
+  void clear();
+  // Add a station heard in this band.
+  void addSignal(const SpectrumSignal &signal);
+
+  // Fill `picks` with the (up to) `maxPicks` best candidates of the specified bandwidth (20 or
+  // 40 MHz), best first. Returns the number of picks.
+  size_t recommend(int widthMhz, ChannelPolicy policy, ChannelPick *picks, size_t maxPicks) const;
+
+private:
+  int _slotForChannel(int channelNum) const;
+  bool _isCandidate(int channelNum) const;
+  void _score(int primary, uint8_t second, ChannelPick &pick) const;
+
+  static void _addRxPower(int channelNum, int rssi, void *advisor);
+
+  bool _is24GHz;
+  int _minChannel;
+  int _maxChannel;
+  int _channelDelta;
+  size_t _numSlots;
+
+  bool _candidate[ADVISOR_MAX_SLOTS];
+  power_t _rxPower[ADVISOR_MAX_SLOTS];    // Power received on each channel.
+  uint16_t _occupancy[ADVISOR_MAX_SLOTS]; // Stations transmitting at full power on each channel.
+};
+
+#endif
@@ -0,0 +1,172 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Multi-resolution per-channel congestion history. See congestion-history.h.
+// (Portable; no Arduino dependencies.)
+
+#include <string.h>
+
+#include "congestion-history.h"
+
+static_assert(CONGESTION_RING_LEN[0] <= CONGESTION_MAX_RING_LEN
+    && CONGESTION_RING_LEN[1] <= CONGESTION_MAX_RING_LEN
+    && CONGESTION_RING_LEN[2] <= CONGESTION_MAX_RING_LEN
+    && CONGESTION_RING_LEN[3] <= CONGESTION_MAX_RING_LEN, "CONGESTION_MAX_RING_LEN too small");
+
+static const CongestionSample NO_DATA_SAMPLE = {
+  CONGESTION_NO_DATA, CONGESTION_NO_DATA, CONGESTION_NO_DATA
+};
+
+// Offset of each level's ring within a channel's slots.
+static size_t ringOffset(size_t level) {
+  size_t offset = 0;
+  for (size_t i = 0; i < level; i++) {
+    offset += CONGESTION_RING_LEN[i];
+  }
+  return offset;
+}
+
+CongestionHistory::CongestionHistory(): _numChannels(0), _scans(0) {
+  memset(_head, 0, sizeof(_head));
+  memset(_count, 0, sizeof(_count));
+  memset(_bucket, 0, sizeof(_bucket));
+  memset(_scanSecs, 0, sizeof(_scanSecs));
+  memset(_totals, 0, sizeof(_totals));
+}
+
+bool CongestionHistory::defineChannel(int channelNum) {
+  if (_numChannels == CONGESTION_MAX_CHANNELS) {
+    return false;
+  }
+
+  _channels[_numChannels++] = channelNum;
+  return true;
+}
+
+int CongestionHistory::channelIdx(int channelNum) const {
+  for (size_t i = 0; i < _numChannels; i++) {
+    if (_channels[i] == channelNum) {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+void CongestionHistory::_fold(Totals &totals, int minDbm, int maxDbm, int32_t sumDbm,
+    uint32_t count) {
+  if (totals.count == 0 || minDbm < totals.minDbm) {
+    totals.minDbm = minDbm;
+  }
+  if (totals.count == 0 || maxDbm > totals.maxDbm) {
+    totals.maxDbm = maxDbm;
+  }
+  totals.sumDbm += sumDbm;
+  totals.count += count;
+}
+
+// Start a new sample in `level`'s ring, overwriting the oldest if it's full. Returns its slot.
+size_t CongestionHistory::_advance(size_t level) {
+  _head[level] = (_head[level] + 1) % CONGESTION_RING_LEN[level];
+  if (_count[level] < CONGESTION_RING_LEN[level]) {
+    _count[level]++;
+  }
+
+  return ringOffset(level) + _head[level];
+}
+
+// Close out the current bucket at `level`: store its totals as a sample, and fold them into the
+// next level's current bucket.
+void CongestionHistory::_closeBucket(size_t level) {
+  size_t slot = _advance(level);
+  for (size_t chan = 0; chan < _numChannels; chan++) {
+    Totals &totals = _totals[chan][level];
+    if (totals.count == 0) {
+      _samples[chan][slot] = NO_DATA_SAMPLE;
+      continue;
+    }
+
+    // Round to the nearest dBm (away from zero at .5).
+    int32_t half = static_cast<int32_t>(totals.count / 2);
+    int32_t count = static_cast<int32_t>(totals.count);
+    int32_t avg = (totals.sumDbm + (totals.sumDbm < 0 ? -half : half)) / count;
+    _samples[chan][slot] = { totals.minDbm, static_cast<int8_t>(avg), totals.maxDbm };
+
+    if (level + 1 < CONGESTION_NUM_LEVELS) {
+      _fold(_totals[chan][level + 1], totals.minDbm, totals.maxDbm, totals.sumDbm, totals.count);
+    }
+    memset(&totals, 0, sizeof(totals));
+  }
+}
+
+void CongestionHistory::beginScan(uint32_t timestampSecs) {
+  if (_scans++ == 0) {
+    for (size_t level = CONGESTION_PER_MINUTE; level < CONGESTION_NUM_LEVELS; level++) {
+      _bucket[level] = timestampSecs / CONGESTION_BUCKET_SECS[level];
+    }
+  }
+
+  // Each level's bucket boundaries are also boundaries of the level below, so once a level's
+  // bucket is still open, so are all coarser ones.
+  for (size_t level = CONGESTION_PER_MINUTE; level < CONGESTION_NUM_LEVELS; level++) {
+    uint32_t bucket = timestampSecs / CONGESTION_BUCKET_SECS[level];
+    if (bucket == _bucket[level]) {
+      break;
+    }
+
+    _closeBucket(level);
+
+    // Buckets with no scans at all (e.g. the device was asleep) get empty samples.
+    uint32_t gap = bucket - _bucket[level] - 1;
+    for (uint32_t i = 0; i < gap && i < CONGESTION_RING_LEN[level]; i++) {
+      size_t slot = _advance(level);
+      for (size_t chan = 0; chan < _numChannels; chan++) {
+        _samples[chan][slot] = NO_DATA_SAMPLE;
+      }
+    }
+    _bucket[level] = bucket;
+  }
+
+  size_t slot = _advance(CONGESTION_PER_SCAN);
+  _scanSecs[slot] = timestampSecs;
+  for (size_t chan = 0; chan < _numChannels; chan++) {
+    _samples[chan][slot] = NO_DATA_SAMPLE;
+  }
+}
+
+void CongestionHistory::addChannel(int channelNum, int dbm) {
+  int chan = channelIdx(channelNum);
+  if (chan < 0 || _scans == 0) {
+    return;
+  }
+
+  // CONGESTION_NO_DATA is reserved.
+  dbm = dbm < INT8_MIN + 1 ? INT8_MIN + 1 : (dbm > INT8_MAX ? INT8_MAX : dbm);
+  int8_t dbm8 = static_cast<int8_t>(dbm);
+  _samples[chan][_head[CONGESTION_PER_SCAN]] = { dbm8, dbm8, dbm8 };
+  _fold(_totals[chan][CONGESTION_PER_MINUTE], dbm, dbm, dbm, 1);
+}
+
+size_t CongestionHistory::query(size_t chanIdx, CongestionLevel level,
+    CongestionSample *samples, uint32_t *startSecs, size_t maxSamples) const {
+  size_t len = CONGESTION_RING_LEN[level];
+  size_t n = _count[level] < maxSamples ? _count[level] : maxSamples;
+  size_t offset = ringOffset(level);
+
+  for (size_t i = 0; i < n; i++) {
+    size_t age = n - 1 - i; // Samples before the newest.
+    size_t ringIdx = (_head[level] + len - age) % len;
+    samples[i] = _samples[chanIdx][offset + ringIdx];
+    if (startSecs == NULL) {
+      continue;
+    }
+
+    if (level == CONGESTION_PER_SCAN) {
+      startSecs[i] = _scanSecs[ringIdx];
+    } else {
+      // The newest sample is the bucket before the one still being totaled.
+      startSecs[i] = (_bucket[level] - 1 - age) * CONGESTION_BUCKET_SECS[level];
+    }
+  }
+
+  return n;
+}
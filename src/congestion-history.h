@@ -0,0 +1,98 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Multi-resolution per-channel congestion history, in the style of a round-robin database.
+// (Portable; no Arduino dependencies.)
+
+#ifndef _CONGESTION_HISTORY_H
+#define _CONGESTION_HISTORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Max channels tracked, across both bands.
+constexpr size_t CONGESTION_MAX_CHANNELS = 32;
+
+// Resolutions, finest first. Each has a fixed-size ring of samples per channel.
+enum CongestionLevel : uint8_t {
+  CONGESTION_PER_SCAN = 0,
+  CONGESTION_PER_MINUTE = 1,
+  CONGESTION_PER_HOUR = 2,
+  CONGESTION_PER_DAY = 3,
+};
+constexpr size_t CONGESTION_NUM_LEVELS = 4;
+
+// Samples kept at each level: the last 30 scans, hour, 3 days, and 5 weeks.
+constexpr size_t CONGESTION_RING_LEN[CONGESTION_NUM_LEVELS] = { 30, 60, 72, 35 };
+// Time covered by each sample at each level, in seconds. (Per-scan samples cover one scan.)
+constexpr uint32_t CONGESTION_BUCKET_SECS[CONGESTION_NUM_LEVELS] = { 0, 60, 3600, 86400 };
+constexpr size_t CONGESTION_MAX_RING_LEN = 72;
+
+constexpr size_t CONGESTION_TOTAL_SLOTS = CONGESTION_RING_LEN[0] + CONGESTION_RING_LEN[1]
+    + CONGESTION_RING_LEN[2] + CONGESTION_RING_LEN[3];
+
+// avgDbm of a sample with no data (e.g. the device was off, or asleep through the whole bucket).
+constexpr int8_t CONGESTION_NO_DATA = INT8_MIN;
+
+// Total power on a channel, in dBm, over one sample's span.
+struct CongestionSample {
+  int8_t minDbm;
+  int8_t avgDbm;
+  int8_t maxDbm;
+};
+
+// Records each channel's total power after every scan at per-scan resolution, and folds it into
+// the per-minute, per-hour and per-day rings as it goes: each coarser level keeps a running
+// min / sum / max for its current bucket, which is closed into the ring (and folded into the next
+// level up) when a scan arrives in a later bucket. Averages are over all scans in the bucket, not
+// averages of averages. Memory use is fixed: 3 bytes per slot per channel, plus the running
+// totals.
+class CongestionHistory {
+public:
+  CongestionHistory();
+
+  // Add a channel to track. Returns false if CONGESTION_MAX_CHANNELS are already defined.
+  bool defineChannel(int channelNum);
+  size_t numChannels() const { return _numChannels; };
+  int channelNumAt(size_t idx) const { return _channels[idx]; };
+  // Return the index of `channelNum`, or -1 if it's not tracked.
+  int channelIdx(int channelNum) const;
+
+  // Record a scan: call beginScan() with a clock in seconds that never goes backward, then
+  // addChannel() once for each channel. Channels not added have no data for this scan.
+  void beginScan(uint32_t timestampSecs);
+  void addChannel(int channelNum, int dbm);
+
+  // Copy up to `maxSamples` of the newest samples for the channel at `chanIdx` at `level` to
+  // `samples`, oldest first. If `startSecs` isn't NULL, it receives the start time of each
+  // sample (the time of the scan, for CONGESTION_PER_SCAN). Returns the number copied.
+  size_t query(size_t chanIdx, CongestionLevel level, CongestionSample *samples,
+      uint32_t *startSecs, size_t maxSamples) const;
+
+  uint32_t scans() const { return _scans; };
+
+private:
+  struct Totals {
+    int32_t sumDbm;
+    uint32_t count;
+    int8_t minDbm;
+    int8_t maxDbm;
+  };
+
+  static void _fold(Totals &totals, int minDbm, int maxDbm, int32_t sumDbm, uint32_t count);
+  size_t _advance(size_t level);
+  void _closeBucket(size_t level);
+
+  int _channels[CONGESTION_MAX_CHANNELS];
+  size_t _numChannels;
+
+  uint32_t _scans;
+  size_t _head[CONGESTION_NUM_LEVELS];  // Ring slot holding the newest sample.
+  size_t _count[CONGESTION_NUM_LEVELS]; // Samples in the ring.
+  uint32_t _bucket[CONGESTION_NUM_LEVELS]; // Bucket number (secs / bucket secs) being totaled.
+  uint32_t _scanSecs[CONGESTION_RING_LEN[CONGESTION_PER_SCAN]];
+
+  CongestionSample _samples[CONGESTION_MAX_CHANNELS][CONGESTION_TOTAL_SLOTS];
+  Totals _totals[CONGESTION_MAX_CHANNELS][CONGESTION_NUM_LEVELS]; // [0] unused.
+};
+
+#endif
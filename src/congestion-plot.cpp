@@ -0,0 +1,84 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Draw a channel's congestion history. See congestion-plot.h.
+
+#include "wifi-scanner.h"
+
+// Same dBm scale as the heatmap power bars.
+static constexpr int PLOT_MAX_DBM = -25;
+static constexpr int PLOT_MIN_DBM = -90;
+
+// Units of one sample at each level, for the x-axis label.
+static const char *levelUnits[CONGESTION_NUM_LEVELS] = { "scans", "min", "h", "d" };
+
+// Y coordinate of `dbm` in a plot of height `plotH` whose bottom is at `baseY`.
+static int dbmToY(int dbm, int baseY, int plotH) {
+  int clamped = min(PLOT_MAX_DBM, max(dbm, PLOT_MIN_DBM));
+  return baseY - plotH * (clamped - PLOT_MIN_DBM) / (PLOT_MAX_DBM - PLOT_MIN_DBM);
+}
+
+void CongestionPlot::render(TFT_eSPI &lcd, uint32_t renderFlags) {
+  drawBackground(lcd, renderFlags);
+  drawBorder(lcd, renderFlags);
+
+  int16_t childX, childY, childW, childH;
+  getChildAreaBoundingBox(childX, childY, childW, childH);
+
+  constexpr int xAxisHeight = 12; // 12 px reserved for X axis labels.
+  constexpr int yAxisWidth = 20;  // 20 px reserved for Y axis labels.
+  int plotX = childX + yAxisWidth;
+  int plotW = childW - yAxisWidth;
+  int plotH = childH - xAxisHeight - 1;
+  int baseY = childY + plotH;
+
+  lcd.drawFastHLine(plotX, baseY + 1, plotW, TFT_WHITE);
+  lcd.drawFastVLine(plotX - 1, childY, plotH + 2, TFT_WHITE);
+
+  lcd.setTextColor(TFT_WHITE);
+  lcd.setTextFont(0);
+  lcd.drawNumber(PLOT_MAX_DBM, childX, childY);
+  lcd.drawNumber(PLOT_MIN_DBM, childX, baseY - 7);
+
+  size_t ringLen = CONGESTION_RING_LEN[_level];
+  char axisLabel[16];
+  snprintf(axisLabel, sizeof(axisLabel), "-%u %s", ringLen, levelUnits[_level]);
+  lcd.drawString(axisLabel, plotX, baseY + 4);
+  lcd.drawString("now", plotX + plotW - 18, baseY + 4);
+
+  if (_chanIdx >= _history.numChannels()) {
+    return;
+  }
+
+  CongestionSample samples[CONGESTION_MAX_RING_LEN];
+  size_t n = _history.query(_chanIdx, _level, samples, NULL, ringLen);
+
+  // Each ring slot gets an equal column, so the plot fills in from the right as samples arrive.
+  int colWidth = max(plotW / static_cast<int>(ringLen) - 1, 1);
+  uint16_t rangeColor = scaleColorBrightness(_color, 0.4f);
+  for (size_t i = 0; i < n; i++) {
+    const CongestionSample &sample = samples[i];
+    if (sample.avgDbm == CONGESTION_NO_DATA) {
+      continue;
+    }
+
+    int x = plotX + (ringLen - n + i) * plotW / ringLen;
+    int minY = dbmToY(sample.minDbm, baseY, plotH);
+    int maxY = dbmToY(sample.maxDbm, baseY, plotH);
+    int avgY = dbmToY(sample.avgDbm, baseY, plotH);
+
+    lcd.fillRect(x, maxY, colWidth, minY - maxY + 1, rangeColor);
+    lcd.fillRect(x, max(avgY - 1, childY), colWidth, 2, _color);
+  }
+}
+
+int16_t CongestionPlot::getContentWidth(TFT_eSPI &lcd) const {
+  int16_t cx, cy, cw, ch;
+  getChildAreaBoundingBox(cx, cy, cw, ch);
+  return cw;
+}
+
+int16_t CongestionPlot::getContentHeight(TFT_eSPI &lcd) const {
+  int16_t cx, cy, cw, ch;
+  getChildAreaBoundingBox(cx, cy, cw, ch);
+  return ch;
+}
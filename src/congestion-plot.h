@@ -0,0 +1,37 @@
+// (c) Copyright 2022 Aaron Kimball
+
+#ifndef _CONGESTION_PLOT_H
+#define _CONGESTION_PLOT_H
+
+#include <uiwidgets.h>
+
+#include "congestion-history.h"
+
+// Plots one channel's congestion history at one resolution: a min..max bar per sample, with the
+// average marked in it. The newest sample is at the right edge; the x axis spans the whole ring.
+class CongestionPlot : public UIWidget {
+public:
+  CongestionPlot(const CongestionHistory &history): UIWidget(), _history(history),
+      _chanIdx(0), _level(CONGESTION_PER_MINUTE), _color(TFT_GREEN) { };
+
+  virtual void render(TFT_eSPI &lcd, uint32_t renderFlags);
+  virtual int16_t getContentWidth(TFT_eSPI &lcd) const;
+  virtual int16_t getContentHeight(TFT_eSPI &lcd) const;
+  virtual bool redrawChildWidget(UIWidget *widget, TFT_eSPI &lcd, uint32_t renderFlags=0) {
+    return widget == this ? render(lcd, renderFlags), true : false;
+  };
+
+  void setChannelIdx(size_t chanIdx) { _chanIdx = chanIdx; };
+  size_t channelIdx() const { return _chanIdx; };
+  void setLevel(CongestionLevel level) { _level = level; };
+  CongestionLevel level() const { return _level; };
+  void setColor(uint16_t color) { _color = color; };
+
+private:
+  const CongestionHistory &_history;
+  size_t _chanIdx;
+  CongestionLevel _level;
+  uint16_t _color;
+};
+
+#endif
@@ -0,0 +1,72 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Adaptive per-channel dwell times. See dwell-scheduler.h.
+// (Portable; no Arduino dependencies.)
+
+#include "dwell-scheduler.h"
+
+// An idle channel must get back to DWELL_MIN_MS (a peak of 0): after 12 sweeps if it once had one
+// AP, and after 72 even from the highest peak.
+static_assert(dwellIdlePeak(16, 12) == 0, "a channel that had one AP never returns to min dwell");
+static_assert(dwellIdlePeak(UINT16_MAX, 72) == 0, "a busy channel never returns to min dwell");
+
+DwellScheduler::DwellScheduler(): _numChannels(0), _sweepCount(UINT32_MAX) {
+}
+
+void DwellScheduler::defineChannel(int channelNum) {
+  if (_numChannels >= DWELL_MAX_CHANNELS) {
+    return;
+  }
+
+  _plan[_numChannels].channel = channelNum;
+  _plan[_numChannels].passive = false;
+  _plan[_numChannels].dwellMs = DWELL_FULL_MS;
+  _peakX16[_numChannels] = 0;
+  _numChannels++;
+}
+
+void DwellScheduler::beginSweep() {
+  _sweepCount++;
+  bool full = isFullSweep();
+
+  for (size_t i = 0; i < _numChannels; i++) {
+    ChannelDwell &dwell = _plan[i];
+    if (full) {
+      dwell.passive = false;
+      dwell.dwellMs = DWELL_FULL_MS;
+      continue;
+    }
+
+    // Round the expected AP count up; a channel that had one AP recently still gets time for it.
+    uint32_t expectedAPs = (_peakX16[i] + 15) / 16;
+    uint32_t dwellMs = DWELL_MIN_MS + DWELL_PER_AP_MS * expectedAPs;
+    dwell.passive = expectedAPs >= DWELL_PASSIVE_MIN_APS;
+    if (dwell.passive && dwellMs < DWELL_BEACON_MS) {
+      dwellMs = DWELL_BEACON_MS;
+    }
+    if (dwellMs > DWELL_MAX_MS) {
+      dwellMs = DWELL_MAX_MS;
+    }
+    dwell.dwellMs = dwellMs;
+  }
+}
+
+void DwellScheduler::recordChannel(size_t idx, unsigned int numAPs) {
+  if (idx >= _numChannels) {
+    return;
+  }
+
+  uint32_t seenX16 = numAPs * 16;
+  uint32_t decayed = dwellDecayPeak(_peakX16[idx]);
+  uint32_t peak = seenX16 > decayed ? seenX16 : decayed;
+  _peakX16[idx] = peak > UINT16_MAX ? UINT16_MAX : peak;
+}
+
+uint32_t DwellScheduler::plannedMs() const {
+  uint32_t total = 0;
+  for (size_t i = 0; i < _numChannels; i++) {
+    total += _plan[i].dwellMs;
+  }
+
+  return total;
+}
@@ -0,0 +1,81 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Per-channel scan dwell times that adapt to how busy each channel has been.
+// (Portable; no Arduino dependencies.)
+
+#ifndef _DWELL_SCHEDULER_H
+#define _DWELL_SCHEDULER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Max channels in the sweep: every 2.4 GHz channel and the 5 GHz channels we scan.
+constexpr size_t DWELL_MAX_CHANNELS = 32;
+
+// A quiet channel gets an active scan of DWELL_MIN_MS; probe responses arrive well inside it.
+// Each AP expected on the channel adds DWELL_PER_AP_MS, up to DWELL_MAX_MS.
+constexpr uint16_t DWELL_MIN_MS = 30;
+constexpr uint16_t DWELL_PER_AP_MS = 15;
+constexpr uint16_t DWELL_MAX_MS = 200;
+
+// Channels expected to hold at least this many APs are scanned passively for at least one
+// beacon interval (102.4 ms, plus margin): probe responses from that many APs collide, and
+// listening catches every AP that beacons without adding probe traffic to a busy channel.
+constexpr uint16_t DWELL_PASSIVE_MIN_APS = 4;
+constexpr uint16_t DWELL_BEACON_MS = 120;
+
+// Every Nth sweep (and the first) scans every channel actively for DWELL_FULL_MS, the radio's
+// default, so APs that appear on quiet channels are found promptly.
+constexpr uint16_t DWELL_FULL_MS = 300;
+constexpr uint16_t DWELL_FULL_SWEEP_INTERVAL = 10;
+
+// One idle sweep's decay of a channel's peak AP count (in 1/16ths): it loses 1/8, rounded up so
+// that small peaks still fall to 0 rather than getting stuck at 1..7.
+constexpr uint16_t dwellDecayPeak(uint16_t peakX16) {
+  return peakX16 - (peakX16 + 7) / 8;
+}
+
+// A channel's peak after `sweeps` sweeps with no APs.
+constexpr uint16_t dwellIdlePeak(uint16_t peakX16, uint32_t sweeps) {
+  return sweeps == 0 ? peakX16 : dwellIdlePeak(dwellDecayPeak(peakX16), sweeps - 1);
+}
+
+// How to scan one channel in the next sweep.
+struct ChannelDwell {
+  uint8_t channel;
+  bool passive;
+  uint16_t dwellMs;
+};
+
+// Plans each sweep from the occupancy seen in previous ones. Occupancy per channel is tracked as
+// a peak that jumps up to a new high immediately and decays by 1/8 per sweep, so a channel that
+// was recently busy keeps a long dwell for a while even if some sweeps find fewer APs there. A
+// channel left idle decays all the way back to DWELL_MIN_MS.
+class DwellScheduler {
+public:
+  DwellScheduler();
+
+  // Add a channel to the sweep, in scan order.
+  void defineChannel(int channelNum);
+  size_t numChannels() const { return _numChannels; };
+
+  // Plan the next sweep.
+  void beginSweep();
+  // How to scan the idx'th channel in this sweep.
+  const ChannelDwell &plan(size_t idx) const { return _plan[idx]; };
+  // Report the number of APs found with their primary channel on the idx'th channel.
+  void recordChannel(size_t idx, unsigned int numAPs);
+  // True if this sweep scans every channel for DWELL_FULL_MS.
+  bool isFullSweep() const { return _sweepCount % DWELL_FULL_SWEEP_INTERVAL == 0; };
+
+  // Sum of the planned dwell times for this sweep.
+  uint32_t plannedMs() const;
+
+private:
+  size_t _numChannels;
+  uint32_t _sweepCount; // Sweeps begun, less one.
+  ChannelDwell _plan[DWELL_MAX_CHANNELS];
+  uint16_t _peakX16[DWELL_MAX_CHANNELS]; // Decaying peak APs per channel, in 1/16ths.
+};
+
+#endif
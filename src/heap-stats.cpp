@@ -0,0 +1,175 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Heap accounting. Replaces the global operator new / delete with versions that track live
+// and peak bytes, and counts allocations per scan so that fragmentation across rescans can be
+// observed.
+
+#include <malloc.h>
+#include <new>
+
+#include "wifi-scanner.h"
+
+// Each allocation is prefixed with a header recording its size, so operator delete can
+// account for it. The header is padded to keep the returned pointer maximally aligned.
+static constexpr size_t ALLOC_HEADER_SIZE = alignof(max_align_t);
+
+static volatile uint32_t liveBytes = 0;
+static volatile uint32_t peakBytes = 0;
+static volatile uint32_t liveAllocs = 0;
+static volatile uint32_t scanAllocs = 0;
+static volatile uint32_t scanFrees = 0;
+static volatile bool budgetExceeded = false;
+
+static HeapStats lastScanStats;
+
+static constexpr size_t HEAP_MSG_LEN = 96;
+static char heapMsg[HEAP_MSG_LEN];
+
+// Allocation bookkeeping can happen from rpc tasks as well as the main loop; use atomic ops.
+static void *trackedAlloc(size_t size) {
+  uint8_t *block = reinterpret_cast<uint8_t*>(malloc(size + ALLOC_HEADER_SIZE));
+  if (NULL == block) {
+    return NULL;
+  }
+
+  *reinterpret_cast<size_t*>(block) = size;
+
+  uint32_t live = __atomic_add_fetch(&liveBytes, size, __ATOMIC_RELAXED);
+  __atomic_add_fetch(&liveAllocs, 1, __ATOMIC_RELAXED);
+  __atomic_add_fetch(&scanAllocs, 1, __ATOMIC_RELAXED);
+
+  uint32_t peak = peakBytes;
+  while (live > peak &&
+      !__atomic_compare_exchange_n(&peakBytes, &peak, live, true, __ATOMIC_RELAXED,
+          __ATOMIC_RELAXED)) {
+    // `peak` was reloaded by the failed CAS; retry.
+  }
+
+  if (live > HEAP_BUDGET_BYTES) {
+    // Can't safely print from inside the allocator; heapScanEnd() reports this.
+    budgetExceeded = true;
+  }
+
+  return block + ALLOC_HEADER_SIZE;
+}
+
+static void trackedFree(void *ptr) {
+  if (NULL == ptr) {
+    return;
+  }
+
+  uint8_t *block = reinterpret_cast<uint8_t*>(ptr) - ALLOC_HEADER_SIZE;
+  size_t size = *reinterpret_cast<size_t*>(block);
+
+  __atomic_sub_fetch(&liveBytes, size, __ATOMIC_RELAXED);
+  __atomic_sub_fetch(&liveAllocs, 1, __ATOMIC_RELAXED);
+  __atomic_add_fetch(&scanFrees, 1, __ATOMIC_RELAXED);
+  free(block);
+}
+
+void *operator new(size_t size) { return trackedAlloc(size); }
+void *operator new[](size_t size) { return trackedAlloc(size); }
+void *operator new(size_t size, const std::nothrow_t&) noexcept { return trackedAlloc(size); }
+void *operator new[](size_t size, const std::nothrow_t&) noexcept { return trackedAlloc(size); }
+void operator delete(void *ptr) noexcept { trackedFree(ptr); }
+void operator delete[](void *ptr) noexcept { trackedFree(ptr); }
+void operator delete(void *ptr, size_t) noexcept { trackedFree(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { trackedFree(ptr); }
+
+
+#if defined(__arm__)
+// newlib-nano malloc internals: the free list is a singly-linked list of chunks in address
+// order, each starting with its total size (including this header).
+struct nano_malloc_chunk {
+  long size;
+  nano_malloc_chunk *next;
+};
+
+extern "C" nano_malloc_chunk *__malloc_free_list;
+extern "C" void *_sbrk(int incr);
+
+// Leave this much room between the heap and the stack when estimating how much the heap
+// could grow.
+static constexpr uint32_t STACK_SAFETY_MARGIN = 1024;
+#endif
+
+uint32_t heapLargestFreeBlock() {
+#if defined(__arm__)
+  uint32_t largest = 0;
+
+  noInterrupts();
+  for (nano_malloc_chunk *chunk = __malloc_free_list; chunk != NULL; chunk = chunk->next) {
+    uint32_t usable = chunk->size - sizeof(long);
+    largest = max(largest, usable);
+  }
+  interrupts();
+
+  // Unclaimed space between the top of the heap and the stack can also satisfy a request. The
+  // heap grows toward the main stack (MSP) at the top of RAM. If thread code is running on a
+  // process stack instead (CONTROL.SPSEL set, e.g. an RTOS task), that stack also bounds the gap
+  // when it lies above the heap; one allocated below the heap top doesn't.
+  uint32_t heapTop = reinterpret_cast<uint32_t>(_sbrk(0));
+  uint32_t stackPtr = __get_MSP();
+  if (__get_CONTROL() & CONTROL_SPSEL_Msk) {
+    uint32_t processStackPtr = __get_PSP();
+    if (processStackPtr > heapTop) {
+      stackPtr = min(stackPtr, processStackPtr);
+    }
+  }
+  if (stackPtr > heapTop + STACK_SAFETY_MARGIN) {
+    largest = max(largest, stackPtr - heapTop - STACK_SAFETY_MARGIN);
+  }
+
+  return largest;
+#else
+  return 0; // Not supported off-target.
+#endif
+}
+
+void heapScanBegin() {
+  scanAllocs = 0;
+  scanFrees = 0;
+}
+
+const HeapStats &heapLastScanStats() {
+  return lastScanStats;
+}
+
+void heapScanEnd() {
+  struct mallinfo mi = mallinfo();
+
+  lastScanStats.liveBytes = liveBytes;
+  lastScanStats.peakBytes = peakBytes;
+  lastScanStats.liveAllocs = liveAllocs;
+  lastScanStats.scanAllocs = scanAllocs;
+  lastScanStats.scanFrees = scanFrees;
+  lastScanStats.arenaUsedBytes = mi.uordblks;
+  lastScanStats.arenaFreeBytes = mi.fordblks;
+  lastScanStats.largestFreeBlock = heapLargestFreeBlock();
+  lastScanStats.budgetExceeded = budgetExceeded;
+
+  snprintf(heapMsg, HEAP_MSG_LEN,
+      "heap: live=%lu peak=%lu allocs=%lu frees=%lu arena=%lu free=%lu largest=%lu",
+      (unsigned long)lastScanStats.liveBytes, (unsigned long)lastScanStats.peakBytes,
+      (unsigned long)lastScanStats.scanAllocs, (unsigned long)lastScanStats.scanFrees,
+      (unsigned long)lastScanStats.arenaUsedBytes, (unsigned long)lastScanStats.arenaFreeBytes,
+      (unsigned long)lastScanStats.largestFreeBlock);
+  DBGPRINT(heapMsg);
+
+  if (lastScanStats.budgetExceeded) {
+    snprintf(heapMsg, HEAP_MSG_LEN, "HEAP BUDGET EXCEEDED: peak %lu > %lu bytes",
+        (unsigned long)lastScanStats.peakBytes, (unsigned long)HEAP_BUDGET_BYTES);
+    DBGPRINT(heapMsg);
+    if (!isHeadless()) {
+      setStatusLine(heapMsg); // (Headless, no widgets were built; serial is all there is.)
+    }
+#ifdef DEBUG
+    // Treat this like a failed assertion: stop here so it can't be missed, and keep
+    // repeating the message for anyone who connects to the serial port later.
+    while (true) {
+      delay(1000);
+      DBGPRINT(heapMsg);
+    }
+#endif
+  }
+}
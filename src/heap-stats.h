@@ -0,0 +1,40 @@
+// (c) Copyright 2022 Aaron Kimball
+
+#ifndef _HEAP_STATS_H
+#define _HEAP_STATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Maximum number of bytes that may be live through operator new at any time. Exceeding this
+// is treated as a bug; see heapScanEnd().
+constexpr uint32_t HEAP_BUDGET_BYTES = 64 * 1024;
+
+// Snapshot of heap accounting, taken at the end of each scan.
+struct HeapStats {
+  uint32_t liveBytes;        // Bytes currently allocated through operator new.
+  uint32_t peakBytes;        // High-water mark of liveBytes since boot.
+  uint32_t liveAllocs;       // Number of outstanding operator new allocations.
+  uint32_t scanAllocs;       // Number of operator new calls during the last scan.
+  uint32_t scanFrees;        // Number of operator delete calls during the last scan.
+  uint32_t arenaUsedBytes;   // Total malloc arena in use (includes String and other malloc users).
+  uint32_t arenaFreeBytes;   // Free bytes held in the malloc arena's free list.
+  uint32_t largestFreeBlock; // Largest single allocation that could currently succeed.
+  bool budgetExceeded;       // True if liveBytes has ever exceeded HEAP_BUDGET_BYTES.
+};
+
+// Reset per-scan allocation counters. Call at the start of scanWifi().
+extern void heapScanBegin();
+
+// Take a HeapStats snapshot, report it over serial, and fail loudly if the RAM budget was
+// exceeded at any point. Call at the end of scanWifi().
+extern void heapScanEnd();
+
+// Return the snapshot taken by the most recent heapScanEnd().
+extern const HeapStats &heapLastScanStats();
+
+// Walk the allocator's free list and the unused space between the heap and the stack to find
+// the largest block that malloc() could hand out right now.
+extern uint32_t heapLargestFreeBlock();
+
+#endif
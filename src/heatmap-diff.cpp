@@ -0,0 +1,61 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Per-channel change against a baseline. See heatmap-diff.h.
+// (Portable; no Arduino dependencies.)
+
+#include <string.h>
+
+#include "heatmap-diff.h"
+#include "spectrum.h"
+
+// Power received on a channel with `power` from stations on it, in tenths of a dBm.
+static int rxDeciDbm(power_t power) {
+  return powerToDeciDbm(dbmToPower(noiseFloorDBm) + power);
+}
+
+void heatmapTotalsClear(HeatmapTotals &totals) {
+  memset(totals.power, 0, sizeof(totals.power));
+  memset(totals.signals, 0, sizeof(totals.signals));
+}
+
+void heatmapTotalsDefineChannel(HeatmapTotals &totals, int channelNum) {
+  if (totals.numChannels < HEATMAP_DIFF_MAX_CHANNELS) {
+    totals.channelNum[totals.numChannels] = channelNum;
+    totals.power[totals.numChannels] = 0;
+    totals.signals[totals.numChannels] = 0;
+    totals.numChannels++;
+  }
+}
+
+void heatmapTotalsAddSignal(HeatmapTotals &totals, int channelNum, int rssi) {
+  for (size_t i = 0; i < totals.numChannels; i++) {
+    if (totals.channelNum[i] == channelNum) {
+      totals.power[i] += dbmToPower(rssi);
+      totals.signals[i]++;
+      return;
+    }
+  }
+}
+
+void HeatmapDiff::pin(const HeatmapTotals &totals) {
+  memcpy(&_baseline, &totals, sizeof(_baseline));
+  for (size_t i = 0; i < _baseline.numChannels; i++) {
+    _baseDeciDbm[i] = rxDeciDbm(_baseline.power[i]);
+  }
+  _pinned = true;
+  update(totals);
+}
+
+void HeatmapDiff::update(const HeatmapTotals &live) {
+  _numDeltas = 0;
+  if (!_pinned || live.numChannels != _baseline.numChannels
+      || memcmp(live.channelNum, _baseline.channelNum, live.numChannels * sizeof(int)) != 0) {
+    return;
+  }
+
+  for (size_t i = 0; i < live.numChannels; i++) {
+    _deltaDeciDb[i] = rxDeciDbm(live.power[i]) - _baseDeciDbm[i];
+    _deltaSignals[i] = static_cast<int>(live.signals[i]) - _baseline.signals[i];
+  }
+  _numDeltas = live.numChannels;
+}
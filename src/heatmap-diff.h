@@ -0,0 +1,65 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Compare a band's per-channel congestion against a pinned baseline, e.g. before and after
+// moving or retuning an AP. (Portable; no Arduino dependencies.)
+
+#ifndef _HEATMAP_DIFF_H
+#define _HEATMAP_DIFF_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "linear-power.h"
+
+// Max channels in one band plan.
+constexpr size_t HEATMAP_DIFF_MAX_CHANNELS = 32;
+
+// A band's aggregate per-channel totals after a scan: the same sums a Heatmap keeps.
+struct HeatmapTotals {
+  size_t numChannels;
+  int channelNum[HEATMAP_DIFF_MAX_CHANNELS];
+  power_t power[HEATMAP_DIFF_MAX_CHANNELS];     // Total linear power heard on the channel.
+  uint16_t signals[HEATMAP_DIFF_MAX_CHANNELS];  // Stations heard on the channel.
+};
+
+// Discard the totals' signal data, keeping the channel plan.
+extern void heatmapTotalsClear(HeatmapTotals &totals);
+// Add the plan's next channel (ignored once HEATMAP_DIFF_MAX_CHANNELS are defined).
+extern void heatmapTotalsDefineChannel(HeatmapTotals &totals, int channelNum);
+// Add a signal heard on `channelNum` at `rssi`, as Heatmap::addSignal() does, but without
+// keeping each rssi. Ignored if the channel isn't in the plan.
+extern void heatmapTotalsAddSignal(HeatmapTotals &totals, int channelNum, int rssi);
+
+// Holds the baseline totals and the per-channel change since then. Each update is a subtraction
+// of two per-channel vectors, so it costs O(channels), however many stations were heard.
+class HeatmapDiff {
+public:
+  HeatmapDiff(): _pinned(false) { _baseline.numChannels = 0; _numDeltas = 0; };
+
+  // Pin `totals` as the baseline. The change is zero until the next update().
+  void pin(const HeatmapTotals &totals);
+  void unpin() { _pinned = false; _numDeltas = 0; };
+  bool isPinned() const { return _pinned; };
+
+  // Compute the change from the baseline to `live`. The channel plans must match; if they
+  // don't, there are no deltas (numChannels() is 0).
+  void update(const HeatmapTotals &live);
+
+  size_t numChannels() const { return _numDeltas; };
+  // Change in power received on the channel at `idx`, in tenths of a dB. Both sides include the
+  // noise floor, so a channel going from empty to one -80 dBm station reads +10 dB, not +inf.
+  int deltaDeciDbAt(size_t idx) const { return _deltaDeciDb[idx]; };
+  // Change in the number of stations heard on the channel at `idx`.
+  int deltaSignalsAt(size_t idx) const { return _deltaSignals[idx]; };
+
+private:
+  bool _pinned;
+  HeatmapTotals _baseline;
+  int _baseDeciDbm[HEATMAP_DIFF_MAX_CHANNELS]; // Baseline power + noise floor; computed by pin().
+
+  size_t _numDeltas;
+  int16_t _deltaDeciDb[HEATMAP_DIFF_MAX_CHANNELS];
+  int16_t _deltaSignals[HEATMAP_DIFF_MAX_CHANNELS];
+};
+
+#endif
@@ -11,8 +11,7 @@ static constexpr int MAX_RSSI = -25;
 static constexpr int MIN_RSSI = -90;
 static constexpr int TOTAL_RSSI_RANGE = MAX_RSSI - MIN_RSSI;
 
-// Scale the components of a color by brightness in range [0.0, 1.0].
-static uint16_t scaleColorBrightness(uint16_t color, float brightness) {
+uint16_t scaleColorBrightness(uint16_t color, float brightness) {
   uint16_t r = ((color >> 11) & 0x1F) * brightness;
   uint16_t g = ((color >> 5)  & 0x3F) * brightness;
   uint16_t b = ((color >> 0)  & 0x1F) * brightness;
@@ -23,6 +22,7 @@ static uint16_t scaleColorBrightness(uint16_t color, float brightness) {
 void Heatmap::defineChannel(int channelNum) {
   _channels.push_back(channelNum); // idx 'n' points to channel # 'channelNum'.
   _rssiLevels.push_back(tc::vector<int>()); // Add a vector to hold its rssi levels.
+  _power.push_back(0);
 }
 
 void Heatmap::addSignal(int channelNum, int rssi) {
@@ -32,6 +32,8 @@ void Heatmap::addSignal(int channelNum, int rssi) {
     return;
   }
 
+  _power[channelIdx] += dbmToPower(rssi);
+
   tc::vector<int> &rssiLvls = _rssiLevels[channelIdx];
   for (size_t i = 0; i < rssiLvls.size(); i++) {
     if (rssiLvls[i] < rssi) {
@@ -86,6 +88,24 @@ int Heatmap::channelNumBelow(int channelNum) const {
   return _channels[idx - 1];
 }
 
+int Heatmap::maxRssiAt(size_t idx, int noSignal) const {
+  const tc::vector<int> &rssiLvls = _rssiLevels[idx];
+  if (rssiLvls.size() == 0) {
+    return noSignal;
+  }
+
+  return rssiLvls[0]; // addSignal() keeps each channel's levels sorted strongest-first.
+}
+
+void Heatmap::totals(HeatmapTotals &out) const {
+  out.numChannels = min(_channels.size(), HEATMAP_DIFF_MAX_CHANNELS);
+  for (size_t i = 0; i < out.numChannels; i++) {
+    out.channelNum[i] = _channels[i];
+    out.power[i] = _power[i];
+    out.signals[i] = _rssiLevels[i].size();
+  }
+}
+
 void Heatmap::render(TFT_eSPI &lcd, uint32_t renderFlags) {
   drawBackground(lcd, renderFlags);
   drawBorder(lcd, renderFlags);
@@ -94,6 +114,17 @@ void Heatmap::render(TFT_eSPI &lcd, uint32_t renderFlags) {
   int16_t childX, childY, childW, childH;
   getChildAreaBoundingBox(childX, childY, childW, childH);
 
+  if (_mode == HEATMAP_POWER_BARS) {
+    _renderPowerBars(lcd, childX, childY, childW, childH);
+  } else if (_mode == HEATMAP_DIFF) {
+    _renderDiff(lcd, childX, childY, childW, childH);
+  } else {
+    _renderBlocks(lcd, childX, childY, childW, childH);
+  }
+}
+
+void Heatmap::_renderBlocks(TFT_eSPI &lcd, int16_t childX, int16_t childY, int16_t childW,
+    int16_t childH) {
   constexpr int xAxisHeight = 12; // 12 px reserved for X axis.
   constexpr int maxBlockHeightLimit = 16; // blocks are variable height, but no taller than 16 px.
 
@@ -146,6 +177,89 @@ void Heatmap::render(TFT_eSPI &lcd, uint32_t renderFlags) {
   }
 }
 
+// Draw one bar per channel whose height is the channel's total linear power, in dBm, on the
+// same scale as the block tints. Cost is per channel, regardless of how many signals there are.
+void Heatmap::_renderPowerBars(TFT_eSPI &lcd, int16_t childX, int16_t childY, int16_t childW,
+    int16_t childH) {
+  constexpr int xAxisHeight = 12; // 12 px reserved for X axis.
+  constexpr int valueHeight = 10; // 10 px reserved above the tallest bar for its dBm label.
+
+  int maxColWidth = childW / _channels.size(); // width per col + associated padding
+  constexpr int colPad = 2; // 2 px padding between columns.
+  int colWidth = max(maxColWidth - colPad, 1);
+  int textOffsetX = colWidth / 2 - 4; // roughly center the x-axis labels under columns.
+
+  int barAreaHeight = childH - xAxisHeight - valueHeight;
+  int baseY = childY + childH - xAxisHeight - 1;
+
+  lcd.drawFastHLine(childX, childY + childH - xAxisHeight, childW, TFT_WHITE);
+
+  int cursorX = childX;
+  lcd.setTextColor(TFT_WHITE);
+  lcd.setTextFont(0); // (font 0 for small size in x-axis and value labels.)
+  for (unsigned int chanIdx = 0; chanIdx < _channels.size(); chanIdx++) {
+    if (_power[chanIdx] > 0) {
+      int dbm = powerToDbm(_power[chanIdx]);
+      int effectiveRssi = min(MAX_RSSI, max(dbm, MIN_RSSI));
+      int barHeight = max(1, barAreaHeight * (effectiveRssi - MIN_RSSI) / TOTAL_RSSI_RANGE);
+      float colorScalar = 0.3f + 0.7f * ((float)effectiveRssi - MIN_RSSI) / ((float)TOTAL_RSSI_RANGE);
+
+      lcd.fillRect(cursorX, baseY - barHeight, colWidth, barHeight,
+          scaleColorBrightness(_color, colorScalar));
+      lcd.drawNumber(dbm, cursorX, baseY - barHeight - valueHeight + 1);
+    }
+
+    lcd.drawNumber(_channels[chanIdx], cursorX + textOffsetX, childY + childH - xAxisHeight + 2);
+    cursorX += colWidth + colPad;
+  }
+}
+
+// Draw one bar per channel for its change in total power since the pinned baseline: up from the
+// center line for more congestion, down for less, labeled in dB. Bars are full height at
+// +/- DIFF_RANGE_DECI_DB.
+void Heatmap::_renderDiff(TFT_eSPI &lcd, int16_t childX, int16_t childY, int16_t childW,
+    int16_t childH) {
+  constexpr int xAxisHeight = 12; // 12 px reserved for X axis.
+  constexpr int valueHeight = 10; // 10 px reserved above and below the bars for dB labels.
+  constexpr int DIFF_RANGE_DECI_DB = 200;
+
+  int maxColWidth = childW / _channels.size(); // width per col + associated padding
+  constexpr int colPad = 2; // 2 px padding between columns.
+  int colWidth = max(maxColWidth - colPad, 1);
+  int textOffsetX = colWidth / 2 - 4; // roughly center the x-axis labels under columns.
+
+  int halfHeight = (childH - xAxisHeight) / 2 - valueHeight;
+  int midY = childY + valueHeight + halfHeight;
+
+  lcd.drawFastHLine(childX, midY, childW, TFT_DARKGREY);
+  lcd.drawFastHLine(childX, childY + childH - xAxisHeight, childW, TFT_WHITE);
+
+  // No bars until there's a baseline for this band plan.
+  bool haveDeltas = _diff != NULL && _diff->numChannels() == _channels.size();
+
+  int cursorX = childX;
+  lcd.setTextColor(TFT_WHITE);
+  lcd.setTextFont(0); // (font 0 for small size in x-axis and value labels.)
+  for (unsigned int chanIdx = 0; chanIdx < _channels.size(); chanIdx++) {
+    if (haveDeltas) {
+      int delta = _diff->deltaDeciDbAt(chanIdx);
+      int deltaDb = (delta + (delta >= 0 ? 5 : -5)) / 10;
+      int clamped = min(DIFF_RANGE_DECI_DB, max(delta, -DIFF_RANGE_DECI_DB));
+      int barHeight = max(1, halfHeight * abs(clamped) / DIFF_RANGE_DECI_DB);
+      if (deltaDb > 0) {
+        lcd.fillRect(cursorX, midY - barHeight, colWidth, barHeight, TFT_RED);
+        lcd.drawNumber(deltaDb, cursorX, midY - barHeight - valueHeight + 1);
+      } else if (deltaDb < 0) {
+        lcd.fillRect(cursorX, midY + 1, colWidth, barHeight, TFT_GREEN);
+        lcd.drawNumber(deltaDb, cursorX, midY + barHeight + 2);
+      }
+    }
+
+    lcd.drawNumber(_channels[chanIdx], cursorX + textOffsetX, childY + childH - xAxisHeight + 2);
+    cursorX += colWidth + colPad;
+  }
+}
+
 int16_t Heatmap::getContentWidth(TFT_eSPI &lcd) const {
   int16_t cx, cy, cw, ch;
   getChildAreaBoundingBox(cx, cy, cw, ch);
@@ -6,9 +6,20 @@
 #include <uiwidgets.h>
 #include <tiny-collections.h>
 
+#include "heatmap-diff.h"
+#include "linear-power.h"
+
+// How a Heatmap draws each channel's column.
+enum HeatmapMode : uint8_t {
+  HEATMAP_BLOCKS = 0,     // One block per signal, stacked; tinted by rssi.
+  HEATMAP_POWER_BARS = 1, // One bar per channel, as tall as the channel's total power in dBm.
+  HEATMAP_DIFF = 2,       // One bar per channel, up or down by its change since a baseline (dB).
+};
+
 class Heatmap : public UIWidget {
 public:
-  Heatmap(): UIWidget(), _channels(), _rssiLevels(), _color(TFT_RED) { };
+  Heatmap(): UIWidget(), _channels(), _rssiLevels(), _power(), _color(TFT_RED),
+      _mode(HEATMAP_BLOCKS), _diff(NULL) { };
 
   virtual void render(TFT_eSPI &lcd, uint32_t renderFlags);
   virtual int16_t getContentWidth(TFT_eSPI &lcd) const;
@@ -22,9 +33,13 @@ public:
   // Add the signal strength for a signal heard on the specified channel.
   void addSignal(int channelNum, int rssi);
   // Discard existing signal data.
-  void clear() { _channels.clear(); _rssiLevels.clear(); };
+  void clear() { _channels.clear(); _rssiLevels.clear(); _power.clear(); };
 
   void setColor(uint16_t color) { _color = color; };
+  void setMode(HeatmapMode mode) { _mode = mode; };
+  HeatmapMode mode() const { return _mode; };
+  // Set the changes drawn in HEATMAP_DIFF mode. They must be for this heatmap's band plan.
+  void setDiff(const HeatmapDiff *diff) { _diff = diff; };
 
   // Return the next (higher) channel number in the band plan above `channelNum` or
   // NO_CHANNEL if none is found. (i.e., channelNum is the highest in the band plan.)
@@ -33,15 +48,38 @@ public:
   // NO_CHANNEL if none is found. (i.e., channelNum is the lowest in the band plan.)
   int channelNumBelow(int channelNum) const;
 
+  // Per-channel signal data, indexed by position in the band plan (0..numChannels()-1).
+  size_t numChannels() const { return _channels.size(); };
+  int channelNumAt(size_t idx) const { return _channels[idx]; };
+  size_t signalCountAt(size_t idx) const { return _rssiLevels[idx].size(); };
+  // Strongest rssi recorded on the channel at `idx`, or `noSignal` if there are none.
+  int maxRssiAt(size_t idx, int noSignal) const;
+  // Sum of the linear power of all signals recorded on the channel at `idx`.
+  power_t powerAt(size_t idx) const { return _power[idx]; };
+  // Copy the per-channel totals, e.g. to pin or update a HeatmapDiff.
+  void totals(HeatmapTotals &out) const;
+
 private:
   size_t _idxForChannelNum(int channelNum) const;
+  void _renderBlocks(TFT_eSPI &lcd, int16_t childX, int16_t childY, int16_t childW,
+      int16_t childH);
+  void _renderPowerBars(TFT_eSPI &lcd, int16_t childX, int16_t childY, int16_t childW,
+      int16_t childH);
+  void _renderDiff(TFT_eSPI &lcd, int16_t childX, int16_t childY, int16_t childW,
+      int16_t childH);
 
   tc::vector<int> _channels;
   tc::vector<tc::vector<int>> _rssiLevels;
+  tc::vector<power_t> _power;
 
   uint16_t _color;
+  HeatmapMode _mode;
+  const HeatmapDiff *_diff;
 };
 
+// Scale the components of a color by brightness in range [0.0, 1.0].
+extern uint16_t scaleColorBrightness(uint16_t color, float brightness);
+
 constexpr unsigned int CHANNEL_NOT_FOUND = 0xFFFFFFFF;
 constexpr int NO_CHANNEL = static_cast<int>(CHANNEL_NOT_FOUND);
 
@@ -0,0 +1,402 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Streaming encoder / decoder for the columnar scan history format. See history-format.h.
+// (Portable; no Arduino dependencies.)
+
+#include <string.h>
+
+#include "history-format.h"
+
+static const uint8_t HISTORY_MAGIC[4] = { 'W', 'H', 'S', 'T' };
+
+static constexpr uint8_t NO_ID = 0xFF;
+
+static inline size_t putVarint(uint8_t *out, uint32_t val) {
+  size_t len = 0;
+  while (val >= 0x80) {
+    out[len++] = (val & 0x7F) | 0x80;
+    val >>= 7;
+  }
+  out[len++] = val;
+  return len;
+}
+
+static inline bool getVarint(const uint8_t *buf, size_t len, size_t &pos, uint32_t &val) {
+  val = 0;
+  for (unsigned int shift = 0; shift < 35; shift += 7) {
+    if (pos >= len) {
+      return false;
+    }
+
+    uint8_t b = buf[pos++];
+    val |= static_cast<uint32_t>(b & 0x7F) << shift;
+    if ((b & 0x80) == 0) {
+      return true;
+    }
+  }
+
+  return false; // Too long for a u32.
+}
+
+static inline uint32_t zigzag(int32_t val) {
+  return (static_cast<uint32_t>(val) << 1) ^ static_cast<uint32_t>(val >> 31);
+}
+
+static inline int32_t unzigzag(uint32_t val) {
+  return static_cast<int32_t>(val >> 1) ^ -static_cast<int32_t>(val & 1);
+}
+
+static inline size_t bitmapLen(size_t bits) {
+  return (bits + 7) / 8;
+}
+
+// Write a record's type and length, moving its payload (built at out + RECORD_PREFIX_MAX)
+// back so it immediately follows them. Returns the total record length.
+static constexpr size_t RECORD_PREFIX_MAX = 1 + 3; // type + varint length of up to 2 MiB.
+static size_t finishRecord(uint8_t *out, uint8_t recType, size_t payloadLen) {
+  uint8_t prefix[RECORD_PREFIX_MAX];
+  prefix[0] = recType;
+  size_t prefixLen = 1 + putVarint(prefix + 1, payloadLen);
+
+  memmove(out + prefixLen, out + RECORD_PREFIX_MAX, payloadLen);
+  memcpy(out, prefix, prefixLen);
+  return prefixLen + payloadLen;
+}
+
+size_t historyEncodeHeader(uint8_t *buf) {
+  memcpy(buf, HISTORY_MAGIC, sizeof(HISTORY_MAGIC));
+  buf[4] = HISTORY_VERSION;
+  buf[5] = HISTORY_HEADER_LEN;
+  buf[6] = 0;
+  buf[7] = 0;
+  return HISTORY_HEADER_LEN;
+}
+
+size_t historyDecodeHeader(const uint8_t *buf, size_t len) {
+  if (len < HISTORY_HEADER_LEN || memcmp(buf, HISTORY_MAGIC, sizeof(HISTORY_MAGIC)) != 0) {
+    return 0;
+  }
+
+  if (buf[4] > HISTORY_VERSION || buf[5] < HISTORY_HEADER_LEN) {
+    return 0;
+  }
+
+  return buf[5];
+}
+
+
+////////    Encoder    ////////
+
+static inline size_t bssidSlot(const uint8_t *bssid, size_t numSlots) {
+  // FNV-1a over the 6 octets.
+  uint32_t hash = 2166136261u;
+  for (int i = 0; i < 6; i++) {
+    hash = (hash ^ bssid[i]) * 16777619u;
+  }
+  return hash % numSlots;
+}
+
+int HistoryEncoder::_lookup(const uint8_t *bssid) const {
+  size_t slot = bssidSlot(bssid, INDEX_SLOTS);
+  // The index is never more than half full, so this always reaches an empty slot.
+  while (_index[slot] != NO_ID) {
+    if (memcmp(_entries[_index[slot]].bssid, bssid, 6) == 0) {
+      return _index[slot];
+    }
+    slot = (slot + 1) % INDEX_SLOTS;
+  }
+
+  return -1;
+}
+
+void HistoryEncoder::_insert(const uint8_t *bssid, uint8_t id) {
+  size_t slot = bssidSlot(bssid, INDEX_SLOTS);
+  while (_index[slot] != NO_ID) {
+    slot = (slot + 1) % INDEX_SLOTS;
+  }
+  _index[slot] = id;
+}
+
+size_t HistoryEncoder::encodeScan(uint32_t timestamp, const ScanLogStation *stations,
+    size_t numStations, uint8_t *out) {
+  if (numStations > HISTORY_MAX_STATIONS) {
+    numStations = HISTORY_MAX_STATIONS;
+  }
+
+  if (!_needSegment) {
+    // Would the new stations in this scan overflow the dictionary?
+    size_t numNew = 0;
+    for (size_t i = 0; i < numStations; i++) {
+      if (_lookup(stations[i].bssid) < 0) {
+        numNew++;
+      }
+    }
+
+    if (_numStations + numNew > HISTORY_MAX_STATIONS || _segmentScans >= HISTORY_SEGMENT_SCANS) {
+      startSegment();
+    }
+  }
+
+  size_t pos = 0;
+  if (_needSegment) {
+    _needSegment = false;
+    _numStations = 0;
+    _segmentScans = 0;
+    _lastTimestamp = timestamp;
+    memset(_index, NO_ID, sizeof(_index));
+
+    out[pos++] = HISTORY_REC_SEGMENT;
+    out[pos++] = 4;
+    out[pos++] = timestamp & 0xFF;
+    out[pos++] = (timestamp >> 8) & 0xFF;
+    out[pos++] = (timestamp >> 16) & 0xFF;
+    out[pos++] = (timestamp >> 24) & 0xFF;
+  }
+
+  // Map each station in this scan to its dictionary id, defining new ones as needed.
+  // Values are held per id so the columns below come out in id order.
+  bool present[HISTORY_MAX_STATIONS];
+  uint8_t curChannel[HISTORY_MAX_STATIONS];
+  int8_t curRssi[HISTORY_MAX_STATIONS];
+  memset(present, 0, sizeof(present));
+
+  for (size_t i = 0; i < numStations; i++) {
+    const ScanLogStation &station = stations[i];
+    int id = _lookup(station.bssid);
+    if (id < 0) {
+      id = _numStations++;
+      Entry &entry = _entries[id];
+      memcpy(entry.bssid, station.bssid, 6);
+      entry.channel = station.primary;
+      entry.rssi = station.rssi;
+      _insert(station.bssid, id);
+
+      uint8_t ssidLen = station.ssidLen > SCAN_LOG_SSID_MAX_LEN
+          ? SCAN_LOG_SSID_MAX_LEN : station.ssidLen;
+      uint8_t *payload = out + pos + RECORD_PREFIX_MAX;
+      memcpy(payload, station.bssid, 6);
+      payload[6] = station.second;
+      payload[7] = station.authmode;
+      payload[8] = station.phyFlags;
+      payload[9] = station.primary;
+      payload[10] = static_cast<uint8_t>(station.rssi);
+      payload[11] = ssidLen;
+      memcpy(payload + 12, station.ssid, ssidLen);
+      pos += finishRecord(out + pos, HISTORY_REC_STATION, 12 + ssidLen);
+    } else if (present[id]) {
+      continue; // Same bssid reported twice in one scan; keep the first.
+    }
+
+    present[id] = true;
+    curChannel[id] = station.primary;
+    curRssi[id] = station.rssi;
+  }
+
+  // Build the scan record's payload.
+  uint8_t *payload = out + pos + RECORD_PREFIX_MAX;
+  size_t len = 0;
+  len += putVarint(payload + len, timestamp - _lastTimestamp);
+  len += putVarint(payload + len, _numStations);
+
+  uint8_t *presenceBits = payload + len;
+  memset(presenceBits, 0, bitmapLen(_numStations));
+  size_t numPresent = 0;
+  for (size_t id = 0; id < _numStations; id++) {
+    if (present[id]) {
+      presenceBits[id / 8] |= 1 << (id % 8);
+      numPresent++;
+    }
+  }
+  len += bitmapLen(_numStations);
+
+  // RSSI column.
+  for (size_t id = 0; id < _numStations; id++) {
+    if (present[id]) {
+      len += putVarint(payload + len, zigzag(curRssi[id] - _entries[id].rssi));
+      _entries[id].rssi = curRssi[id];
+    }
+  }
+
+  // Channel column: which present stations changed channel, then their deltas.
+  uint8_t *changedBits = payload + len;
+  memset(changedBits, 0, bitmapLen(numPresent));
+  len += bitmapLen(numPresent);
+  size_t presentIdx = 0;
+  for (size_t id = 0; id < _numStations; id++) {
+    if (!present[id]) {
+      continue;
+    }
+
+    if (curChannel[id] != _entries[id].channel) {
+      changedBits[presentIdx / 8] |= 1 << (presentIdx % 8);
+      len += putVarint(payload + len, zigzag(curChannel[id] - _entries[id].channel));
+      _entries[id].channel = curChannel[id];
+    }
+    presentIdx++;
+  }
+
+  pos += finishRecord(out + pos, HISTORY_REC_SCAN, len);
+
+  _lastTimestamp = timestamp;
+  _segmentScans++;
+  return pos;
+}
+
+
+////////    Decoder    ////////
+
+void HistoryDecoder::feed(const uint8_t *data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    uint8_t b = data[i];
+    switch (_state) {
+    case STATE_HEADER:
+      _buf[_bufLen++] = b;
+      if (_bufLen == HISTORY_HEADER_LEN) {
+        if (historyDecodeHeader(_buf, _bufLen) == 0) {
+          _errors++; // Not a history stream; try to carry on as though it were.
+        }
+        _bufLen = 0;
+        _state = STATE_TYPE;
+      }
+      break;
+    case STATE_TYPE:
+      _recType = b;
+      _recLen = 0;
+      _lenShift = 0;
+      _state = STATE_LEN;
+      break;
+    case STATE_LEN:
+      if (_lenShift > 28) {
+        // Runaway length varint; treat it as garbage and look for a new record.
+        _errors++;
+        _synced = false;
+        _state = STATE_TYPE;
+        break;
+      }
+      _recLen |= static_cast<size_t>(b & 0x7F) << _lenShift;
+      _lenShift += 7;
+      if ((b & 0x80) == 0) {
+        _bufLen = 0;
+        _state = STATE_PAYLOAD;
+        if (_recLen == 0) {
+          if (!_dispatch()) {
+            _errors++;
+            _synced = false;
+          }
+          _state = STATE_TYPE;
+        }
+      }
+      break;
+    case STATE_PAYLOAD:
+      if (_bufLen < HISTORY_MAX_RECORD_LEN) {
+        _buf[_bufLen] = b;
+      }
+      _bufLen++; // Oversize records are consumed but not stored, then rejected.
+      if (_bufLen == _recLen) {
+        if (_recLen > HISTORY_MAX_RECORD_LEN || !_dispatch()) {
+          _errors++;
+          _synced = false;
+        }
+        _state = STATE_TYPE;
+      }
+      break;
+    }
+  }
+}
+
+bool HistoryDecoder::_dispatch() {
+  const uint8_t *payload = _buf;
+  size_t len = _recLen;
+
+  switch (_recType) {
+  case HISTORY_REC_SEGMENT:
+    if (len < 4) {
+      return false;
+    }
+    _timestamp = payload[0] | (payload[1] << 8) | (payload[2] << 16)
+        | (static_cast<uint32_t>(payload[3]) << 24);
+    _numStations = 0;
+    _synced = true;
+    _listener.onSegment(_timestamp);
+    return true;
+
+  case HISTORY_REC_STATION: {
+    if (!_synced) {
+      return true; // Skipping ahead to the next segment.
+    }
+    if (len < 12 || payload[11] > SCAN_LOG_SSID_MAX_LEN || 12u + payload[11] > len
+        || _numStations >= HISTORY_MAX_STATIONS) {
+      return false;
+    }
+
+    uint8_t id = _numStations++;
+    HistoryStation &station = _stations[id];
+    memcpy(station.bssid, payload, 6);
+    station.second = payload[6];
+    station.authmode = payload[7];
+    station.phyFlags = payload[8];
+    _lastChannel[id] = payload[9];
+    _lastRssi[id] = static_cast<int8_t>(payload[10]);
+    memcpy(station.ssid, payload + 12, payload[11]);
+    station.ssid[payload[11]] = '\0';
+    _listener.onStation(id, station);
+    return true;
+  }
+
+  case HISTORY_REC_SCAN: {
+    if (!_synced) {
+      return true;
+    }
+
+    size_t pos = 0;
+    uint32_t dt, numStations;
+    if (!getVarint(payload, len, pos, dt) || !getVarint(payload, len, pos, numStations)
+        || numStations > _numStations || pos + bitmapLen(numStations) > len) {
+      return false;
+    }
+
+    const uint8_t *presenceBits = payload + pos;
+    pos += bitmapLen(numStations);
+    size_t numPresent = 0;
+    for (size_t id = 0; id < numStations; id++) {
+      if (presenceBits[id / 8] & (1 << (id % 8))) {
+        _samples[numPresent++].id = id;
+      }
+    }
+
+    for (size_t i = 0; i < numPresent; i++) {
+      uint32_t rssiDelta;
+      if (!getVarint(payload, len, pos, rssiDelta)) {
+        return false;
+      }
+      uint8_t id = _samples[i].id;
+      _lastRssi[id] = _lastRssi[id] + unzigzag(rssiDelta);
+      _samples[i].rssi = _lastRssi[id];
+    }
+
+    if (pos + bitmapLen(numPresent) > len) {
+      return false;
+    }
+    const uint8_t *changedBits = payload + pos;
+    pos += bitmapLen(numPresent);
+    for (size_t i = 0; i < numPresent; i++) {
+      uint8_t id = _samples[i].id;
+      if (changedBits[i / 8] & (1 << (i % 8))) {
+        uint32_t chanDelta;
+        if (!getVarint(payload, len, pos, chanDelta)) {
+          return false;
+        }
+        _lastChannel[id] = _lastChannel[id] + unzigzag(chanDelta);
+      }
+      _samples[i].channel = _lastChannel[id];
+    }
+
+    _timestamp += dt;
+    _listener.onScan(_timestamp, _samples, numPresent);
+    return true;
+  }
+
+  default:
+    return true; // Unknown record type from a newer version; skip it.
+  }
+}
@@ -0,0 +1,185 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Delta-encoded, columnar time-series format for long-running scan history. This header has no
+// Arduino dependencies so that the host-side decoder can share it.
+//
+// A history stream is a file header followed by a sequence of records. Each record is:
+//
+//   u8       record type (HISTORY_REC_*)
+//   varint   payload length in bytes
+//   u8[]     payload
+//
+// Integers are unsigned LEB128 varints unless noted; signed values are zigzag-encoded first.
+// Multi-byte fixed-width integers are little-endian.
+//
+// The stream is divided into segments. Each segment starts with a HISTORY_REC_SEGMENT record
+// and has its own dictionary of stations. Within a segment, a station is identified by its
+// dictionary id (0, 1, 2... in order of definition). A decoder can start at any segment.
+//
+//   HISTORY_REC_SEGMENT:
+//     u32      base timestamp in milliseconds since boot
+//
+//   HISTORY_REC_STATION: defines the next dictionary id. Written once per segment, just before
+//   the first scan in which the station appears.
+//     u8[6]    bssid
+//     u8       secondary channel (wifi_second_chan_t)
+//     u8       authmode (wifi_auth_mode_t)
+//     u8       phy flags (SCAN_LOG_PHY_*)
+//     u8       initial channel
+//     i8       initial rssi
+//     u8       ssid length
+//     char[]   ssid
+//
+//   HISTORY_REC_SCAN:
+//     varint   milliseconds since the previous scan (or since the segment base timestamp)
+//     varint   N: number of stations in the dictionary as of this scan
+//     u8[]     presence bitmap; ceil(N/8) bytes; bit i (LSB first) set if station i was seen
+//     then, for the P stations present, in id order:
+//     varint[] rssi column: zigzag(rssi - previous rssi of that station), P entries
+//     u8[]     channel-changed bitmap over the P present stations; ceil(P/8) bytes
+//     varint[] channel column: zigzag(channel - previous channel), one per changed station
+//
+// The "previous" rssi and channel of a station start at the values in its
+// HISTORY_REC_STATION record and are updated each time it's present in a scan.
+
+#ifndef _HISTORY_FORMAT_H
+#define _HISTORY_FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "scan-log-format.h"
+
+constexpr uint8_t HISTORY_VERSION = 1;
+constexpr size_t HISTORY_HEADER_LEN = 8;
+
+constexpr uint8_t HISTORY_REC_SEGMENT = 1;
+constexpr uint8_t HISTORY_REC_STATION = 2;
+constexpr uint8_t HISTORY_REC_SCAN = 3;
+
+// Max stations in one segment's dictionary; enough for a whole MULTI_PASS_SCAN station table.
+// When a scan would overflow it, a new segment is started with only the stations in that scan.
+// (Dictionary ids are stored in a byte.)
+constexpr size_t HISTORY_MAX_STATIONS = 160;
+
+// Scans per segment before a new segment (and dictionary) is started anyway, bounding how far
+// back a decoder has to go to resynchronize. (1440 scans = one day at one scan per minute.)
+constexpr uint32_t HISTORY_SEGMENT_SCANS = 1440;
+
+// Upper bounds on record sizes (type + length varint + payload).
+constexpr size_t HISTORY_MAX_STATION_REC_LEN = 1 + 2 + 12 + SCAN_LOG_SSID_MAX_LEN;
+constexpr size_t HISTORY_MAX_SCAN_REC_LEN =
+    1 + 3 + 5 + 2 + HISTORY_MAX_STATIONS / 8 + HISTORY_MAX_STATIONS * 2
+    + HISTORY_MAX_STATIONS / 8 + HISTORY_MAX_STATIONS * 2;
+constexpr size_t HISTORY_MAX_RECORD_LEN = HISTORY_MAX_SCAN_REC_LEN;
+
+// Worst case output of HistoryEncoder::encodeScan(): a new segment, a full dictionary, and a
+// scan record.
+constexpr size_t HISTORY_MAX_ENCODED_SCAN_LEN =
+    1 + 1 + 4 + HISTORY_MAX_STATIONS * HISTORY_MAX_STATION_REC_LEN + HISTORY_MAX_SCAN_REC_LEN;
+
+extern size_t historyEncodeHeader(uint8_t *buf);
+// Returns the header length to skip, or 0 if this is not a history stream this reader
+// understands.
+extern size_t historyDecodeHeader(const uint8_t *buf, size_t len);
+
+// Streaming encoder. Keeps only the current segment's dictionary and last-seen values.
+class HistoryEncoder {
+public:
+  HistoryEncoder() { startSegment(); };
+
+  // Force the next scan to begin a new segment; e.g., because output is moving to a new file.
+  void startSegment() { _numStations = 0; _segmentScans = 0; _needSegment = true; };
+
+  // Encode a scan into `out`, which must hold HISTORY_MAX_ENCODED_SCAN_LEN bytes. Emits a
+  // segment record and station definitions first, if needed. Returns bytes written.
+  size_t encodeScan(uint32_t timestamp, const ScanLogStation *stations, size_t numStations,
+      uint8_t *out);
+
+private:
+  struct Entry {
+    uint8_t bssid[6];
+    uint8_t channel;
+    int8_t rssi;
+  };
+
+  int _lookup(const uint8_t *bssid) const;
+  void _insert(const uint8_t *bssid, uint8_t id);
+
+  Entry _entries[HISTORY_MAX_STATIONS];
+  // Open-addressed hash index from bssid to dictionary id; 0xFF marks an empty slot.
+  static constexpr size_t INDEX_SLOTS = HISTORY_MAX_STATIONS * 2;
+  uint8_t _index[INDEX_SLOTS];
+  size_t _numStations;
+
+  uint32_t _segmentScans;
+  uint32_t _lastTimestamp;
+  bool _needSegment;
+};
+
+// A station's static attributes from its HISTORY_REC_STATION record.
+struct HistoryStation {
+  uint8_t bssid[6];
+  uint8_t second;
+  uint8_t authmode;
+  uint8_t phyFlags;
+  char ssid[SCAN_LOG_SSID_MAX_LEN + 1];
+};
+
+// One present station's values in a decoded scan.
+struct HistorySample {
+  uint8_t id;
+  uint8_t channel;
+  int8_t rssi;
+};
+
+// Streaming decoder. Feed it bytes in any size chunks; it calls back into a Listener.
+class HistoryDecoder {
+public:
+  class Listener {
+  public:
+    virtual ~Listener() { };
+    virtual void onSegment(uint32_t baseTimestamp) = 0;
+    virtual void onStation(uint8_t id, const HistoryStation &station) = 0;
+    virtual void onScan(uint32_t timestamp, const HistorySample *samples, size_t numSamples) = 0;
+  };
+
+  HistoryDecoder(Listener &listener): _listener(listener), _state(STATE_HEADER), _bufLen(0),
+      _recType(0), _recLen(0), _lenShift(0), _synced(false), _numStations(0), _timestamp(0),
+      _errors(0) { };
+
+  void feed(const uint8_t *data, size_t len);
+
+  // Station attributes by dictionary id in the current segment.
+  const HistoryStation &station(uint8_t id) const { return _stations[id]; };
+
+  // Number of records that could not be decoded. After an error, scans are ignored until the
+  // start of the next segment.
+  uint32_t errors() const { return _errors; };
+
+private:
+  enum State { STATE_HEADER, STATE_TYPE, STATE_LEN, STATE_PAYLOAD };
+
+  bool _dispatch();
+
+  Listener &_listener;
+  State _state;
+
+  uint8_t _buf[HISTORY_MAX_RECORD_LEN];
+  size_t _bufLen;
+  uint8_t _recType;
+  size_t _recLen;
+  unsigned int _lenShift;
+  bool _synced; // False until a segment record is seen, and after any decode error.
+
+  HistoryStation _stations[HISTORY_MAX_STATIONS];
+  uint8_t _lastChannel[HISTORY_MAX_STATIONS];
+  int8_t _lastRssi[HISTORY_MAX_STATIONS];
+  size_t _numStations;
+  uint32_t _timestamp;
+
+  HistorySample _samples[HISTORY_MAX_STATIONS];
+  uint32_t _errors;
+};
+
+#endif
@@ -0,0 +1,79 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Record compact long-running scan history to the SD card. See history-format.h.
+
+#include "wifi-scanner.h"
+
+// Write-behind logger for history files.
+static SdLogger historyLogger;
+
+static HistoryEncoder historyEncoder;
+static_assert(HISTORY_MAX_STATIONS >= MAX_STATIONS, "a scan must fit in one history segment");
+
+// Header written at the start of each history file.
+static uint8_t historyFileHeader[HISTORY_HEADER_LEN];
+
+// The scan currently being assembled, and its encoded form.
+static uint32_t historyTimestamp = 0;
+static ScanLogStation historyStations[MAX_STATIONS];
+static size_t historyNumStations = 0;
+static uint8_t historyEncodeBuf[HISTORY_MAX_ENCODED_SCAN_LEN];
+
+// File index that historyEncoder's current segment was written into.
+static uint16_t historySegmentFile = 0;
+
+bool historyLogBegin() {
+  size_t headerLen = historyEncodeHeader(historyFileHeader);
+  bool ok = historyLogger.begin(HISTORY_LOG_PREFIX, HISTORY_LOG_SUFFIX, historyFileHeader,
+      headerLen);
+  historySegmentFile = historyLogger.fileIndex();
+  historyEncoder.startSegment();
+  return ok;
+}
+
+void historyLogPoll() {
+  historyLogger.poll();
+}
+
+const SdLogStats &historyLogStats() {
+  return historyLogger.stats();
+}
+
+void historyLogStartScan(uint32_t timestamp) {
+  historyTimestamp = timestamp;
+  historyNumStations = 0;
+}
+
+void historyLogAddStation(const wifi_ap_record_t *pWifiAPRecord) {
+  if (historyNumStations >= MAX_STATIONS) {
+    return;
+  }
+
+  scanLogStationFromAPRecord(pWifiAPRecord, historyStations[historyNumStations++]);
+}
+
+bool historyLogFinishScan() {
+  if (historyLogger.fileIndex() != historySegmentFile) {
+    // The log rotated; each file must begin with a segment record and its own dictionary so
+    // that it can be decoded on its own.
+    historySegmentFile = historyLogger.fileIndex();
+    historyEncoder.startSegment();
+  }
+
+  if (historyLogger.backpressure()) {
+    // The card is falling behind. Skip this scan before encoding it, so the next scan's deltas
+    // are against the last one logged and cover this one's changes too; no new segment needed.
+    historyLogger.shed();
+    return false;
+  }
+
+  size_t len = historyEncoder.encodeScan(historyTimestamp, historyStations, historyNumStations,
+      historyEncodeBuf);
+  if (!historyLogger.append(historyEncodeBuf, len)) {
+    // Later scans are deltas against this one; start over so the file stays decodable.
+    historyEncoder.startSegment();
+    return false;
+  }
+
+  return true;
+}
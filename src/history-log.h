@@ -0,0 +1,26 @@
+// (c) Copyright 2022 Aaron Kimball
+
+#ifndef _HISTORY_LOG_H
+#define _HISTORY_LOG_H
+
+#include "history-format.h"
+#include "sd-logger.h"
+
+// Long-running scan history is appended to files named /histNNNN.wsh when HISTORY_LOG is
+// defined. See history-format.h for the encoding; tools/wifi-history-decode reads it back.
+#define HISTORY_LOG_PREFIX "/hist"
+#define HISTORY_LOG_SUFFIX ".wsh"
+
+// Start the write-behind SD logger for scan history. Call after sdCardBegin().
+extern bool historyLogBegin();
+// Record a scan: call historyLogStartScan(), then historyLogAddStation() for each station,
+// then historyLogFinishScan() to encode it and queue it for the SD log. Returns false if it was
+// dropped, or skipped because the card is falling behind (then the next scan covers it).
+extern void historyLogStartScan(uint32_t timestamp);
+extern void historyLogAddStation(const wifi_ap_record_t *pWifiAPRecord);
+extern bool historyLogFinishScan();
+// Write queued history to the card. Call from loop().
+extern void historyLogPoll();
+extern const SdLogStats &historyLogStats();
+
+#endif
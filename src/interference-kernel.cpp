@@ -0,0 +1,155 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Packed spectral overlap accumulation. See interference-kernel.h.
+// (Portable; no Arduino dependencies.)
+
+#include <string.h>
+
+#include "interference-kernel.h"
+#include "linear-power.h"
+
+// Mask attenuations are converted to linear gain relative to this (arbitrary) power level.
+static constexpr int KERNEL_REF_DBM = -30;
+
+void interferenceAccumulateScalar(int16_t *acc, const int16_t *kernel, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    int32_t sum = static_cast<int32_t>(acc[i]) + kernel[i];
+    acc[i] = sum > INT16_MAX ? INT16_MAX : (sum < INT16_MIN ? INT16_MIN : sum);
+  }
+}
+
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP == 1
+// Saturating add of each signed 16-bit half of `a` and `b`. (As CMSIS's __QADD16.)
+static inline uint32_t qadd16(uint32_t a, uint32_t b) {
+  uint32_t result;
+  __asm ("qadd16 %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+  return result;
+}
+
+void interferenceAccumulate(int16_t *acc, const int16_t *kernel, size_t len) {
+  // Each word holds two channels' weights. (memcpy of an aligned word compiles to one LDR/STR,
+  // without breaking strict aliasing.)
+  for (size_t i = 0; i < len; i += 2) {
+    uint32_t accWord, kernelWord;
+    memcpy(&accWord, acc + i, sizeof(accWord));
+    memcpy(&kernelWord, kernel + i, sizeof(kernelWord));
+    accWord = qadd16(accWord, kernelWord);
+    memcpy(acc + i, &accWord, sizeof(accWord));
+  }
+}
+
+bool interferenceAccumulateIsSimd() {
+  return true;
+}
+#else
+void interferenceAccumulate(int16_t *acc, const int16_t *kernel, size_t len) {
+  interferenceAccumulateScalar(acc, kernel, len);
+}
+
+bool interferenceAccumulateIsSimd() {
+  return false;
+}
+#endif
+
+// Cache key for a transmission's shape; never 0.
+static uint32_t kernelKey(const SpectrumSignal &signal) {
+  return (static_cast<uint32_t>(signal.primary) << 8) | (signal.second << 4)
+      | (signal.phy11b ? 2 : 0) | (signal.phy11n ? 1 : 0) | 0x80000000;
+}
+
+InterferenceMap::InterferenceMap(bool is24GHz): _is24GHz(is24GHz) {
+  _minChannel = is24GHz ? min24GHzChannelNum : min50GHzChannelNum;
+  int maxChannel = is24GHz ? max24GHzChannelNum : max50GHzChannelNum;
+  _numSlots = (maxChannel - _minChannel + 2) & ~1;
+  memset(_cache, 0, sizeof(_cache));
+  clear();
+}
+
+void InterferenceMap::clear() {
+  memset(_weights, 0, sizeof(_weights));
+}
+
+int InterferenceMap::weightAt(int channelNum) const {
+  int slot = channelNum - _minChannel;
+  if (slot < 0 || slot >= static_cast<int>(_numSlots)) {
+    return 0;
+  }
+
+  return _weights[slot];
+}
+
+// A kernel under construction, and the channel number of its first slot.
+struct KernelBuilder {
+  InterferenceKernel *kernel;
+  int firstChannel;
+};
+
+// Sink for spectrumForEachChannel(), called with the signal at KERNEL_REF_DBM: stores the linear
+// gain of the mask on each channel reached, rounded to Q8.
+static void addKernelWeight(int channelNum, int rssi, void *builder) {
+  KernelBuilder *b = static_cast<KernelBuilder*>(builder);
+  power_t ref = dbmToPower(KERNEL_REF_DBM);
+  size_t slot = channelNum - b->firstChannel;
+  if (slot < b->kernel->len) {
+    b->kernel->weights[slot] = (dbmToPower(rssi) * INTERFERENCE_FULL_WEIGHT + ref / 2) / ref;
+  }
+}
+
+bool InterferenceMap::makeKernel(const SpectrumSignal &signal, InterferenceKernel &kernel) const {
+  if (spectrumIs24GHz(signal.primary) != _is24GHz) {
+    return false;
+  }
+
+  // The kernel spans the footprint and the mask on either side, clipped to the band, and is
+  // widened to whole words.
+  SpectrumFootprint fp;
+  spectrumFootprint(signal, fp);
+  int reach = fp.maskLen * fp.channelDelta;
+  int lowSlot = fp.lowerChannelNum - reach - _minChannel;
+  int highSlot = fp.upperChannelNum + reach - _minChannel;
+  lowSlot = lowSlot < 0 ? 0 : lowSlot & ~1;
+  highSlot = highSlot >= static_cast<int>(_numSlots) ? _numSlots - 1 : highSlot;
+  if (highSlot < lowSlot || highSlot - lowSlot >= static_cast<int>(INTERFERENCE_KERNEL_MAX_LEN)) {
+    return false; // Primary channel outside the band plan.
+  }
+
+  kernel.firstSlot = lowSlot;
+  kernel.len = (highSlot - lowSlot + 2) & ~1;
+  memset(kernel.weights, 0, sizeof(kernel.weights));
+
+  SpectrumSignal refSignal = signal;
+  refSignal.rssi = KERNEL_REF_DBM; // The whole mask is above the noise floor at this level.
+  KernelBuilder builder = { &kernel, _minChannel + lowSlot };
+  spectrumForEachChannel(refSignal, addKernelWeight, &builder);
+  return true;
+}
+
+void InterferenceMap::addKernel(const InterferenceKernel &kernel, bool simd) {
+  int16_t *acc = _weights + kernel.firstSlot;
+  if (simd) {
+    interferenceAccumulate(acc, kernel.weights, kernel.len);
+  } else {
+    interferenceAccumulateScalar(acc, kernel.weights, kernel.len);
+  }
+}
+
+const InterferenceKernel *InterferenceMap::_cachedKernel(const SpectrumSignal &signal) {
+  uint32_t key = kernelKey(signal);
+  CacheEntry &entry = _cache[(key * 2654435761u) >> 27 & (CACHE_SIZE - 1)];
+  if (entry.key != key) {
+    if (!makeKernel(signal, entry.kernel)) {
+      entry.key = 0;
+      return NULL;
+    }
+    entry.key = key;
+  }
+
+  return &entry.kernel;
+}
+
+void InterferenceMap::addSignal(const SpectrumSignal &signal) {
+  const InterferenceKernel *kernel = _cachedKernel(signal);
+  if (kernel != NULL) {
+    addKernel(*kernel);
+  }
+}
@@ -0,0 +1,77 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Per-channel spectral overlap, accumulated as packed 16-bit integers: two channels per
+// Cortex-M4 QADD16 instruction. (Portable; no Arduino dependencies.)
+
+#ifndef _INTERFERENCE_KERNEL_H
+#define _INTERFERENCE_KERNEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "spectrum.h"
+
+// Weights are Q8 fixed point: a station counts as INTERFERENCE_FULL_WEIGHT on each channel it
+// occupies, and as that times its spectral mask's linear gain on each channel the mask reaches
+// (-10 dB: 26, -26 dB: 1). Accumulators saturate at INT16_MAX, about 127 full-weight stations.
+constexpr int16_t INTERFERENCE_FULL_WEIGHT = 256;
+
+// Accumulator slots are indexed by channel number within the band, rounded up to an even count.
+constexpr size_t INTERFERENCE_MAX_SLOTS = (max50GHzChannelNum - min50GHzChannelNum + 2) & ~1;
+
+// A station's weights over the slots it reaches. Both the first slot and the length are even,
+// so the kernel lines up with whole 32-bit words of the accumulators.
+constexpr size_t INTERFERENCE_KERNEL_MAX_LEN = 16;
+struct InterferenceKernel {
+  uint16_t firstSlot;
+  uint16_t len;
+  alignas(4) int16_t weights[INTERFERENCE_KERNEL_MAX_LEN];
+};
+
+// Saturating add of `len` (even) packed weights from `kernel` into `acc`; both 4-byte aligned.
+// Uses QADD16 where the target has the DSP extension, otherwise the scalar version.
+extern void interferenceAccumulate(int16_t *acc, const int16_t *kernel, size_t len);
+// One weight at a time. Gives identical results; used on host and for benchmarks.
+extern void interferenceAccumulateScalar(int16_t *acc, const int16_t *kernel, size_t len);
+// True if interferenceAccumulate() uses SIMD instructions on this target.
+extern bool interferenceAccumulateIsSimd();
+
+// The mask-weighted number of stations overlapping each channel in one band.
+//
+// A kernel depends only on the shape of a station's transmission (primary and secondary
+// channels and PHY), not on its rssi, so kernels are built once and cached; adding a station
+// is then a cache lookup and len/2 packed adds, rather than a call per channel reached.
+class InterferenceMap {
+public:
+  InterferenceMap(bool is24GHz);
+
+  // Discard the stations of the previous scan. (Cached kernels are kept.)
+  void clear();
+  // Add a station heard in this band.
+  void addSignal(const SpectrumSignal &signal);
+  // Overlap on `channelNum`, in Q8; 0 for a channel outside the band.
+  int weightAt(int channelNum) const;
+
+  // Build the kernel of a station's transmission. Returns false if it's in the other band.
+  bool makeKernel(const SpectrumSignal &signal, InterferenceKernel &kernel) const;
+  // Add a kernel made by makeKernel(), with interferenceAccumulate() or the scalar version.
+  void addKernel(const InterferenceKernel &kernel, bool simd=true);
+
+private:
+  const InterferenceKernel *_cachedKernel(const SpectrumSignal &signal);
+
+  static constexpr size_t CACHE_SIZE = 32; // Direct-mapped; a scan uses only a few shapes.
+  struct CacheEntry {
+    uint32_t key; // See kernelKey() in interference-kernel.cpp; 0 if empty.
+    InterferenceKernel kernel;
+  };
+
+  bool _is24GHz;
+  int _minChannel;
+  size_t _numSlots;
+  // Word-aligned for packed access.
+  alignas(4) int16_t _weights[INTERFERENCE_MAX_SLOTS];
+  CacheEntry _cache[CACHE_SIZE];
+};
+
+#endif
@@ -0,0 +1,65 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Fixed-point dBm <-> linear power tables. See linear-power.h.
+// (Portable; no Arduino dependencies.)
+
+#include "linear-power.h"
+
+// dBm -> power: split (dbm - POWER_UNIT_DBM) into tens and units. Each 10 dB is a factor of 10;
+// each remaining 1 dB step is a factor of 10^(1/10), held here multiplied by 1000.
+static const uint16_t dbUnitsToRatioMilli[10] = {
+  1000, 1259, 1585, 1995, 2512, 3162, 3981, 5012, 6310, 7943,
+};
+
+static const power_t powersOfTen[(POWER_MAX_DBM - POWER_UNIT_DBM) / 10 + 1] = {
+  1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+  100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+  10000000000000ULL, 100000000000000ULL, 1000000000000000ULL,
+};
+
+// power -> dB: 10*log10(x) = 10*log10(2) * log2(x). The integer part of log2(x) is the position
+// of the highest set bit; this table covers the fraction, indexed by the next 6 bits below it.
+// Entries are 10*log10(1 + (i + 0.5) / 64) in hundredths of a dB.
+static constexpr unsigned int LOG_FRAC_BITS = 6;
+static const uint16_t log2FracCentiDb[1 << LOG_FRAC_BITS] = {
+    3,  10,  17,  23,  30,  36,  42,  48,  54,  60,  66,  72,  77,  83,  89,  94,
+  100, 105, 110, 116, 121, 126, 131, 136, 141, 146, 150, 155, 160, 165, 169, 174,
+  178, 183, 187, 192, 196, 200, 205, 209, 213, 217, 221, 225, 229, 233, 237, 241,
+  245, 249, 253, 256, 260, 264, 268, 271, 275, 278, 282, 285, 289, 292, 296, 299,
+};
+
+// 3.0103 dB per doubling, in units of 0.0001 dB.
+static constexpr uint32_t DB_PER_DOUBLING_X10000 = 30103;
+
+power_t dbmToPower(int dbm) {
+  if (dbm < POWER_MIN_DBM) {
+    dbm = POWER_MIN_DBM;
+  } else if (dbm > POWER_MAX_DBM) {
+    dbm = POWER_MAX_DBM;
+  }
+
+  unsigned int db = dbm - POWER_UNIT_DBM;
+  return powersOfTen[db / 10] * dbUnitsToRatioMilli[db % 10] / 1000;
+}
+
+int powerToDeciDbm(power_t power) {
+  if (power < dbmToPower(POWER_MIN_DBM)) {
+    return POWER_MIN_DBM * 10;
+  }
+
+  unsigned int msb = 63 - __builtin_clzll(power);
+  unsigned int frac;
+  if (msb >= LOG_FRAC_BITS) {
+    frac = (power >> (msb - LOG_FRAC_BITS)) & ((1 << LOG_FRAC_BITS) - 1);
+  } else {
+    frac = (power << (LOG_FRAC_BITS - msb)) & ((1 << LOG_FRAC_BITS) - 1);
+  }
+
+  int centiDb = (msb * DB_PER_DOUBLING_X10000 + 50) / 100 + log2FracCentiDb[frac];
+  return POWER_UNIT_DBM * 10 + (centiDb + 5) / 10;
+}
+
+int powerToDbm(power_t power) {
+  // Round via a positive offset; integer division truncates toward zero.
+  return (powerToDeciDbm(power) - POWER_UNIT_DBM * 10 + 5) / 10 + POWER_UNIT_DBM;
+}
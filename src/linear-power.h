@@ -0,0 +1,31 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Fixed-point conversions between dBm and linear power, so signals can be summed as power
+// rather than stacked as counts, without floating-point pow() / log10() on the SAMD51.
+// (Portable; no Arduino dependencies.)
+
+#ifndef _LINEAR_POWER_H
+#define _LINEAR_POWER_H
+
+#include <stdint.h>
+
+// Linear power, in attowatts (1 aW = 1e-15 mW = -150 dBm). 64 bits holds the sum of thousands
+// of 0 dBm signals, while the weakest signals reported still resolve to 0.1%.
+typedef uint64_t power_t;
+constexpr int POWER_UNIT_DBM = -150;
+
+// Range of dBm values converted by dbmToPower(); inputs outside it are clamped.
+constexpr int POWER_MIN_DBM = -120;
+constexpr int POWER_MAX_DBM = 0;
+
+// Return the linear power of a signal of `dbm` dBm. (Accurate to 0.1%.)
+extern power_t dbmToPower(int dbm);
+
+// Return `power` in tenths of a dBm. (Accurate to about 0.1 dB.) Power below POWER_MIN_DBM,
+// including zero, is reported as POWER_MIN_DBM.
+extern int powerToDeciDbm(power_t power);
+
+// Return `power` in dBm, rounded to the nearest dB.
+extern int powerToDbm(power_t power);
+
+#endif
@@ -0,0 +1,201 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Low-power unattended monitoring mode. See low-power.h.
+//
+// The RTC runs from the 1.024 kHz ultra-low-power oscillator in 32-bit counter mode, and serves
+// both as the wake-up alarm (COMP0) and as the time base for the duty-cycle counters, since
+// SysTick (and so millis()) stops in standby.
+
+#include "wifi-scanner.h"
+
+#ifdef LOW_POWER_MONITOR
+
+static MonitorStats stats;
+static MonitorState curState = MONITOR_STATE_AWAKE;
+static uint32_t stateStartTicks = 0;
+static uint32_t nextScanTicks = 0;
+static bool hasStandby = false;
+
+static volatile bool rtcWoke = false;
+static volatile bool buttonWoke = false;
+
+static const uint32_t stateMilliAmps[MONITOR_NUM_STATES] = {
+  MONITOR_AWAKE_MA,
+  MONITOR_SCAN_MA,
+  MONITOR_STANDBY_MA,
+};
+
+#ifdef __SAMD51__
+void RTC_Handler(void) {
+  if (RTC->MODE0.INTFLAG.reg & RTC_MODE0_INTFLAG_CMP0) {
+    RTC->MODE0.INTFLAG.reg = RTC_MODE0_INTFLAG_CMP0; // Write 1 to clear.
+    rtcWoke = true;
+  }
+}
+
+uint32_t rtcTicks() {
+  while (RTC->MODE0.SYNCBUSY.bit.COUNT) { }
+  return RTC->MODE0.COUNT.reg;
+}
+
+static void rtcSetAlarm(uint32_t ticks) {
+  RTC->MODE0.COMP[0].reg = ticks;
+  while (RTC->MODE0.SYNCBUSY.bit.COMP0) { }
+}
+
+static void rtcSetup() {
+  // Clock the RTC from the 1.024 kHz output of the 32 kHz ultra-low-power oscillator, which
+  // keeps running in standby.
+  MCLK->APBAMASK.reg |= MCLK_APBAMASK_RTC;
+  OSC32KCTRL->RTCCTRL.reg = OSC32KCTRL_RTCCTRL_RTCSEL_ULP1K;
+
+  RTC->MODE0.CTRLA.reg = RTC_MODE0_CTRLA_SWRST;
+  while (RTC->MODE0.SYNCBUSY.bit.SWRST) { }
+
+  // 32-bit free-running counter; COMP0 raises an interrupt but doesn't clear the count, so the
+  // count is also our time base.
+  RTC->MODE0.CTRLA.reg = RTC_MODE0_CTRLA_MODE_COUNT32 | RTC_MODE0_CTRLA_PRESCALER_DIV1
+      | RTC_MODE0_CTRLA_COUNTSYNC;
+  RTC->MODE0.INTENSET.reg = RTC_MODE0_INTENSET_CMP0;
+  NVIC_EnableIRQ(RTC_IRQn);
+
+  RTC->MODE0.CTRLA.reg |= RTC_MODE0_CTRLA_ENABLE;
+  while (RTC->MODE0.SYNCBUSY.bit.ENABLE) { }
+}
+#else
+uint32_t rtcTicks() {
+  return static_cast<uint32_t>(static_cast<uint64_t>(millis()) * RTC_TICKS_PER_SEC / 1000);
+}
+#endif // __SAMD51__
+
+static void onWakeButton() {
+  buttonWoke = true;
+}
+
+// Close out the time spent in the current state and move to `state`.
+static void enterState(MonitorState state) {
+  uint32_t now = rtcTicks();
+  uint32_t elapsed = now - stateStartTicks;
+  stats.stateTicks[curState] += elapsed;
+  // mA * mV = uW; * ticks / 1024 = uJ.
+  stats.energyMicroJoules += static_cast<uint64_t>(stateMilliAmps[curState]) * MONITOR_SUPPLY_MV
+      * elapsed / RTC_TICKS_PER_SEC;
+
+  curState = state;
+  stateStartTicks = now;
+}
+
+void monitorWakeOnPin(uint8_t pin) {
+  attachInterrupt(digitalPinToInterrupt(pin), onWakeButton, FALLING);
+}
+
+bool monitorBegin() {
+  memset(&stats, 0, sizeof(stats));
+
+#ifdef __SAMD51__
+  rtcSetup();
+
+  // attachInterrupt() clocks the EIC from a GCLK that stops in standby; switch it to the
+  // always-on 32 kHz ULP oscillator so a button press can wake us.
+  EIC->CTRLA.bit.ENABLE = 0;
+  while (EIC->SYNCBUSY.bit.ENABLE) { }
+  EIC->CTRLA.bit.CKSEL = 1;
+  EIC->CTRLA.bit.ENABLE = 1;
+  while (EIC->SYNCBUSY.bit.ENABLE) { }
+
+  hasStandby = true;
+#endif
+
+  pinMode(LCD_BACKLIGHT, OUTPUT);
+  WiFi.mode(WIFI_OFF);
+  scanCacheCountRpc();
+
+  curState = MONITOR_STATE_AWAKE;
+  stateStartTicks = rtcTicks();
+  nextScanTicks = stateStartTicks + MONITOR_SCAN_INTERVAL_SECS * RTC_TICKS_PER_SEC;
+  return hasStandby;
+}
+
+bool monitorScanDue() {
+  return static_cast<int32_t>(rtcTicks() - nextScanTicks) >= 0;
+}
+
+void monitorScanStart() {
+  enterState(MONITOR_STATE_SCAN);
+  WiFi.mode(WIFI_STA);
+  scanCacheCountRpc();
+}
+
+void monitorScanEnd() {
+  // The RTL8721D draws far more than the SAMD51 even when idle; turn it off until next time.
+  WiFi.mode(WIFI_OFF);
+  scanCacheCountRpc();
+  stats.scans++;
+  nextScanTicks = rtcTicks() + MONITOR_SCAN_INTERVAL_SECS * RTC_TICKS_PER_SEC;
+  enterState(MONITOR_STATE_AWAKE);
+}
+
+void monitorSetBacklight(bool on) {
+  digitalWrite(LCD_BACKLIGHT, on ? HIGH : LOW);
+}
+
+bool monitorSleep() {
+  buttonWoke = false;
+  rtcWoke = false;
+  enterState(MONITOR_STATE_STANDBY);
+
+#ifdef __SAMD51__
+  rtcSetAlarm(nextScanTicks);
+  PM->SLEEPCFG.reg = PM_SLEEPCFG_SLEEPMODE_STANDBY;
+  while (PM->SLEEPCFG.bit.SLEEPMODE != PM_SLEEPCFG_SLEEPMODE_STANDBY_Val) { }
+  // Interrupts other than ours (e.g., USB) can also end standby early; go back to sleep. The
+  // flags are tested with interrupts masked, so a wakeup ISR can't run between the test and WFI
+  // and leave us asleep until some unrelated interrupt. (A pending interrupt still ends WFI
+  // while masked; its handler runs when they're unmasked.)
+  __disable_irq();
+  while (!buttonWoke && !rtcWoke && !monitorScanDue()) {
+    __DSB();
+    __WFI();
+    __enable_irq();
+    __disable_irq();
+  }
+  __enable_irq();
+#else
+  while (!buttonWoke && !monitorScanDue()) {
+    delay(10);
+  }
+#endif
+
+  enterState(MONITOR_STATE_AWAKE);
+  if (buttonWoke) {
+    stats.buttonWakes++;
+  }
+  return buttonWoke;
+}
+
+uint32_t monitorDutyCyclePermille() {
+  enterState(curState); // Bring the counters up to date.
+  uint64_t active = stats.stateTicks[MONITOR_STATE_AWAKE] + stats.stateTicks[MONITOR_STATE_SCAN];
+  uint64_t total = active + stats.stateTicks[MONITOR_STATE_STANDBY];
+  if (total == 0) {
+    return 1000;
+  }
+
+  return active * 1000 / total;
+}
+
+uint32_t monitorEnergyPerScanMicroJoules() {
+  enterState(curState);
+  if (stats.scans == 0) {
+    return 0;
+  }
+
+  return stats.energyMicroJoules / stats.scans;
+}
+
+const MonitorStats &monitorStats() {
+  enterState(curState);
+  return stats;
+}
+
+#endif // LOW_POWER_MONITOR
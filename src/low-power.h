@@ -0,0 +1,70 @@
+// (c) Copyright 2022 Aaron Kimball
+
+#ifndef _LOW_POWER_H
+#define _LOW_POWER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Unattended monitoring mode (LOW_POWER_MONITOR): scan every MONITOR_SCAN_INTERVAL_SECS with
+// the backlight off and the radio off between scans. In between, the SAMD51 sleeps in standby
+// until the RTC compare for the next scan or a button press wakes it. A button press turns the
+// screen back on for MONITOR_AWAKE_MILLIS after the last button activity.
+constexpr uint32_t MONITOR_SCAN_INTERVAL_SECS = 60;
+constexpr uint32_t MONITOR_AWAKE_MILLIS = 30000;
+
+// The RTC counts at 1.024 kHz and keeps running in standby, unlike millis().
+constexpr uint32_t RTC_TICKS_PER_SEC = 1024;
+
+// Nominal supply current in each state, used to estimate energy from the measured time in each
+// state. (There's no current sensor on the Wio Terminal; measure your unit and adjust.)
+constexpr uint32_t MONITOR_SUPPLY_MV = 3300;
+constexpr uint32_t MONITOR_SCAN_MA = 180;    // CPU and radio active, backlight off.
+constexpr uint32_t MONITOR_AWAKE_MA = 110;   // CPU active, backlight on, radio off.
+constexpr uint32_t MONITOR_STANDBY_MA = 12;  // SAMD51 standby, radio off, backlight off.
+
+// States whose time is accounted for separately.
+enum MonitorState : uint8_t {
+  MONITOR_STATE_AWAKE = 0,   // Screen on, radio off; user interaction or housekeeping.
+  MONITOR_STATE_SCAN = 1,    // Radio on for a scan.
+  MONITOR_STATE_STANDBY = 2, // Asleep.
+  MONITOR_NUM_STATES = 3
+};
+
+struct MonitorStats {
+  uint32_t scans;
+  uint32_t buttonWakes;        // Times standby was ended by a button instead of the RTC.
+  uint64_t stateTicks[MONITOR_NUM_STATES]; // Time spent in each state; RTC ticks (1/1024 s).
+  uint64_t energyMicroJoules;  // Estimated total energy since monitorBegin().
+};
+
+// Wake from standby when the button on `pin` is pressed. Call for each button before
+// monitorBegin().
+extern void monitorWakeOnPin(uint8_t pin);
+// Configure the RTC and button wake sources, turn the radio off, and schedule the first scan
+// MONITOR_SCAN_INTERVAL_SECS from now. Call once from setup(). Returns false if this platform
+// doesn't support standby (in which case monitorSleep() just idles until the next scan is due).
+extern bool monitorBegin();
+
+// True if it's time for the next scheduled scan.
+extern bool monitorScanDue();
+// Bracket a scan: powers the radio up, and back down when it's done. monitorScanEnd() also
+// schedules the next scan.
+extern void monitorScanStart();
+extern void monitorScanEnd();
+
+extern void monitorSetBacklight(bool on);
+// Sleep in standby until the next scan is due or a button is pressed. Returns true if it was
+// woken by a button.
+extern bool monitorSleep();
+
+// Duty cycle (time with radio or screen on / total time), in tenths of a percent.
+extern uint32_t monitorDutyCyclePermille();
+// Average estimated energy per scan, including the sleep between scans.
+extern uint32_t monitorEnergyPerScanMicroJoules();
+extern const MonitorStats &monitorStats();
+
+// RTC ticks since monitorBegin(). Wraps after about 48 days.
+extern uint32_t rtcTicks();
+
+#endif
@@ -0,0 +1,5992 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// GENERATED by tools/gen-oui-table.py; do not edit. Included only by oui.cpp.
+// Source: IEEE MA-L registry (oui.txt), as bundled in netaddr 1.3.0
+// 5581 OUIs, 31 vendor names.
+
+#ifndef _OUI_TABLE_H
+#define _OUI_TABLE_H
+
+static constexpr size_t OUI_TABLE_LEN = 5581;
+
+// Sorted 24-bit OUIs, big-endian.
+static const uint8_t ouiKeys[OUI_TABLE_LEN][3] = {
+  { 0x00, 0x00, 0x0C },
+  { 0x00, 0x01, 0x42 },
+  { 0x00, 0x01, 0x43 },
+  { 0x00, 0x01, 0x63 },
+  { 0x00, 0x01, 0x64 },
+  { 0x00, 0x01, 0x96 },
+  { 0x00, 0x01, 0x97 },
+  { 0x00, 0x01, 0xC7 },
+  { 0x00, 0x01, 0xC9 },
+  { 0x00, 0x02, 0x16 },
+  { 0x00, 0x02, 0x17 },
+  { 0x00, 0x02, 0x3D },
+  { 0x00, 0x02, 0x4A },
+  { 0x00, 0x02, 0x4B },
+  { 0x00, 0x02, 0x7D },
+  { 0x00, 0x02, 0x7E },
+  { 0x00, 0x02, 0xB9 },
+  { 0x00, 0x02, 0xBA },
+  { 0x00, 0x02, 0xFC },
+  { 0x00, 0x02, 0xFD },
+  { 0x00, 0x03, 0x31 },
+  { 0x00, 0x03, 0x32 },
+  { 0x00, 0x03, 0x6B },
+  { 0x00, 0x03, 0x6C },
+  { 0x00, 0x03, 0x93 },
+  { 0x00, 0x03, 0x9F },
+  { 0x00, 0x03, 0xA0 },
+  { 0x00, 0x03, 0xE3 },
+  { 0x00, 0x03, 0xE4 },
+  { 0x00, 0x03, 0xFD },
+  { 0x00, 0x03, 0xFE },
+  { 0x00, 0x03, 0xFF },
+  { 0x00, 0x04, 0x0E },
+  { 0x00, 0x04, 0x27 },
+  { 0x00, 0x04, 0x28 },
+  { 0x00, 0x04, 0x4D },
+  { 0x00, 0x04, 0x4E },
+  { 0x00, 0x04, 0x6D },
+  { 0x00, 0x04, 0x6E },
+  { 0x00, 0x04, 0x9A },
+  { 0x00, 0x04, 0x9B },
+  { 0x00, 0x04, 0xC0 },
+  { 0x00, 0x04, 0xC1 },
+  { 0x00, 0x04, 0xDD },
+  { 0x00, 0x04, 0xDE },
+  { 0x00, 0x05, 0x00 },
+  { 0x00, 0x05, 0x01 },
+  { 0x00, 0x05, 0x02 },
+  { 0x00, 0x05, 0x31 },
+  { 0x00, 0x05, 0x32 },
+  { 0x00, 0x05, 0x5D },
+  { 0x00, 0x05, 0x5E },
+  { 0x00, 0x05, 0x5F },
+  { 0x00, 0x05, 0x73 },
+  { 0x00, 0x05, 0x74 },
+  { 0x00, 0x05, 0x9A },
+  { 0x00, 0x05, 0x9B },
+  { 0x00, 0x05, 0xDC },
+  { 0x00, 0x05, 0xDD },
+  { 0x00, 0x06, 0x28 },
+  { 0x00, 0x06, 0x2A },
+  { 0x00, 0x06, 0x52 },
+  { 0x00, 0x06, 0x53 },
+  { 0x00, 0x06, 0x7C },
+  { 0x00, 0x06, 0xC1 },
+  { 0x00, 0x06, 0xD6 },
+  { 0x00, 0x06, 0xD7 },
+  { 0x00, 0x06, 0xF6 },
+  { 0x00, 0x07, 0x0D },
+  { 0x00, 0x07, 0x0E },
+  { 0x00, 0x07, 0x40 },
+  { 0x00, 0x07, 0x4F },
+  { 0x00, 0x07, 0x50 },
+  { 0x00, 0x07, 0x7D },
+  { 0x00, 0x07, 0x84 },
+  { 0x00, 0x07, 0x85 },
+  { 0x00, 0x07, 0xB3 },
+  { 0x00, 0x07, 0xB4 },
+  { 0x00, 0x07, 0xEB },
+  { 0x00, 0x07, 0xEC },
+  { 0x00, 0x08, 0x20 },
+  { 0x00, 0x08, 0x21 },
+  { 0x00, 0x08, 0x2F },
+  { 0x00, 0x08, 0x30 },
+  { 0x00, 0x08, 0x31 },
+  { 0x00, 0x08, 0x32 },
+  { 0x00, 0x08, 0x7C },
+  { 0x00, 0x08, 0x7D },
+  { 0x00, 0x08, 0xA3 },
+  { 0x00, 0x08, 0xA4 },
+  { 0x00, 0x08, 0xC2 },
+  { 0x00, 0x08, 0xE2 },
+  { 0x00, 0x08, 0xE3 },
+  { 0x00, 0x09, 0x0F },
+  { 0x00, 0x09, 0x11 },
+  { 0x00, 0x09, 0x12 },
+  { 0x00, 0x09, 0x43 },
+  { 0x00, 0x09, 0x44 },
+  { 0x00, 0x09, 0x5B },
+  { 0x00, 0x09, 0x7B },
+  { 0x00, 0x09, 0x7C },
+  { 0x00, 0x09, 0xB6 },
+  { 0x00, 0x09, 0xB7 },
+  { 0x00, 0x09, 0xBF },
+  { 0x00, 0x09, 0xE8 },
+  { 0x00, 0x09, 0xE9 },
+  { 0x00, 0x0A, 0x27 },
+  { 0x00, 0x0A, 0x41 },
+  { 0x00, 0x0A, 0x42 },
+  { 0x00, 0x0A, 0x8A },
+  { 0x00, 0x0A, 0x8B },
+  { 0x00, 0x0A, 0x95 },
+  { 0x00, 0x0A, 0xB7 },
+  { 0x00, 0x0A, 0xB8 },
+  { 0x00, 0x0A, 0xEB },
+  { 0x00, 0x0A, 0xF3 },
+  { 0x00, 0x0A, 0xF4 },
+  { 0x00, 0x0B, 0x45 },
+  { 0x00, 0x0B, 0x46 },
+  { 0x00, 0x0B, 0x5F },
+  { 0x00, 0x0B, 0x60 },
+  { 0x00, 0x0B, 0x85 },
+  { 0x00, 0x0B, 0x86 },
+  { 0x00, 0x0B, 0xBE },
+  { 0x00, 0x0B, 0xBF },
+  { 0x00, 0x0B, 0xFC },
+  { 0x00, 0x0B, 0xFD },
+  { 0x00, 0x0C, 0x30 },
+  { 0x00, 0x0C, 0x31 },
+  { 0x00, 0x0C, 0x41 },
+  { 0x00, 0x0C, 0x42 },
+  { 0x00, 0x0C, 0x6E },
+  { 0x00, 0x0C, 0x85 },
+  { 0x00, 0x0C, 0x86 },
+  { 0x00, 0x0C, 0xCE },
+  { 0x00, 0x0C, 0xCF },
+  { 0x00, 0x0C, 0xE6 },
+  { 0x00, 0x0D, 0x0B },
+  { 0x00, 0x0D, 0x28 },
+  { 0x00, 0x0D, 0x29 },
+  { 0x00, 0x0D, 0x4B },
+  { 0x00, 0x0D, 0x65 },
+  { 0x00, 0x0D, 0x66 },
+  { 0x00, 0x0D, 0x88 },
+  { 0x00, 0x0D, 0x93 },
+  { 0x00, 0x0D, 0xBC },
+  { 0x00, 0x0D, 0xBD },
+  { 0x00, 0x0D, 0xEC },
+  { 0x00, 0x0D, 0xED },
+  { 0x00, 0x0E, 0x08 },
+  { 0x00, 0x0E, 0x38 },
+  { 0x00, 0x0E, 0x39 },
+  { 0x00, 0x0E, 0x58 },
+  { 0x00, 0x0E, 0x83 },
+  { 0x00, 0x0E, 0x84 },
+  { 0x00, 0x0E, 0xA6 },
+  { 0x00, 0x0E, 0xD6 },
+  { 0x00, 0x0E, 0xD7 },
+  { 0x00, 0x0F, 0x23 },
+  { 0x00, 0x0F, 0x24 },
+  { 0x00, 0x0F, 0x34 },
+  { 0x00, 0x0F, 0x35 },
+  { 0x00, 0x0F, 0x3D },
+  { 0x00, 0x0F, 0x66 },
+  { 0x00, 0x0F, 0x8F },
+  { 0x00, 0x0F, 0x90 },
+  { 0x00, 0x0F, 0xB5 },
+  { 0x00, 0x0F, 0xF7 },
+  { 0x00, 0x0F, 0xF8 },
+  { 0x00, 0x10, 0x07 },
+  { 0x00, 0x10, 0x0B },
+  { 0x00, 0x10, 0x0D },
+  { 0x00, 0x10, 0x11 },
+  { 0x00, 0x10, 0x14 },
+  { 0x00, 0x10, 0x1F },
+  { 0x00, 0x10, 0x29 },
+  { 0x00, 0x10, 0x2F },
+  { 0x00, 0x10, 0x54 },
+  { 0x00, 0x10, 0x79 },
+  { 0x00, 0x10, 0x7B },
+  { 0x00, 0x10, 0xA6 },
+  { 0x00, 0x10, 0xF6 },
+  { 0x00, 0x10, 0xFA },
+  { 0x00, 0x10, 0xFF },
+  { 0x00, 0x11, 0x20 },
+  { 0x00, 0x11, 0x21 },
+  { 0x00, 0x11, 0x24 },
+  { 0x00, 0x11, 0x2F },
+  { 0x00, 0x11, 0x50 },
+  { 0x00, 0x11, 0x5C },
+  { 0x00, 0x11, 0x5D },
+  { 0x00, 0x11, 0x92 },
+  { 0x00, 0x11, 0x93 },
+  { 0x00, 0x11, 0x95 },
+  { 0x00, 0x11, 0xBB },
+  { 0x00, 0x11, 0xBC },
+  { 0x00, 0x11, 0xD8 },
+  { 0x00, 0x12, 0x00 },
+  { 0x00, 0x12, 0x01 },
+  { 0x00, 0x12, 0x17 },
+  { 0x00, 0x12, 0x43 },
+  { 0x00, 0x12, 0x44 },
+  { 0x00, 0x12, 0x5A },
+  { 0x00, 0x12, 0x7F },
+  { 0x00, 0x12, 0x80 },
+  { 0x00, 0x12, 0xD9 },
+  { 0x00, 0x12, 0xDA },
+  { 0x00, 0x13, 0x10 },
+  { 0x00, 0x13, 0x19 },
+  { 0x00, 0x13, 0x1A },
+  { 0x00, 0x13, 0x46 },
+  { 0x00, 0x13, 0x49 },
+  { 0x00, 0x13, 0x5F },
+  { 0x00, 0x13, 0x60 },
+  { 0x00, 0x13, 0x7F },
+  { 0x00, 0x13, 0x80 },
+  { 0x00, 0x13, 0x92 },
+  { 0x00, 0x13, 0xC3 },
+  { 0x00, 0x13, 0xC4 },
+  { 0x00, 0x13, 0xD4 },
+  { 0x00, 0x14, 0x1B },
+  { 0x00, 0x14, 0x1C },
+  { 0x00, 0x14, 0x51 },
+  { 0x00, 0x14, 0x69 },
+  { 0x00, 0x14, 0x6A },
+  { 0x00, 0x14, 0x6C },
+  { 0x00, 0x14, 0x78 },
+  { 0x00, 0x14, 0xA8 },
+  { 0x00, 0x14, 0xA9 },
+  { 0x00, 0x14, 0xBF },
+  { 0x00, 0x14, 0xF1 },
+  { 0x00, 0x14, 0xF2 },
+  { 0x00, 0x15, 0x0C },
+  { 0x00, 0x15, 0x2B },
+  { 0x00, 0x15, 0x2C },
+  { 0x00, 0x15, 0x5D },
+  { 0x00, 0x15, 0x62 },
+  { 0x00, 0x15, 0x63 },
+  { 0x00, 0x15, 0x6D },
+  { 0x00, 0x15, 0xC6 },
+  { 0x00, 0x15, 0xC7 },
+  { 0x00, 0x15, 0xE9 },
+  { 0x00, 0x15, 0xEB },
+  { 0x00, 0x15, 0xF2 },
+  { 0x00, 0x15, 0xF9 },
+  { 0x00, 0x15, 0xFA },
+  { 0x00, 0x16, 0x01 },
+  { 0x00, 0x16, 0x46 },
+  { 0x00, 0x16, 0x47 },
+  { 0x00, 0x16, 0x56 },
+  { 0x00, 0x16, 0x9C },
+  { 0x00, 0x16, 0x9D },
+  { 0x00, 0x16, 0xB6 },
+  { 0x00, 0x16, 0xC7 },
+  { 0x00, 0x16, 0xC8 },
+  { 0x00, 0x16, 0xCB },
+  { 0x00, 0x17, 0x0E },
+  { 0x00, 0x17, 0x0F },
+  { 0x00, 0x17, 0x31 },
+  { 0x00, 0x17, 0x3B },
+  { 0x00, 0x17, 0x3F },
+  { 0x00, 0x17, 0x59 },
+  { 0x00, 0x17, 0x5A },
+  { 0x00, 0x17, 0x94 },
+  { 0x00, 0x17, 0x95 },
+  { 0x00, 0x17, 0x9A },
+  { 0x00, 0x17, 0xAB },
+  { 0x00, 0x17, 0xDF },
+  { 0x00, 0x17, 0xE0 },
+  { 0x00, 0x17, 0xF2 },
+  { 0x00, 0x17, 0xFA },
+  { 0x00, 0x18, 0x0A },
+  { 0x00, 0x18, 0x18 },
+  { 0x00, 0x18, 0x19 },
+  { 0x00, 0x18, 0x39 },
+  { 0x00, 0x18, 0x4D },
+  { 0x00, 0x18, 0x68 },
+  { 0x00, 0x18, 0x73 },
+  { 0x00, 0x18, 0x74 },
+  { 0x00, 0x18, 0x82 },
+  { 0x00, 0x18, 0xB9 },
+  { 0x00, 0x18, 0xBA },
+  { 0x00, 0x18, 0xF3 },
+  { 0x00, 0x18, 0xF8 },
+  { 0x00, 0x19, 0x06 },
+  { 0x00, 0x19, 0x07 },
+  { 0x00, 0x19, 0x1D },
+  { 0x00, 0x19, 0x2F },
+  { 0x00, 0x19, 0x30 },
+  { 0x00, 0x19, 0x47 },
+  { 0x00, 0x19, 0x55 },
+  { 0x00, 0x19, 0x56 },
+  { 0x00, 0x19, 0x5B },
+  { 0x00, 0x19, 0xA9 },
+  { 0x00, 0x19, 0xAA },
+  { 0x00, 0x19, 0xC6 },
+  { 0x00, 0x19, 0xCB },
+  { 0x00, 0x19, 0xE0 },
+  { 0x00, 0x19, 0xE3 },
+  { 0x00, 0x19, 0xE7 },
+  { 0x00, 0x19, 0xE8 },
+  { 0x00, 0x19, 0xFD },
+  { 0x00, 0x1A, 0x11 },
+  { 0x00, 0x1A, 0x1E },
+  { 0x00, 0x1A, 0x2F },
+  { 0x00, 0x1A, 0x30 },
+  { 0x00, 0x1A, 0x4F },
+  { 0x00, 0x1A, 0x6C },
+  { 0x00, 0x1A, 0x6D },
+  { 0x00, 0x1A, 0x70 },
+  { 0x00, 0x1A, 0x92 },
+  { 0x00, 0x1A, 0xA1 },
+  { 0x00, 0x1A, 0xA2 },
+  { 0x00, 0x1A, 0xE2 },
+  { 0x00, 0x1A, 0xE3 },
+  { 0x00, 0x1A, 0xE9 },
+  { 0x00, 0x1B, 0x0C },
+  { 0x00, 0x1B, 0x0D },
+  { 0x00, 0x1B, 0x11 },
+  { 0x00, 0x1B, 0x2A },
+  { 0x00, 0x1B, 0x2B },
+  { 0x00, 0x1B, 0x2F },
+  { 0x00, 0x1B, 0x53 },
+  { 0x00, 0x1B, 0x54 },
+  { 0x00, 0x1B, 0x63 },
+  { 0x00, 0x1B, 0x67 },
+  { 0x00, 0x1B, 0x7A },
+  { 0x00, 0x1B, 0x8F },
+  { 0x00, 0x1B, 0x90 },
+  { 0x00, 0x1B, 0xD4 },
+  { 0x00, 0x1B, 0xD5 },
+  { 0x00, 0x1B, 0xD7 },
+  { 0x00, 0x1B, 0xEA },
+  { 0x00, 0x1B, 0xFC },
+  { 0x00, 0x1C, 0x0E },
+  { 0x00, 0x1C, 0x0F },
+  { 0x00, 0x1C, 0x10 },
+  { 0x00, 0x1C, 0x4A },
+  { 0x00, 0x1C, 0x57 },
+  { 0x00, 0x1C, 0x58 },
+  { 0x00, 0x1C, 0xB0 },
+  { 0x00, 0x1C, 0xB1 },
+  { 0x00, 0x1C, 0xB3 },
+  { 0x00, 0x1C, 0xBE },
+  { 0x00, 0x1C, 0xDF },
+  { 0x00, 0x1C, 0xF0 },
+  { 0x00, 0x1C, 0xF6 },
+  { 0x00, 0x1C, 0xF9 },
+  { 0x00, 0x1D, 0x0F },
+  { 0x00, 0x1D, 0x2E },
+  { 0x00, 0x1D, 0x45 },
+  { 0x00, 0x1D, 0x46 },
+  { 0x00, 0x1D, 0x4F },
+  { 0x00, 0x1D, 0x60 },
+  { 0x00, 0x1D, 0x70 },
+  { 0x00, 0x1D, 0x71 },
+  { 0x00, 0x1D, 0x73 },
+  { 0x00, 0x1D, 0x7E },
+  { 0x00, 0x1D, 0xA1 },
+  { 0x00, 0x1D, 0xA2 },
+  { 0x00, 0x1D, 0xBC },
+  { 0x00, 0x1D, 0xD8 },
+  { 0x00, 0x1D, 0xE5 },
+  { 0x00, 0x1D, 0xE6 },
+  { 0x00, 0x1E, 0x10 },
+  { 0x00, 0x1E, 0x13 },
+  { 0x00, 0x1E, 0x14 },
+  { 0x00, 0x1E, 0x2A },
+  { 0x00, 0x1E, 0x35 },
+  { 0x00, 0x1E, 0x49 },
+  { 0x00, 0x1E, 0x4A },
+  { 0x00, 0x1E, 0x52 },
+  { 0x00, 0x1E, 0x58 },
+  { 0x00, 0x1E, 0x6B },
+  { 0x00, 0x1E, 0x73 },
+  { 0x00, 0x1E, 0x79 },
+  { 0x00, 0x1E, 0x7A },
+  { 0x00, 0x1E, 0x8C },
+  { 0x00, 0x1E, 0xA9 },
+  { 0x00, 0x1E, 0xBD },
+  { 0x00, 0x1E, 0xBE },
+  { 0x00, 0x1E, 0xC2 },
+  { 0x00, 0x1E, 0xE5 },
+  { 0x00, 0x1E, 0xF6 },
+  { 0x00, 0x1E, 0xF7 },
+  { 0x00, 0x1F, 0x26 },
+  { 0x00, 0x1F, 0x27 },
+  { 0x00, 0x1F, 0x32 },
+  { 0x00, 0x1F, 0x33 },
+  { 0x00, 0x1F, 0x3F },
+  { 0x00, 0x1F, 0x41 },
+  { 0x00, 0x1F, 0x5B },
+  { 0x00, 0x1F, 0x6C },
+  { 0x00, 0x1F, 0x6D },
+  { 0x00, 0x1F, 0x9D },
+  { 0x00, 0x1F, 0x9E },
+  { 0x00, 0x1F, 0xC5 },
+  { 0x00, 0x1F, 0xC6 },
+  { 0x00, 0x1F, 0xC9 },
+  { 0x00, 0x1F, 0xCA },
+  { 0x00, 0x1F, 0xF3 },
+  { 0x00, 0x21, 0x1B },
+  { 0x00, 0x21, 0x1C },
+  { 0x00, 0x21, 0x27 },
+  { 0x00, 0x21, 0x29 },
+  { 0x00, 0x21, 0x47 },
+  { 0x00, 0x21, 0x55 },
+  { 0x00, 0x21, 0x56 },
+  { 0x00, 0x21, 0x91 },
+  { 0x00, 0x21, 0xA0 },
+  { 0x00, 0x21, 0xA1 },
+  { 0x00, 0x21, 0xBD },
+  { 0x00, 0x21, 0xBE },
+  { 0x00, 0x21, 0xD7 },
+  { 0x00, 0x21, 0xD8 },
+  { 0x00, 0x21, 0xE9 },
+  { 0x00, 0x22, 0x0C },
+  { 0x00, 0x22, 0x0D },
+  { 0x00, 0x22, 0x15 },
+  { 0x00, 0x22, 0x3A },
+  { 0x00, 0x22, 0x3F },
+  { 0x00, 0x22, 0x41 },
+  { 0x00, 0x22, 0x48 },
+  { 0x00, 0x22, 0x4C },
+  { 0x00, 0x22, 0x55 },
+  { 0x00, 0x22, 0x56 },
+  { 0x00, 0x22, 0x6B },
+  { 0x00, 0x22, 0x75 },
+  { 0x00, 0x22, 0x7F },
+  { 0x00, 0x22, 0x90 },
+  { 0x00, 0x22, 0x91 },
+  { 0x00, 0x22, 0x93 },
+  { 0x00, 0x22, 0xAA },
+  { 0x00, 0x22, 0xB0 },
+  { 0x00, 0x22, 0xBD },
+  { 0x00, 0x22, 0xBE },
+  { 0x00, 0x22, 0xCE },
+  { 0x00, 0x22, 0xD7 },
+  { 0x00, 0x23, 0x04 },
+  { 0x00, 0x23, 0x05 },
+  { 0x00, 0x23, 0x12 },
+  { 0x00, 0x23, 0x31 },
+  { 0x00, 0x23, 0x32 },
+  { 0x00, 0x23, 0x33 },
+  { 0x00, 0x23, 0x34 },
+  { 0x00, 0x23, 0x54 },
+  { 0x00, 0x23, 0x5D },
+  { 0x00, 0x23, 0x5E },
+  { 0x00, 0x23, 0x69 },
+  { 0x00, 0x23, 0x6C },
+  { 0x00, 0x23, 0xAB },
+  { 0x00, 0x23, 0xAC },
+  { 0x00, 0x23, 0xBE },
+  { 0x00, 0x23, 0xCC },
+  { 0x00, 0x23, 0xCD },
+  { 0x00, 0x23, 0xDF },
+  { 0x00, 0x23, 0xEA },
+  { 0x00, 0x23, 0xEB },
+  { 0x00, 0x23, 0xF8 },
+  { 0x00, 0x24, 0x01 },
+  { 0x00, 0x24, 0x13 },
+  { 0x00, 0x24, 0x14 },
+  { 0x00, 0x24, 0x1E },
+  { 0x00, 0x24, 0x36 },
+  { 0x00, 0x24, 0x44 },
+  { 0x00, 0x24, 0x50 },
+  { 0x00, 0x24, 0x51 },
+  { 0x00, 0x24, 0x6C },
+  { 0x00, 0x24, 0x82 },
+  { 0x00, 0x24, 0x8C },
+  { 0x00, 0x24, 0x97 },
+  { 0x00, 0x24, 0x98 },
+  { 0x00, 0x24, 0xA5 },
+  { 0x00, 0x24, 0xB2 },
+  { 0x00, 0x24, 0xC3 },
+  { 0x00, 0x24, 0xC4 },
+  { 0x00, 0x24, 0xF3 },
+  { 0x00, 0x24, 0xF7 },
+  { 0x00, 0x24, 0xF9 },
+  { 0x00, 0x24, 0xFE },
+  { 0x00, 0x25, 0x00 },
+  { 0x00, 0x25, 0x12 },
+  { 0x00, 0x25, 0x2E },
+  { 0x00, 0x25, 0x45 },
+  { 0x00, 0x25, 0x46 },
+  { 0x00, 0x25, 0x4B },
+  { 0x00, 0x25, 0x68 },
+  { 0x00, 0x25, 0x83 },
+  { 0x00, 0x25, 0x84 },
+  { 0x00, 0x25, 0x86 },
+  { 0x00, 0x25, 0x9C },
+  { 0x00, 0x25, 0x9E },
+  { 0x00, 0x25, 0xA0 },
+  { 0x00, 0x25, 0xAE },
+  { 0x00, 0x25, 0xB4 },
+  { 0x00, 0x25, 0xB5 },
+  { 0x00, 0x25, 0xBC },
+  { 0x00, 0x25, 0xC4 },
+  { 0x00, 0x26, 0x08 },
+  { 0x00, 0x26, 0x0A },
+  { 0x00, 0x26, 0x0B },
+  { 0x00, 0x26, 0x18 },
+  { 0x00, 0x26, 0x4A },
+  { 0x00, 0x26, 0x51 },
+  { 0x00, 0x26, 0x52 },
+  { 0x00, 0x26, 0x59 },
+  { 0x00, 0x26, 0x5A },
+  { 0x00, 0x26, 0x98 },
+  { 0x00, 0x26, 0x99 },
+  { 0x00, 0x26, 0xB0 },
+  { 0x00, 0x26, 0xBB },
+  { 0x00, 0x26, 0xCA },
+  { 0x00, 0x26, 0xCB },
+  { 0x00, 0x26, 0xED },
+  { 0x00, 0x26, 0xF2 },
+  { 0x00, 0x27, 0x09 },
+  { 0x00, 0x27, 0x0C },
+  { 0x00, 0x27, 0x0D },
+  { 0x00, 0x27, 0x19 },
+  { 0x00, 0x27, 0x22 },
+  { 0x00, 0x27, 0x90 },
+  { 0x00, 0x27, 0xE3 },
+  { 0x00, 0x29, 0xC2 },
+  { 0x00, 0x2A, 0x10 },
+  { 0x00, 0x2A, 0x6A },
+  { 0x00, 0x2B, 0xF5 },
+  { 0x00, 0x2C, 0xC8 },
+  { 0x00, 0x2E, 0xC7 },
+  { 0x00, 0x2F, 0x5C },
+  { 0x00, 0x30, 0x19 },
+  { 0x00, 0x30, 0x24 },
+  { 0x00, 0x30, 0x40 },
+  { 0x00, 0x30, 0x65 },
+  { 0x00, 0x30, 0x71 },
+  { 0x00, 0x30, 0x78 },
+  { 0x00, 0x30, 0x7B },
+  { 0x00, 0x30, 0x80 },
+  { 0x00, 0x30, 0x85 },
+  { 0x00, 0x30, 0x94 },
+  { 0x00, 0x30, 0x96 },
+  { 0x00, 0x30, 0xA3 },
+  { 0x00, 0x30, 0xB6 },
+  { 0x00, 0x30, 0xBD },
+  { 0x00, 0x30, 0xF2 },
+  { 0x00, 0x31, 0x92 },
+  { 0x00, 0x32, 0x17 },
+  { 0x00, 0x33, 0x58 },
+  { 0x00, 0x34, 0xFE },
+  { 0x00, 0x35, 0x1A },
+  { 0x00, 0x38, 0xDF },
+  { 0x00, 0x3A, 0x7D },
+  { 0x00, 0x3A, 0x98 },
+  { 0x00, 0x3A, 0x99 },
+  { 0x00, 0x3A, 0x9A },
+  { 0x00, 0x3A, 0x9B },
+  { 0x00, 0x3A, 0x9C },
+  { 0x00, 0x3C, 0x10 },
+  { 0x00, 0x3E, 0x73 },
+  { 0x00, 0x3E, 0xE1 },
+  { 0x00, 0x40, 0x0B },
+  { 0x00, 0x40, 0x26 },
+  { 0x00, 0x40, 0x96 },
+  { 0x00, 0x41, 0xD2 },
+  { 0x00, 0x42, 0x5A },
+  { 0x00, 0x42, 0x68 },
+  { 0x00, 0x45, 0x1D },
+  { 0x00, 0x46, 0x4B },
+  { 0x00, 0x4A, 0x77 },
+  { 0x00, 0x4F, 0x1A },
+  { 0x00, 0x50, 0x0B },
+  { 0x00, 0x50, 0x0F },
+  { 0x00, 0x50, 0x14 },
+  { 0x00, 0x50, 0x2A },
+  { 0x00, 0x50, 0x3E },
+  { 0x00, 0x50, 0x50 },
+  { 0x00, 0x50, 0x53 },
+  { 0x00, 0x50, 0x54 },
+  { 0x00, 0x50, 0x73 },
+  { 0x00, 0x50, 0x80 },
+  { 0x00, 0x50, 0xA2 },
+  { 0x00, 0x50, 0xA7 },
+  { 0x00, 0x50, 0xBA },
+  { 0x00, 0x50, 0xBD },
+  { 0x00, 0x50, 0xD1 },
+  { 0x00, 0x50, 0xE2 },
+  { 0x00, 0x50, 0xE4 },
+  { 0x00, 0x50, 0xF0 },
+  { 0x00, 0x56, 0x2B },
+  { 0x00, 0x56, 0xCD },
+  { 0x00, 0x57, 0xD2 },
+  { 0x00, 0x59, 0xDC },
+  { 0x00, 0x5A, 0x13 },
+  { 0x00, 0x5B, 0x94 },
+  { 0x00, 0x5D, 0x73 },
+  { 0x00, 0x5F, 0x67 },
+  { 0x00, 0x5F, 0x86 },
+  { 0x00, 0x60, 0x09 },
+  { 0x00, 0x60, 0x2F },
+  { 0x00, 0x60, 0x3E },
+  { 0x00, 0x60, 0x47 },
+  { 0x00, 0x60, 0x5C },
+  { 0x00, 0x60, 0x70 },
+  { 0x00, 0x60, 0x83 },
+  { 0x00, 0x61, 0x51 },
+  { 0x00, 0x61, 0x71 },
+  { 0x00, 0x62, 0xEC },
+  { 0x00, 0x64, 0x40 },
+  { 0x00, 0x66, 0x4B },
+  { 0x00, 0x6B, 0x6F },
+  { 0x00, 0x6B, 0xF1 },
+  { 0x00, 0x6C, 0xBC },
+  { 0x00, 0x6D, 0x52 },
+  { 0x00, 0x71, 0x47 },
+  { 0x00, 0x72, 0x78 },
+  { 0x00, 0x76, 0x86 },
+  { 0x00, 0x77, 0x8D },
+  { 0x00, 0x78, 0x88 },
+  { 0x00, 0x7D, 0x60 },
+  { 0x00, 0x7E, 0x95 },
+  { 0x00, 0x80, 0xC8 },
+  { 0x00, 0x81, 0x2A },
+  { 0x00, 0x81, 0xC4 },
+  { 0x00, 0x84, 0x1E },
+  { 0x00, 0x87, 0x31 },
+  { 0x00, 0x87, 0x64 },
+  { 0x00, 0x88, 0x65 },
+  { 0x00, 0x8A, 0x76 },
+  { 0x00, 0x8A, 0x96 },
+  { 0x00, 0x8E, 0x73 },
+  { 0x00, 0x8E, 0xF2 },
+  { 0x00, 0x90, 0x0C },
+  { 0x00, 0x90, 0x21 },
+  { 0x00, 0x90, 0x2B },
+  { 0x00, 0x90, 0x5F },
+  { 0x00, 0x90, 0x6D },
+  { 0x00, 0x90, 0x6F },
+  { 0x00, 0x90, 0x86 },
+  { 0x00, 0x90, 0x92 },
+  { 0x00, 0x90, 0xA6 },
+  { 0x00, 0x90, 0xAB },
+  { 0x00, 0x90, 0xB1 },
+  { 0x00, 0x90, 0xBF },
+  { 0x00, 0x90, 0xD9 },
+  { 0x00, 0x90, 0xF2 },
+  { 0x00, 0x99, 0x1D },
+  { 0x00, 0x9A, 0xCD },
+  { 0x00, 0x9A, 0xD2 },
+  { 0x00, 0x9E, 0x1E },
+  { 0x00, 0x9E, 0xC8 },
+  { 0x00, 0xA0, 0x40 },
+  { 0x00, 0xA0, 0xC5 },
+  { 0x00, 0xA2, 0x89 },
+  { 0x00, 0xA2, 0xEE },
+  { 0x00, 0xA3, 0x8E },
+  { 0x00, 0xA3, 0xD1 },
+  { 0x00, 0xA5, 0xBF },
+  { 0x00, 0xA6, 0xCA },
+  { 0x00, 0xA7, 0x42 },
+  { 0x00, 0xAA, 0x6E },
+  { 0x00, 0xAD, 0x24 },
+  { 0x00, 0xAF, 0x1F },
+  { 0x00, 0xB0, 0x4A },
+  { 0x00, 0xB0, 0x64 },
+  { 0x00, 0xB0, 0x8E },
+  { 0x00, 0xB0, 0xC2 },
+  { 0x00, 0xB0, 0xE1 },
+  { 0x00, 0xB1, 0xE3 },
+  { 0x00, 0xB3, 0x62 },
+  { 0x00, 0xB6, 0x70 },
+  { 0x00, 0xB7, 0x71 },
+  { 0x00, 0xB8, 0xB3 },
+  { 0x00, 0xBB, 0x3A },
+  { 0x00, 0xBC, 0x60 },
+  { 0x00, 0xBE, 0x3B },
+  { 0x00, 0xBE, 0x75 },
+  { 0x00, 0xBF, 0x77 },
+  { 0x00, 0xC1, 0x64 },
+  { 0x00, 0xC1, 0xB1 },
+  { 0x00, 0xC3, 0x0A },
+  { 0x00, 0xC5, 0x85 },
+  { 0x00, 0xC6, 0x10 },
+  { 0x00, 0xC8, 0x8B },
+  { 0x00, 0xCA, 0xE5 },
+  { 0x00, 0xCC, 0xFC },
+  { 0x00, 0xCD, 0xFE },
+  { 0x00, 0xD0, 0x06 },
+  { 0x00, 0xD0, 0x58 },
+  { 0x00, 0xD0, 0x63 },
+  { 0x00, 0xD0, 0x79 },
+  { 0x00, 0xD0, 0x90 },
+  { 0x00, 0xD0, 0x97 },
+  { 0x00, 0xD0, 0xBA },
+  { 0x00, 0xD0, 0xBB },
+  { 0x00, 0xD0, 0xBC },
+  { 0x00, 0xD0, 0xC0 },
+  { 0x00, 0xD0, 0xD3 },
+  { 0x00, 0xD0, 0xE4 },
+  { 0x00, 0xD0, 0xFF },
+  { 0x00, 0xD6, 0xFE },
+  { 0x00, 0xD7, 0x8F },
+  { 0x00, 0xDA, 0x55 },
+  { 0x00, 0xDB, 0x70 },
+  { 0x00, 0xDE, 0xFB },
+  { 0x00, 0xDF, 0x1D },
+  { 0x00, 0xE0, 0x14 },
+  { 0x00, 0xE0, 0x18 },
+  { 0x00, 0xE0, 0x1E },
+  { 0x00, 0xE0, 0x34 },
+  { 0x00, 0xE0, 0x4C },
+  { 0x00, 0xE0, 0x4F },
+  { 0x00, 0xE0, 0x8F },
+  { 0x00, 0xE0, 0xA3 },
+  { 0x00, 0xE0, 0xB0 },
+  { 0x00, 0xE0, 0xF7 },
+  { 0x00, 0xE0, 0xF9 },
+  { 0x00, 0xE0, 0xFC },
+  { 0x00, 0xE0, 0xFE },
+  { 0x00, 0xE1, 0x6D },
+  { 0x00, 0xE4, 0x06 },
+  { 0x00, 0xE5, 0xF1 },
+  { 0x00, 0xE6, 0x3A },
+  { 0x00, 0xE7, 0xE3 },
+  { 0x00, 0xEA, 0xBD },
+  { 0x00, 0xEB, 0xD5 },
+  { 0x00, 0xEC, 0x0A },
+  { 0x00, 0xEE, 0xAB },
+  { 0x00, 0xF2, 0x8B },
+  { 0x00, 0xF3, 0x61 },
+  { 0x00, 0xF3, 0x9F },
+  { 0x00, 0xF4, 0xB9 },
+  { 0x00, 0xF6, 0x20 },
+  { 0x00, 0xF6, 0x63 },
+  { 0x00, 0xF7, 0x6F },
+  { 0x00, 0xF7, 0xAD },
+  { 0x00, 0xF8, 0x1C },
+  { 0x00, 0xF8, 0x2C },
+  { 0x00, 0xF9, 0x52 },
+  { 0x00, 0xFC, 0x8B },
+  { 0x00, 0xFC, 0xBA },
+  { 0x00, 0xFD, 0x22 },
+  { 0x00, 0xFE, 0xC8 },
+  { 0x04, 0x02, 0x1F },
+  { 0x04, 0x03, 0xD6 },
+  { 0x04, 0x0C, 0xCE },
+  { 0x04, 0x10, 0x6B },
+  { 0x04, 0x14, 0x71 },
+  { 0x04, 0x15, 0x52 },
+  { 0x04, 0x18, 0x92 },
+  { 0x04, 0x18, 0xD6 },
+  { 0x04, 0x1D, 0xC7 },
+  { 0x04, 0x1E, 0x64 },
+  { 0x04, 0x20, 0x84 },
+  { 0x04, 0x25, 0xC5 },
+  { 0x04, 0x26, 0x65 },
+  { 0x04, 0x27, 0x28 },
+  { 0x04, 0x27, 0x58 },
+  { 0x04, 0x2A, 0xE2 },
+  { 0x04, 0x33, 0x89 },
+  { 0x04, 0x42, 0x1A },
+  { 0x04, 0x48, 0x9A },
+  { 0x04, 0x4A, 0x6C },
+  { 0x04, 0x4B, 0xED },
+  { 0x04, 0x4F, 0x4C },
+  { 0x04, 0x4F, 0xAA },
+  { 0x04, 0x52, 0xF3 },
+  { 0x04, 0x54, 0x53 },
+  { 0x04, 0x5F, 0xB9 },
+  { 0x04, 0x62, 0x73 },
+  { 0x04, 0x68, 0x65 },
+  { 0x04, 0x69, 0xF8 },
+  { 0x04, 0x6C, 0x9D },
+  { 0x04, 0x6E, 0xCB },
+  { 0x04, 0x72, 0x95 },
+  { 0x04, 0x75, 0x03 },
+  { 0x04, 0x76, 0xB0 },
+  { 0x04, 0x79, 0x70 },
+  { 0x04, 0x88, 0x5F },
+  { 0x04, 0x8C, 0x16 },
+  { 0x04, 0x92, 0x26 },
+  { 0x04, 0x95, 0x73 },
+  { 0x04, 0x99, 0xB9 },
+  { 0x04, 0x99, 0xBB },
+  { 0x04, 0x9D, 0x05 },
+  { 0x04, 0x9F, 0xCA },
+  { 0x04, 0xA1, 0x51 },
+  { 0x04, 0xA7, 0x41 },
+  { 0x04, 0xA8, 0x1C },
+  { 0x04, 0xB0, 0xE7 },
+  { 0x04, 0xB1, 0x67 },
+  { 0x04, 0xB4, 0xFE },
+  { 0x04, 0xBA, 0xD6 },
+  { 0x04, 0xBC, 0x6D },
+  { 0x04, 0xBD, 0x70 },
+  { 0x04, 0xBD, 0x88 },
+  { 0x04, 0xBD, 0x97 },
+  { 0x04, 0xBF, 0x6D },
+  { 0x04, 0xC0, 0x6F },
+  { 0x04, 0xC5, 0xA4 },
+  { 0x04, 0xC8, 0x07 },
+  { 0x04, 0xCA, 0xED },
+  { 0x04, 0xCC, 0xBC },
+  { 0x04, 0xD1, 0x3A },
+  { 0x04, 0xD3, 0xCF },
+  { 0x04, 0xD4, 0xC4 },
+  { 0x04, 0xD5, 0x90 },
+  { 0x04, 0xD9, 0xF5 },
+  { 0x04, 0xDA, 0xD2 },
+  { 0x04, 0xDB, 0x56 },
+  { 0x04, 0xE5, 0x36 },
+  { 0x04, 0xE5, 0x98 },
+  { 0x04, 0xE7, 0x95 },
+  { 0x04, 0xEB, 0x40 },
+  { 0x04, 0xF1, 0x3E },
+  { 0x04, 0xF3, 0x52 },
+  { 0x04, 0xF7, 0xE4 },
+  { 0x04, 0xF9, 0x38 },
+  { 0x04, 0xF9, 0xF8 },
+  { 0x04, 0xFE, 0x7F },
+  { 0x04, 0xFE, 0x8D },
+  { 0x08, 0x00, 0x07 },
+  { 0x08, 0x02, 0x05 },
+  { 0x08, 0x02, 0x8E },
+  { 0x08, 0x05, 0x81 },
+  { 0x08, 0x12, 0xA5 },
+  { 0x08, 0x17, 0x35 },
+  { 0x08, 0x18, 0x1A },
+  { 0x08, 0x19, 0xA6 },
+  { 0x08, 0x1C, 0x6E },
+  { 0x08, 0x1F, 0x71 },
+  { 0x08, 0x1F, 0xF3 },
+  { 0x08, 0x23, 0xC6 },
+  { 0x08, 0x25, 0x25 },
+  { 0x08, 0x25, 0x73 },
+  { 0x08, 0x26, 0x97 },
+  { 0x08, 0x2C, 0xB6 },
+  { 0x08, 0x2F, 0xE9 },
+  { 0x08, 0x31, 0x8B },
+  { 0x08, 0x36, 0xC9 },
+  { 0x08, 0x3A, 0x8D },
+  { 0x08, 0x3A, 0xF2 },
+  { 0x08, 0x3F, 0xBC },
+  { 0x08, 0x44, 0x73 },
+  { 0x08, 0x45, 0xD1 },
+  { 0x08, 0x4F, 0x0A },
+  { 0x08, 0x4F, 0xA9 },
+  { 0x08, 0x4F, 0xF9 },
+  { 0x08, 0x55, 0x31 },
+  { 0x08, 0x57, 0x00 },
+  { 0x08, 0x57, 0xFB },
+  { 0x08, 0x5A, 0x11 },
+  { 0x08, 0x5B, 0x0E },
+  { 0x08, 0x5C, 0x1B },
+  { 0x08, 0x60, 0x6E },
+  { 0x08, 0x60, 0x83 },
+  { 0x08, 0x62, 0x66 },
+  { 0x08, 0x63, 0x61 },
+  { 0x08, 0x65, 0x18 },
+  { 0x08, 0x66, 0x98 },
+  { 0x08, 0x6A, 0xE5 },
+  { 0x08, 0x6D, 0x41 },
+  { 0x08, 0x70, 0x45 },
+  { 0x08, 0x70, 0x73 },
+  { 0x08, 0x74, 0x02 },
+  { 0x08, 0x79, 0x8C },
+  { 0x08, 0x7A, 0x4C },
+  { 0x08, 0x7B, 0x87 },
+  { 0x08, 0x7C, 0x39 },
+  { 0x08, 0x80, 0x39 },
+  { 0x08, 0x84, 0x9D },
+  { 0x08, 0x86, 0x3B },
+  { 0x08, 0x87, 0xC7 },
+  { 0x08, 0x8E, 0xDC },
+  { 0x08, 0x91, 0x15 },
+  { 0x08, 0x91, 0xA3 },
+  { 0x08, 0x93, 0x56 },
+  { 0x08, 0x95, 0x42 },
+  { 0x08, 0x96, 0xAD },
+  { 0x08, 0x96, 0xD7 },
+  { 0x08, 0x9A, 0xC7 },
+  { 0x08, 0x9E, 0x08 },
+  { 0x08, 0x9E, 0x84 },
+  { 0x08, 0xA6, 0xBC },
+  { 0x08, 0xAA, 0x89 },
+  { 0x08, 0xB4, 0xB1 },
+  { 0x08, 0xB6, 0x1F },
+  { 0x08, 0xBD, 0x43 },
+  { 0x08, 0xBF, 0xB8 },
+  { 0x08, 0xC0, 0x21 },
+  { 0x08, 0xC2, 0x24 },
+  { 0x08, 0xC7, 0x29 },
+  { 0x08, 0xCC, 0x68 },
+  { 0x08, 0xCC, 0xA7 },
+  { 0x08, 0xD0, 0x9F },
+  { 0x08, 0xD1, 0xF9 },
+  { 0x08, 0xE6, 0x3B },
+  { 0x08, 0xE6, 0x89 },
+  { 0x08, 0xE8, 0x4F },
+  { 0x08, 0xEB, 0xF6 },
+  { 0x08, 0xEC, 0xF5 },
+  { 0x08, 0xF1, 0xB3 },
+  { 0x08, 0xF3, 0xFB },
+  { 0x08, 0xF4, 0xAB },
+  { 0x08, 0xF6, 0x06 },
+  { 0x08, 0xF6, 0x9C },
+  { 0x08, 0xF8, 0xBC },
+  { 0x08, 0xF9, 0xE0 },
+  { 0x08, 0xFA, 0x28 },
+  { 0x08, 0xFF, 0x44 },
+  { 0x0C, 0x01, 0x4B },
+  { 0x0C, 0x0E, 0x76 },
+  { 0x0C, 0x11, 0x67 },
+  { 0x0C, 0x12, 0x62 },
+  { 0x0C, 0x15, 0x39 },
+  { 0x0C, 0x18, 0x4E },
+  { 0x0C, 0x19, 0xF8 },
+  { 0x0C, 0x1D, 0xAF },
+  { 0x0C, 0x23, 0x8D },
+  { 0x0C, 0x27, 0x24 },
+  { 0x0C, 0x2C, 0x54 },
+  { 0x0C, 0x2E, 0x57 },
+  { 0x0C, 0x30, 0x21 },
+  { 0x0C, 0x31, 0xDC },
+  { 0x0C, 0x35, 0x26 },
+  { 0x0C, 0x37, 0x47 },
+  { 0x0C, 0x37, 0xDC },
+  { 0x0C, 0x3B, 0x50 },
+  { 0x0C, 0x3E, 0x9F },
+  { 0x0C, 0x41, 0x3E },
+  { 0x0C, 0x41, 0xE9 },
+  { 0x0C, 0x43, 0xF9 },
+  { 0x0C, 0x45, 0xBA },
+  { 0x0C, 0x47, 0xC9 },
+  { 0x0C, 0x4B, 0x54 },
+  { 0x0C, 0x4D, 0xE9 },
+  { 0x0C, 0x4F, 0x9B },
+  { 0x0C, 0x51, 0x01 },
+  { 0x0C, 0x51, 0x7E },
+  { 0x0C, 0x53, 0xB7 },
+  { 0x0C, 0x67, 0x43 },
+  { 0x0C, 0x68, 0x03 },
+  { 0x0C, 0x6A, 0xC4 },
+  { 0x0C, 0x70, 0x4A },
+  { 0x0C, 0x72, 0x2C },
+  { 0x0C, 0x72, 0x74 },
+  { 0x0C, 0x72, 0xD9 },
+  { 0x0C, 0x74, 0xC2 },
+  { 0x0C, 0x75, 0xBD },
+  { 0x0C, 0x77, 0x1A },
+  { 0x0C, 0x7B, 0xC8 },
+  { 0x0C, 0x80, 0x63 },
+  { 0x0C, 0x82, 0x68 },
+  { 0x0C, 0x84, 0x08 },
+  { 0x0C, 0x85, 0x25 },
+  { 0x0C, 0x8B, 0x95 },
+  { 0x0C, 0x8D, 0xDB },
+  { 0x0C, 0x8F, 0xFF },
+  { 0x0C, 0x96, 0xBF },
+  { 0x0C, 0x97, 0x5F },
+  { 0x0C, 0x98, 0x38 },
+  { 0x0C, 0x9D, 0x92 },
+  { 0x0C, 0xAF, 0x31 },
+  { 0x0C, 0xB5, 0x27 },
+  { 0x0C, 0xB6, 0xD2 },
+  { 0x0C, 0xB8, 0x15 },
+  { 0x0C, 0xBC, 0x9F },
+  { 0x0C, 0xC4, 0x13 },
+  { 0x0C, 0xC6, 0xCC },
+  { 0x0C, 0xC6, 0xFD },
+  { 0x0C, 0xD0, 0xF8 },
+  { 0x0C, 0xD5, 0xD3 },
+  { 0x0C, 0xD6, 0xBD },
+  { 0x0C, 0xD7, 0x46 },
+  { 0x0C, 0xD9, 0x96 },
+  { 0x0C, 0xDB, 0xEA },
+  { 0x0C, 0xDC, 0x7E },
+  { 0x0C, 0xDC, 0x91 },
+  { 0x0C, 0xE4, 0x41 },
+  { 0x0C, 0xE5, 0xB5 },
+  { 0x0C, 0xE7, 0x25 },
+  { 0x0C, 0xEE, 0x99 },
+  { 0x0C, 0xF3, 0x46 },
+  { 0x0C, 0xF4, 0xD5 },
+  { 0x0C, 0xF5, 0xA4 },
+  { 0x0C, 0xFC, 0x18 },
+  { 0x10, 0x00, 0x20 },
+  { 0x10, 0x01, 0x77 },
+  { 0x10, 0x05, 0xCA },
+  { 0x10, 0x06, 0x1C },
+  { 0x10, 0x06, 0xED },
+  { 0x10, 0x09, 0xF9 },
+  { 0x10, 0x0C, 0x6B },
+  { 0x10, 0x0D, 0x7F },
+  { 0x10, 0x10, 0x81 },
+  { 0x10, 0x12, 0xD0 },
+  { 0x10, 0x1B, 0x54 },
+  { 0x10, 0x1C, 0x0C },
+  { 0x10, 0x24, 0x07 },
+  { 0x10, 0x27, 0xF5 },
+  { 0x10, 0x29, 0x59 },
+  { 0x10, 0x2A, 0xB3 },
+  { 0x10, 0x2F, 0x6B },
+  { 0x10, 0x30, 0x25 },
+  { 0x10, 0x32, 0x1D },
+  { 0x10, 0x3C, 0x59 },
+  { 0x10, 0x3F, 0x44 },
+  { 0x10, 0x40, 0xF3 },
+  { 0x10, 0x41, 0x7F },
+  { 0x10, 0x44, 0x00 },
+  { 0x10, 0x47, 0x80 },
+  { 0x10, 0x4F, 0x58 },
+  { 0x10, 0x51, 0x72 },
+  { 0x10, 0x52, 0x1C },
+  { 0x10, 0x59, 0x32 },
+  { 0x10, 0x5F, 0x49 },
+  { 0x10, 0x62, 0xEB },
+  { 0x10, 0x6F, 0x3F },
+  { 0x10, 0x71, 0xB3 },
+  { 0x10, 0x7B, 0x44 },
+  { 0x10, 0x7B, 0xEF },
+  { 0x10, 0x7C, 0x61 },
+  { 0x10, 0x8C, 0xCF },
+  { 0x10, 0x8F, 0xFE },
+  { 0x10, 0x91, 0xA8 },
+  { 0x10, 0x93, 0xE9 },
+  { 0x10, 0x94, 0xBB },
+  { 0x10, 0x96, 0x93 },
+  { 0x10, 0x97, 0xBD },
+  { 0x10, 0x9A, 0xDD },
+  { 0x10, 0x9F, 0x41 },
+  { 0x10, 0xA2, 0xD3 },
+  { 0x10, 0xA4, 0xDA },
+  { 0x10, 0xA8, 0x29 },
+  { 0x10, 0xAE, 0x60 },
+  { 0x10, 0xB1, 0xF8 },
+  { 0x10, 0xB3, 0xC6 },
+  { 0x10, 0xB3, 0xD5 },
+  { 0x10, 0xB3, 0xD6 },
+  { 0x10, 0xB5, 0x88 },
+  { 0x10, 0xB9, 0xC4 },
+  { 0x10, 0xBD, 0x18 },
+  { 0x10, 0xBD, 0x3A },
+  { 0x10, 0xBE, 0xF5 },
+  { 0x10, 0xBF, 0x48 },
+  { 0x10, 0xBF, 0x67 },
+  { 0x10, 0xC1, 0x72 },
+  { 0x10, 0xC3, 0x7B },
+  { 0x10, 0xC3, 0xAB },
+  { 0x10, 0xC6, 0x1F },
+  { 0x10, 0xCE, 0x02 },
+  { 0x10, 0xCE, 0xE9 },
+  { 0x10, 0xCF, 0x0F },
+  { 0x10, 0xD0, 0xAB },
+  { 0x10, 0xDA, 0x43 },
+  { 0x10, 0xDD, 0xB1 },
+  { 0x10, 0xE2, 0xC9 },
+  { 0x10, 0xEA, 0x59 },
+  { 0x10, 0xF0, 0x68 },
+  { 0x10, 0xF3, 0x11 },
+  { 0x10, 0xF9, 0x20 },
+  { 0x10, 0xFE, 0xED },
+  { 0x14, 0x00, 0x7D },
+  { 0x14, 0x09, 0xB4 },
+  { 0x14, 0x09, 0xDC },
+  { 0x14, 0x0A, 0xC5 },
+  { 0x14, 0x10, 0x9F },
+  { 0x14, 0x13, 0xFB },
+  { 0x14, 0x16, 0x9D },
+  { 0x14, 0x1A, 0x97 },
+  { 0x14, 0x20, 0x5E },
+  { 0x14, 0x22, 0x3B },
+  { 0x14, 0x23, 0x0A },
+  { 0x14, 0x28, 0x76 },
+  { 0x14, 0x2B, 0x2F },
+  { 0x14, 0x2D, 0x4D },
+  { 0x14, 0x30, 0x04 },
+  { 0x14, 0x33, 0x75 },
+  { 0x14, 0x3C, 0xC3 },
+  { 0x14, 0x3E, 0xBF },
+  { 0x14, 0x46, 0x58 },
+  { 0x14, 0x49, 0x20 },
+  { 0x14, 0x49, 0xD4 },
+  { 0x14, 0x57, 0x9F },
+  { 0x14, 0x59, 0xC0 },
+  { 0x14, 0x5A, 0x05 },
+  { 0x14, 0x5F, 0x94 },
+  { 0x14, 0x60, 0x80 },
+  { 0x14, 0x60, 0xCB },
+  { 0x14, 0x65, 0x6A },
+  { 0x14, 0x6B, 0x9A },
+  { 0x14, 0x75, 0x90 },
+  { 0x14, 0x7D, 0xDA },
+  { 0x14, 0x7F, 0xCE },
+  { 0x14, 0x84, 0x73 },
+  { 0x14, 0x85, 0x09 },
+  { 0x14, 0x86, 0x92 },
+  { 0x14, 0x87, 0x6A },
+  { 0x14, 0x88, 0xE6 },
+  { 0x14, 0x89, 0xCB },
+  { 0x14, 0x8C, 0x4A },
+  { 0x14, 0x8F, 0xC6 },
+  { 0x14, 0x91, 0x38 },
+  { 0x14, 0x91, 0x82 },
+  { 0x14, 0x94, 0x6C },
+  { 0x14, 0x95, 0xCE },
+  { 0x14, 0x98, 0x77 },
+  { 0x14, 0x99, 0x3E },
+  { 0x14, 0x99, 0xE2 },
+  { 0x14, 0x9A, 0x10 },
+  { 0x14, 0x9D, 0x09 },
+  { 0x14, 0x9D, 0x99 },
+  { 0x14, 0x9F, 0x43 },
+  { 0x14, 0xA0, 0xF8 },
+  { 0x14, 0xA2, 0xA0 },
+  { 0x14, 0xA5, 0x1A },
+  { 0x14, 0xAB, 0x02 },
+  { 0x14, 0xAB, 0xEC },
+  { 0x14, 0xB9, 0x68 },
+  { 0x14, 0xBD, 0x61 },
+  { 0x14, 0xC1, 0x4E },
+  { 0x14, 0xC2, 0x13 },
+  { 0x14, 0xC8, 0x8B },
+  { 0x14, 0xCA, 0x56 },
+  { 0x14, 0xCB, 0x65 },
+  { 0x14, 0xCC, 0x20 },
+  { 0x14, 0xCF, 0x92 },
+  { 0x14, 0xD0, 0x0D },
+  { 0x14, 0xD1, 0x1F },
+  { 0x14, 0xD1, 0x69 },
+  { 0x14, 0xD1, 0x9E },
+  { 0x14, 0xD6, 0x4D },
+  { 0x14, 0xD8, 0x64 },
+  { 0x14, 0xDA, 0xE9 },
+  { 0x14, 0xDD, 0xA9 },
+  { 0x14, 0xE6, 0xE4 },
+  { 0x14, 0xEB, 0x08 },
+  { 0x14, 0xEB, 0xB6 },
+  { 0x14, 0xF2, 0x87 },
+  { 0x14, 0xF6, 0x5A },
+  { 0x18, 0x01, 0xF1 },
+  { 0x18, 0x02, 0x2D },
+  { 0x18, 0x0F, 0x76 },
+  { 0x18, 0x13, 0x2D },
+  { 0x18, 0x20, 0x32 },
+  { 0x18, 0x2A, 0x57 },
+  { 0x18, 0x2A, 0x7B },
+  { 0x18, 0x31, 0xBF },
+  { 0x18, 0x33, 0x9D },
+  { 0x18, 0x34, 0x51 },
+  { 0x18, 0x3D, 0x5E },
+  { 0x18, 0x3E, 0xEF },
+  { 0x18, 0x3F, 0x70 },
+  { 0x18, 0x44, 0xE6 },
+  { 0x18, 0x48, 0xBE },
+  { 0x18, 0x4A, 0x53 },
+  { 0x18, 0x4B, 0x0D },
+  { 0x18, 0x55, 0x0F },
+  { 0x18, 0x55, 0xE3 },
+  { 0x18, 0x56, 0x44 },
+  { 0x18, 0x56, 0xC3 },
+  { 0x18, 0x59, 0x33 },
+  { 0x18, 0x59, 0x36 },
+  { 0x18, 0x59, 0xF5 },
+  { 0x18, 0x5E, 0x0B },
+  { 0x18, 0x64, 0x72 },
+  { 0x18, 0x65, 0x90 },
+  { 0x18, 0x68, 0x6A },
+  { 0x18, 0x74, 0x2E },
+  { 0x18, 0x79, 0xFD },
+  { 0x18, 0x7A, 0x3B },
+  { 0x18, 0x7C, 0x0B },
+  { 0x18, 0x7E, 0xB9 },
+  { 0x18, 0x80, 0x90 },
+  { 0x18, 0x81, 0x0E },
+  { 0x18, 0x87, 0x40 },
+  { 0x18, 0x8B, 0x0E },
+  { 0x18, 0x8B, 0x45 },
+  { 0x18, 0x8B, 0x9D },
+  { 0x18, 0x9C, 0x5D },
+  { 0x18, 0x9E, 0xFC },
+  { 0x18, 0xA6, 0xF7 },
+  { 0x18, 0xAF, 0x61 },
+  { 0x18, 0xAF, 0x8F },
+  { 0x18, 0xC2, 0xBF },
+  { 0x18, 0xC5, 0x8A },
+  { 0x18, 0xCA, 0xA7 },
+  { 0x18, 0xCF, 0x24 },
+  { 0x18, 0xD2, 0x76 },
+  { 0x18, 0xD6, 0xC7 },
+  { 0x18, 0xD6, 0xDD },
+  { 0x18, 0xDE, 0xD7 },
+  { 0x18, 0xE7, 0x28 },
+  { 0x18, 0xE7, 0xB0 },
+  { 0x18, 0xE7, 0xF4 },
+  { 0x18, 0xE8, 0x29 },
+  { 0x18, 0xE9, 0x1D },
+  { 0x18, 0xEC, 0xE7 },
+  { 0x18, 0xEE, 0x69 },
+  { 0x18, 0xEF, 0x63 },
+  { 0x18, 0xF0, 0xE4 },
+  { 0x18, 0xF1, 0xD8 },
+  { 0x18, 0xF2, 0x2C },
+  { 0x18, 0xF6, 0x43 },
+  { 0x18, 0xF9, 0x35 },
+  { 0x18, 0xFA, 0xB7 },
+  { 0x18, 0xFD, 0x74 },
+  { 0x18, 0xFE, 0x34 },
+  { 0x1C, 0x0D, 0x7D },
+  { 0x1C, 0x12, 0xB0 },
+  { 0x1C, 0x15, 0x1F },
+  { 0x1C, 0x17, 0xD3 },
+  { 0x1C, 0x1A, 0xC0 },
+  { 0x1C, 0x1A, 0xDF },
+  { 0x1C, 0x1D, 0x67 },
+  { 0x1C, 0x1D, 0x86 },
+  { 0x1C, 0x20, 0xDB },
+  { 0x1C, 0x27, 0x04 },
+  { 0x1C, 0x28, 0xAF },
+  { 0x1C, 0x36, 0xBB },
+  { 0x1C, 0x3A, 0x60 },
+  { 0x1C, 0x3B, 0xF3 },
+  { 0x1C, 0x3C, 0xD4 },
+  { 0x1C, 0x3D, 0x2F },
+  { 0x1C, 0x43, 0x63 },
+  { 0x1C, 0x44, 0x19 },
+  { 0x1C, 0x45, 0x86 },
+  { 0x1C, 0x4D, 0x66 },
+  { 0x1C, 0x53, 0xF9 },
+  { 0x1C, 0x57, 0xDC },
+  { 0x1C, 0x59, 0x9B },
+  { 0x1C, 0x5C, 0xF2 },
+  { 0x1C, 0x5F, 0x2B },
+  { 0x1C, 0x61, 0xB4 },
+  { 0x1C, 0x67, 0x4A },
+  { 0x1C, 0x67, 0x58 },
+  { 0x1C, 0x6A, 0x76 },
+  { 0x1C, 0x6A, 0x7A },
+  { 0x1C, 0x71, 0x25 },
+  { 0x1C, 0x73, 0xE2 },
+  { 0x1C, 0x74, 0x0D },
+  { 0x1C, 0x7E, 0xE5 },
+  { 0x1C, 0x7F, 0x2C },
+  { 0x1C, 0x86, 0x82 },
+  { 0x1C, 0x87, 0x2C },
+  { 0x1C, 0x8E, 0x5C },
+  { 0x1C, 0x91, 0x48 },
+  { 0x1C, 0x91, 0x80 },
+  { 0x1C, 0x93, 0xC4 },
+  { 0x1C, 0x9D, 0xC2 },
+  { 0x1C, 0x9E, 0x46 },
+  { 0x1C, 0xA6, 0x81 },
+  { 0x1C, 0xAA, 0x07 },
+  { 0x1C, 0xAB, 0xA7 },
+  { 0x1C, 0xAE, 0xCB },
+  { 0x1C, 0xAF, 0xF7 },
+  { 0x1C, 0xB3, 0xC9 },
+  { 0x1C, 0xB7, 0x2C },
+  { 0x1C, 0xB7, 0x96 },
+  { 0x1C, 0xB9, 0xC4 },
+  { 0x1C, 0xBD, 0xB9 },
+  { 0x1C, 0xCC, 0xD6 },
+  { 0x1C, 0xD1, 0xE0 },
+  { 0x1C, 0xDE, 0xA7 },
+  { 0x1C, 0xDF, 0x0F },
+  { 0x1C, 0xE2, 0x09 },
+  { 0x1C, 0xE5, 0x04 },
+  { 0x1C, 0xE6, 0x2B },
+  { 0x1C, 0xE6, 0x39 },
+  { 0x1C, 0xE6, 0xC7 },
+  { 0x1C, 0xE8, 0x5D },
+  { 0x1C, 0xED, 0x6F },
+  { 0x1C, 0xF2, 0x9A },
+  { 0x1C, 0xFA, 0x68 },
+  { 0x1C, 0xFC, 0x17 },
+  { 0x1C, 0xFE, 0x2B },
+  { 0x20, 0x04, 0x84 },
+  { 0x20, 0x08, 0x89 },
+  { 0x20, 0x08, 0xED },
+  { 0x20, 0x0B, 0xC5 },
+  { 0x20, 0x0B, 0xC7 },
+  { 0x20, 0x0B, 0xCF },
+  { 0x20, 0x0C, 0xC8 },
+  { 0x20, 0x0E, 0x2B },
+  { 0x20, 0x10, 0x8A },
+  { 0x20, 0x15, 0x82 },
+  { 0x20, 0x16, 0x42 },
+  { 0x20, 0x1A, 0x94 },
+  { 0x20, 0x1C, 0x3A },
+  { 0x20, 0x1F, 0x3B },
+  { 0x20, 0x23, 0x51 },
+  { 0x20, 0x28, 0x3E },
+  { 0x20, 0x2B, 0xC1 },
+  { 0x20, 0x32, 0xC6 },
+  { 0x20, 0x34, 0xFB },
+  { 0x20, 0x36, 0x26 },
+  { 0x20, 0x37, 0x06 },
+  { 0x20, 0x37, 0xA5 },
+  { 0x20, 0x3A, 0x07 },
+  { 0x20, 0x3A, 0xEB },
+  { 0x20, 0x3C, 0xAE },
+  { 0x20, 0x3D, 0xB2 },
+  { 0x20, 0x47, 0xDA },
+  { 0x20, 0x4C, 0x03 },
+  { 0x20, 0x4C, 0x9E },
+  { 0x20, 0x4E, 0x7F },
+  { 0x20, 0x53, 0x83 },
+  { 0x20, 0x54, 0xFA },
+  { 0x20, 0x58, 0x69 },
+  { 0x20, 0x5A, 0x1D },
+  { 0x20, 0x62, 0x74 },
+  { 0x20, 0x65, 0x8E },
+  { 0x20, 0x69, 0x80 },
+  { 0x20, 0x6B, 0xE7 },
+  { 0x20, 0x76, 0x8F },
+  { 0x20, 0x78, 0xCD },
+  { 0x20, 0x78, 0xF0 },
+  { 0x20, 0x7D, 0x74 },
+  { 0x20, 0x82, 0xC0 },
+  { 0x20, 0x87, 0xEC },
+  { 0x20, 0x89, 0x86 },
+  { 0x20, 0x8C, 0x86 },
+  { 0x20, 0x91, 0xDF },
+  { 0x20, 0x9B, 0xCD },
+  { 0x20, 0x9C, 0xB4 },
+  { 0x20, 0xA1, 0x71 },
+  { 0x20, 0xA2, 0xE4 },
+  { 0x20, 0xA5, 0xCB },
+  { 0x20, 0xA6, 0x0C },
+  { 0x20, 0xA6, 0x80 },
+  { 0x20, 0xA7, 0x66 },
+  { 0x20, 0xA9, 0x9B },
+  { 0x20, 0xAA, 0x4B },
+  { 0x20, 0xAB, 0x37 },
+  { 0x20, 0xAB, 0x48 },
+  { 0x20, 0xBB, 0xC0 },
+  { 0x20, 0xC9, 0xD0 },
+  { 0x20, 0xCC, 0x27 },
+  { 0x20, 0xCF, 0x30 },
+  { 0x20, 0xCF, 0xAE },
+  { 0x20, 0xDA, 0x22 },
+  { 0x20, 0xDC, 0xE6 },
+  { 0x20, 0xDF, 0x73 },
+  { 0x20, 0xDF, 0xB9 },
+  { 0x20, 0xE2, 0xA8 },
+  { 0x20, 0xE5, 0x2A },
+  { 0x20, 0xE8, 0x74 },
+  { 0x20, 0xE8, 0x82 },
+  { 0x20, 0xEE, 0x28 },
+  { 0x20, 0xEF, 0xBD },
+  { 0x20, 0xF1, 0x7C },
+  { 0x20, 0xF3, 0xA3 },
+  { 0x20, 0xF4, 0x78 },
+  { 0x20, 0xFA, 0x85 },
+  { 0x20, 0xFE, 0x00 },
+  { 0x24, 0x00, 0xBA },
+  { 0x24, 0x01, 0xC7 },
+  { 0x24, 0x05, 0x88 },
+  { 0x24, 0x09, 0x95 },
+  { 0x24, 0x0A, 0xC4 },
+  { 0x24, 0x11, 0x45 },
+  { 0x24, 0x16, 0x1B },
+  { 0x24, 0x16, 0x6D },
+  { 0x24, 0x16, 0x9D },
+  { 0x24, 0x1B, 0x7A },
+  { 0x24, 0x1E, 0xEB },
+  { 0x24, 0x1F, 0xA0 },
+  { 0x24, 0x24, 0x0E },
+  { 0x24, 0x26, 0xD6 },
+  { 0x24, 0x29, 0x34 },
+  { 0x24, 0x2A, 0x04 },
+  { 0x24, 0x2E, 0x02 },
+  { 0x24, 0x2F, 0xD0 },
+  { 0x24, 0x31, 0x54 },
+  { 0x24, 0x36, 0xDA },
+  { 0x24, 0x37, 0x4C },
+  { 0x24, 0x44, 0x27 },
+  { 0x24, 0x46, 0xE4 },
+  { 0x24, 0x4B, 0xF1 },
+  { 0x24, 0x4B, 0xFE },
+  { 0x24, 0x4C, 0x07 },
+  { 0x24, 0x4C, 0xAB },
+  { 0x24, 0x4C, 0xE3 },
+  { 0x24, 0x58, 0x6E },
+  { 0x24, 0x58, 0x7C },
+  { 0x24, 0x5A, 0x4C },
+  { 0x24, 0x5A, 0x5F },
+  { 0x24, 0x5B, 0xA7 },
+  { 0x24, 0x5E, 0x48 },
+  { 0x24, 0x62, 0xAB },
+  { 0x24, 0x62, 0xCE },
+  { 0x24, 0x65, 0x11 },
+  { 0x24, 0x69, 0x68 },
+  { 0x24, 0x69, 0xA5 },
+  { 0x24, 0x6C, 0x84 },
+  { 0x24, 0x6F, 0x28 },
+  { 0x24, 0x75, 0xFC },
+  { 0x24, 0x76, 0x7D },
+  { 0x24, 0x79, 0x2A },
+  { 0x24, 0x7E, 0x12 },
+  { 0x24, 0x7E, 0x51 },
+  { 0x24, 0x7F, 0x3C },
+  { 0x24, 0x81, 0x3B },
+  { 0x24, 0x91, 0xBB },
+  { 0x24, 0x95, 0x2F },
+  { 0x24, 0x97, 0x45 },
+  { 0x24, 0x9E, 0xAB },
+  { 0x24, 0xA0, 0x74 },
+  { 0x24, 0xA1, 0x60 },
+  { 0x24, 0xA2, 0xE1 },
+  { 0x24, 0xA4, 0x3C },
+  { 0x24, 0xA5, 0x2C },
+  { 0x24, 0xA6, 0x5E },
+  { 0x24, 0xAB, 0x81 },
+  { 0x24, 0xB2, 0xDE },
+  { 0x24, 0xB3, 0x39 },
+  { 0x24, 0xB6, 0x57 },
+  { 0x24, 0xBC, 0xF8 },
+  { 0x24, 0xC4, 0x4A },
+  { 0x24, 0xC9, 0xA1 },
+  { 0x24, 0xCE, 0x33 },
+  { 0x24, 0xD0, 0xDF },
+  { 0x24, 0xD3, 0x37 },
+  { 0x24, 0xD3, 0xF2 },
+  { 0x24, 0xD5, 0xE4 },
+  { 0x24, 0xD7, 0x9C },
+  { 0x24, 0xD7, 0xEB },
+  { 0x24, 0xDA, 0x33 },
+  { 0x24, 0xDB, 0xAC },
+  { 0x24, 0xDC, 0xC3 },
+  { 0x24, 0xDE, 0xC6 },
+  { 0x24, 0xDF, 0x6A },
+  { 0x24, 0xE3, 0x14 },
+  { 0x24, 0xE5, 0x0F },
+  { 0x24, 0xE9, 0xB3 },
+  { 0x24, 0xEB, 0xED },
+  { 0x24, 0xF0, 0x94 },
+  { 0x24, 0xF5, 0xA2 },
+  { 0x24, 0xF6, 0x03 },
+  { 0x24, 0xF6, 0x77 },
+  { 0x24, 0xFB, 0x65 },
+  { 0x28, 0x01, 0x1C },
+  { 0x28, 0x02, 0x2E },
+  { 0x28, 0x02, 0x44 },
+  { 0x28, 0x0B, 0x5C },
+  { 0x28, 0x10, 0x7B },
+  { 0x28, 0x11, 0xEC },
+  { 0x28, 0x16, 0x7F },
+  { 0x28, 0x16, 0xA8 },
+  { 0x28, 0x17, 0x09 },
+  { 0x28, 0x18, 0x78 },
+  { 0x28, 0x1D, 0xFB },
+  { 0x28, 0x22, 0x1E },
+  { 0x28, 0x28, 0x5D },
+  { 0x28, 0x2C, 0xB2 },
+  { 0x28, 0x2D, 0x7F },
+  { 0x28, 0x31, 0x52 },
+  { 0x28, 0x31, 0xF8 },
+  { 0x28, 0x34, 0xA2 },
+  { 0x28, 0x34, 0xFF },
+  { 0x28, 0x37, 0x37 },
+  { 0x28, 0x3B, 0x82 },
+  { 0x28, 0x3C, 0xE4 },
+  { 0x28, 0x41, 0xC6 },
+  { 0x28, 0x41, 0xEC },
+  { 0x28, 0x4E, 0x44 },
+  { 0x28, 0x52, 0x61 },
+  { 0x28, 0x53, 0x4E },
+  { 0x28, 0x5A, 0xEB },
+  { 0x28, 0x5F, 0xDB },
+  { 0x28, 0x68, 0xD2 },
+  { 0x28, 0x6A, 0xB8 },
+  { 0x28, 0x6A, 0xBA },
+  { 0x28, 0x6E, 0xD4 },
+  { 0x28, 0x6F, 0x7F },
+  { 0x28, 0x70, 0x4E },
+  { 0x28, 0x73, 0xF6 },
+  { 0x28, 0x77, 0x77 },
+  { 0x28, 0x77, 0xF1 },
+  { 0x28, 0x7B, 0x09 },
+  { 0x28, 0x80, 0x88 },
+  { 0x28, 0x80, 0x8A },
+  { 0x28, 0x83, 0xC9 },
+  { 0x28, 0x87, 0xBA },
+  { 0x28, 0x8C, 0xB8 },
+  { 0x28, 0x8E, 0xEC },
+  { 0x28, 0x8F, 0xF6 },
+  { 0x28, 0x93, 0xFE },
+  { 0x28, 0x94, 0x01 },
+  { 0x28, 0x94, 0x0F },
+  { 0x28, 0x9E, 0x97 },
+  { 0x28, 0xA0, 0x2B },
+  { 0x28, 0xA6, 0xDB },
+  { 0x28, 0xAC, 0x9E },
+  { 0x28, 0xAF, 0xFD },
+  { 0x28, 0xB3, 0x71 },
+  { 0x28, 0xB4, 0x48 },
+  { 0x28, 0xBD, 0x89 },
+  { 0x28, 0xC1, 0xA0 },
+  { 0x28, 0xC5, 0x38 },
+  { 0x28, 0xC6, 0x8E },
+  { 0x28, 0xC7, 0x09 },
+  { 0x28, 0xC7, 0xCE },
+  { 0x28, 0xC8, 0x7C },
+  { 0x28, 0xCD, 0xC1 },
+  { 0x28, 0xCF, 0x51 },
+  { 0x28, 0xCF, 0xDA },
+  { 0x28, 0xCF, 0xE9 },
+  { 0x28, 0xDE, 0x65 },
+  { 0x28, 0xDE, 0xA8 },
+  { 0x28, 0xDE, 0xE5 },
+  { 0x28, 0xE0, 0x2C },
+  { 0x28, 0xE1, 0x4C },
+  { 0x28, 0xE3, 0x1F },
+  { 0x28, 0xE3, 0x4E },
+  { 0x28, 0xE5, 0xB0 },
+  { 0x28, 0xE7, 0xCF },
+  { 0x28, 0xEA, 0x0B },
+  { 0x28, 0xEA, 0x2D },
+  { 0x28, 0xEC, 0x95 },
+  { 0x28, 0xED, 0x6A },
+  { 0x28, 0xEE, 0x52 },
+  { 0x28, 0xEF, 0x01 },
+  { 0x28, 0xF0, 0x33 },
+  { 0x28, 0xF0, 0x76 },
+  { 0x28, 0xFB, 0xAE },
+  { 0x28, 0xFF, 0x3C },
+  { 0x28, 0xFF, 0x3E },
+  { 0x2C, 0x01, 0xB5 },
+  { 0x2C, 0x0B, 0xAB },
+  { 0x2C, 0x0B, 0xE9 },
+  { 0x2C, 0x10, 0xC1 },
+  { 0x2C, 0x15, 0xD9 },
+  { 0x2C, 0x18, 0x09 },
+  { 0x2C, 0x1A, 0x01 },
+  { 0x2C, 0x1A, 0x05 },
+  { 0x2C, 0x1F, 0x23 },
+  { 0x2C, 0x20, 0x0B },
+  { 0x2C, 0x26, 0xC5 },
+  { 0x2C, 0x27, 0x68 },
+  { 0x2C, 0x29, 0x97 },
+  { 0x2C, 0x30, 0x33 },
+  { 0x2C, 0x31, 0x24 },
+  { 0x2C, 0x32, 0x6A },
+  { 0x2C, 0x33, 0x11 },
+  { 0x2C, 0x33, 0x61 },
+  { 0x2C, 0x36, 0xF8 },
+  { 0x2C, 0x3A, 0xE8 },
+  { 0x2C, 0x3A, 0xFD },
+  { 0x2C, 0x3E, 0xCF },
+  { 0x2C, 0x3F, 0x0B },
+  { 0x2C, 0x3F, 0x38 },
+  { 0x2C, 0x4D, 0x54 },
+  { 0x2C, 0x4F, 0x52 },
+  { 0x2C, 0x52, 0xAF },
+  { 0x2C, 0x54, 0x2D },
+  { 0x2C, 0x54, 0x91 },
+  { 0x2C, 0x55, 0xD3 },
+  { 0x2C, 0x56, 0xDC },
+  { 0x2C, 0x57, 0x41 },
+  { 0x2C, 0x57, 0xCE },
+  { 0x2C, 0x58, 0xE8 },
+  { 0x2C, 0x5A, 0x0F },
+  { 0x2C, 0x5D, 0x93 },
+  { 0x2C, 0x61, 0xF6 },
+  { 0x2C, 0x69, 0x3E },
+  { 0x2C, 0x70, 0x4F },
+  { 0x2C, 0x71, 0xFF },
+  { 0x2C, 0x73, 0xA0 },
+  { 0x2C, 0x76, 0x00 },
+  { 0x2C, 0x7C, 0xF2 },
+  { 0x2C, 0x81, 0xBF },
+  { 0x2C, 0x82, 0x17 },
+  { 0x2C, 0x86, 0xD2 },
+  { 0x2C, 0x91, 0xAB },
+  { 0x2C, 0x94, 0x52 },
+  { 0x2C, 0x95, 0x7F },
+  { 0x2C, 0x97, 0xB1 },
+  { 0x2C, 0x9D, 0x1E },
+  { 0x2C, 0xA7, 0x9E },
+  { 0x2C, 0xAB, 0x00 },
+  { 0x2C, 0xAB, 0x46 },
+  { 0x2C, 0xAB, 0xA4 },
+  { 0x2C, 0xAB, 0xEB },
+  { 0x2C, 0xB0, 0x5D },
+  { 0x2C, 0xB4, 0x3A },
+  { 0x2C, 0xB6, 0x8F },
+  { 0x2C, 0xBC, 0x87 },
+  { 0x2C, 0xBE, 0x08 },
+  { 0x2C, 0xC2, 0x53 },
+  { 0x2C, 0xC5, 0xD3 },
+  { 0x2C, 0xC8, 0x1B },
+  { 0x2C, 0xCF, 0x58 },
+  { 0x2C, 0xCF, 0x67 },
+  { 0x2C, 0xD0, 0x2D },
+  { 0x2C, 0xD0, 0x66 },
+  { 0x2C, 0xE6, 0xCC },
+  { 0x2C, 0xED, 0xB0 },
+  { 0x2C, 0xF0, 0xA2 },
+  { 0x2C, 0xF0, 0xEE },
+  { 0x2C, 0xF1, 0xBB },
+  { 0x2C, 0xF4, 0x32 },
+  { 0x2C, 0xF7, 0xF1 },
+  { 0x2C, 0xF8, 0x9B },
+  { 0x2C, 0xFD, 0xA1 },
+  { 0x2C, 0xFE, 0x4F },
+  { 0x30, 0x0C, 0x23 },
+  { 0x30, 0x10, 0xE4 },
+  { 0x30, 0x19, 0x84 },
+  { 0x30, 0x1F, 0x48 },
+  { 0x30, 0x23, 0x03 },
+  { 0x30, 0x30, 0xF9 },
+  { 0x30, 0x35, 0xAD },
+  { 0x30, 0x37, 0xA6 },
+  { 0x30, 0x37, 0xB3 },
+  { 0x30, 0x3B, 0x7C },
+  { 0x30, 0x40, 0x74 },
+  { 0x30, 0x42, 0x40 },
+  { 0x30, 0x45, 0x96 },
+  { 0x30, 0x46, 0x9A },
+  { 0x30, 0x49, 0x9E },
+  { 0x30, 0x50, 0xCE },
+  { 0x30, 0x57, 0x14 },
+  { 0x30, 0x5A, 0x3A },
+  { 0x30, 0x63, 0x6B },
+  { 0x30, 0x74, 0x96 },
+  { 0x30, 0x82, 0x16 },
+  { 0x30, 0x83, 0x98 },
+  { 0x30, 0x85, 0xA9 },
+  { 0x30, 0x87, 0x30 },
+  { 0x30, 0x87, 0xD9 },
+  { 0x30, 0x8B, 0xB2 },
+  { 0x30, 0x8D, 0xD4 },
+  { 0x30, 0x8E, 0xCF },
+  { 0x30, 0x90, 0x48 },
+  { 0x30, 0x90, 0xAB },
+  { 0x30, 0x99, 0x35 },
+  { 0x30, 0xA1, 0xFA },
+  { 0x30, 0xA3, 0x0F },
+  { 0x30, 0xAE, 0xA4 },
+  { 0x30, 0xB4, 0x9E },
+  { 0x30, 0xB5, 0xC2 },
+  { 0x30, 0xB9, 0x30 },
+  { 0x30, 0xC5, 0x0F },
+  { 0x30, 0xC6, 0xF7 },
+  { 0x30, 0xC9, 0x22 },
+  { 0x30, 0xCC, 0x21 },
+  { 0x30, 0xD1, 0x7E },
+  { 0x30, 0xD3, 0x86 },
+  { 0x30, 0xD5, 0x3E },
+  { 0x30, 0xD7, 0xA1 },
+  { 0x30, 0xD8, 0x75 },
+  { 0x30, 0xD9, 0xD9 },
+  { 0x30, 0xDC, 0xE7 },
+  { 0x30, 0xDE, 0x4B },
+  { 0x30, 0xE0, 0x4F },
+  { 0x30, 0xE4, 0xDB },
+  { 0x30, 0xE9, 0x8E },
+  { 0x30, 0xF3, 0x1D },
+  { 0x30, 0xF3, 0x35 },
+  { 0x30, 0xF7, 0x0D },
+  { 0x30, 0xF7, 0xC5 },
+  { 0x30, 0xFB, 0xB8 },
+  { 0x30, 0xFC, 0x68 },
+  { 0x30, 0xFD, 0x38 },
+  { 0x30, 0xFD, 0x65 },
+  { 0x30, 0xFF, 0xFD },
+  { 0x34, 0x00, 0xA3 },
+  { 0x34, 0x08, 0x04 },
+  { 0x34, 0x08, 0xBC },
+  { 0x34, 0x0A, 0x33 },
+  { 0x34, 0x0A, 0x98 },
+  { 0x34, 0x12, 0x98 },
+  { 0x34, 0x12, 0xF9 },
+  { 0x34, 0x15, 0x93 },
+  { 0x34, 0x15, 0x9E },
+  { 0x34, 0x1B, 0x2D },
+  { 0x34, 0x1C, 0xF0 },
+  { 0x34, 0x1E, 0x6B },
+  { 0x34, 0x20, 0xE3 },
+  { 0x34, 0x24, 0x3E },
+  { 0x34, 0x25, 0xBE },
+  { 0x34, 0x28, 0x40 },
+  { 0x34, 0x29, 0x12 },
+  { 0x34, 0x2B, 0x6E },
+  { 0x34, 0x2E, 0xB6 },
+  { 0x34, 0x2F, 0xBD },
+  { 0x34, 0x31, 0x8F },
+  { 0x34, 0x31, 0xC4 },
+  { 0x34, 0x36, 0x3B },
+  { 0x34, 0x36, 0x54 },
+  { 0x34, 0x37, 0x59 },
+  { 0x34, 0x3A, 0x20 },
+  { 0x34, 0x3D, 0xC4 },
+  { 0x34, 0x42, 0x62 },
+  { 0x34, 0x4B, 0x50 },
+  { 0x34, 0x4D, 0xEA },
+  { 0x34, 0x51, 0xC9 },
+  { 0x34, 0x56, 0xFE },
+  { 0x34, 0x58, 0x40 },
+  { 0x34, 0x5D, 0xA8 },
+  { 0x34, 0x5E, 0x08 },
+  { 0x34, 0x60, 0xF9 },
+  { 0x34, 0x62, 0x88 },
+  { 0x34, 0x66, 0x79 },
+  { 0x34, 0x69, 0x87 },
+  { 0x34, 0x6A, 0xC2 },
+  { 0x34, 0x6B, 0xD3 },
+  { 0x34, 0x6F, 0x90 },
+  { 0x34, 0x73, 0x2D },
+  { 0x34, 0x78, 0x39 },
+  { 0x34, 0x79, 0x16 },
+  { 0x34, 0x7C, 0x25 },
+  { 0x34, 0x7E, 0x5C },
+  { 0x34, 0x80, 0xB3 },
+  { 0x34, 0x81, 0xC4 },
+  { 0x34, 0x85, 0x18 },
+  { 0x34, 0x86, 0x5D },
+  { 0x34, 0x88, 0x18 },
+  { 0x34, 0x8A, 0x12 },
+  { 0x34, 0x8C, 0x5E },
+  { 0x34, 0x8F, 0x27 },
+  { 0x34, 0x94, 0x54 },
+  { 0x34, 0x96, 0x72 },
+  { 0x34, 0x96, 0x77 },
+  { 0x34, 0x97, 0xF6 },
+  { 0x34, 0x98, 0x7A },
+  { 0x34, 0x98, 0xB5 },
+  { 0x34, 0xA2, 0xA2 },
+  { 0x34, 0xA3, 0x95 },
+  { 0x34, 0xA8, 0x4E },
+  { 0x34, 0xA8, 0xEB },
+  { 0x34, 0xAB, 0x37 },
+  { 0x34, 0xAB, 0x95 },
+  { 0x34, 0xAF, 0x2C },
+  { 0x34, 0xAF, 0xB3 },
+  { 0x34, 0xB1, 0xEB },
+  { 0x34, 0xB3, 0x54 },
+  { 0x34, 0xB4, 0x72 },
+  { 0x34, 0xB7, 0xDA },
+  { 0x34, 0xB8, 0x83 },
+  { 0x34, 0xB9, 0x8D },
+  { 0x34, 0xBD, 0xC8 },
+  { 0x34, 0xBD, 0xFA },
+  { 0x34, 0xC0, 0x59 },
+  { 0x34, 0xC5, 0x15 },
+  { 0x34, 0xC7, 0xE9 },
+  { 0x34, 0xCD, 0xBE },
+  { 0x34, 0xD2, 0x70 },
+  { 0x34, 0xDA, 0xB7 },
+  { 0x34, 0xDB, 0xFD },
+  { 0x34, 0xDE, 0x34 },
+  { 0x34, 0xE0, 0xCF },
+  { 0x34, 0xE2, 0xFD },
+  { 0x34, 0xE8, 0x94 },
+  { 0x34, 0xED, 0x1B },
+  { 0x34, 0xEE, 0x16 },
+  { 0x34, 0xF7, 0x16 },
+  { 0x34, 0xF8, 0xE7 },
+  { 0x34, 0xFA, 0x9F },
+  { 0x34, 0xFD, 0x6A },
+  { 0x34, 0xFE, 0x77 },
+  { 0x38, 0x0E, 0x4D },
+  { 0x38, 0x0F, 0x4A },
+  { 0x38, 0x0F, 0xAD },
+  { 0x38, 0x10, 0xD5 },
+  { 0x38, 0x10, 0xF0 },
+  { 0x38, 0x1C, 0x1A },
+  { 0x38, 0x20, 0x28 },
+  { 0x38, 0x20, 0x56 },
+  { 0x38, 0x21, 0xC7 },
+  { 0x38, 0x2C, 0x4A },
+  { 0x38, 0x37, 0x8B },
+  { 0x38, 0x42, 0x0B },
+  { 0x38, 0x45, 0x3B },
+  { 0x38, 0x46, 0x08 },
+  { 0x38, 0x47, 0xBC },
+  { 0x38, 0x48, 0x4C },
+  { 0x38, 0x4C, 0x4F },
+  { 0x38, 0x53, 0x9C },
+  { 0x38, 0x54, 0x9B },
+  { 0x38, 0x56, 0x3D },
+  { 0x38, 0x5F, 0x66 },
+  { 0x38, 0x65, 0xB2 },
+  { 0x38, 0x66, 0xF0 },
+  { 0x38, 0x6E, 0x88 },
+  { 0x38, 0x71, 0xDE },
+  { 0x38, 0x83, 0x45 },
+  { 0x38, 0x84, 0x79 },
+  { 0x38, 0x86, 0xF7 },
+  { 0x38, 0x88, 0x1E },
+  { 0x38, 0x88, 0xA4 },
+  { 0x38, 0x89, 0x2C },
+  { 0x38, 0x8B, 0x59 },
+  { 0x38, 0x90, 0x52 },
+  { 0x38, 0x90, 0xA5 },
+  { 0x38, 0x90, 0xAF },
+  { 0x38, 0x91, 0xB7 },
+  { 0x38, 0x94, 0xED },
+  { 0x38, 0x9C, 0xB2 },
+  { 0x38, 0x9E, 0x80 },
+  { 0x38, 0xA4, 0xED },
+  { 0x38, 0xB5, 0x4D },
+  { 0x38, 0xBC, 0x01 },
+  { 0x38, 0xBD, 0x7A },
+  { 0x38, 0xC0, 0xEA },
+  { 0x38, 0xC6, 0xBD },
+  { 0x38, 0xC8, 0x5C },
+  { 0x38, 0xC9, 0x86 },
+  { 0x38, 0xCA, 0xDA },
+  { 0x38, 0xD5, 0x47 },
+  { 0x38, 0xD8, 0x2F },
+  { 0x38, 0xE1, 0xAA },
+  { 0x38, 0xE2, 0xDD },
+  { 0x38, 0xE6, 0x0A },
+  { 0x38, 0xEB, 0x47 },
+  { 0x38, 0xEC, 0x0D },
+  { 0x38, 0xED, 0x18 },
+  { 0x38, 0xF6, 0xCF },
+  { 0x38, 0xF7, 0x3D },
+  { 0x38, 0xF8, 0x89 },
+  { 0x38, 0xF9, 0xD3 },
+  { 0x38, 0xFB, 0x14 },
+  { 0x38, 0xFD, 0xF8 },
+  { 0x38, 0xFF, 0x36 },
+  { 0x3C, 0x05, 0x8E },
+  { 0x3C, 0x06, 0x30 },
+  { 0x3C, 0x06, 0xA7 },
+  { 0x3C, 0x07, 0x54 },
+  { 0x3C, 0x08, 0xF6 },
+  { 0x3C, 0x0E, 0x23 },
+  { 0x3C, 0x13, 0x5A },
+  { 0x3C, 0x13, 0xBB },
+  { 0x3C, 0x13, 0xCC },
+  { 0x3C, 0x15, 0xC2 },
+  { 0x3C, 0x15, 0xFB },
+  { 0x3C, 0x1E, 0x04 },
+  { 0x3C, 0x1E, 0xB5 },
+  { 0x3C, 0x22, 0xFB },
+  { 0x3C, 0x26, 0xE4 },
+  { 0x3C, 0x28, 0x6D },
+  { 0x3C, 0x2E, 0xF9 },
+  { 0x3C, 0x2E, 0xFF },
+  { 0x3C, 0x30, 0x6F },
+  { 0x3C, 0x31, 0x74 },
+  { 0x3C, 0x33, 0x32 },
+  { 0x3C, 0x36, 0x6A },
+  { 0x3C, 0x37, 0x12 },
+  { 0x3C, 0x37, 0x86 },
+  { 0x3C, 0x39, 0xC8 },
+  { 0x3C, 0x41, 0x0E },
+  { 0x3C, 0x46, 0xA1 },
+  { 0x3C, 0x46, 0xD8 },
+  { 0x3C, 0x47, 0x11 },
+  { 0x3C, 0x4D, 0xBE },
+  { 0x3C, 0x51, 0x0E },
+  { 0x3C, 0x52, 0xA1 },
+  { 0x3C, 0x54, 0x47 },
+  { 0x3C, 0x57, 0x31 },
+  { 0x3C, 0x5A, 0xB4 },
+  { 0x3C, 0x5C, 0xC4 },
+  { 0x3C, 0x5E, 0xC3 },
+  { 0x3C, 0x61, 0x05 },
+  { 0x3C, 0x67, 0x8C },
+  { 0x3C, 0x6A, 0x48 },
+  { 0x3C, 0x6D, 0x89 },
+  { 0x3C, 0x6F, 0x9B },
+  { 0x3C, 0x71, 0xBF },
+  { 0x3C, 0x78, 0x43 },
+  { 0x3C, 0x7C, 0x3F },
+  { 0x3C, 0x7D, 0x0A },
+  { 0x3C, 0x83, 0x75 },
+  { 0x3C, 0x84, 0x27 },
+  { 0x3C, 0x84, 0x6A },
+  { 0x3C, 0x86, 0x9A },
+  { 0x3C, 0x8B, 0x7F },
+  { 0x3C, 0x8D, 0x20 },
+  { 0x3C, 0x90, 0xE0 },
+  { 0x3C, 0x93, 0xF4 },
+  { 0x3C, 0x9D, 0x56 },
+  { 0x3C, 0xA1, 0x61 },
+  { 0x3C, 0xA3, 0x7E },
+  { 0x3C, 0xA6, 0x2F },
+  { 0x3C, 0xA6, 0xF6 },
+  { 0x3C, 0xA7, 0xAE },
+  { 0x3C, 0xAB, 0x8E },
+  { 0x3C, 0xAF, 0xB7 },
+  { 0x3C, 0xBC, 0xD0 },
+  { 0x3C, 0xBF, 0x60 },
+  { 0x3C, 0xC0, 0x3E },
+  { 0x3C, 0xCD, 0x36 },
+  { 0x3C, 0xCD, 0x5D },
+  { 0x3C, 0xCE, 0x73 },
+  { 0x3C, 0xD0, 0xF8 },
+  { 0x3C, 0xDA, 0x2A },
+  { 0x3C, 0xDF, 0x1E },
+  { 0x3C, 0xDF, 0xBD },
+  { 0x3C, 0xE0, 0x72 },
+  { 0x3C, 0xE4, 0x41 },
+  { 0x3C, 0xE8, 0x24 },
+  { 0x3C, 0xE9, 0x0E },
+  { 0x3C, 0xF6, 0x52 },
+  { 0x3C, 0xF8, 0x08 },
+  { 0x3C, 0xF9, 0xF0 },
+  { 0x3C, 0xFA, 0x06 },
+  { 0x3C, 0xFA, 0x43 },
+  { 0x3C, 0xFE, 0xAC },
+  { 0x3C, 0xFF, 0xD8 },
+  { 0x40, 0x01, 0x7A },
+  { 0x40, 0x06, 0xD5 },
+  { 0x40, 0x0E, 0xF3 },
+  { 0x40, 0x14, 0x82 },
+  { 0x40, 0x16, 0x7E },
+  { 0x40, 0x16, 0x9F },
+  { 0x40, 0x22, 0xD8 },
+  { 0x40, 0x26, 0x19 },
+  { 0x40, 0x30, 0x04 },
+  { 0x40, 0x33, 0x1A },
+  { 0x40, 0x3C, 0xFC },
+  { 0x40, 0x3F, 0x8C },
+  { 0x40, 0x41, 0x0D },
+  { 0x40, 0x42, 0x44 },
+  { 0x40, 0x45, 0xC4 },
+  { 0x40, 0x4A, 0x03 },
+  { 0x40, 0x4C, 0xCA },
+  { 0x40, 0x4D, 0x7F },
+  { 0x40, 0x4D, 0x8E },
+  { 0x40, 0x4F, 0x42 },
+  { 0x40, 0x55, 0x39 },
+  { 0x40, 0x5D, 0x82 },
+  { 0x40, 0x6C, 0x8F },
+  { 0x40, 0x6F, 0x27 },
+  { 0x40, 0x70, 0xF5 },
+  { 0x40, 0x7D, 0x0F },
+  { 0x40, 0x83, 0x1D },
+  { 0x40, 0x86, 0xCB },
+  { 0x40, 0x8E, 0x2C },
+  { 0x40, 0x91, 0x51 },
+  { 0x40, 0x92, 0x1A },
+  { 0x40, 0x98, 0xAD },
+  { 0x40, 0x9B, 0xCD },
+  { 0x40, 0x9C, 0x28 },
+  { 0x40, 0xA2, 0xDB },
+  { 0x40, 0xA6, 0xD9 },
+  { 0x40, 0xA6, 0xE8 },
+  { 0x40, 0xA9, 0xCF },
+  { 0x40, 0xAE, 0x30 },
+  { 0x40, 0xB0, 0x76 },
+  { 0x40, 0xB1, 0x5C },
+  { 0x40, 0xB3, 0x95 },
+  { 0x40, 0xB4, 0xCD },
+  { 0x40, 0xB5, 0xC1 },
+  { 0x40, 0xB8, 0x2D },
+  { 0x40, 0xBC, 0x60 },
+  { 0x40, 0xC7, 0x11 },
+  { 0x40, 0xCB, 0xA8 },
+  { 0x40, 0xCB, 0xC0 },
+  { 0x40, 0xCE, 0x24 },
+  { 0x40, 0xD1, 0x60 },
+  { 0x40, 0xD2, 0x8A },
+  { 0x40, 0xD3, 0x2D },
+  { 0x40, 0xDA, 0x5C },
+  { 0x40, 0xE3, 0xD6 },
+  { 0x40, 0xE6, 0x4B },
+  { 0x40, 0xED, 0x00 },
+  { 0x40, 0xED, 0xCF },
+  { 0x40, 0xEE, 0xDD },
+  { 0x40, 0xF0, 0x78 },
+  { 0x40, 0xF4, 0x07 },
+  { 0x40, 0xF4, 0xEC },
+  { 0x40, 0xF5, 0x20 },
+  { 0x40, 0xF6, 0xBC },
+  { 0x40, 0xF9, 0x46 },
+  { 0x44, 0x00, 0x10 },
+  { 0x44, 0x00, 0x49 },
+  { 0x44, 0x00, 0x4D },
+  { 0x44, 0x03, 0xA7 },
+  { 0x44, 0x07, 0x0B },
+  { 0x44, 0x12, 0x44 },
+  { 0x44, 0x13, 0xD0 },
+  { 0x44, 0x16, 0x22 },
+  { 0x44, 0x17, 0x93 },
+  { 0x44, 0x18, 0xFD },
+  { 0x44, 0x1B, 0x88 },
+  { 0x44, 0x1E, 0x98 },
+  { 0x44, 0x22, 0x7C },
+  { 0x44, 0x2A, 0x60 },
+  { 0x44, 0x2B, 0x03 },
+  { 0x44, 0x30, 0x3F },
+  { 0x44, 0x32, 0x62 },
+  { 0x44, 0x35, 0x83 },
+  { 0x44, 0x3D, 0x54 },
+  { 0x44, 0x41, 0xF0 },
+  { 0x44, 0x42, 0x01 },
+  { 0x44, 0x4A, 0xDB },
+  { 0x44, 0x4C, 0x0C },
+  { 0x44, 0x4E, 0x6D },
+  { 0x44, 0x55, 0xB1 },
+  { 0x44, 0x58, 0x29 },
+  { 0x44, 0x59, 0x43 },
+  { 0x44, 0x59, 0xE3 },
+  { 0x44, 0x5B, 0xED },
+  { 0x44, 0x64, 0x3C },
+  { 0x44, 0x65, 0x0D },
+  { 0x44, 0x67, 0x47 },
+  { 0x44, 0x6A, 0x2E },
+  { 0x44, 0x6D, 0x7F },
+  { 0x44, 0x6E, 0xE5 },
+  { 0x44, 0x76, 0x54 },
+  { 0x44, 0x82, 0xE5 },
+  { 0x44, 0x88, 0x16 },
+  { 0x44, 0x90, 0xBB },
+  { 0x44, 0x94, 0xFC },
+  { 0x44, 0x9B, 0xC1 },
+  { 0x44, 0xA1, 0x91 },
+  { 0x44, 0xA3, 0xC7 },
+  { 0x44, 0xA5, 0x6E },
+  { 0x44, 0xA8, 0xFC },
+  { 0x44, 0xAD, 0xD9 },
+  { 0x44, 0xAE, 0x25 },
+  { 0x44, 0xB3, 0x2D },
+  { 0x44, 0xB4, 0xB2 },
+  { 0x44, 0xB6, 0xBE },
+  { 0x44, 0xBB, 0x3B },
+  { 0x44, 0xC3, 0x46 },
+  { 0x44, 0xC3, 0xB6 },
+  { 0x44, 0xC6, 0x5D },
+  { 0x44, 0xD3, 0xCA },
+  { 0x44, 0xD5, 0xCC },
+  { 0x44, 0xD7, 0x91 },
+  { 0x44, 0xD8, 0x84 },
+  { 0x44, 0xD9, 0xE7 },
+  { 0x44, 0xDA, 0x30 },
+  { 0x44, 0xE0, 0x8E },
+  { 0x44, 0xE4, 0xD9 },
+  { 0x44, 0xE6, 0x6E },
+  { 0x44, 0xE9, 0x68 },
+  { 0x44, 0xF0, 0x9E },
+  { 0x44, 0xF2, 0x1B },
+  { 0x44, 0xF4, 0x36 },
+  { 0x44, 0xFB, 0x42 },
+  { 0x44, 0xFB, 0x5A },
+  { 0x44, 0xFF, 0xBA },
+  { 0x48, 0x00, 0x20 },
+  { 0x48, 0x00, 0x31 },
+  { 0x48, 0x00, 0xB3 },
+  { 0x48, 0x0E, 0xEC },
+  { 0x48, 0x12, 0x58 },
+  { 0x48, 0x12, 0x8F },
+  { 0x48, 0x1B, 0xA4 },
+  { 0x48, 0x1D, 0x70 },
+  { 0x48, 0x22, 0x54 },
+  { 0x48, 0x26, 0x2C },
+  { 0x48, 0x27, 0xC5 },
+  { 0x48, 0x27, 0xE2 },
+  { 0x48, 0x28, 0x2F },
+  { 0x48, 0x2C, 0xA0 },
+  { 0x48, 0x2C, 0xD0 },
+  { 0x48, 0x2E, 0x72 },
+  { 0x48, 0x2F, 0x6B },
+  { 0x48, 0x2F, 0xD7 },
+  { 0x48, 0x31, 0x77 },
+  { 0x48, 0x31, 0xB7 },
+  { 0x48, 0x35, 0x2B },
+  { 0x48, 0x3B, 0x38 },
+  { 0x48, 0x3C, 0x0C },
+  { 0x48, 0x3F, 0xDA },
+  { 0x48, 0x3F, 0xE9 },
+  { 0x48, 0x43, 0x5A },
+  { 0x48, 0x43, 0x7C },
+  { 0x48, 0x43, 0xDD },
+  { 0x48, 0x44, 0x87 },
+  { 0x48, 0x46, 0xFB },
+  { 0x48, 0x4B, 0xAA },
+  { 0x48, 0x4C, 0x29 },
+  { 0x48, 0x50, 0x73 },
+  { 0x48, 0x55, 0x19 },
+  { 0x48, 0x57, 0x02 },
+  { 0x48, 0x59, 0xA4 },
+  { 0x48, 0x5B, 0x39 },
+  { 0x48, 0x5D, 0x35 },
+  { 0x48, 0x5F, 0x08 },
+  { 0x48, 0x5F, 0xDF },
+  { 0x48, 0x60, 0xBC },
+  { 0x48, 0x62, 0x76 },
+  { 0x48, 0x70, 0x6F },
+  { 0x48, 0x74, 0x10 },
+  { 0x48, 0x74, 0x6E },
+  { 0x48, 0x78, 0x5E },
+  { 0x48, 0x7B, 0x6B },
+  { 0x48, 0x7D, 0x2E },
+  { 0x48, 0x80, 0x02 },
+  { 0x48, 0x86, 0xE8 },
+  { 0x48, 0x87, 0x59 },
+  { 0x48, 0x8B, 0x0A },
+  { 0x48, 0x8E, 0xEF },
+  { 0x48, 0x8F, 0x5A },
+  { 0x48, 0x91, 0xD5 },
+  { 0x48, 0xA1, 0x95 },
+  { 0x48, 0xA5, 0xE7 },
+  { 0x48, 0xA6, 0xB8 },
+  { 0x48, 0xA7, 0x4E },
+  { 0x48, 0xA9, 0x1C },
+  { 0x48, 0xA9, 0x8A },
+  { 0x48, 0xAD, 0x08 },
+  { 0x48, 0xB2, 0x5D },
+  { 0x48, 0xB4, 0x23 },
+  { 0x48, 0xB4, 0xC3 },
+  { 0x48, 0xB8, 0xA3 },
+  { 0x48, 0xBD, 0x4A },
+  { 0x48, 0xBF, 0x6B },
+  { 0x48, 0xCA, 0x43 },
+  { 0x48, 0xCD, 0xD3 },
+  { 0x48, 0xD5, 0x39 },
+  { 0x48, 0xD6, 0xD5 },
+  { 0x48, 0xD7, 0x05 },
+  { 0x48, 0xDB, 0x50 },
+  { 0x48, 0xDC, 0x2D },
+  { 0x48, 0xE1, 0x5C },
+  { 0x48, 0xE7, 0x29 },
+  { 0x48, 0xE9, 0xF1 },
+  { 0x48, 0xED, 0xE6 },
+  { 0x48, 0xEE, 0x0C },
+  { 0x48, 0xF8, 0xB3 },
+  { 0x48, 0xF8, 0xDB },
+  { 0x48, 0xFD, 0x8E },
+  { 0x48, 0xFD, 0xA3 },
+  { 0x4C, 0x00, 0x82 },
+  { 0x4C, 0x02, 0x20 },
+  { 0x4C, 0x09, 0xB4 },
+  { 0x4C, 0x10, 0xD5 },
+  { 0x4C, 0x11, 0xAE },
+  { 0x4C, 0x16, 0xF1 },
+  { 0x4C, 0x17, 0x44 },
+  { 0x4C, 0x1F, 0xCC },
+  { 0x4C, 0x20, 0xB8 },
+  { 0x4C, 0x2E, 0xB4 },
+  { 0x4C, 0x32, 0x75 },
+  { 0x4C, 0x3B, 0xDF },
+  { 0x4C, 0x42, 0x1E },
+  { 0x4C, 0x49, 0x4F },
+  { 0x4C, 0x49, 0xE3 },
+  { 0x4C, 0x4C, 0xD8 },
+  { 0x4C, 0x4E, 0x35 },
+  { 0x4C, 0x53, 0xFD },
+  { 0x4C, 0x54, 0x99 },
+  { 0x4C, 0x56, 0x9D },
+  { 0x4C, 0x57, 0xCA },
+  { 0x4C, 0x5D, 0x3C },
+  { 0x4C, 0x5E, 0x0C },
+  { 0x4C, 0x60, 0xDE },
+  { 0x4C, 0x63, 0x71 },
+  { 0x4C, 0x6B, 0xE8 },
+  { 0x4C, 0x71, 0x0C },
+  { 0x4C, 0x71, 0x0D },
+  { 0x4C, 0x74, 0xBF },
+  { 0x4C, 0x75, 0x25 },
+  { 0x4C, 0x77, 0x6D },
+  { 0x4C, 0x79, 0x75 },
+  { 0x4C, 0x7C, 0x5F },
+  { 0x4C, 0x7C, 0xD9 },
+  { 0x4C, 0x83, 0xDE },
+  { 0x4C, 0x8B, 0xEF },
+  { 0x4C, 0x8D, 0x53 },
+  { 0x4C, 0x8D, 0x79 },
+  { 0x4C, 0x97, 0xCC },
+  { 0x4C, 0x9E, 0xFF },
+  { 0x4C, 0xA6, 0x4D },
+  { 0x4C, 0xAB, 0x4F },
+  { 0x4C, 0xAB, 0xFC },
+  { 0x4C, 0xAC, 0x0A },
+  { 0x4C, 0xAE, 0x13 },
+  { 0x4C, 0xB0, 0x87 },
+  { 0x4C, 0xB1, 0x6C },
+  { 0x4C, 0xB1, 0x99 },
+  { 0x4C, 0xB1, 0xCD },
+  { 0x4C, 0xB9, 0x10 },
+  { 0x4C, 0xBC, 0x48 },
+  { 0x4C, 0xC5, 0x3E },
+  { 0x4C, 0xC8, 0xA1 },
+  { 0x4C, 0xCB, 0xF5 },
+  { 0x4C, 0xD0, 0xCB },
+  { 0x4C, 0xD0, 0xDD },
+  { 0x4C, 0xD1, 0xA1 },
+  { 0x4C, 0xD5, 0x87 },
+  { 0x4C, 0xD6, 0x29 },
+  { 0x4C, 0xE0, 0xDB },
+  { 0x4C, 0xE1, 0x75 },
+  { 0x4C, 0xE1, 0x76 },
+  { 0x4C, 0xE6, 0x76 },
+  { 0x4C, 0xE6, 0xC0 },
+  { 0x4C, 0xEB, 0xD6 },
+  { 0x4C, 0xEC, 0x0F },
+  { 0x4C, 0xED, 0xFB },
+  { 0x4C, 0xEF, 0xC0 },
+  { 0x4C, 0xF2, 0x02 },
+  { 0x4C, 0xF5, 0x5B },
+  { 0x4C, 0xF9, 0x5D },
+  { 0x4C, 0xFB, 0x45 },
+  { 0x50, 0x01, 0x6B },
+  { 0x50, 0x01, 0xD9 },
+  { 0x50, 0x02, 0x91 },
+  { 0x50, 0x04, 0xB8 },
+  { 0x50, 0x06, 0x04 },
+  { 0x50, 0x06, 0xAB },
+  { 0x50, 0x07, 0xC3 },
+  { 0x50, 0x0B, 0x26 },
+  { 0x50, 0x0F, 0x80 },
+  { 0x50, 0x14, 0xC1 },
+  { 0x50, 0x17, 0xFF },
+  { 0x50, 0x1C, 0xB0 },
+  { 0x50, 0x1C, 0xBF },
+  { 0x50, 0x1D, 0x93 },
+  { 0x50, 0x1F, 0xC6 },
+  { 0x50, 0x23, 0x6D },
+  { 0x50, 0x23, 0xA2 },
+  { 0x50, 0x2F, 0xA8 },
+  { 0x50, 0x32, 0x37 },
+  { 0x50, 0x39, 0x55 },
+  { 0x50, 0x3D, 0xC6 },
+  { 0x50, 0x3D, 0xE5 },
+  { 0x50, 0x3E, 0xAA },
+  { 0x50, 0x41, 0x72 },
+  { 0x50, 0x42, 0x89 },
+  { 0x50, 0x46, 0x4A },
+  { 0x50, 0x46, 0x5D },
+  { 0x50, 0x49, 0x21 },
+  { 0x50, 0x4A, 0x6E },
+  { 0x50, 0x57, 0x8A },
+  { 0x50, 0x57, 0xA8 },
+  { 0x50, 0x5C, 0x88 },
+  { 0x50, 0x5D, 0x7A },
+  { 0x50, 0x5D, 0xAC },
+  { 0x50, 0x5E, 0x24 },
+  { 0x50, 0x61, 0xBF },
+  { 0x50, 0x63, 0x91 },
+  { 0x50, 0x67, 0xAE },
+  { 0x50, 0x67, 0xF0 },
+  { 0x50, 0x68, 0x0A },
+  { 0x50, 0x6A, 0x03 },
+  { 0x50, 0x6F, 0x77 },
+  { 0x50, 0x78, 0xB3 },
+  { 0x50, 0x7A, 0x55 },
+  { 0x50, 0x7A, 0xC5 },
+  { 0x50, 0x82, 0xD5 },
+  { 0x50, 0x87, 0x89 },
+  { 0x50, 0x8E, 0x49 },
+  { 0x50, 0x8F, 0x4C },
+  { 0x50, 0x91, 0xE3 },
+  { 0x50, 0x98, 0x39 },
+  { 0x50, 0x9A, 0x88 },
+  { 0x50, 0x9F, 0x27 },
+  { 0x50, 0xA0, 0x09 },
+  { 0x50, 0xA6, 0x7F },
+  { 0x50, 0xA6, 0xD8 },
+  { 0x50, 0xA7, 0x2B },
+  { 0x50, 0xA7, 0x33 },
+  { 0x50, 0xAF, 0x4D },
+  { 0x50, 0xB1, 0x27 },
+  { 0x50, 0xBC, 0x96 },
+  { 0x50, 0xBD, 0x5F },
+  { 0x50, 0xC4, 0xDD },
+  { 0x50, 0xC7, 0xBF },
+  { 0x50, 0xD4, 0x5C },
+  { 0x50, 0xD4, 0xF7 },
+  { 0x50, 0xDA, 0xD6 },
+  { 0x50, 0xDC, 0xE7 },
+  { 0x50, 0xDE, 0x06 },
+  { 0x50, 0xE0, 0x39 },
+  { 0x50, 0xE2, 0x4E },
+  { 0x50, 0xE4, 0xE0 },
+  { 0x50, 0xE6, 0x36 },
+  { 0x50, 0xEA, 0xD6 },
+  { 0x50, 0xEB, 0xF6 },
+  { 0x50, 0xED, 0x3C },
+  { 0x50, 0xF4, 0xEB },
+  { 0x50, 0xF5, 0xDA },
+  { 0x50, 0xF7, 0x22 },
+  { 0x50, 0xFA, 0x84 },
+  { 0x54, 0x02, 0x95 },
+  { 0x54, 0x04, 0xA6 },
+  { 0x54, 0x07, 0x7D },
+  { 0x54, 0x09, 0x10 },
+  { 0x54, 0x09, 0x55 },
+  { 0x54, 0x10, 0x2E },
+  { 0x54, 0x12, 0xCB },
+  { 0x54, 0x13, 0x10 },
+  { 0x54, 0x1F, 0x8D },
+  { 0x54, 0x22, 0x59 },
+  { 0x54, 0x22, 0xF8 },
+  { 0x54, 0x25, 0xEA },
+  { 0x54, 0x26, 0x96 },
+  { 0x54, 0x2A, 0x1B },
+  { 0x54, 0x2B, 0x8D },
+  { 0x54, 0x32, 0x04 },
+  { 0x54, 0x32, 0xC7 },
+  { 0x54, 0x33, 0xC6 },
+  { 0x54, 0x33, 0xCB },
+  { 0x54, 0x34, 0xEF },
+  { 0x54, 0x39, 0xDF },
+  { 0x54, 0x3D, 0x37 },
+  { 0x54, 0x43, 0xB2 },
+  { 0x54, 0x44, 0x3B },
+  { 0x54, 0x46, 0x17 },
+  { 0x54, 0x4A, 0x00 },
+  { 0x54, 0x4C, 0x8A },
+  { 0x54, 0x4E, 0x90 },
+  { 0x54, 0x51, 0x1B },
+  { 0x54, 0x51, 0xDE },
+  { 0x54, 0x5A, 0xA6 },
+  { 0x54, 0x60, 0x09 },
+  { 0x54, 0x60, 0x6D },
+  { 0x54, 0x62, 0xE2 },
+  { 0x54, 0x69, 0x90 },
+  { 0x54, 0x72, 0x4F },
+  { 0x54, 0x75, 0x95 },
+  { 0x54, 0x75, 0xD0 },
+  { 0x54, 0x78, 0x1A },
+  { 0x54, 0x7C, 0x69 },
+  { 0x54, 0x7F, 0xEE },
+  { 0x54, 0x83, 0x3A },
+  { 0x54, 0x84, 0xDC },
+  { 0x54, 0x86, 0xBC },
+  { 0x54, 0x88, 0xDE },
+  { 0x54, 0x89, 0x98 },
+  { 0x54, 0x8A, 0xBA },
+  { 0x54, 0x92, 0x09 },
+  { 0x54, 0x99, 0x63 },
+  { 0x54, 0x9F, 0x13 },
+  { 0x54, 0x9F, 0xC6 },
+  { 0x54, 0xA0, 0x50 },
+  { 0x54, 0xA2, 0x74 },
+  { 0x54, 0xA5, 0x1B },
+  { 0x54, 0xA7, 0x03 },
+  { 0x54, 0xAE, 0x27 },
+  { 0x54, 0xAF, 0x97 },
+  { 0x54, 0xB1, 0x21 },
+  { 0x54, 0xB8, 0x0A },
+  { 0x54, 0xBA, 0xD6 },
+  { 0x54, 0xBE, 0x53 },
+  { 0x54, 0xC4, 0x80 },
+  { 0x54, 0xC8, 0x0F },
+  { 0x54, 0xCE, 0x82 },
+  { 0x54, 0xCF, 0x8D },
+  { 0x54, 0xD4, 0x6F },
+  { 0x54, 0xD7, 0xE3 },
+  { 0x54, 0xDE, 0xD3 },
+  { 0x54, 0xE4, 0x3A },
+  { 0x54, 0xE6, 0x1B },
+  { 0x54, 0xE6, 0xFC },
+  { 0x54, 0xEA, 0xA8 },
+  { 0x54, 0xEB, 0xE9 },
+  { 0x54, 0xEC, 0x2F },
+  { 0x54, 0xEF, 0x43 },
+  { 0x54, 0xF0, 0xB1 },
+  { 0x54, 0xF6, 0xE2 },
+  { 0x58, 0x0A, 0x20 },
+  { 0x58, 0x0A, 0xD4 },
+  { 0x58, 0x11, 0x22 },
+  { 0x58, 0x1F, 0x28 },
+  { 0x58, 0x1F, 0xAA },
+  { 0x58, 0x20, 0x59 },
+  { 0x58, 0x24, 0x29 },
+  { 0x58, 0x25, 0x75 },
+  { 0x58, 0x27, 0x8C },
+  { 0x58, 0x2A, 0xF7 },
+  { 0x58, 0x2F, 0x40 },
+  { 0x58, 0x35, 0xD9 },
+  { 0x58, 0x36, 0x53 },
+  { 0x58, 0x40, 0x4E },
+  { 0x58, 0x41, 0x20 },
+  { 0x58, 0x44, 0x98 },
+  { 0x58, 0x55, 0x95 },
+  { 0x58, 0x55, 0xCA },
+  { 0x58, 0x56, 0x9F },
+  { 0x58, 0x56, 0xC2 },
+  { 0x58, 0x5F, 0xF6 },
+  { 0x58, 0x60, 0x5F },
+  { 0x58, 0x64, 0xC4 },
+  { 0x58, 0x6B, 0x14 },
+  { 0x58, 0x6D, 0x8F },
+  { 0x58, 0x73, 0xD1 },
+  { 0x58, 0x73, 0xD8 },
+  { 0x58, 0x7F, 0x57 },
+  { 0x58, 0x7F, 0x66 },
+  { 0x58, 0x8B, 0x1C },
+  { 0x58, 0x8B, 0xF3 },
+  { 0x58, 0x8D, 0x09 },
+  { 0x58, 0x93, 0x96 },
+  { 0x58, 0x97, 0x1E },
+  { 0x58, 0x97, 0xBD },
+  { 0x58, 0x9A, 0x3E },
+  { 0x58, 0xAC, 0x78 },
+  { 0x58, 0xAD, 0x12 },
+  { 0x58, 0xAE, 0xA8 },
+  { 0x58, 0xB0, 0x35 },
+  { 0x58, 0xB0, 0x3E },
+  { 0x58, 0xB6, 0x33 },
+  { 0x58, 0xB9, 0x65 },
+  { 0x58, 0xBA, 0xD4 },
+  { 0x58, 0xBC, 0x27 },
+  { 0x58, 0xBD, 0xA3 },
+  { 0x58, 0xBE, 0x72 },
+  { 0x58, 0xBF, 0x25 },
+  { 0x58, 0xBF, 0xEA },
+  { 0x58, 0xCB, 0x52 },
+  { 0x58, 0xCF, 0x79 },
+  { 0x58, 0xD0, 0x61 },
+  { 0x58, 0xD3, 0x12 },
+  { 0x58, 0xD3, 0x49 },
+  { 0x58, 0xD5, 0x6E },
+  { 0x58, 0xD7, 0x59 },
+  { 0x58, 0xE2, 0x8F },
+  { 0x58, 0xE4, 0x88 },
+  { 0x58, 0xE6, 0xBA },
+  { 0x58, 0xEF, 0x68 },
+  { 0x58, 0xF3, 0x9C },
+  { 0x58, 0xF8, 0xD7 },
+  { 0x58, 0xF9, 0x87 },
+  { 0x58, 0xFB, 0x96 },
+  { 0x58, 0xFF, 0xA1 },
+  { 0x5C, 0x03, 0x39 },
+  { 0x5C, 0x07, 0xA6 },
+  { 0x5C, 0x09, 0x47 },
+  { 0x5C, 0x09, 0x79 },
+  { 0x5C, 0x0C, 0xE6 },
+  { 0x5C, 0x10, 0x1E },
+  { 0x5C, 0x16, 0x7D },
+  { 0x5C, 0x1B, 0xF4 },
+  { 0x5C, 0x1D, 0xD9 },
+  { 0x5C, 0x31, 0x92 },
+  { 0x5C, 0x33, 0x7B },
+  { 0x5C, 0x3A, 0x3D },
+  { 0x5C, 0x3E, 0x06 },
+  { 0x5C, 0x3E, 0x1B },
+  { 0x5C, 0x49, 0x79 },
+  { 0x5C, 0x4C, 0xA9 },
+  { 0x5C, 0x4D, 0xBF },
+  { 0x5C, 0x50, 0x15 },
+  { 0x5C, 0x50, 0xD9 },
+  { 0x5C, 0x52, 0x1E },
+  { 0x5C, 0x52, 0x30 },
+  { 0x5C, 0x52, 0x84 },
+  { 0x5C, 0x54, 0x6D },
+  { 0x5C, 0x59, 0x48 },
+  { 0x5C, 0x5A, 0xC7 },
+  { 0x5C, 0x5B, 0x35 },
+  { 0x5C, 0x62, 0x8B },
+  { 0x5C, 0x63, 0xBF },
+  { 0x5C, 0x64, 0x7A },
+  { 0x5C, 0x64, 0x8E },
+  { 0x5C, 0x64, 0xF1 },
+  { 0x5C, 0x6A, 0x80 },
+  { 0x5C, 0x70, 0x17 },
+  { 0x5C, 0x70, 0x75 },
+  { 0x5C, 0x71, 0x0D },
+  { 0x5C, 0x7D, 0x5E },
+  { 0x5C, 0x83, 0x6C },
+  { 0x5C, 0x83, 0x8F },
+  { 0x5C, 0x87, 0x30 },
+  { 0x5C, 0x89, 0x9A },
+  { 0x5C, 0x8B, 0x6B },
+  { 0x5C, 0x8D, 0x4E },
+  { 0x5C, 0x91, 0x57 },
+  { 0x5C, 0x91, 0x75 },
+  { 0x5C, 0x95, 0xAE },
+  { 0x5C, 0x96, 0x9D },
+  { 0x5C, 0x97, 0xF3 },
+  { 0x5C, 0xA4, 0x7D },
+  { 0x5C, 0xA4, 0x8A },
+  { 0x5C, 0xA4, 0xF4 },
+  { 0x5C, 0xA6, 0x2D },
+  { 0x5C, 0xA6, 0xE6 },
+  { 0x5C, 0xA8, 0x6A },
+  { 0x5C, 0xAA, 0xFD },
+  { 0x5C, 0xAD, 0xCF },
+  { 0x5C, 0xB0, 0x0A },
+  { 0x5C, 0xB1, 0x2E },
+  { 0x5C, 0xB3, 0x95 },
+  { 0x5C, 0xB4, 0x3E },
+  { 0x5C, 0xBA, 0x37 },
+  { 0x5C, 0xBB, 0xEE },
+  { 0x5C, 0xC0, 0xA0 },
+  { 0x5C, 0xC3, 0x07 },
+  { 0x5C, 0xCF, 0x7F },
+  { 0x5C, 0xD0, 0x6E },
+  { 0x5C, 0xD9, 0x98 },
+  { 0x5C, 0xDF, 0x89 },
+  { 0x5C, 0xE1, 0x76 },
+  { 0x5C, 0xE2, 0x8C },
+  { 0x5C, 0xE7, 0x47 },
+  { 0x5C, 0xE8, 0x83 },
+  { 0x5C, 0xE9, 0x1E },
+  { 0x5C, 0xE9, 0x31 },
+  { 0x5C, 0xF4, 0xAB },
+  { 0x5C, 0xF5, 0xDA },
+  { 0x5C, 0xF7, 0xE6 },
+  { 0x5C, 0xF9, 0x38 },
+  { 0x5C, 0xF9, 0x6A },
+  { 0x5C, 0xFC, 0x66 },
+  { 0x60, 0x01, 0x94 },
+  { 0x60, 0x01, 0xB1 },
+  { 0x60, 0x03, 0x08 },
+  { 0x60, 0x06, 0xE3 },
+  { 0x60, 0x08, 0x10 },
+  { 0x60, 0x0F, 0x6B },
+  { 0x60, 0x10, 0x9E },
+  { 0x60, 0x12, 0x3C },
+  { 0x60, 0x14, 0x66 },
+  { 0x60, 0x18, 0x88 },
+  { 0x60, 0x1A, 0xC7 },
+  { 0x60, 0x22, 0x32 },
+  { 0x60, 0x26, 0xAA },
+  { 0x60, 0x26, 0xEF },
+  { 0x60, 0x29, 0x2B },
+  { 0x60, 0x2A, 0xD0 },
+  { 0x60, 0x2E, 0x20 },
+  { 0x60, 0x30, 0xD4 },
+  { 0x60, 0x31, 0x97 },
+  { 0x60, 0x32, 0xB1 },
+  { 0x60, 0x33, 0x4B },
+  { 0x60, 0x38, 0xE0 },
+  { 0x60, 0x3A, 0x7C },
+  { 0x60, 0x3D, 0x29 },
+  { 0x60, 0x3E, 0x5F },
+  { 0x60, 0x45, 0xCB },
+  { 0x60, 0x4D, 0xE1 },
+  { 0x60, 0x53, 0x75 },
+  { 0x60, 0x55, 0xF9 },
+  { 0x60, 0x57, 0xC8 },
+  { 0x60, 0x63, 0x4C },
+  { 0x60, 0x65, 0x25 },
+  { 0x60, 0x69, 0x44 },
+  { 0x60, 0x6B, 0xB3 },
+  { 0x60, 0x6B, 0xFF },
+  { 0x60, 0x6E, 0xE8 },
+  { 0x60, 0x70, 0x6C },
+  { 0x60, 0x70, 0xC0 },
+  { 0x60, 0x73, 0x5C },
+  { 0x60, 0x73, 0xBC },
+  { 0x60, 0x7E, 0xC9 },
+  { 0x60, 0x7E, 0xCD },
+  { 0x60, 0x82, 0x46 },
+  { 0x60, 0x83, 0x34 },
+  { 0x60, 0x83, 0x73 },
+  { 0x60, 0x84, 0xBD },
+  { 0x60, 0x8B, 0x0E },
+  { 0x60, 0x8C, 0x4A },
+  { 0x60, 0x92, 0x17 },
+  { 0x60, 0x93, 0x16 },
+  { 0x60, 0x95, 0xBD },
+  { 0x60, 0x96, 0xA4 },
+  { 0x60, 0x9A, 0xC1 },
+  { 0x60, 0x9B, 0xB4 },
+  { 0x60, 0xA2, 0xC6 },
+  { 0x60, 0xA3, 0x7D },
+  { 0x60, 0xA4, 0x4C },
+  { 0x60, 0xA4, 0xB7 },
+  { 0x60, 0xA6, 0xC5 },
+  { 0x60, 0xAB, 0x67 },
+  { 0x60, 0xB7, 0x6E },
+  { 0x60, 0xB9, 0xC0 },
+  { 0x60, 0xBE, 0xC4 },
+  { 0x60, 0xC5, 0x47 },
+  { 0x60, 0xCE, 0x41 },
+  { 0x60, 0xD0, 0x2C },
+  { 0x60, 0xD0, 0x39 },
+  { 0x60, 0xD7, 0x55 },
+  { 0x60, 0xD9, 0xC7 },
+  { 0x60, 0xDD, 0x70 },
+  { 0x60, 0xDE, 0x44 },
+  { 0x60, 0xDE, 0xF3 },
+  { 0x60, 0xE3, 0x27 },
+  { 0x60, 0xE5, 0xD8 },
+  { 0x60, 0xE7, 0x01 },
+  { 0x60, 0xF1, 0x8A },
+  { 0x60, 0xF4, 0x45 },
+  { 0x60, 0xF8, 0x1D },
+  { 0x60, 0xFA, 0x9D },
+  { 0x60, 0xFA, 0xCD },
+  { 0x60, 0xFB, 0x42 },
+  { 0x60, 0xFD, 0xA6 },
+  { 0x60, 0xFE, 0xC5 },
+  { 0x64, 0x00, 0xF1 },
+  { 0x64, 0x09, 0x80 },
+  { 0x64, 0x0B, 0xD7 },
+  { 0x64, 0x12, 0x25 },
+  { 0x64, 0x13, 0x6C },
+  { 0x64, 0x13, 0xAB },
+  { 0x64, 0x16, 0x8D },
+  { 0x64, 0x16, 0xF0 },
+  { 0x64, 0x20, 0x0C },
+  { 0x64, 0x29, 0x43 },
+  { 0x64, 0x2C, 0xAC },
+  { 0x64, 0x3A, 0xEA },
+  { 0x64, 0x3E, 0x0A },
+  { 0x64, 0x3E, 0x8C },
+  { 0x64, 0x41, 0xE6 },
+  { 0x64, 0x53, 0xE0 },
+  { 0x64, 0x56, 0x01 },
+  { 0x64, 0x5A, 0x36 },
+  { 0x64, 0x5A, 0xED },
+  { 0x64, 0x5E, 0x10 },
+  { 0x64, 0x66, 0xB3 },
+  { 0x64, 0x67, 0xCD },
+  { 0x64, 0x6D, 0x2F },
+  { 0x64, 0x6D, 0x4E },
+  { 0x64, 0x6D, 0x6C },
+  { 0x64, 0x6E, 0x60 },
+  { 0x64, 0x6E, 0x97 },
+  { 0x64, 0x70, 0x02 },
+  { 0x64, 0x70, 0x33 },
+  { 0x64, 0x76, 0xBA },
+  { 0x64, 0x85, 0x05 },
+  { 0x64, 0x8F, 0x3E },
+  { 0x64, 0x9A, 0xBE },
+  { 0x64, 0x9E, 0xF3 },
+  { 0x64, 0xA0, 0xE7 },
+  { 0x64, 0xA2, 0x00 },
+  { 0x64, 0xA3, 0xCB },
+  { 0x64, 0xA5, 0xC3 },
+  { 0x64, 0xA6, 0x51 },
+  { 0x64, 0xAE, 0x0C },
+  { 0x64, 0xB0, 0xA6 },
+  { 0x64, 0xB4, 0x73 },
+  { 0x64, 0xB5, 0xC6 },
+  { 0x64, 0xB7, 0x08 },
+  { 0x64, 0xB9, 0xE8 },
+  { 0x64, 0xBA, 0xA4 },
+  { 0x64, 0xBF, 0x6B },
+  { 0x64, 0xC3, 0x94 },
+  { 0x64, 0xC7, 0x53 },
+  { 0x64, 0xCC, 0x2E },
+  { 0x64, 0xD1, 0x54 },
+  { 0x64, 0xD2, 0xC4 },
+  { 0x64, 0xD8, 0x14 },
+  { 0x64, 0xD9, 0x89 },
+  { 0x64, 0xDB, 0x38 },
+  { 0x64, 0xDD, 0xE9 },
+  { 0x64, 0xE6, 0x82 },
+  { 0x64, 0xE8, 0x33 },
+  { 0x64, 0xE8, 0x81 },
+  { 0x64, 0xE9, 0x50 },
+  { 0x64, 0xF6, 0x9D },
+  { 0x64, 0xF8, 0x1C },
+  { 0x68, 0x09, 0x27 },
+  { 0x68, 0x13, 0xF3 },
+  { 0x68, 0x1A, 0xB2 },
+  { 0x68, 0x1B, 0xEF },
+  { 0x68, 0x27, 0x5F },
+  { 0x68, 0x28, 0xCF },
+  { 0x68, 0x2C, 0x7B },
+  { 0x68, 0x2F, 0x67 },
+  { 0x68, 0x37, 0xE9 },
+  { 0x68, 0x3A, 0x1E },
+  { 0x68, 0x3B, 0x78 },
+  { 0x68, 0x3E, 0xC0 },
+  { 0x68, 0x45, 0xCC },
+  { 0x68, 0x49, 0x83 },
+  { 0x68, 0x49, 0x92 },
+  { 0x68, 0x4A, 0xAE },
+  { 0x68, 0x4D, 0xB6 },
+  { 0x68, 0x54, 0xFD },
+  { 0x68, 0x5B, 0x35 },
+  { 0x68, 0x64, 0x4B },
+  { 0x68, 0x67, 0x25 },
+  { 0x68, 0x6C, 0xE6 },
+  { 0x68, 0x71, 0x61 },
+  { 0x68, 0x72, 0x51 },
+  { 0x68, 0x77, 0x24 },
+  { 0x68, 0x77, 0xDA },
+  { 0x68, 0x79, 0x09 },
+  { 0x68, 0x7D, 0xB4 },
+  { 0x68, 0x7F, 0x74 },
+  { 0x68, 0x7F, 0xF0 },
+  { 0x68, 0x81, 0xE0 },
+  { 0x68, 0x83, 0xCB },
+  { 0x68, 0x86, 0xA7 },
+  { 0x68, 0x87, 0xC6 },
+  { 0x68, 0x89, 0xC1 },
+  { 0x68, 0x8A, 0xF0 },
+  { 0x68, 0x8F, 0x84 },
+  { 0x68, 0x92, 0x34 },
+  { 0x68, 0x94, 0x4A },
+  { 0x68, 0x96, 0x2E },
+  { 0x68, 0x96, 0x7B },
+  { 0x68, 0x99, 0xCD },
+  { 0x68, 0x9A, 0x87 },
+  { 0x68, 0x9C, 0x70 },
+  { 0x68, 0x9C, 0xE2 },
+  { 0x68, 0x9E, 0x0B },
+  { 0x68, 0x9E, 0x29 },
+  { 0x68, 0x9F, 0xF0 },
+  { 0x68, 0xA0, 0x3E },
+  { 0x68, 0xA0, 0xF6 },
+  { 0x68, 0xA4, 0x6A },
+  { 0x68, 0xA8, 0x28 },
+  { 0x68, 0xA8, 0x6D },
+  { 0x68, 0xAB, 0x1E },
+  { 0x68, 0xAE, 0x20 },
+  { 0x68, 0xB6, 0x91 },
+  { 0x68, 0xB6, 0xB3 },
+  { 0x68, 0xBC, 0x0C },
+  { 0x68, 0xBD, 0xAB },
+  { 0x68, 0xC4, 0x4C },
+  { 0x68, 0xC6, 0x3A },
+  { 0x68, 0xCA, 0xC4 },
+  { 0x68, 0xCA, 0xE4 },
+  { 0x68, 0xCC, 0x6E },
+  { 0x68, 0xD7, 0x9A },
+  { 0x68, 0xD9, 0x27 },
+  { 0x68, 0xD9, 0x3C },
+  { 0x68, 0xDB, 0xCA },
+  { 0x68, 0xDB, 0xF5 },
+  { 0x68, 0xDD, 0xB7 },
+  { 0x68, 0xDF, 0xDD },
+  { 0x68, 0xE1, 0xDC },
+  { 0x68, 0xE2, 0x09 },
+  { 0x68, 0xE5, 0x9E },
+  { 0x68, 0xEE, 0x96 },
+  { 0x68, 0xEF, 0x43 },
+  { 0x68, 0xEF, 0xBD },
+  { 0x68, 0xF5, 0x43 },
+  { 0x68, 0xF6, 0x3B },
+  { 0x68, 0xFB, 0x7E },
+  { 0x68, 0xFE, 0xF7 },
+  { 0x68, 0xFF, 0x7B },
+  { 0x6C, 0x03, 0x09 },
+  { 0x6C, 0x03, 0xB5 },
+  { 0x6C, 0x04, 0x7A },
+  { 0x6C, 0x0C, 0x9A },
+  { 0x6C, 0x13, 0xD5 },
+  { 0x6C, 0x14, 0x6E },
+  { 0x6C, 0x15, 0x44 },
+  { 0x6C, 0x16, 0x32 },
+  { 0x6C, 0x19, 0x8F },
+  { 0x6C, 0x19, 0xC0 },
+  { 0x6C, 0x20, 0x56 },
+  { 0x6C, 0x26, 0x36 },
+  { 0x6C, 0x29, 0xD2 },
+  { 0x6C, 0x31, 0x0E },
+  { 0x6C, 0x34, 0x91 },
+  { 0x6C, 0x3B, 0x6B },
+  { 0x6C, 0x3E, 0x6D },
+  { 0x6C, 0x40, 0x08 },
+  { 0x6C, 0x41, 0x0E },
+  { 0x6C, 0x41, 0x6A },
+  { 0x6C, 0x44, 0x2A },
+  { 0x6C, 0x48, 0x3F },
+  { 0x6C, 0x4A, 0x85 },
+  { 0x6C, 0x4D, 0x73 },
+  { 0x6C, 0x4E, 0xF6 },
+  { 0x6C, 0x50, 0x4D },
+  { 0x6C, 0x55, 0x8D },
+  { 0x6C, 0x56, 0x97 },
+  { 0x6C, 0x5A, 0xB0 },
+  { 0x6C, 0x5D, 0x3A },
+  { 0x6C, 0x5E, 0x3B },
+  { 0x6C, 0x67, 0xEF },
+  { 0x6C, 0x6C, 0x0F },
+  { 0x6C, 0x6C, 0xD3 },
+  { 0x6C, 0x70, 0x9F },
+  { 0x6C, 0x71, 0x0D },
+  { 0x6C, 0x71, 0xD2 },
+  { 0x6C, 0x72, 0x20 },
+  { 0x6C, 0x72, 0xE7 },
+  { 0x6C, 0x7E, 0x67 },
+  { 0x6C, 0x7F, 0x0C },
+  { 0x6C, 0x8B, 0x2F },
+  { 0x6C, 0x8B, 0xD3 },
+  { 0x6C, 0x8D, 0x77 },
+  { 0x6C, 0x8D, 0xC1 },
+  { 0x6C, 0x94, 0xF8 },
+  { 0x6C, 0x96, 0xCF },
+  { 0x6C, 0x99, 0x89 },
+  { 0x6C, 0x99, 0x9D },
+  { 0x6C, 0x9C, 0xED },
+  { 0x6C, 0xA7, 0x5F },
+  { 0x6C, 0xAA, 0xB3 },
+  { 0x6C, 0xAB, 0x05 },
+  { 0x6C, 0xAB, 0x31 },
+  { 0x6C, 0xB0, 0xCE },
+  { 0x6C, 0xB1, 0x33 },
+  { 0x6C, 0xB1, 0x58 },
+  { 0x6C, 0xB2, 0xAE },
+  { 0x6C, 0xB4, 0x56 },
+  { 0x6C, 0xB7, 0x49 },
+  { 0x6C, 0xB7, 0xE2 },
+  { 0x6C, 0xB8, 0x81 },
+  { 0x6C, 0xC2, 0x6B },
+  { 0x6C, 0xC3, 0xB2 },
+  { 0x6C, 0xC4, 0x9F },
+  { 0x6C, 0xCD, 0xD6 },
+  { 0x6C, 0xD1, 0xE5 },
+  { 0x6C, 0xD2, 0xBA },
+  { 0x6C, 0xD6, 0x3F },
+  { 0x6C, 0xD6, 0xE3 },
+  { 0x6C, 0xD7, 0x04 },
+  { 0x6C, 0xDD, 0x30 },
+  { 0x6C, 0xDE, 0xA9 },
+  { 0x6C, 0xE5, 0xC9 },
+  { 0x6C, 0xE8, 0x5C },
+  { 0x6C, 0xE8, 0x73 },
+  { 0x6C, 0xE8, 0x74 },
+  { 0x6C, 0xEB, 0xB6 },
+  { 0x6C, 0xEF, 0xBD },
+  { 0x6C, 0xF3, 0x7F },
+  { 0x6C, 0xF7, 0x84 },
+  { 0x6C, 0xFA, 0x89 },
+  { 0x70, 0x01, 0xB5 },
+  { 0x70, 0x03, 0x9F },
+  { 0x70, 0x04, 0x1D },
+  { 0x70, 0x0B, 0x4F },
+  { 0x70, 0x0F, 0x6A },
+  { 0x70, 0x10, 0x5C },
+  { 0x70, 0x11, 0x0E },
+  { 0x70, 0x11, 0x24 },
+  { 0x70, 0x14, 0xA6 },
+  { 0x70, 0x18, 0xA7 },
+  { 0x70, 0x19, 0x2F },
+  { 0x70, 0x1F, 0x53 },
+  { 0x70, 0x22, 0xFE },
+  { 0x70, 0x2C, 0x09 },
+  { 0x70, 0x2E, 0x22 },
+  { 0x70, 0x2F, 0x35 },
+  { 0x70, 0x31, 0x7F },
+  { 0x70, 0x35, 0x09 },
+  { 0x70, 0x3A, 0x0E },
+  { 0x70, 0x3A, 0x51 },
+  { 0x70, 0x3A, 0xCB },
+  { 0x70, 0x3C, 0x69 },
+  { 0x70, 0x3E, 0xAC },
+  { 0x70, 0x46, 0x98 },
+  { 0x70, 0x47, 0x77 },
+  { 0x70, 0x48, 0x0F },
+  { 0x70, 0x48, 0xF7 },
+  { 0x70, 0x49, 0xA2 },
+  { 0x70, 0x4C, 0xA5 },
+  { 0x70, 0x4D, 0x7B },
+  { 0x70, 0x4E, 0x6B },
+  { 0x70, 0x4F, 0x57 },
+  { 0x70, 0x54, 0xF5 },
+  { 0x70, 0x56, 0x81 },
+  { 0x70, 0x5F, 0xA3 },
+  { 0x70, 0x61, 0x7B },
+  { 0x70, 0x62, 0xB8 },
+  { 0x70, 0x69, 0x5A },
+  { 0x70, 0x6B, 0xB9 },
+  { 0x70, 0x6D, 0x15 },
+  { 0x70, 0x6E, 0x6D },
+  { 0x70, 0x70, 0x0D },
+  { 0x70, 0x70, 0x8B },
+  { 0x70, 0x70, 0xAA },
+  { 0x70, 0x72, 0x3C },
+  { 0x70, 0x72, 0xFE },
+  { 0x70, 0x73, 0x62 },
+  { 0x70, 0x73, 0xCB },
+  { 0x70, 0x79, 0x90 },
+  { 0x70, 0x79, 0xB3 },
+  { 0x70, 0x7B, 0xE8 },
+  { 0x70, 0x7C, 0xE3 },
+  { 0x70, 0x7D, 0xB9 },
+  { 0x70, 0x81, 0x05 },
+  { 0x70, 0x81, 0xEB },
+  { 0x70, 0x8A, 0x09 },
+  { 0x70, 0x8B, 0xCD },
+  { 0x70, 0x8C, 0xB6 },
+  { 0x70, 0x90, 0x41 },
+  { 0x70, 0x9C, 0x45 },
+  { 0x70, 0x9F, 0x2D },
+  { 0x70, 0xA2, 0xB3 },
+  { 0x70, 0xA7, 0x41 },
+  { 0x70, 0xA8, 0xE3 },
+  { 0x70, 0xA9, 0x83 },
+  { 0x70, 0xAE, 0xD5 },
+  { 0x70, 0xB3, 0x06 },
+  { 0x70, 0xB3, 0x17 },
+  { 0x70, 0xB8, 0xF6 },
+  { 0x70, 0xBB, 0x5B },
+  { 0x70, 0xBB, 0xE9 },
+  { 0x70, 0xBC, 0x10 },
+  { 0x70, 0xBC, 0x48 },
+  { 0x70, 0xC7, 0xF2 },
+  { 0x70, 0xC9, 0xC6 },
+  { 0x70, 0xCA, 0x97 },
+  { 0x70, 0xCA, 0x9B },
+  { 0x70, 0xCD, 0x60 },
+  { 0x70, 0xD3, 0x13 },
+  { 0x70, 0xD3, 0x79 },
+  { 0x70, 0xDA, 0x48 },
+  { 0x70, 0xDB, 0x98 },
+  { 0x70, 0xDE, 0xE2 },
+  { 0x70, 0xDF, 0x2F },
+  { 0x70, 0xE4, 0x22 },
+  { 0x70, 0xE7, 0x2C },
+  { 0x70, 0xEA, 0x1A },
+  { 0x70, 0xEA, 0x5A },
+  { 0x70, 0xEC, 0xE4 },
+  { 0x70, 0xEF, 0x00 },
+  { 0x70, 0xF0, 0x87 },
+  { 0x70, 0xF0, 0x88 },
+  { 0x70, 0xF0, 0x96 },
+  { 0x70, 0xF3, 0x5A },
+  { 0x70, 0xF8, 0xAE },
+  { 0x70, 0xFD, 0x45 },
+  { 0x74, 0x03, 0xBD },
+  { 0x74, 0x05, 0xA5 },
+  { 0x74, 0x0E, 0xA4 },
+  { 0x74, 0x11, 0xB2 },
+  { 0x74, 0x15, 0x75 },
+  { 0x74, 0x15, 0xF5 },
+  { 0x74, 0x1B, 0xB2 },
+  { 0x74, 0x23, 0x44 },
+  { 0x74, 0x26, 0xAC },
+  { 0x74, 0x26, 0xFF },
+  { 0x74, 0x31, 0x74 },
+  { 0x74, 0x33, 0xE9 },
+  { 0x74, 0x34, 0x2B },
+  { 0x74, 0x38, 0x22 },
+  { 0x74, 0x39, 0x89 },
+  { 0x74, 0x3E, 0x2B },
+  { 0x74, 0x42, 0x7F },
+  { 0x74, 0x42, 0x8B },
+  { 0x74, 0x44, 0x01 },
+  { 0x74, 0x4A, 0xA4 },
+  { 0x74, 0x4D, 0x28 },
+  { 0x74, 0x4D, 0x6D },
+  { 0x74, 0x4D, 0xBD },
+  { 0x74, 0x51, 0xBA },
+  { 0x74, 0x54, 0x7D },
+  { 0x74, 0x58, 0xF3 },
+  { 0x74, 0x59, 0x09 },
+  { 0x74, 0x5A, 0xAA },
+  { 0x74, 0x60, 0xFA },
+  { 0x74, 0x65, 0x0C },
+  { 0x74, 0x6F, 0x88 },
+  { 0x74, 0x71, 0x8B },
+  { 0x74, 0x73, 0xB4 },
+  { 0x74, 0x74, 0x46 },
+  { 0x74, 0x75, 0x48 },
+  { 0x74, 0x78, 0xA6 },
+  { 0x74, 0x81, 0x14 },
+  { 0x74, 0x83, 0xC2 },
+  { 0x74, 0x84, 0x69 },
+  { 0x74, 0x86, 0x0B },
+  { 0x74, 0x87, 0x2E },
+  { 0x74, 0x88, 0x2A },
+  { 0x74, 0x88, 0xBB },
+  { 0x74, 0x8D, 0x08 },
+  { 0x74, 0x8F, 0x3C },
+  { 0x74, 0x8F, 0xC2 },
+  { 0x74, 0x91, 0x1A },
+  { 0x74, 0x97, 0x81 },
+  { 0x74, 0x9B, 0x89 },
+  { 0x74, 0x9D, 0x8F },
+  { 0x74, 0x9E, 0x75 },
+  { 0x74, 0x9E, 0xAF },
+  { 0x74, 0xA0, 0x2F },
+  { 0x74, 0xA0, 0x63 },
+  { 0x74, 0xA2, 0xE6 },
+  { 0x74, 0xA5, 0x28 },
+  { 0x74, 0xA6, 0xCD },
+  { 0x74, 0xA7, 0x8E },
+  { 0x74, 0xA7, 0xEA },
+  { 0x74, 0xAC, 0xB9 },
+  { 0x74, 0xAD, 0x98 },
+  { 0x74, 0xB5, 0x7E },
+  { 0x74, 0xB5, 0x87 },
+  { 0x74, 0xC1, 0x4F },
+  { 0x74, 0xC2, 0x46 },
+  { 0x74, 0xCA, 0x60 },
+  { 0x74, 0xD0, 0x2B },
+  { 0x74, 0xD2, 0x1D },
+  { 0x74, 0xD4, 0x23 },
+  { 0x74, 0xD6, 0x37 },
+  { 0x74, 0xDA, 0x88 },
+  { 0x74, 0xDA, 0xDA },
+  { 0x74, 0xE1, 0xB6 },
+  { 0x74, 0xE2, 0x0C },
+  { 0x74, 0xE2, 0x8C },
+  { 0x74, 0xE2, 0xF5 },
+  { 0x74, 0xE9, 0xBF },
+  { 0x74, 0xEA, 0x3A },
+  { 0x74, 0xEC, 0xB2 },
+  { 0x74, 0xF2, 0xFA },
+  { 0x74, 0xF9, 0xCA },
+  { 0x74, 0xFE, 0xCE },
+  { 0x78, 0x02, 0x8B },
+  { 0x78, 0x02, 0xB1 },
+  { 0x78, 0x02, 0xF8 },
+  { 0x78, 0x08, 0x4D },
+  { 0x78, 0x0C, 0xF0 },
+  { 0x78, 0x16, 0x99 },
+  { 0x78, 0x17, 0xBE },
+  { 0x78, 0x18, 0xEC },
+  { 0x78, 0x1D, 0x4A },
+  { 0x78, 0x1D, 0xBA },
+  { 0x78, 0x20, 0xA5 },
+  { 0x78, 0x21, 0x84 },
+  { 0x78, 0x24, 0xAF },
+  { 0x78, 0x28, 0xCA },
+  { 0x78, 0x2D, 0xAD },
+  { 0x78, 0x30, 0x5D },
+  { 0x78, 0x31, 0x2B },
+  { 0x78, 0x31, 0xC1 },
+  { 0x78, 0x32, 0x1B },
+  { 0x78, 0x3A, 0x84 },
+  { 0x78, 0x44, 0xFD },
+  { 0x78, 0x45, 0x58 },
+  { 0x78, 0x4F, 0x43 },
+  { 0x78, 0x54, 0x2E },
+  { 0x78, 0x57, 0x73 },
+  { 0x78, 0x58, 0x60 },
+  { 0x78, 0x5C, 0x5E },
+  { 0x78, 0x60, 0x5B },
+  { 0x78, 0x62, 0x56 },
+  { 0x78, 0x64, 0xC0 },
+  { 0x78, 0x67, 0xD7 },
+  { 0x78, 0x6A, 0x89 },
+  { 0x78, 0x6C, 0x1C },
+  { 0x78, 0x6C, 0x84 },
+  { 0x78, 0x72, 0x5D },
+  { 0x78, 0x7B, 0x8A },
+  { 0x78, 0x7E, 0x61 },
+  { 0x78, 0x88, 0x6D },
+  { 0x78, 0x8A, 0x20 },
+  { 0x78, 0x8C, 0xB5 },
+  { 0x78, 0x90, 0xA2 },
+  { 0x78, 0x96, 0x82 },
+  { 0x78, 0x98, 0xE8 },
+  { 0x78, 0x9A, 0x18 },
+  { 0x78, 0x9F, 0x70 },
+  { 0x78, 0xA0, 0x3F },
+  { 0x78, 0xA1, 0x06 },
+  { 0x78, 0xA2, 0xA0 },
+  { 0x78, 0xA3, 0xE4 },
+  { 0x78, 0xA7, 0xC7 },
+  { 0x78, 0xB4, 0x6A },
+  { 0x78, 0xBA, 0xF9 },
+  { 0x78, 0xBC, 0x1A },
+  { 0x78, 0xC1, 0xA7 },
+  { 0x78, 0xC5, 0x7D },
+  { 0x78, 0xCA, 0x39 },
+  { 0x78, 0xCF, 0x2F },
+  { 0x78, 0xD1, 0x62 },
+  { 0x78, 0xD2, 0x94 },
+  { 0x78, 0xD7, 0x52 },
+  { 0x78, 0xD7, 0x5F },
+  { 0x78, 0xD8, 0x40 },
+  { 0x78, 0xDA, 0x6E },
+  { 0x78, 0xDD, 0x33 },
+  { 0x78, 0xE1, 0x03 },
+  { 0x78, 0xE3, 0x6D },
+  { 0x78, 0xE3, 0xDE },
+  { 0x78, 0xE8, 0xB6 },
+  { 0x78, 0xEB, 0x46 },
+  { 0x78, 0xF1, 0xC6 },
+  { 0x78, 0xF5, 0x57 },
+  { 0x78, 0xF5, 0xFD },
+  { 0x78, 0xFB, 0xD8 },
+  { 0x78, 0xFD, 0x94 },
+  { 0x7C, 0x00, 0x4D },
+  { 0x7C, 0x01, 0x91 },
+  { 0x7C, 0x03, 0x5E },
+  { 0x7C, 0x03, 0xAB },
+  { 0x7C, 0x04, 0xD0 },
+  { 0x7C, 0x0E, 0xCE },
+  { 0x7C, 0x10, 0xC9 },
+  { 0x7C, 0x11, 0xBE },
+  { 0x7C, 0x11, 0xCB },
+  { 0x7C, 0x1A, 0xC0 },
+  { 0x7C, 0x1C, 0xF1 },
+  { 0x7C, 0x1D, 0xD9 },
+  { 0x7C, 0x21, 0x0D },
+  { 0x7C, 0x21, 0x0E },
+  { 0x7C, 0x24, 0x99 },
+  { 0x7C, 0x29, 0x6F },
+  { 0x7C, 0x2A, 0xCA },
+  { 0x7C, 0x2A, 0xDB },
+  { 0x7C, 0x2E, 0xBD },
+  { 0x7C, 0x31, 0x0E },
+  { 0x7C, 0x33, 0xF9 },
+  { 0x7C, 0x39, 0x53 },
+  { 0x7C, 0x39, 0x85 },
+  { 0x7C, 0x4B, 0x26 },
+  { 0x7C, 0x50, 0x49 },
+  { 0x7C, 0x57, 0x3C },
+  { 0x7C, 0x60, 0x97 },
+  { 0x7C, 0x61, 0x30 },
+  { 0x7C, 0x61, 0x66 },
+  { 0x7C, 0x63, 0x05 },
+  { 0x7C, 0x66, 0x9A },
+  { 0x7C, 0x67, 0xAB },
+  { 0x7C, 0x69, 0xF6 },
+  { 0x7C, 0x6D, 0x62 },
+  { 0x7C, 0x6D, 0xF8 },
+  { 0x7C, 0x73, 0x98 },
+  { 0x7C, 0x76, 0x68 },
+  { 0x7C, 0x77, 0x16 },
+  { 0x7C, 0x7D, 0x3D },
+  { 0x7C, 0x87, 0xCE },
+  { 0x7C, 0x8B, 0xCA },
+  { 0x7C, 0x94, 0x2A },
+  { 0x7C, 0x95, 0xF3 },
+  { 0x7C, 0x9A, 0x1D },
+  { 0x7C, 0x9E, 0xBD },
+  { 0x7C, 0xA1, 0x77 },
+  { 0x7C, 0xA1, 0xAE },
+  { 0x7C, 0xA2, 0x3E },
+  { 0x7C, 0xA4, 0x49 },
+  { 0x7C, 0xAB, 0x60 },
+  { 0x7C, 0xAD, 0x4F },
+  { 0x7C, 0xAD, 0x74 },
+  { 0x7C, 0xB1, 0x5D },
+  { 0x7C, 0xB2, 0x1B },
+  { 0x7C, 0xB3, 0x0A },
+  { 0x7C, 0xB5, 0x9B },
+  { 0x7C, 0xB5, 0x9F },
+  { 0x7C, 0xBB, 0x8A },
+  { 0x7C, 0xC0, 0x6F },
+  { 0x7C, 0xC0, 0xAA },
+  { 0x7C, 0xC1, 0x80 },
+  { 0x7C, 0xC2, 0xC6 },
+  { 0x7C, 0xC3, 0x85 },
+  { 0x7C, 0xC3, 0xA1 },
+  { 0x7C, 0xC5, 0x37 },
+  { 0x7C, 0xD1, 0xC3 },
+  { 0x7C, 0xD3, 0xE5 },
+  { 0x7C, 0xD5, 0x66 },
+  { 0x7C, 0xD6, 0x61 },
+  { 0x7C, 0xD9, 0x5C },
+  { 0x7C, 0xD9, 0xA0 },
+  { 0x7C, 0xDF, 0xA1 },
+  { 0x7C, 0xEC, 0xB1 },
+  { 0x7C, 0xED, 0xC6 },
+  { 0x7C, 0xF0, 0x5F },
+  { 0x7C, 0xF3, 0x4D },
+  { 0x7C, 0xF8, 0x80 },
+  { 0x7C, 0xFA, 0xDF },
+  { 0x7C, 0xFC, 0x16 },
+  { 0x7C, 0xFD, 0x6B },
+  { 0x7C, 0xFF, 0x4D },
+  { 0x80, 0x00, 0x6E },
+  { 0x80, 0x03, 0x84 },
+  { 0x80, 0x04, 0x5F },
+  { 0x80, 0x0C, 0x67 },
+  { 0x80, 0x0C, 0xF9 },
+  { 0x80, 0x13, 0x82 },
+  { 0x80, 0x24, 0x8F },
+  { 0x80, 0x26, 0x89 },
+  { 0x80, 0x27, 0x6C },
+  { 0x80, 0x2A, 0xA8 },
+  { 0x80, 0x2D, 0x1A },
+  { 0x80, 0x2D, 0xBF },
+  { 0x80, 0x2E, 0xC3 },
+  { 0x80, 0x35, 0xC1 },
+  { 0x80, 0x37, 0x73 },
+  { 0x80, 0x38, 0xBC },
+  { 0x80, 0x3C, 0x20 },
+  { 0x80, 0x41, 0x26 },
+  { 0x80, 0x49, 0x71 },
+  { 0x80, 0x4A, 0x14 },
+  { 0x80, 0x4A, 0xF2 },
+  { 0x80, 0x54, 0xD9 },
+  { 0x80, 0x54, 0xE3 },
+  { 0x80, 0x5F, 0xC5 },
+  { 0x80, 0x60, 0x36 },
+  { 0x80, 0x64, 0x6F },
+  { 0x80, 0x65, 0x7C },
+  { 0x80, 0x65, 0x99 },
+  { 0x80, 0x69, 0x1A },
+  { 0x80, 0x69, 0x33 },
+  { 0x80, 0x6A, 0x00 },
+  { 0x80, 0x6D, 0x71 },
+  { 0x80, 0x71, 0x7A },
+  { 0x80, 0x7C, 0x0A },
+  { 0x80, 0x7D, 0x14 },
+  { 0x80, 0x7D, 0x3A },
+  { 0x80, 0x80, 0x2C },
+  { 0x80, 0x82, 0x23 },
+  { 0x80, 0x89, 0x17 },
+  { 0x80, 0x8F, 0x1D },
+  { 0x80, 0x92, 0x9F },
+  { 0x80, 0x95, 0x3A },
+  { 0x80, 0xA9, 0x97 },
+  { 0x80, 0xAD, 0x16 },
+  { 0x80, 0xAE, 0x54 },
+  { 0x80, 0xB0, 0x3D },
+  { 0x80, 0xB0, 0x7B },
+  { 0x80, 0xB5, 0x75 },
+  { 0x80, 0xB6, 0x86 },
+  { 0x80, 0xB9, 0x89 },
+  { 0x80, 0xBC, 0x37 },
+  { 0x80, 0xBE, 0x05 },
+  { 0x80, 0xC5, 0xE6 },
+  { 0x80, 0xCC, 0x9C },
+  { 0x80, 0xD0, 0x9B },
+  { 0x80, 0xD2, 0xE5 },
+  { 0x80, 0xD4, 0xA5 },
+  { 0x80, 0xD6, 0x05 },
+  { 0x80, 0xE0, 0x1D },
+  { 0x80, 0xE1, 0xBF },
+  { 0x80, 0xE6, 0x50 },
+  { 0x80, 0xE8, 0x6F },
+  { 0x80, 0xEA, 0x07 },
+  { 0x80, 0xEA, 0x0B },
+  { 0x80, 0xEA, 0x96 },
+  { 0x80, 0xED, 0x2C },
+  { 0x80, 0xF0, 0xCF },
+  { 0x80, 0xF1, 0xA4 },
+  { 0x80, 0xFB, 0x06 },
+  { 0x84, 0x0D, 0x8E },
+  { 0x84, 0x13, 0x9F },
+  { 0x84, 0x15, 0xD3 },
+  { 0x84, 0x16, 0xF9 },
+  { 0x84, 0x18, 0x3A },
+  { 0x84, 0x1B, 0x5E },
+  { 0x84, 0x1C, 0x70 },
+  { 0x84, 0x21, 0xF1 },
+  { 0x84, 0x23, 0x88 },
+  { 0x84, 0x28, 0x59 },
+  { 0x84, 0x29, 0x99 },
+  { 0x84, 0x2F, 0x57 },
+  { 0x84, 0x38, 0x35 },
+  { 0x84, 0x39, 0x8F },
+  { 0x84, 0x3C, 0x99 },
+  { 0x84, 0x3D, 0xC6 },
+  { 0x84, 0x3E, 0x92 },
+  { 0x84, 0x41, 0x67 },
+  { 0x84, 0x46, 0xFE },
+  { 0x84, 0x47, 0x65 },
+  { 0x84, 0x57, 0x33 },
+  { 0x84, 0x5A, 0x3E },
+  { 0x84, 0x5B, 0x12 },
+  { 0x84, 0x63, 0xD6 },
+  { 0x84, 0x64, 0xDD },
+  { 0x84, 0x68, 0x78 },
+  { 0x84, 0x74, 0x2A },
+  { 0x84, 0x74, 0x60 },
+  { 0x84, 0x76, 0x37 },
+  { 0x84, 0x78, 0x8B },
+  { 0x84, 0x78, 0xAC },
+  { 0x84, 0x80, 0x2D },
+  { 0x84, 0x85, 0x06 },
+  { 0x84, 0x88, 0xE1 },
+  { 0x84, 0x89, 0xAD },
+  { 0x84, 0x8A, 0x8D },
+  { 0x84, 0x8C, 0x8D },
+  { 0x84, 0x8D, 0xC7 },
+  { 0x84, 0x8E, 0x0C },
+  { 0x84, 0x93, 0xB2 },
+  { 0x84, 0x94, 0x37 },
+  { 0x84, 0x9F, 0xB5 },
+  { 0x84, 0xA1, 0x34 },
+  { 0x84, 0xA8, 0xE4 },
+  { 0x84, 0xA9, 0xC4 },
+  { 0x84, 0xAB, 0x1A },
+  { 0x84, 0xAC, 0x16 },
+  { 0x84, 0xAD, 0x58 },
+  { 0x84, 0xAD, 0x8D },
+  { 0x84, 0xAF, 0xEC },
+  { 0x84, 0xB1, 0x53 },
+  { 0x84, 0xB1, 0xE2 },
+  { 0x84, 0xB1, 0xE4 },
+  { 0x84, 0xB2, 0x61 },
+  { 0x84, 0xB5, 0x17 },
+  { 0x84, 0xB8, 0x02 },
+  { 0x84, 0xBE, 0x52 },
+  { 0x84, 0xC9, 0xB2 },
+  { 0x84, 0xCC, 0xA8 },
+  { 0x84, 0xD3, 0x28 },
+  { 0x84, 0xD4, 0x7E },
+  { 0x84, 0xD6, 0xD0 },
+  { 0x84, 0xD8, 0x1B },
+  { 0x84, 0xDB, 0xAC },
+  { 0x84, 0xE8, 0xCB },
+  { 0x84, 0xEA, 0xED },
+  { 0x84, 0xEB, 0xEF },
+  { 0x84, 0xF1, 0x47 },
+  { 0x84, 0xF3, 0xEB },
+  { 0x84, 0xF5, 0xEB },
+  { 0x84, 0xF7, 0x03 },
+  { 0x84, 0xFC, 0xAC },
+  { 0x84, 0xFC, 0xE6 },
+  { 0x84, 0xFC, 0xFE },
+  { 0x88, 0x10, 0x8F },
+  { 0x88, 0x11, 0x96 },
+  { 0x88, 0x15, 0x44 },
+  { 0x88, 0x19, 0x08 },
+  { 0x88, 0x1D, 0xFC },
+  { 0x88, 0x1E, 0x5A },
+  { 0x88, 0x1F, 0xA1 },
+  { 0x88, 0x20, 0x0D },
+  { 0x88, 0x25, 0x10 },
+  { 0x88, 0x25, 0x93 },
+  { 0x88, 0x28, 0xB3 },
+  { 0x88, 0x3A, 0x30 },
+  { 0x88, 0x3D, 0x24 },
+  { 0x88, 0x3F, 0xD3 },
+  { 0x88, 0x40, 0x33 },
+  { 0x88, 0x40, 0x3B },
+  { 0x88, 0x43, 0xE1 },
+  { 0x88, 0x44, 0x77 },
+  { 0x88, 0x46, 0x04 },
+  { 0x88, 0x4D, 0x7C },
+  { 0x88, 0x52, 0xEB },
+  { 0x88, 0x53, 0x95 },
+  { 0x88, 0x53, 0xD4 },
+  { 0x88, 0x54, 0x1F },
+  { 0x88, 0x57, 0xEE },
+  { 0x88, 0x5A, 0x92 },
+  { 0x88, 0x5D, 0xFB },
+  { 0x88, 0x63, 0xDF },
+  { 0x88, 0x64, 0x40 },
+  { 0x88, 0x66, 0x39 },
+  { 0x88, 0x66, 0x5A },
+  { 0x88, 0x66, 0xA5 },
+  { 0x88, 0x67, 0xDC },
+  { 0x88, 0x69, 0x3D },
+  { 0x88, 0x6B, 0x6E },
+  { 0x88, 0x6C, 0x60 },
+  { 0x88, 0x6E, 0xEB },
+  { 0x88, 0x71, 0xE5 },
+  { 0x88, 0x74, 0x77 },
+  { 0x88, 0x75, 0x56 },
+  { 0x88, 0x7B, 0x2C },
+  { 0x88, 0x86, 0x03 },
+  { 0x88, 0x89, 0x2F },
+  { 0x88, 0x90, 0x8D },
+  { 0x88, 0x9C, 0xAD },
+  { 0x88, 0xA0, 0xBE },
+  { 0x88, 0xA2, 0xD7 },
+  { 0x88, 0xA4, 0x79 },
+  { 0x88, 0xA9, 0xB7 },
+  { 0x88, 0xAC, 0xC0 },
+  { 0x88, 0xAE, 0x07 },
+  { 0x88, 0xB2, 0x91 },
+  { 0x88, 0xB4, 0xBE },
+  { 0x88, 0xB7, 0xEB },
+  { 0x88, 0xB9, 0x45 },
+  { 0x88, 0xBC, 0xC1 },
+  { 0x88, 0xBF, 0xE4 },
+  { 0x88, 0xC0, 0x8B },
+  { 0x88, 0xC1, 0x74 },
+  { 0x88, 0xC2, 0x27 },
+  { 0x88, 0xC6, 0x63 },
+  { 0x88, 0xC6, 0xE8 },
+  { 0x88, 0xCB, 0x87 },
+  { 0x88, 0xCE, 0x3F },
+  { 0x88, 0xCE, 0xFA },
+  { 0x88, 0xCF, 0x98 },
+  { 0x88, 0xD2, 0x74 },
+  { 0x88, 0xD7, 0xF6 },
+  { 0x88, 0xDE, 0xA9 },
+  { 0x88, 0xE0, 0x56 },
+  { 0x88, 0xE3, 0xAB },
+  { 0x88, 0xE8, 0x7F },
+  { 0x88, 0xE9, 0xFE },
+  { 0x88, 0xF0, 0x31 },
+  { 0x88, 0xF0, 0x77 },
+  { 0x88, 0xF5, 0x6E },
+  { 0x88, 0xF8, 0x72 },
+  { 0x88, 0xFC, 0x5D },
+  { 0x8C, 0x00, 0x6D },
+  { 0x8C, 0x0C, 0x90 },
+  { 0x8C, 0x0D, 0x76 },
+  { 0x8C, 0x14, 0xB4 },
+  { 0x8C, 0x15, 0xC7 },
+  { 0x8C, 0x1E, 0x80 },
+  { 0x8C, 0x21, 0x0A },
+  { 0x8C, 0x25, 0x05 },
+  { 0x8C, 0x26, 0xAA },
+  { 0x8C, 0x29, 0x37 },
+  { 0x8C, 0x2D, 0xAA },
+  { 0x8C, 0x34, 0xFD },
+  { 0x8C, 0x3B, 0xAD },
+  { 0x8C, 0x42, 0x6D },
+  { 0x8C, 0x44, 0xA5 },
+  { 0x8C, 0x49, 0x62 },
+  { 0x8C, 0x4B, 0x14 },
+  { 0x8C, 0x56, 0xC5 },
+  { 0x8C, 0x58, 0x77 },
+  { 0x8C, 0x59, 0x73 },
+  { 0x8C, 0x60, 0x4F },
+  { 0x8C, 0x68, 0x3A },
+  { 0x8C, 0x68, 0xC8 },
+  { 0x8C, 0x6D, 0x77 },
+  { 0x8C, 0x79, 0x09 },
+  { 0x8C, 0x79, 0x67 },
+  { 0x8C, 0x7A, 0x15 },
+  { 0x8C, 0x7A, 0x3D },
+  { 0x8C, 0x7A, 0xAA },
+  { 0x8C, 0x7B, 0x9D },
+  { 0x8C, 0x7C, 0x92 },
+  { 0x8C, 0x83, 0xE8 },
+  { 0x8C, 0x84, 0x42 },
+  { 0x8C, 0x85, 0x90 },
+  { 0x8C, 0x85, 0xC1 },
+  { 0x8C, 0x86, 0x1E },
+  { 0x8C, 0x86, 0x2A },
+  { 0x8C, 0x88, 0x81 },
+  { 0x8C, 0x8E, 0x0D },
+  { 0x8C, 0x8E, 0xF2 },
+  { 0x8C, 0x8F, 0xE9 },
+  { 0x8C, 0x94, 0x1F },
+  { 0x8C, 0x94, 0x61 },
+  { 0x8C, 0x98, 0x6B },
+  { 0x8C, 0xA6, 0xDF },
+  { 0x8C, 0xAA, 0xB5 },
+  { 0x8C, 0xAA, 0xCE },
+  { 0x8C, 0xB6, 0x4F },
+  { 0x8C, 0xBE, 0xBE },
+  { 0x8C, 0xCD, 0xE8 },
+  { 0x8C, 0xCE, 0x4E },
+  { 0x8C, 0xD9, 0xD6 },
+  { 0x8C, 0xDC, 0x02 },
+  { 0x8C, 0xE0, 0x81 },
+  { 0x8C, 0xE1, 0x17 },
+  { 0x8C, 0xE5, 0xEF },
+  { 0x8C, 0xEB, 0xC6 },
+  { 0x8C, 0xEC, 0x7B },
+  { 0x8C, 0xEE, 0xFD },
+  { 0x8C, 0xFA, 0xBA },
+  { 0x8C, 0xFA, 0xDD },
+  { 0x8C, 0xFD, 0x18 },
+  { 0x8C, 0xFE, 0x57 },
+  { 0x8C, 0xFE, 0x74 },
+  { 0x90, 0x01, 0x17 },
+  { 0x90, 0x03, 0x25 },
+  { 0x90, 0x0C, 0xC8 },
+  { 0x90, 0x11, 0x95 },
+  { 0x90, 0x16, 0xBA },
+  { 0x90, 0x17, 0x3F },
+  { 0x90, 0x17, 0xAC },
+  { 0x90, 0x17, 0xC8 },
+  { 0x90, 0x1D, 0x27 },
+  { 0x90, 0x20, 0xC2 },
+  { 0x90, 0x23, 0x5B },
+  { 0x90, 0x25, 0xF2 },
+  { 0x90, 0x27, 0xE4 },
+  { 0x90, 0x2A, 0xEE },
+  { 0x90, 0x2B, 0xD2 },
+  { 0x90, 0x2C, 0x09 },
+  { 0x90, 0x38, 0x0C },
+  { 0x90, 0x39, 0x5F },
+  { 0x90, 0x3A, 0x72 },
+  { 0x90, 0x3C, 0x92 },
+  { 0x90, 0x3F, 0xEA },
+  { 0x90, 0x45, 0x28 },
+  { 0x90, 0x4E, 0x2B },
+  { 0x90, 0x5E, 0x44 },
+  { 0x90, 0x60, 0xF1 },
+  { 0x90, 0x62, 0x3F },
+  { 0x90, 0x64, 0xAD },
+  { 0x90, 0x67, 0x1C },
+  { 0x90, 0x6A, 0xEB },
+  { 0x90, 0x6C, 0xAC },
+  { 0x90, 0x72, 0x40 },
+  { 0x90, 0x77, 0xEE },
+  { 0x90, 0x78, 0xB2 },
+  { 0x90, 0x79, 0xCF },
+  { 0x90, 0x7E, 0x43 },
+  { 0x90, 0x81, 0x2A },
+  { 0x90, 0x81, 0x58 },
+  { 0x90, 0x84, 0x0D },
+  { 0x90, 0x86, 0x9B },
+  { 0x90, 0x88, 0x55 },
+  { 0x90, 0x8C, 0x43 },
+  { 0x90, 0x8D, 0x6C },
+  { 0x90, 0x8D, 0x78 },
+  { 0x90, 0x94, 0x97 },
+  { 0x90, 0x94, 0xE4 },
+  { 0x90, 0x96, 0xF3 },
+  { 0x90, 0x97, 0xD5 },
+  { 0x90, 0x9A, 0x4A },
+  { 0x90, 0x9B, 0x6F },
+  { 0x90, 0x9C, 0x4A },
+  { 0x90, 0xA2, 0x5B },
+  { 0x90, 0xA5, 0xAF },
+  { 0x90, 0xA8, 0x22 },
+  { 0x90, 0xAE, 0x1B },
+  { 0x90, 0xB0, 0xED },
+  { 0x90, 0xB2, 0x1F },
+  { 0x90, 0xB9, 0x31 },
+  { 0x90, 0xC1, 0xC6 },
+  { 0x90, 0xC7, 0x10 },
+  { 0x90, 0xC7, 0xD8 },
+  { 0x90, 0xCA, 0xFA },
+  { 0x90, 0xD4, 0x32 },
+  { 0x90, 0xD8, 0xF3 },
+  { 0x90, 0xDD, 0x5D },
+  { 0x90, 0xE1, 0x7B },
+  { 0x90, 0xE6, 0xBA },
+  { 0x90, 0xE9, 0x5E },
+  { 0x90, 0xEB, 0x50 },
+  { 0x90, 0xEC, 0xEA },
+  { 0x90, 0xEF, 0x68 },
+  { 0x90, 0xF6, 0x52 },
+  { 0x90, 0xF8, 0x2E },
+  { 0x90, 0xF9, 0x70 },
+  { 0x90, 0xF9, 0xB7 },
+  { 0x90, 0xFD, 0x61 },
+  { 0x90, 0xFD, 0x73 },
+  { 0x94, 0x00, 0xB0 },
+  { 0x94, 0x04, 0x9C },
+  { 0x94, 0x0B, 0x19 },
+  { 0x94, 0x0B, 0x83 },
+  { 0x94, 0x0C, 0x6D },
+  { 0x94, 0x0C, 0x98 },
+  { 0x94, 0x0E, 0x6B },
+  { 0x94, 0x0E, 0xE7 },
+  { 0x94, 0x10, 0x3E },
+  { 0x94, 0x16, 0x25 },
+  { 0x94, 0x17, 0x00 },
+  { 0x94, 0x18, 0x65 },
+  { 0x94, 0x25, 0x33 },
+  { 0x94, 0x26, 0x1D },
+  { 0x94, 0x28, 0x6F },
+  { 0x94, 0x2A, 0x6F },
+  { 0x94, 0x33, 0xD8 },
+  { 0x94, 0x35, 0x89 },
+  { 0x94, 0x3A, 0x91 },
+  { 0x94, 0x3C, 0xC6 },
+  { 0x94, 0x3F, 0xD6 },
+  { 0x94, 0x40, 0xF3 },
+  { 0x94, 0x44, 0x52 },
+  { 0x94, 0x45, 0x60 },
+  { 0x94, 0x47, 0x88 },
+  { 0x94, 0x58, 0xCB },
+  { 0x94, 0x5A, 0xFC },
+  { 0x94, 0x5C, 0x9A },
+  { 0x94, 0x60, 0xD5 },
+  { 0x94, 0x64, 0x24 },
+  { 0x94, 0x77, 0x2B },
+  { 0x94, 0x7B, 0xAE },
+  { 0x94, 0x7D, 0x77 },
+  { 0x94, 0x87, 0xE0 },
+  { 0x94, 0x90, 0x10 },
+  { 0x94, 0x94, 0x26 },
+  { 0x94, 0x95, 0xA0 },
+  { 0x94, 0x98, 0x69 },
+  { 0x94, 0x9A, 0xA9 },
+  { 0x94, 0x9F, 0x3E },
+  { 0x94, 0x9F, 0x8B },
+  { 0x94, 0xA4, 0xF9 },
+  { 0x94, 0xA6, 0x7E },
+  { 0x94, 0xA7, 0xB7 },
+  { 0x94, 0xAD, 0x23 },
+  { 0x94, 0xAE, 0xF0 },
+  { 0x94, 0xB0, 0x1F },
+  { 0x94, 0xB2, 0x71 },
+  { 0x94, 0xB3, 0x4F },
+  { 0x94, 0xB4, 0x0F },
+  { 0x94, 0xB5, 0x55 },
+  { 0x94, 0xB9, 0x7E },
+  { 0x94, 0xBF, 0x2D },
+  { 0x94, 0xBF, 0x80 },
+  { 0x94, 0xBF, 0xC4 },
+  { 0x94, 0xCB, 0xCD },
+  { 0x94, 0xD0, 0x0D },
+  { 0x94, 0xD2, 0xBC },
+  { 0x94, 0xD3, 0x31 },
+  { 0x94, 0xD4, 0x69 },
+  { 0x94, 0xD5, 0x4D },
+  { 0x94, 0xD9, 0xB3 },
+  { 0x94, 0xDB, 0xDA },
+  { 0x94, 0xDF, 0x34 },
+  { 0x94, 0xE3, 0x00 },
+  { 0x94, 0xE3, 0xEE },
+  { 0x94, 0xE6, 0x86 },
+  { 0x94, 0xE7, 0xEA },
+  { 0x94, 0xE9, 0x6A },
+  { 0x94, 0xEA, 0x32 },
+  { 0x94, 0xEB, 0x2C },
+  { 0x94, 0xF3, 0x92 },
+  { 0x94, 0xF6, 0x65 },
+  { 0x94, 0xF6, 0xA3 },
+  { 0x94, 0xF6, 0xD6 },
+  { 0x94, 0xFE, 0x22 },
+  { 0x94, 0xFF, 0x3C },
+  { 0x98, 0x00, 0x6A },
+  { 0x98, 0x00, 0xC6 },
+  { 0x98, 0x01, 0xA7 },
+  { 0x98, 0x03, 0xD8 },
+  { 0x98, 0x0D, 0x67 },
+  { 0x98, 0x0D, 0xAF },
+  { 0x98, 0x10, 0xE8 },
+  { 0x98, 0x13, 0x33 },
+  { 0x98, 0x17, 0xF1 },
+  { 0x98, 0x18, 0x88 },
+  { 0x98, 0x1A, 0x35 },
+  { 0x98, 0x22, 0x6E },
+  { 0x98, 0x25, 0x4A },
+  { 0x98, 0x35, 0xED },
+  { 0x98, 0x3F, 0x60 },
+  { 0x98, 0x41, 0x5C },
+  { 0x98, 0x44, 0xCE },
+  { 0x98, 0x46, 0x0A },
+  { 0x98, 0x48, 0x27 },
+  { 0x98, 0x48, 0x74 },
+  { 0x98, 0x4B, 0x06 },
+  { 0x98, 0x50, 0x2E },
+  { 0x98, 0x5A, 0xEB },
+  { 0x98, 0x5F, 0xD3 },
+  { 0x98, 0x60, 0xCA },
+  { 0x98, 0x66, 0x10 },
+  { 0x98, 0x69, 0x8A },
+  { 0x98, 0x6C, 0xF5 },
+  { 0x98, 0x7A, 0x14 },
+  { 0x98, 0x8F, 0x00 },
+  { 0x98, 0x97, 0xCC },
+  { 0x98, 0x9A, 0xB9 },
+  { 0x98, 0x9B, 0xCB },
+  { 0x98, 0x9C, 0x57 },
+  { 0x98, 0x9E, 0x63 },
+  { 0x98, 0x9F, 0x1E },
+  { 0x98, 0xA2, 0xC0 },
+  { 0x98, 0xA5, 0xF9 },
+  { 0x98, 0xB3, 0x79 },
+  { 0x98, 0xB6, 0xE9 },
+  { 0x98, 0xB8, 0xE3 },
+  { 0x98, 0xCA, 0x33 },
+  { 0x98, 0xCC, 0xF3 },
+  { 0x98, 0xCD, 0xAC },
+  { 0x98, 0xD2, 0x93 },
+  { 0x98, 0xD3, 0xD7 },
+  { 0x98, 0xD6, 0xBB },
+  { 0x98, 0xD7, 0xE1 },
+  { 0x98, 0xDA, 0xC4 },
+  { 0x98, 0xDD, 0x60 },
+  { 0x98, 0xDE, 0xD0 },
+  { 0x98, 0xE0, 0xD9 },
+  { 0x98, 0xE7, 0xF5 },
+  { 0x98, 0xE8, 0xFA },
+  { 0x98, 0xEE, 0x8C },
+  { 0x98, 0xF0, 0x83 },
+  { 0x98, 0xF0, 0xAB },
+  { 0x98, 0xF4, 0x28 },
+  { 0x98, 0xF4, 0xAB },
+  { 0x98, 0xF5, 0x37 },
+  { 0x98, 0xF6, 0x21 },
+  { 0x98, 0xFA, 0xE3 },
+  { 0x98, 0xFC, 0x11 },
+  { 0x98, 0xFE, 0x94 },
+  { 0x98, 0xFE, 0xE1 },
+  { 0x9C, 0x04, 0xEB },
+  { 0x9C, 0x05, 0xD6 },
+  { 0x9C, 0x09, 0x8B },
+  { 0x9C, 0x1A, 0x25 },
+  { 0x9C, 0x1C, 0x12 },
+  { 0x9C, 0x1D, 0x36 },
+  { 0x9C, 0x20, 0x7B },
+  { 0x9C, 0x21, 0x6A },
+  { 0x9C, 0x28, 0xB3 },
+  { 0x9C, 0x28, 0xEF },
+  { 0x9C, 0x28, 0xF7 },
+  { 0x9C, 0x29, 0x3F },
+  { 0x9C, 0x2E, 0xA1 },
+  { 0x9C, 0x2F, 0x4E },
+  { 0x9C, 0x35, 0xEB },
+  { 0x9C, 0x37, 0x08 },
+  { 0x9C, 0x37, 0xF4 },
+  { 0x9C, 0x38, 0x18 },
+  { 0x9C, 0x3D, 0xCF },
+  { 0x9C, 0x3E, 0x53 },
+  { 0x9C, 0x4E, 0x20 },
+  { 0x9C, 0x4F, 0x5F },
+  { 0x9C, 0x4F, 0xDA },
+  { 0x9C, 0x52, 0xF8 },
+  { 0x9C, 0x53, 0x22 },
+  { 0x9C, 0x54, 0x16 },
+  { 0x9C, 0x57, 0xAD },
+  { 0x9C, 0x58, 0x3C },
+  { 0x9C, 0x58, 0x84 },
+  { 0x9C, 0x5A, 0x81 },
+  { 0x9C, 0x5C, 0x8E },
+  { 0x9C, 0x63, 0x5B },
+  { 0x9C, 0x63, 0xED },
+  { 0x9C, 0x64, 0x8B },
+  { 0x9C, 0x69, 0xD1 },
+  { 0x9C, 0x6C, 0x15 },
+  { 0x9C, 0x6F, 0x52 },
+  { 0x9C, 0x71, 0x3A },
+  { 0x9C, 0x73, 0x70 },
+  { 0x9C, 0x74, 0x1A },
+  { 0x9C, 0x74, 0x6F },
+  { 0x9C, 0x76, 0x0E },
+  { 0x9C, 0x7D, 0xA3 },
+  { 0x9C, 0x84, 0xBF },
+  { 0x9C, 0x8B, 0xA0 },
+  { 0x9C, 0x92, 0x4F },
+  { 0x9C, 0x99, 0xA0 },
+  { 0x9C, 0x9C, 0x1F },
+  { 0x9C, 0x9E, 0xD5 },
+  { 0x9C, 0xA2, 0xF4 },
+  { 0x9C, 0xA6, 0x15 },
+  { 0x9C, 0xA9, 0xE4 },
+  { 0x9C, 0xAA, 0x1B },
+  { 0x9C, 0xAF, 0xCA },
+  { 0x9C, 0xB2, 0xB2 },
+  { 0x9C, 0xB2, 0xE8 },
+  { 0x9C, 0xB4, 0x00 },
+  { 0x9C, 0xBC, 0xF0 },
+  { 0x9C, 0xBF, 0xCD },
+  { 0x9C, 0xC1, 0x72 },
+  { 0x9C, 0xC7, 0xA6 },
+  { 0x9C, 0xC8, 0xE9 },
+  { 0x9C, 0xC9, 0xEB },
+  { 0x9C, 0xD2, 0x4B },
+  { 0x9C, 0xD3, 0x6D },
+  { 0x9C, 0xD5, 0x7D },
+  { 0x9C, 0xD6, 0x43 },
+  { 0x9C, 0xDB, 0xAF },
+  { 0x9C, 0xE1, 0x76 },
+  { 0x9C, 0xE3, 0x30 },
+  { 0x9C, 0xE3, 0x3F },
+  { 0x9C, 0xE3, 0x74 },
+  { 0x9C, 0xE6, 0x35 },
+  { 0x9C, 0xE6, 0x5E },
+  { 0x9C, 0xE9, 0x1C },
+  { 0x9C, 0xF1, 0xD4 },
+  { 0x9C, 0xF3, 0x87 },
+  { 0x9C, 0xF4, 0x8E },
+  { 0x9C, 0xFA, 0x76 },
+  { 0x9C, 0xFC, 0x01 },
+  { 0x9C, 0xFC, 0x28 },
+  { 0xA0, 0x02, 0xDC },
+  { 0xA0, 0x04, 0x60 },
+  { 0xA0, 0x08, 0x6F },
+  { 0xA0, 0x09, 0x2E },
+  { 0xA0, 0x0F, 0x37 },
+  { 0xA0, 0x10, 0x77 },
+  { 0xA0, 0x18, 0x28 },
+  { 0xA0, 0x1C, 0x8D },
+  { 0xA0, 0x20, 0xA6 },
+  { 0xA0, 0x21, 0xB7 },
+  { 0xA0, 0x23, 0x9F },
+  { 0xA0, 0x25, 0xD7 },
+  { 0xA0, 0x31, 0xDB },
+  { 0xA0, 0x36, 0x79 },
+  { 0xA0, 0x36, 0xBC },
+  { 0xA0, 0x3B, 0xE3 },
+  { 0xA0, 0x3D, 0x6E },
+  { 0xA0, 0x3D, 0x6F },
+  { 0xA0, 0x40, 0x6F },
+  { 0xA0, 0x40, 0xA0 },
+  { 0xA0, 0x44, 0x5C },
+  { 0xA0, 0x4A, 0x5E },
+  { 0xA0, 0x4E, 0xA7 },
+  { 0xA0, 0x4E, 0xCF },
+  { 0xA0, 0x52, 0x72 },
+  { 0xA0, 0x55, 0x4F },
+  { 0xA0, 0x56, 0xF3 },
+  { 0xA0, 0x57, 0xE3 },
+  { 0xA0, 0x63, 0x91 },
+  { 0xA0, 0x70, 0xB7 },
+  { 0xA0, 0x76, 0x4E },
+  { 0xA0, 0x78, 0x17 },
+  { 0xA0, 0x78, 0x2D },
+  { 0xA0, 0x85, 0xFC },
+  { 0xA0, 0x86, 0xC6 },
+  { 0xA0, 0x8C, 0xF8 },
+  { 0xA0, 0x8D, 0x16 },
+  { 0xA0, 0x91, 0xC8 },
+  { 0xA0, 0x93, 0x51 },
+  { 0xA0, 0x99, 0x9B },
+  { 0xA0, 0x9F, 0x7A },
+  { 0xA0, 0xA0, 0x01 },
+  { 0xA0, 0xA3, 0x09 },
+  { 0xA0, 0xA3, 0x3B },
+  { 0xA0, 0xA3, 0xB3 },
+  { 0xA0, 0xA3, 0xF0 },
+  { 0xA0, 0xAB, 0x1B },
+  { 0xA0, 0xAF, 0x12 },
+  { 0xA0, 0xB4, 0x0F },
+  { 0xA0, 0xB4, 0x39 },
+  { 0xA0, 0xB7, 0x65 },
+  { 0xA0, 0xBC, 0x6F },
+  { 0xA0, 0xCF, 0x5B },
+  { 0xA0, 0xCF, 0xF5 },
+  { 0xA0, 0xD0, 0xDC },
+  { 0xA0, 0xD1, 0xB3 },
+  { 0xA0, 0xD2, 0xB1 },
+  { 0xA0, 0xD7, 0x95 },
+  { 0xA0, 0xDD, 0x6C },
+  { 0xA0, 0xDF, 0x15 },
+  { 0xA0, 0xE0, 0xAF },
+  { 0xA0, 0xE4, 0xCB },
+  { 0xA0, 0xEC, 0x80 },
+  { 0xA0, 0xEC, 0xF9 },
+  { 0xA0, 0xED, 0xCD },
+  { 0xA0, 0xF3, 0xC1 },
+  { 0xA0, 0xF4, 0x79 },
+  { 0xA0, 0xF8, 0x49 },
+  { 0xA0, 0xFB, 0xC5 },
+  { 0xA4, 0x00, 0x4E },
+  { 0xA4, 0x00, 0xE2 },
+  { 0xA4, 0x08, 0x01 },
+  { 0xA4, 0x0C, 0xC3 },
+  { 0xA4, 0x0E, 0x75 },
+  { 0xA4, 0x10, 0xB6 },
+  { 0xA4, 0x11, 0xBB },
+  { 0xA4, 0x16, 0xC0 },
+  { 0xA4, 0x16, 0xE7 },
+  { 0xA4, 0x17, 0x8B },
+  { 0xA4, 0x18, 0x75 },
+  { 0xA4, 0x1A, 0x3A },
+  { 0xA4, 0x2A, 0x95 },
+  { 0xA4, 0x2B, 0x8C },
+  { 0xA4, 0x2B, 0xB0 },
+  { 0xA4, 0x31, 0x35 },
+  { 0xA4, 0x38, 0xCC },
+  { 0xA4, 0x40, 0x27 },
+  { 0xA4, 0x45, 0x19 },
+  { 0xA4, 0x4B, 0xD5 },
+  { 0xA4, 0x4C, 0x11 },
+  { 0xA4, 0x50, 0x46 },
+  { 0xA4, 0x53, 0x0E },
+  { 0xA4, 0x55, 0x90 },
+  { 0xA4, 0x56, 0x30 },
+  { 0xA4, 0x5C, 0x27 },
+  { 0xA4, 0x5E, 0x60 },
+  { 0xA4, 0x67, 0x06 },
+  { 0xA4, 0x6C, 0x24 },
+  { 0xA4, 0x6C, 0x2A },
+  { 0xA4, 0x6D, 0xA4 },
+  { 0xA4, 0x71, 0x74 },
+  { 0xA4, 0x77, 0x33 },
+  { 0xA4, 0x77, 0xF3 },
+  { 0xA4, 0x78, 0x06 },
+  { 0xA4, 0x7B, 0x9D },
+  { 0xA4, 0x7C, 0xC9 },
+  { 0xA4, 0x7E, 0x39 },
+  { 0xA4, 0x83, 0xE7 },
+  { 0xA4, 0x88, 0x73 },
+  { 0xA4, 0x93, 0x3F },
+  { 0xA4, 0x93, 0x4C },
+  { 0xA4, 0x99, 0x47 },
+  { 0xA4, 0x9B, 0x4F },
+  { 0xA4, 0x9B, 0xCD },
+  { 0xA4, 0xA2, 0x4A },
+  { 0xA4, 0xA4, 0x6B },
+  { 0xA4, 0xB1, 0x97 },
+  { 0xA4, 0xB2, 0x39 },
+  { 0xA4, 0xB4, 0x39 },
+  { 0xA4, 0xB8, 0x05 },
+  { 0xA4, 0xBA, 0x76 },
+  { 0xA4, 0xBD, 0xC4 },
+  { 0xA4, 0xBE, 0x2B },
+  { 0xA4, 0xC0, 0xE1 },
+  { 0xA4, 0xC3, 0x37 },
+  { 0xA4, 0xC3, 0x61 },
+  { 0xA4, 0xC6, 0x4F },
+  { 0xA4, 0xC6, 0xF0 },
+  { 0xA4, 0xCA, 0xA0 },
+  { 0xA4, 0xCC, 0xB3 },
+  { 0xA4, 0xCF, 0x12 },
+  { 0xA4, 0xCF, 0x99 },
+  { 0xA4, 0xD1, 0x8C },
+  { 0xA4, 0xD1, 0xD2 },
+  { 0xA4, 0xD2, 0x3E },
+  { 0xA4, 0xD9, 0x31 },
+  { 0xA4, 0xDC, 0xBE },
+  { 0xA4, 0xDD, 0x58 },
+  { 0xA4, 0xE2, 0x87 },
+  { 0xA4, 0xE5, 0x7C },
+  { 0xA4, 0xE9, 0x75 },
+  { 0xA4, 0xF1, 0xE8 },
+  { 0xA4, 0xF3, 0x3B },
+  { 0xA4, 0xF6, 0xE8 },
+  { 0xA4, 0xF8, 0x41 },
+  { 0xA4, 0xFC, 0x14 },
+  { 0xA8, 0x02, 0xDB },
+  { 0xA8, 0x03, 0x2A },
+  { 0xA8, 0x0B, 0xFB },
+  { 0xA8, 0x0C, 0x0D },
+  { 0xA8, 0x0C, 0x63 },
+  { 0xA8, 0x15, 0x4D },
+  { 0xA8, 0x1A, 0xF1 },
+  { 0xA8, 0x20, 0x66 },
+  { 0xA8, 0x2B, 0xCD },
+  { 0xA8, 0x3A, 0x79 },
+  { 0xA8, 0x3B, 0x5C },
+  { 0xA8, 0x3E, 0xD3 },
+  { 0xA8, 0x42, 0xA1 },
+  { 0xA8, 0x42, 0xE3 },
+  { 0xA8, 0x46, 0x9D },
+  { 0xA8, 0x48, 0xFA },
+  { 0xA8, 0x49, 0x4D },
+  { 0xA8, 0x4A, 0x28 },
+  { 0xA8, 0x4F, 0xB1 },
+  { 0xA8, 0x50, 0x81 },
+  { 0xA8, 0x51, 0xAB },
+  { 0xA8, 0x52, 0xD4 },
+  { 0xA8, 0x53, 0x7D },
+  { 0xA8, 0x57, 0x4E },
+  { 0xA8, 0x5B, 0x78 },
+  { 0xA8, 0x5B, 0xB7 },
+  { 0xA8, 0x5B, 0xF7 },
+  { 0xA8, 0x5C, 0x2C },
+  { 0xA8, 0x5E, 0x45 },
+  { 0xA8, 0x60, 0xB6 },
+  { 0xA8, 0x63, 0x7D },
+  { 0xA8, 0x66, 0x7F },
+  { 0xA8, 0x6A, 0x86 },
+  { 0xA8, 0x74, 0x84 },
+  { 0xA8, 0x7C, 0x45 },
+  { 0xA8, 0x7C, 0xF8 },
+  { 0xA8, 0x7D, 0x12 },
+  { 0xA8, 0x81, 0x7E },
+  { 0xA8, 0x86, 0xDD },
+  { 0xA8, 0x88, 0x08 },
+  { 0xA8, 0x8C, 0x3E },
+  { 0xA8, 0x8E, 0x24 },
+  { 0xA8, 0x8F, 0xD9 },
+  { 0xA8, 0x91, 0x3D },
+  { 0xA8, 0x96, 0x8A },
+  { 0xA8, 0x9C, 0x78 },
+  { 0xA8, 0x9C, 0xED },
+  { 0xA8, 0x9D, 0x21 },
+  { 0xA8, 0xA6, 0x68 },
+  { 0xA8, 0xAB, 0xB5 },
+  { 0xA8, 0xB1, 0xD4 },
+  { 0xA8, 0xB2, 0x71 },
+  { 0xA8, 0xB4, 0x56 },
+  { 0xA8, 0xB5, 0x7C },
+  { 0xA8, 0xBB, 0x56 },
+  { 0xA8, 0xBB, 0xCF },
+  { 0xA8, 0xBE, 0x27 },
+  { 0xA8, 0xC8, 0x3A },
+  { 0xA8, 0xCA, 0x77 },
+  { 0xA8, 0xCA, 0x7B },
+  { 0xA8, 0xD4, 0xE0 },
+  { 0xA8, 0xE5, 0x44 },
+  { 0xA8, 0xE6, 0x21 },
+  { 0xA8, 0xF5, 0xAC },
+  { 0xA8, 0xF7, 0xD9 },
+  { 0xA8, 0xFA, 0xD8 },
+  { 0xA8, 0xFE, 0x9D },
+  { 0xA8, 0xFF, 0xBA },
+  { 0xAC, 0x00, 0x7A },
+  { 0xAC, 0x00, 0xD0 },
+  { 0xAC, 0x07, 0x5F },
+  { 0xAC, 0x07, 0x75 },
+  { 0xAC, 0x0B, 0xFB },
+  { 0xAC, 0x15, 0xA2 },
+  { 0xAC, 0x15, 0xF4 },
+  { 0xAC, 0x16, 0x15 },
+  { 0xAC, 0x17, 0xC8 },
+  { 0xAC, 0x1D, 0x06 },
+  { 0xAC, 0x1E, 0x9E },
+  { 0xAC, 0x1F, 0x74 },
+  { 0xAC, 0x22, 0x0B },
+  { 0xAC, 0x23, 0x16 },
+  { 0xAC, 0x29, 0x3A },
+  { 0xAC, 0x2A, 0xA1 },
+  { 0xAC, 0x3A, 0x67 },
+  { 0xAC, 0x3A, 0x7A },
+  { 0xAC, 0x3C, 0x0B },
+  { 0xAC, 0x3E, 0xB1 },
+  { 0xAC, 0x41, 0x6A },
+  { 0xAC, 0x45, 0x00 },
+  { 0xAC, 0x49, 0xDB },
+  { 0xAC, 0x4A, 0x56 },
+  { 0xAC, 0x4A, 0x67 },
+  { 0xAC, 0x4E, 0x91 },
+  { 0xAC, 0x51, 0xAB },
+  { 0xAC, 0x5E, 0x14 },
+  { 0xAC, 0x60, 0x89 },
+  { 0xAC, 0x61, 0x75 },
+  { 0xAC, 0x61, 0xEA },
+  { 0xAC, 0x63, 0xBE },
+  { 0xAC, 0x64, 0x62 },
+  { 0xAC, 0x64, 0x90 },
+  { 0xAC, 0x67, 0x06 },
+  { 0xAC, 0x67, 0x84 },
+  { 0xAC, 0x67, 0xB2 },
+  { 0xAC, 0x71, 0x2E },
+  { 0xAC, 0x75, 0x1D },
+  { 0xAC, 0x7A, 0x56 },
+  { 0xAC, 0x7E, 0x8A },
+  { 0xAC, 0x7F, 0x3E },
+  { 0xAC, 0x84, 0xC6 },
+  { 0xAC, 0x85, 0x3D },
+  { 0xAC, 0x86, 0xA3 },
+  { 0xAC, 0x87, 0xA3 },
+  { 0xAC, 0x88, 0xFD },
+  { 0xAC, 0x8B, 0xA9 },
+  { 0xAC, 0x8D, 0x34 },
+  { 0xAC, 0x90, 0x73 },
+  { 0xAC, 0x90, 0x85 },
+  { 0xAC, 0x92, 0x32 },
+  { 0xAC, 0x97, 0x38 },
+  { 0xAC, 0x99, 0x29 },
+  { 0xAC, 0x9E, 0x17 },
+  { 0xAC, 0xA0, 0x16 },
+  { 0xAC, 0xA3, 0x1E },
+  { 0xAC, 0xAD, 0x4B },
+  { 0xAC, 0xAE, 0x19 },
+  { 0xAC, 0xB3, 0xB5 },
+  { 0xAC, 0xBC, 0x32 },
+  { 0xAC, 0xBC, 0xB5 },
+  { 0xAC, 0xBC, 0xD9 },
+  { 0xAC, 0xC1, 0xEE },
+  { 0xAC, 0xC9, 0x06 },
+  { 0xAC, 0xCC, 0xFC },
+  { 0xAC, 0xCF, 0x5C },
+  { 0xAC, 0xCF, 0x85 },
+  { 0xAC, 0xD0, 0x74 },
+  { 0xAC, 0xD3, 0x1D },
+  { 0xAC, 0xDC, 0xCA },
+  { 0xAC, 0xDF, 0xA1 },
+  { 0xAC, 0xE2, 0x15 },
+  { 0xAC, 0xE3, 0x42 },
+  { 0xAC, 0xE4, 0xB5 },
+  { 0xAC, 0xE8, 0x7B },
+  { 0xAC, 0xF1, 0xDF },
+  { 0xAC, 0xF2, 0xC5 },
+  { 0xAC, 0xF5, 0xE6 },
+  { 0xAC, 0xF7, 0xF3 },
+  { 0xAC, 0xF9, 0x70 },
+  { 0xAC, 0xFD, 0xEC },
+  { 0xAC, 0xFF, 0x6B },
+  { 0xB0, 0x00, 0xB4 },
+  { 0xB0, 0x08, 0x75 },
+  { 0xB0, 0x0A, 0xD5 },
+  { 0xB0, 0x16, 0x56 },
+  { 0xB0, 0x19, 0xC6 },
+  { 0xB0, 0x1F, 0x8C },
+  { 0xB0, 0x21, 0x6F },
+  { 0xB0, 0x26, 0x80 },
+  { 0xB0, 0x2A, 0x43 },
+  { 0xB0, 0x34, 0x95 },
+  { 0xB0, 0x35, 0xB5 },
+  { 0xB0, 0x39, 0x56 },
+  { 0xB0, 0x3F, 0x64 },
+  { 0xB0, 0x48, 0x1A },
+  { 0xB0, 0x48, 0x7A },
+  { 0xB0, 0x4E, 0x26 },
+  { 0xB0, 0x55, 0x08 },
+  { 0xB0, 0x5B, 0x67 },
+  { 0xB0, 0x65, 0xBD },
+  { 0xB0, 0x67, 0xB5 },
+  { 0xB0, 0x6A, 0x41 },
+  { 0xB0, 0x6E, 0xBF },
+  { 0xB0, 0x70, 0x2D },
+  { 0xB0, 0x73, 0x9C },
+  { 0xB0, 0x75, 0xD5 },
+  { 0xB0, 0x76, 0x1B },
+  { 0xB0, 0x7D, 0x47 },
+  { 0xB0, 0x7F, 0xB9 },
+  { 0xB0, 0x89, 0x00 },
+  { 0xB0, 0x8B, 0x92 },
+  { 0xB0, 0x8B, 0xCF },
+  { 0xB0, 0x8B, 0xD0 },
+  { 0xB0, 0x8C, 0x75 },
+  { 0xB0, 0x8D, 0x57 },
+  { 0xB0, 0x90, 0x7E },
+  { 0xB0, 0x95, 0x75 },
+  { 0xB0, 0x95, 0x8E },
+  { 0xB0, 0x99, 0x5A },
+  { 0xB0, 0x9C, 0x63 },
+  { 0xB0, 0x9F, 0xBA },
+  { 0xB0, 0xA4, 0xF0 },
+  { 0xB0, 0xA6, 0x51 },
+  { 0xB0, 0xA7, 0x32 },
+  { 0xB0, 0xA7, 0x37 },
+  { 0xB0, 0xA7, 0xB9 },
+  { 0xB0, 0xAA, 0x77 },
+  { 0xB0, 0xAC, 0xD2 },
+  { 0xB0, 0xB1, 0x94 },
+  { 0xB0, 0xB2, 0x1C },
+  { 0xB0, 0xB2, 0xDC },
+  { 0xB0, 0xB9, 0x8A },
+  { 0xB0, 0xBE, 0x76 },
+  { 0xB0, 0xBE, 0x83 },
+  { 0xB0, 0xC1, 0x9E },
+  { 0xB0, 0xC5, 0x3C },
+  { 0xB0, 0xC5, 0x54 },
+  { 0xB0, 0xC7, 0x45 },
+  { 0xB0, 0xC7, 0x87 },
+  { 0xB0, 0xCA, 0x68 },
+  { 0xB0, 0xCF, 0xCB },
+  { 0xB0, 0xD5, 0x76 },
+  { 0xB0, 0xDE, 0x28 },
+  { 0xB0, 0xE1, 0x7E },
+  { 0xB0, 0xE2, 0x35 },
+  { 0xB0, 0xE4, 0xD5 },
+  { 0xB0, 0xE5, 0xED },
+  { 0xB0, 0xE5, 0xEF },
+  { 0xB0, 0xE5, 0xF9 },
+  { 0xB0, 0xEB, 0x57 },
+  { 0xB0, 0xEC, 0xDD },
+  { 0xB0, 0xEE, 0x7B },
+  { 0xB0, 0xF1, 0xD8 },
+  { 0xB0, 0xF2, 0x08 },
+  { 0xB0, 0xF7, 0xC4 },
+  { 0xB0, 0xFA, 0xEB },
+  { 0xB0, 0xFC, 0x0D },
+  { 0xB4, 0x02, 0x16 },
+  { 0xB4, 0x04, 0x21 },
+  { 0xB4, 0x05, 0xA1 },
+  { 0xB4, 0x09, 0x31 },
+  { 0xB4, 0x14, 0x89 },
+  { 0xB4, 0x14, 0xE6 },
+  { 0xB4, 0x15, 0x13 },
+  { 0xB4, 0x18, 0xD1 },
+  { 0xB4, 0x19, 0x74 },
+  { 0xB4, 0x1B, 0xB0 },
+  { 0xB4, 0x1C, 0x30 },
+  { 0xB4, 0x2B, 0xB9 },
+  { 0xB4, 0x30, 0x52 },
+  { 0xB4, 0x37, 0xD8 },
+  { 0xB4, 0x3A, 0xE2 },
+  { 0xB4, 0x40, 0xA4 },
+  { 0xB4, 0x43, 0x26 },
+  { 0xB4, 0x4B, 0xD2 },
+  { 0xB4, 0x4C, 0x90 },
+  { 0xB4, 0x56, 0xE3 },
+  { 0xB4, 0x5D, 0x50 },
+  { 0xB4, 0x5F, 0x84 },
+  { 0xB4, 0x61, 0x42 },
+  { 0xB4, 0x6E, 0x08 },
+  { 0xB4, 0x75, 0x0E },
+  { 0xB4, 0x79, 0xC8 },
+  { 0xB4, 0x7C, 0x9C },
+  { 0xB4, 0x85, 0xE1 },
+  { 0xB4, 0x86, 0x55 },
+  { 0xB4, 0x89, 0x01 },
+  { 0xB4, 0x8A, 0x0A },
+  { 0xB4, 0x8B, 0x19 },
+  { 0xB4, 0x98, 0x42 },
+  { 0xB4, 0x9C, 0xDF },
+  { 0xB4, 0xA4, 0xE3 },
+  { 0xB4, 0xA8, 0xB9 },
+  { 0xB4, 0xAE, 0xC1 },
+  { 0xB4, 0xB0, 0x24 },
+  { 0xB4, 0xB0, 0x55 },
+  { 0xB4, 0xB3, 0x62 },
+  { 0xB4, 0xB7, 0x42 },
+  { 0xB4, 0xC4, 0xFC },
+  { 0xB4, 0xCD, 0x27 },
+  { 0xB4, 0xDE, 0x31 },
+  { 0xB4, 0xDE, 0xDF },
+  { 0xB4, 0xDF, 0x91 },
+  { 0xB4, 0xE4, 0x54 },
+  { 0xB4, 0xE6, 0x2D },
+  { 0xB4, 0xE9, 0xB0 },
+  { 0xB4, 0xF0, 0xAB },
+  { 0xB4, 0xF5, 0x8E },
+  { 0xB4, 0xF6, 0x1C },
+  { 0xB4, 0xFA, 0x48 },
+  { 0xB4, 0xFB, 0xE4 },
+  { 0xB4, 0xFB, 0xF9 },
+  { 0xB4, 0xFF, 0x98 },
+  { 0xB8, 0x05, 0xAB },
+  { 0xB8, 0x07, 0x56 },
+  { 0xB8, 0x08, 0xD7 },
+  { 0xB8, 0x09, 0x8A },
+  { 0xB8, 0x11, 0x4B },
+  { 0xB8, 0x14, 0x4D },
+  { 0xB8, 0x17, 0xC2 },
+  { 0xB8, 0x21, 0x1C },
+  { 0xB8, 0x27, 0xEB },
+  { 0xB8, 0x2A, 0xA9 },
+  { 0xB8, 0x31, 0xB5 },
+  { 0xB8, 0x37, 0x4A },
+  { 0xB8, 0x37, 0xB2 },
+  { 0xB8, 0x38, 0x61 },
+  { 0xB8, 0x3A, 0x5A },
+  { 0xB8, 0x3B, 0xCC },
+  { 0xB8, 0x3C, 0x28 },
+  { 0xB8, 0x3E, 0x59 },
+  { 0xB8, 0x41, 0xA4 },
+  { 0xB8, 0x44, 0xD9 },
+  { 0xB8, 0x49, 0x6D },
+  { 0xB8, 0x4F, 0xD5 },
+  { 0xB8, 0x53, 0xAC },
+  { 0xB8, 0x56, 0x00 },
+  { 0xB8, 0x5D, 0x0A },
+  { 0xB8, 0x5D, 0xC3 },
+  { 0xB8, 0x5F, 0x98 },
+  { 0xB8, 0x5F, 0xB0 },
+  { 0xB8, 0x62, 0x1F },
+  { 0xB8, 0x63, 0x4D },
+  { 0xB8, 0x69, 0xF4 },
+  { 0xB8, 0x78, 0x26 },
+  { 0xB8, 0x78, 0x2E },
+  { 0xB8, 0x7B, 0xC5 },
+  { 0xB8, 0x7B, 0xD4 },
+  { 0xB8, 0x81, 0xFA },
+  { 0xB8, 0x85, 0x7B },
+  { 0xB8, 0x8A, 0xEC },
+  { 0xB8, 0x8D, 0x12 },
+  { 0xB8, 0x90, 0x47 },
+  { 0xB8, 0x94, 0x36 },
+  { 0xB8, 0x94, 0xE7 },
+  { 0xB8, 0x9F, 0xCC },
+  { 0xB8, 0xA1, 0x75 },
+  { 0xB8, 0xA3, 0x77 },
+  { 0xB8, 0xA3, 0x86 },
+  { 0xB8, 0xAB, 0x61 },
+  { 0xB8, 0xAE, 0x6E },
+  { 0xB8, 0xB2, 0xF8 },
+  { 0xB8, 0xBC, 0x1B },
+  { 0xB8, 0xBE, 0xBF },
+  { 0xB8, 0xC1, 0x11 },
+  { 0xB8, 0xC3, 0x85 },
+  { 0xB8, 0xC7, 0x5D },
+  { 0xB8, 0xD4, 0xBC },
+  { 0xB8, 0xD4, 0xE7 },
+  { 0xB8, 0xD5, 0x26 },
+  { 0xB8, 0xD6, 0x1A },
+  { 0xB8, 0xD6, 0xF6 },
+  { 0xB8, 0xDB, 0x38 },
+  { 0xB8, 0xDD, 0x71 },
+  { 0xB8, 0xE3, 0xB1 },
+  { 0xB8, 0xE6, 0x0C },
+  { 0xB8, 0xE8, 0x56 },
+  { 0xB8, 0xE9, 0x37 },
+  { 0xB8, 0xEA, 0x98 },
+  { 0xB8, 0xEC, 0xA3 },
+  { 0xB8, 0xF0, 0x09 },
+  { 0xB8, 0xF0, 0xB9 },
+  { 0xB8, 0xF1, 0x2A },
+  { 0xB8, 0xF6, 0xB1 },
+  { 0xB8, 0xF8, 0x83 },
+  { 0xB8, 0xFF, 0x61 },
+  { 0xBC, 0x05, 0x43 },
+  { 0xBC, 0x09, 0x63 },
+  { 0xBC, 0x0F, 0x9A },
+  { 0xBC, 0x16, 0x65 },
+  { 0xBC, 0x16, 0x95 },
+  { 0xBC, 0x16, 0xF5 },
+  { 0xBC, 0x18, 0x96 },
+  { 0xBC, 0x1E, 0x85 },
+  { 0xBC, 0x22, 0x28 },
+  { 0xBC, 0x25, 0xE0 },
+  { 0xBC, 0x26, 0xC7 },
+  { 0xBC, 0x2C, 0xE6 },
+  { 0xBC, 0x33, 0x40 },
+  { 0xBC, 0x37, 0xD3 },
+  { 0xBC, 0x3B, 0xAF },
+  { 0xBC, 0x3D, 0x85 },
+  { 0xBC, 0x3F, 0x8F },
+  { 0xBC, 0x46, 0x99 },
+  { 0xBC, 0x4A, 0x56 },
+  { 0xBC, 0x4C, 0x78 },
+  { 0xBC, 0x4C, 0xA0 },
+  { 0xBC, 0x4C, 0xC4 },
+  { 0xBC, 0x52, 0xB7 },
+  { 0xBC, 0x54, 0x36 },
+  { 0xBC, 0x5A, 0x56 },
+  { 0xBC, 0x61, 0x93 },
+  { 0xBC, 0x62, 0x0E },
+  { 0xBC, 0x62, 0x9C },
+  { 0xBC, 0x67, 0x1C },
+  { 0xBC, 0x67, 0x78 },
+  { 0xBC, 0x6A, 0xD1 },
+  { 0xBC, 0x6C, 0x21 },
+  { 0xBC, 0x74, 0x4B },
+  { 0xBC, 0x75, 0x74 },
+  { 0xBC, 0x76, 0x70 },
+  { 0xBC, 0x76, 0xC5 },
+  { 0xBC, 0x7F, 0xA4 },
+  { 0xBC, 0x83, 0x85 },
+  { 0xBC, 0x89, 0xA7 },
+  { 0xBC, 0x8D, 0x1F },
+  { 0xBC, 0x92, 0x6B },
+  { 0xBC, 0x99, 0x11 },
+  { 0xBC, 0x99, 0x30 },
+  { 0xBC, 0x9C, 0x31 },
+  { 0xBC, 0x9E, 0xBB },
+  { 0xBC, 0x9F, 0xE4 },
+  { 0xBC, 0x9F, 0xEF },
+  { 0xBC, 0xA5, 0x11 },
+  { 0xBC, 0xA5, 0xA9 },
+  { 0xBC, 0xA9, 0x20 },
+  { 0xBC, 0xAE, 0xC5 },
+  { 0xBC, 0xB0, 0xE7 },
+  { 0xBC, 0xB1, 0xD3 },
+  { 0xBC, 0xB8, 0x63 },
+  { 0xBC, 0xBB, 0x58 },
+  { 0xBC, 0xBD, 0x84 },
+  { 0xBC, 0xC4, 0x27 },
+  { 0xBC, 0xC4, 0x93 },
+  { 0xBC, 0xC8, 0x10 },
+  { 0xBC, 0xCE, 0x25 },
+  { 0xBC, 0xCF, 0x4F },
+  { 0xBC, 0xD0, 0x74 },
+  { 0xBC, 0xD1, 0x65 },
+  { 0xBC, 0xD1, 0x77 },
+  { 0xBC, 0xD2, 0x06 },
+  { 0xBC, 0xD2, 0x95 },
+  { 0xBC, 0xD7, 0xA5 },
+  { 0xBC, 0xD7, 0xD4 },
+  { 0xBC, 0xDB, 0x09 },
+  { 0xBC, 0xDD, 0xC2 },
+  { 0xBC, 0xDF, 0x58 },
+  { 0xBC, 0xE1, 0x43 },
+  { 0xBC, 0xE2, 0x65 },
+  { 0xBC, 0xE7, 0x12 },
+  { 0xBC, 0xEC, 0x5D },
+  { 0xBC, 0xEE, 0x7B },
+  { 0xBC, 0xF1, 0xF2 },
+  { 0xBC, 0xF4, 0x5F },
+  { 0xBC, 0xF6, 0x85 },
+  { 0xBC, 0xF8, 0x8B },
+  { 0xBC, 0xFA, 0xEB },
+  { 0xBC, 0xFE, 0xD9 },
+  { 0xBC, 0xFF, 0x4D },
+  { 0xC0, 0x06, 0x0C },
+  { 0xC0, 0x06, 0xC3 },
+  { 0xC0, 0x14, 0xFE },
+  { 0xC0, 0x16, 0x93 },
+  { 0xC0, 0x17, 0x54 },
+  { 0xC0, 0x1A, 0xDA },
+  { 0xC0, 0x25, 0x06 },
+  { 0xC0, 0x25, 0x5C },
+  { 0xC0, 0x25, 0xE9 },
+  { 0xC0, 0x2C, 0x17 },
+  { 0xC0, 0x2C, 0x5C },
+  { 0xC0, 0x33, 0x79 },
+  { 0xC0, 0x3E, 0x50 },
+  { 0xC0, 0x3F, 0x0E },
+  { 0xC0, 0x3F, 0xDD },
+  { 0xC0, 0x44, 0x42 },
+  { 0xC0, 0x49, 0x43 },
+  { 0xC0, 0x49, 0xEF },
+  { 0xC0, 0x4A, 0x00 },
+  { 0xC0, 0x4E, 0x30 },
+  { 0xC0, 0x4E, 0x8A },
+  { 0xC0, 0x51, 0x5C },
+  { 0xC0, 0x56, 0x27 },
+  { 0xC0, 0x61, 0x18 },
+  { 0xC0, 0x62, 0x6B },
+  { 0xC0, 0x63, 0x94 },
+  { 0xC0, 0x64, 0xE4 },
+  { 0xC0, 0x67, 0xAF },
+  { 0xC0, 0x70, 0x09 },
+  { 0xC0, 0x7B, 0xBC },
+  { 0xC0, 0x84, 0x7A },
+  { 0xC0, 0x84, 0xE0 },
+  { 0xC0, 0x8A, 0xDE },
+  { 0xC0, 0x8B, 0x05 },
+  { 0xC0, 0x8B, 0x2A },
+  { 0xC0, 0x8C, 0x60 },
+  { 0xC0, 0x8D, 0x51 },
+  { 0xC0, 0x91, 0xB9 },
+  { 0xC0, 0x92, 0x96 },
+  { 0xC0, 0x94, 0xAD },
+  { 0xC0, 0x95, 0x6D },
+  { 0xC0, 0x9A, 0xD0 },
+  { 0xC0, 0x9F, 0x42 },
+  { 0xC0, 0x9F, 0xE1 },
+  { 0xC0, 0xA0, 0xBB },
+  { 0xC0, 0xA5, 0x3E },
+  { 0xC0, 0xA6, 0x00 },
+  { 0xC0, 0xA9, 0x38 },
+  { 0xC0, 0xB1, 0x01 },
+  { 0xC0, 0xB6, 0x58 },
+  { 0xC0, 0xBC, 0x9A },
+  { 0xC0, 0xBF, 0xC0 },
+  { 0xC0, 0xC1, 0xC0 },
+  { 0xC0, 0xC5, 0x20 },
+  { 0xC0, 0xC6, 0x87 },
+  { 0xC0, 0xC7, 0x0A },
+  { 0xC0, 0xC9, 0xE3 },
+  { 0xC0, 0xCC, 0xF8 },
+  { 0xC0, 0xCE, 0xCD },
+  { 0xC0, 0xD0, 0x12 },
+  { 0xC0, 0xE0, 0x18 },
+  { 0xC0, 0xE1, 0xBE },
+  { 0xC0, 0xE3, 0xFB },
+  { 0xC0, 0xE4, 0x2D },
+  { 0xC0, 0xE8, 0x62 },
+  { 0xC0, 0xF2, 0xFB },
+  { 0xC0, 0xF4, 0xE6 },
+  { 0xC0, 0xF6, 0xC2 },
+  { 0xC0, 0xF6, 0xEC },
+  { 0xC0, 0xF8, 0x7F },
+  { 0xC0, 0xF9, 0xB0 },
+  { 0xC0, 0xFD, 0x84 },
+  { 0xC0, 0xFF, 0xA8 },
+  { 0xC0, 0xFF, 0xD4 },
+  { 0xC4, 0x01, 0x7C },
+  { 0xC4, 0x04, 0x15 },
+  { 0xC4, 0x05, 0x28 },
+  { 0xC4, 0x06, 0x83 },
+  { 0xC4, 0x07, 0x2F },
+  { 0xC4, 0x0A, 0xCB },
+  { 0xC4, 0x0B, 0x31 },
+  { 0xC4, 0x0B, 0xCB },
+  { 0xC4, 0x0D, 0x96 },
+  { 0xC4, 0x10, 0x8A },
+  { 0xC4, 0x12, 0x34 },
+  { 0xC4, 0x12, 0xEC },
+  { 0xC4, 0x12, 0xF5 },
+  { 0xC4, 0x14, 0x11 },
+  { 0xC4, 0x14, 0x3C },
+  { 0xC4, 0x14, 0xA2 },
+  { 0xC4, 0x16, 0xC8 },
+  { 0xC4, 0x21, 0xB9 },
+  { 0xC4, 0x27, 0x28 },
+  { 0xC4, 0x2A, 0xD0 },
+  { 0xC4, 0x2C, 0x03 },
+  { 0xC4, 0x34, 0x5B },
+  { 0xC4, 0x35, 0xD9 },
+  { 0xC4, 0x36, 0xC0 },
+  { 0xC4, 0x38, 0x75 },
+  { 0xC4, 0x3C, 0xEA },
+  { 0xC4, 0x3D, 0xC7 },
+  { 0xC4, 0x41, 0x1E },
+  { 0xC4, 0x44, 0x7D },
+  { 0xC4, 0x44, 0xA0 },
+  { 0xC4, 0x46, 0x06 },
+  { 0xC4, 0x47, 0x3F },
+  { 0xC4, 0x4D, 0x84 },
+  { 0xC4, 0x4F, 0x33 },
+  { 0xC4, 0x52, 0x4F },
+  { 0xC4, 0x57, 0xCD },
+  { 0xC4, 0x5B, 0xBE },
+  { 0xC4, 0x5E, 0x5C },
+  { 0xC4, 0x61, 0x8B },
+  { 0xC4, 0x61, 0xC7 },
+  { 0xC4, 0x64, 0x13 },
+  { 0xC4, 0x67, 0xD1 },
+  { 0xC4, 0x69, 0xF0 },
+  { 0xC4, 0x6A, 0xB7 },
+  { 0xC4, 0x6E, 0x1F },
+  { 0xC4, 0x71, 0x54 },
+  { 0xC4, 0x71, 0xFE },
+  { 0xC4, 0x72, 0x95 },
+  { 0xC4, 0x74, 0x1E },
+  { 0xC4, 0x75, 0xEA },
+  { 0xC4, 0x7D, 0x4F },
+  { 0xC4, 0x7E, 0xE0 },
+  { 0xC4, 0x84, 0x66 },
+  { 0xC4, 0x86, 0xE9 },
+  { 0xC4, 0x8B, 0xA3 },
+  { 0xC4, 0x91, 0x0C },
+  { 0xC4, 0x95, 0x00 },
+  { 0xC4, 0x98, 0x80 },
+  { 0xC4, 0x9D, 0xED },
+  { 0xC4, 0x9F, 0x4C },
+  { 0xC4, 0xA3, 0x66 },
+  { 0xC4, 0xA4, 0x02 },
+  { 0xC4, 0xA8, 0x1D },
+  { 0xC4, 0xAA, 0x99 },
+  { 0xC4, 0xAC, 0xAA },
+  { 0xC4, 0xAD, 0x34 },
+  { 0xC4, 0xB2, 0x39 },
+  { 0xC4, 0xB3, 0x01 },
+  { 0xC4, 0xB3, 0x6A },
+  { 0xC4, 0xB8, 0xB4 },
+  { 0xC4, 0xB9, 0xCD },
+  { 0xC4, 0xC1, 0x7D },
+  { 0xC4, 0xC3, 0x6B },
+  { 0xC4, 0xC6, 0x03 },
+  { 0xC4, 0xCB, 0x76 },
+  { 0xC4, 0xD4, 0x38 },
+  { 0xC4, 0xD6, 0x66 },
+  { 0xC4, 0xD8, 0xD5 },
+  { 0xC4, 0xDB, 0x04 },
+  { 0xC4, 0xDD, 0x57 },
+  { 0xC4, 0xDE, 0xE2 },
+  { 0xC4, 0xE2, 0x87 },
+  { 0xC4, 0xE9, 0x0A },
+  { 0xC4, 0xE9, 0x84 },
+  { 0xC4, 0xEB, 0xFF },
+  { 0xC4, 0xF0, 0x81 },
+  { 0xC4, 0xF7, 0xD5 },
+  { 0xC4, 0xFB, 0xAA },
+  { 0xC4, 0xFF, 0x1F },
+  { 0xC8, 0x00, 0x84 },
+  { 0xC8, 0x03, 0xF5 },
+  { 0xC8, 0x08, 0x73 },
+  { 0xC8, 0x0C, 0xC8 },
+  { 0xC8, 0x0E, 0x14 },
+  { 0xC8, 0x14, 0x51 },
+  { 0xC8, 0x1E, 0xE7 },
+  { 0xC8, 0x1F, 0xBE },
+  { 0xC8, 0x28, 0xE5 },
+  { 0xC8, 0x2A, 0x14 },
+  { 0xC8, 0x2A, 0xDD },
+  { 0xC8, 0x2B, 0x96 },
+  { 0xC8, 0x2E, 0x18 },
+  { 0xC8, 0x33, 0x4B },
+  { 0xC8, 0x33, 0xE5 },
+  { 0xC8, 0x3A, 0x6B },
+  { 0xC8, 0x3C, 0x85 },
+  { 0xC8, 0x3D, 0xDC },
+  { 0xC8, 0x3F, 0x26 },
+  { 0xC8, 0x47, 0x09 },
+  { 0xC8, 0x4C, 0x75 },
+  { 0xC8, 0x4C, 0x78 },
+  { 0xC8, 0x50, 0xCE },
+  { 0xC8, 0x51, 0x95 },
+  { 0xC8, 0x54, 0x4B },
+  { 0xC8, 0x5A, 0x9F },
+  { 0xC8, 0x60, 0x00 },
+  { 0xC8, 0x64, 0xC7 },
+  { 0xC8, 0x69, 0xCD },
+  { 0xC8, 0x6C, 0x3D },
+  { 0xC8, 0x6C, 0x87 },
+  { 0xC8, 0x6F, 0x1D },
+  { 0xC8, 0x78, 0x67 },
+  { 0xC8, 0x78, 0x7D },
+  { 0xC8, 0x7B, 0x5B },
+  { 0xC8, 0x7F, 0x54 },
+  { 0xC8, 0x84, 0x8C },
+  { 0xC8, 0x84, 0xA1 },
+  { 0xC8, 0x84, 0xCF },
+  { 0xC8, 0x85, 0x50 },
+  { 0xC8, 0x89, 0xF3 },
+  { 0xC8, 0x8D, 0x83 },
+  { 0xC8, 0x94, 0xBB },
+  { 0xC8, 0x96, 0x65 },
+  { 0xC8, 0x98, 0x28 },
+  { 0xC8, 0x9C, 0x1D },
+  { 0xC8, 0x9E, 0x43 },
+  { 0xC8, 0x9F, 0x1A },
+  { 0xC8, 0xA6, 0x08 },
+  { 0xC8, 0xA7, 0x76 },
+  { 0xC8, 0xB1, 0xCD },
+  { 0xC8, 0xB3, 0x73 },
+  { 0xC8, 0xB5, 0xB7 },
+  { 0xC8, 0xB6, 0xD3 },
+  { 0xC8, 0xBC, 0xC8 },
+  { 0xC8, 0xBE, 0x19 },
+  { 0xC8, 0xC2, 0xFA },
+  { 0xC8, 0xC4, 0x65 },
+  { 0xC8, 0xC9, 0xA3 },
+  { 0xC8, 0xD0, 0x83 },
+  { 0xC8, 0xD1, 0x5E },
+  { 0xC8, 0xD1, 0xA9 },
+  { 0xC8, 0xD3, 0xA3 },
+  { 0xC8, 0xD7, 0x19 },
+  { 0xC8, 0xE0, 0xEB },
+  { 0xC8, 0xE6, 0x00 },
+  { 0xC8, 0xEA, 0xF8 },
+  { 0xC8, 0xF0, 0x9E },
+  { 0xC8, 0xF6, 0x50 },
+  { 0xC8, 0xF9, 0xF9 },
+  { 0xC8, 0xFB, 0x26 },
+  { 0xCC, 0x03, 0xD9 },
+  { 0xCC, 0x05, 0x77 },
+  { 0xCC, 0x08, 0x7B },
+  { 0xCC, 0x08, 0x8D },
+  { 0xCC, 0x08, 0xE0 },
+  { 0xCC, 0x08, 0xFA },
+  { 0xCC, 0x08, 0xFB },
+  { 0xCC, 0x0D, 0xEC },
+  { 0xCC, 0x11, 0x5A },
+  { 0xCC, 0x16, 0x7E },
+  { 0xCC, 0x1A, 0xFA },
+  { 0xCC, 0x1B, 0x5A },
+  { 0xCC, 0x1E, 0x56 },
+  { 0xCC, 0x1E, 0x97 },
+  { 0xCC, 0x20, 0x8C },
+  { 0xCC, 0x20, 0xE8 },
+  { 0xCC, 0x25, 0xEF },
+  { 0xCC, 0x28, 0xAA },
+  { 0xCC, 0x29, 0xBD },
+  { 0xCC, 0x29, 0xF5 },
+  { 0xCC, 0x2D, 0xB7 },
+  { 0xCC, 0x2D, 0xE0 },
+  { 0xCC, 0x32, 0xE5 },
+  { 0xCC, 0x34, 0x29 },
+  { 0xCC, 0x36, 0xCF },
+  { 0xCC, 0x3D, 0xD1 },
+  { 0xCC, 0x40, 0xD0 },
+  { 0xCC, 0x42, 0x10 },
+  { 0xCC, 0x44, 0x63 },
+  { 0xCC, 0x46, 0xD6 },
+  { 0xCC, 0x50, 0xE3 },
+  { 0xCC, 0x53, 0xB5 },
+  { 0xCC, 0x5A, 0x53 },
+  { 0xCC, 0x5B, 0x31 },
+  { 0xCC, 0x5D, 0x4E },
+  { 0xCC, 0x60, 0x23 },
+  { 0xCC, 0x60, 0xC8 },
+  { 0xCC, 0x64, 0xA6 },
+  { 0xCC, 0x66, 0x0A },
+  { 0xCC, 0x68, 0xB6 },
+  { 0xCC, 0x68, 0xE0 },
+  { 0xCC, 0x69, 0xFA },
+  { 0xCC, 0x6A, 0x33 },
+  { 0xCC, 0x6D, 0xA0 },
+  { 0xCC, 0x70, 0xED },
+  { 0xCC, 0x78, 0x5F },
+  { 0xCC, 0x79, 0xD7 },
+  { 0xCC, 0x7B, 0x35 },
+  { 0xCC, 0x7B, 0x5C },
+  { 0xCC, 0x7F, 0x75 },
+  { 0xCC, 0x7F, 0x76 },
+  { 0xCC, 0x88, 0xC7 },
+  { 0xCC, 0x89, 0x5E },
+  { 0xCC, 0x8D, 0xA2 },
+  { 0xCC, 0x8E, 0x71 },
+  { 0xCC, 0x90, 0x70 },
+  { 0xCC, 0x96, 0xA0 },
+  { 0xCC, 0x98, 0x91 },
+  { 0xCC, 0x9C, 0x3E },
+  { 0xCC, 0x9E, 0x00 },
+  { 0xCC, 0x9E, 0xA2 },
+  { 0xCC, 0xA0, 0x8F },
+  { 0xCC, 0xA2, 0x23 },
+  { 0xCC, 0xA7, 0xC1 },
+  { 0xCC, 0xB1, 0x82 },
+  { 0xCC, 0xB2, 0x55 },
+  { 0xCC, 0xB6, 0xC8 },
+  { 0xCC, 0xB7, 0xC4 },
+  { 0xCC, 0xBA, 0x6F },
+  { 0xCC, 0xBB, 0xFE },
+  { 0xCC, 0xBC, 0xE3 },
+  { 0xCC, 0xC7, 0x60 },
+  { 0xCC, 0xC9, 0x5D },
+  { 0xCC, 0xCC, 0x81 },
+  { 0xCC, 0xCE, 0x1E },
+  { 0xCC, 0xD0, 0x83 },
+  { 0xCC, 0xD2, 0x81 },
+  { 0xCC, 0xD3, 0x42 },
+  { 0xCC, 0xD5, 0x39 },
+  { 0xCC, 0xD7, 0x3C },
+  { 0xCC, 0xD8, 0xC1 },
+  { 0xCC, 0xDB, 0x93 },
+  { 0xCC, 0xDB, 0xA7 },
+  { 0xCC, 0xE1, 0xD5 },
+  { 0xCC, 0xEB, 0x5E },
+  { 0xCC, 0xED, 0x4D },
+  { 0xCC, 0xEF, 0x48 },
+  { 0xCC, 0xF4, 0x11 },
+  { 0xCC, 0xF7, 0x35 },
+  { 0xCC, 0xFB, 0x65 },
+  { 0xD0, 0x03, 0x4B },
+  { 0xD0, 0x09, 0xC8 },
+  { 0xD0, 0x11, 0xE5 },
+  { 0xD0, 0x12, 0xCB },
+  { 0xD0, 0x15, 0x4A },
+  { 0xD0, 0x15, 0xA6 },
+  { 0xD0, 0x16, 0xB4 },
+  { 0xD0, 0x17, 0xC2 },
+  { 0xD0, 0x21, 0xF9 },
+  { 0xD0, 0x23, 0xDB },
+  { 0xD0, 0x25, 0x98 },
+  { 0xD0, 0x2B, 0x20 },
+  { 0xD0, 0x2D, 0xB3 },
+  { 0xD0, 0x33, 0x11 },
+  { 0xD0, 0x37, 0x45 },
+  { 0xD0, 0x3E, 0x07 },
+  { 0xD0, 0x3E, 0x5C },
+  { 0xD0, 0x3F, 0xAA },
+  { 0xD0, 0x4D, 0x2C },
+  { 0xD0, 0x4D, 0xC6 },
+  { 0xD0, 0x4E, 0x99 },
+  { 0xD0, 0x4F, 0x58 },
+  { 0xD0, 0x4F, 0x7E },
+  { 0xD0, 0x55, 0x09 },
+  { 0xD0, 0x57, 0x4C },
+  { 0xD0, 0x58, 0xA5 },
+  { 0xD0, 0x58, 0xA8 },
+  { 0xD0, 0x59, 0x19 },
+  { 0xD0, 0x5B, 0xA8 },
+  { 0xD0, 0x60, 0x8C },
+  { 0xD0, 0x61, 0x58 },
+  { 0xD0, 0x65, 0x44 },
+  { 0xD0, 0x65, 0xCA },
+  { 0xD0, 0x6B, 0x78 },
+  { 0xD0, 0x6F, 0x82 },
+  { 0xD0, 0x71, 0xC4 },
+  { 0xD0, 0x72, 0xDC },
+  { 0xD0, 0x76, 0xE7 },
+  { 0xD0, 0x7A, 0xB5 },
+  { 0xD0, 0x81, 0x7A },
+  { 0xD0, 0x88, 0x0C },
+  { 0xD0, 0x92, 0x9E },
+  { 0xD0, 0x94, 0xCF },
+  { 0xD0, 0x9C, 0x7A },
+  { 0xD0, 0xA5, 0xA6 },
+  { 0xD0, 0xA6, 0x37 },
+  { 0xD0, 0xBB, 0x61 },
+  { 0xD0, 0xC0, 0x50 },
+  { 0xD0, 0xC2, 0x82 },
+  { 0xD0, 0xC5, 0xF3 },
+  { 0xD0, 0xC6, 0x5B },
+  { 0xD0, 0xC7, 0x30 },
+  { 0xD0, 0xC7, 0x89 },
+  { 0xD0, 0xC7, 0xC0 },
+  { 0xD0, 0xD0, 0x4B },
+  { 0xD0, 0xD0, 0xFD },
+  { 0xD0, 0xD2, 0x3C },
+  { 0xD0, 0xD2, 0xB0 },
+  { 0xD0, 0xD3, 0xE0 },
+  { 0xD0, 0xD7, 0x83 },
+  { 0xD0, 0xD7, 0xBE },
+  { 0xD0, 0xDA, 0xD7 },
+  { 0xD0, 0xDC, 0x2C },
+  { 0xD0, 0xDD, 0x7C },
+  { 0xD0, 0xE0, 0x42 },
+  { 0xD0, 0xE1, 0x40 },
+  { 0xD0, 0xEC, 0x35 },
+  { 0xD0, 0xEF, 0x76 },
+  { 0xD0, 0xEF, 0xC1 },
+  { 0xD0, 0xF9, 0x28 },
+  { 0xD0, 0xF9, 0x9B },
+  { 0xD0, 0xFF, 0x98 },
+  { 0xD4, 0x01, 0x6D },
+  { 0xD4, 0x01, 0xC3 },
+  { 0xD4, 0x0F, 0x9E },
+  { 0xD4, 0x17, 0x61 },
+  { 0xD4, 0x1A, 0xD1 },
+  { 0xD4, 0x20, 0xB0 },
+  { 0xD4, 0x24, 0xDD },
+  { 0xD4, 0x2C, 0x44 },
+  { 0xD4, 0x2C, 0x46 },
+  { 0xD4, 0x2F, 0xCA },
+  { 0xD4, 0x37, 0xD7 },
+  { 0xD4, 0x3A, 0x2C },
+  { 0xD4, 0x3D, 0xF3 },
+  { 0xD4, 0x40, 0xF0 },
+  { 0xD4, 0x46, 0x49 },
+  { 0xD4, 0x46, 0xE1 },
+  { 0xD4, 0x4F, 0x67 },
+  { 0xD4, 0x57, 0x63 },
+  { 0xD4, 0x5D, 0x64 },
+  { 0xD4, 0x5F, 0x7A },
+  { 0xD4, 0x61, 0x2E },
+  { 0xD4, 0x61, 0x9D },
+  { 0xD4, 0x61, 0xDA },
+  { 0xD4, 0x62, 0xEA },
+  { 0xD4, 0x66, 0x24 },
+  { 0xD4, 0x68, 0x4D },
+  { 0xD4, 0x68, 0xAA },
+  { 0xD4, 0x6A, 0x35 },
+  { 0xD4, 0x6A, 0xA8 },
+  { 0xD4, 0x6B, 0xA6 },
+  { 0xD4, 0x6D, 0x50 },
+  { 0xD4, 0x6E, 0x0E },
+  { 0xD4, 0x6E, 0x5C },
+  { 0xD4, 0x72, 0x26 },
+  { 0xD4, 0x76, 0xA0 },
+  { 0xD4, 0x76, 0xEA },
+  { 0xD4, 0x77, 0x98 },
+  { 0xD4, 0x78, 0x9B },
+  { 0xD4, 0x7F, 0x35 },
+  { 0xD4, 0x88, 0x66 },
+  { 0xD4, 0x8A, 0xFC },
+  { 0xD4, 0x8C, 0xB5 },
+  { 0xD4, 0x8F, 0x33 },
+  { 0xD4, 0x90, 0x9C },
+  { 0xD4, 0x91, 0x0F },
+  { 0xD4, 0x94, 0x00 },
+  { 0xD4, 0x94, 0xE8 },
+  { 0xD4, 0x97, 0x0B },
+  { 0xD4, 0x9A, 0x20 },
+  { 0xD4, 0x9E, 0x05 },
+  { 0xD4, 0xA0, 0x2A },
+  { 0xD4, 0xA1, 0x48 },
+  { 0xD4, 0xA3, 0x3D },
+  { 0xD4, 0xA9, 0x23 },
+  { 0xD4, 0xAD, 0x71 },
+  { 0xD4, 0xAD, 0xBD },
+  { 0xD4, 0xB1, 0x10 },
+  { 0xD4, 0xB7, 0x09 },
+  { 0xD4, 0xBD, 0x4F },
+  { 0xD4, 0xC1, 0x9E },
+  { 0xD4, 0xC1, 0xC8 },
+  { 0xD4, 0xC9, 0x3C },
+  { 0xD4, 0xCA, 0x6D },
+  { 0xD4, 0xD4, 0xDA },
+  { 0xD4, 0xD5, 0x1B },
+  { 0xD4, 0xD7, 0x48 },
+  { 0xD4, 0xD8, 0x92 },
+  { 0xD4, 0xDC, 0x09 },
+  { 0xD4, 0xDC, 0xCD },
+  { 0xD4, 0xE0, 0x53 },
+  { 0xD4, 0xE2, 0x2F },
+  { 0xD4, 0xE8, 0x80 },
+  { 0xD4, 0xEB, 0x68 },
+  { 0xD4, 0xF0, 0x57 },
+  { 0xD4, 0xF4, 0x6F },
+  { 0xD4, 0xF5, 0x47 },
+  { 0xD4, 0xF7, 0x56 },
+  { 0xD4, 0xF9, 0x8D },
+  { 0xD4, 0xF9, 0xA1 },
+  { 0xD4, 0xFB, 0x8E },
+  { 0xD8, 0x00, 0x4D },
+  { 0xD8, 0x07, 0xB6 },
+  { 0xD8, 0x09, 0x7F },
+  { 0xD8, 0x0A, 0x60 },
+  { 0xD8, 0x0A, 0xE6 },
+  { 0xD8, 0x0D, 0x17 },
+  { 0xD8, 0x10, 0x9F },
+  { 0xD8, 0x13, 0x2A },
+  { 0xD8, 0x15, 0x0D },
+  { 0xD8, 0x1B, 0xB5 },
+  { 0xD8, 0x1C, 0x79 },
+  { 0xD8, 0x1D, 0x72 },
+  { 0xD8, 0x24, 0xBD },
+  { 0xD8, 0x29, 0x18 },
+  { 0xD8, 0x29, 0xF8 },
+  { 0xD8, 0x30, 0x62 },
+  { 0xD8, 0x31, 0x2C },
+  { 0xD8, 0x31, 0x34 },
+  { 0xD8, 0x32, 0xE3 },
+  { 0xD8, 0x38, 0xFC },
+  { 0xD8, 0x3A, 0xDD },
+  { 0xD8, 0x40, 0x08 },
+  { 0xD8, 0x44, 0x89 },
+  { 0xD8, 0x47, 0x32 },
+  { 0xD8, 0x49, 0x0B },
+  { 0xD8, 0x4A, 0x2B },
+  { 0xD8, 0x4C, 0x90 },
+  { 0xD8, 0x50, 0xE6 },
+  { 0xD8, 0x55, 0xA3 },
+  { 0xD8, 0x59, 0x82 },
+  { 0xD8, 0x5D, 0x4C },
+  { 0xD8, 0x63, 0x75 },
+  { 0xD8, 0x67, 0xD9 },
+  { 0xD8, 0x68, 0x52 },
+  { 0xD8, 0x6B, 0xF7 },
+  { 0xD8, 0x6B, 0xFC },
+  { 0xD8, 0x6C, 0x63 },
+  { 0xD8, 0x6D, 0x17 },
+  { 0xD8, 0x74, 0x95 },
+  { 0xD8, 0x76, 0xAE },
+  { 0xD8, 0x88, 0x63 },
+  { 0xD8, 0x8C, 0x73 },
+  { 0xD8, 0x8C, 0x79 },
+  { 0xD8, 0x8F, 0x76 },
+  { 0xD8, 0x91, 0x2A },
+  { 0xD8, 0x96, 0x95 },
+  { 0xD8, 0x9B, 0x3B },
+  { 0xD8, 0x9E, 0x3F },
+  { 0xD8, 0xA0, 0x1D },
+  { 0xD8, 0xA0, 0xE8 },
+  { 0xD8, 0xA2, 0x5E },
+  { 0xD8, 0xA8, 0xC8 },
+  { 0xD8, 0xB0, 0x53 },
+  { 0xD8, 0xB1, 0x90 },
+  { 0xD8, 0xB3, 0x70 },
+  { 0xD8, 0xBB, 0x2C },
+  { 0xD8, 0xBC, 0x38 },
+  { 0xD8, 0xBE, 0x1F },
+  { 0xD8, 0xBE, 0x65 },
+  { 0xD8, 0xBF, 0xC0 },
+  { 0xD8, 0xC7, 0x71 },
+  { 0xD8, 0xC7, 0xC8 },
+  { 0xD8, 0xCE, 0x3A },
+  { 0xD8, 0xCF, 0x9C },
+  { 0xD8, 0xD1, 0xCB },
+  { 0xD8, 0xDA, 0xF1 },
+  { 0xD8, 0xDC, 0x40 },
+  { 0xD8, 0xDE, 0x3A },
+  { 0xD8, 0xE2, 0xDF },
+  { 0xD8, 0xE5, 0x93 },
+  { 0xD8, 0xE8, 0x44 },
+  { 0xD8, 0xEB, 0x46 },
+  { 0xD8, 0xEC, 0x5E },
+  { 0xD8, 0xEC, 0xE5 },
+  { 0xD8, 0xF1, 0x5B },
+  { 0xD8, 0xFB, 0xD6 },
+  { 0xD8, 0xFE, 0xE3 },
+  { 0xDC, 0x00, 0x77 },
+  { 0xDC, 0x02, 0x8E },
+  { 0xDC, 0x05, 0x39 },
+  { 0xDC, 0x08, 0x0F },
+  { 0xDC, 0x09, 0x4C },
+  { 0xDC, 0x0B, 0x09 },
+  { 0xDC, 0x0C, 0x5C },
+  { 0xDC, 0x10, 0x57 },
+  { 0xDC, 0x15, 0xC8 },
+  { 0xDC, 0x16, 0xB2 },
+  { 0xDC, 0x21, 0xE2 },
+  { 0xDC, 0x2B, 0x2A },
+  { 0xDC, 0x2B, 0x61 },
+  { 0xDC, 0x2C, 0x6E },
+  { 0xDC, 0x36, 0x42 },
+  { 0xDC, 0x37, 0x14 },
+  { 0xDC, 0x39, 0x6F },
+  { 0xDC, 0x39, 0x79 },
+  { 0xDC, 0x3A, 0x5E },
+  { 0xDC, 0x41, 0x5F },
+  { 0xDC, 0x45, 0xB8 },
+  { 0xDC, 0x4F, 0x22 },
+  { 0xDC, 0x51, 0x93 },
+  { 0xDC, 0x52, 0x85 },
+  { 0xDC, 0x53, 0x92 },
+  { 0xDC, 0x54, 0x75 },
+  { 0xDC, 0x54, 0xD7 },
+  { 0xDC, 0x56, 0xE7 },
+  { 0xDC, 0x61, 0x80 },
+  { 0xDC, 0x62, 0x1F },
+  { 0xDC, 0x68, 0x80 },
+  { 0xDC, 0x68, 0xEB },
+  { 0xDC, 0x6A, 0xE7 },
+  { 0xDC, 0x6D, 0xBC },
+  { 0xDC, 0x71, 0x37 },
+  { 0xDC, 0x71, 0xD0 },
+  { 0xDC, 0x72, 0x9B },
+  { 0xDC, 0x77, 0x4C },
+  { 0xDC, 0x7B, 0x94 },
+  { 0xDC, 0x80, 0x84 },
+  { 0xDC, 0x86, 0xD8 },
+  { 0xDC, 0x8C, 0x37 },
+  { 0xDC, 0x90, 0x88 },
+  { 0xDC, 0x91, 0xBF },
+  { 0xDC, 0x98, 0x40 },
+  { 0xDC, 0x99, 0x14 },
+  { 0xDC, 0x9B, 0x9C },
+  { 0xDC, 0x9F, 0xDB },
+  { 0xDC, 0xA0, 0xD0 },
+  { 0xDC, 0xA4, 0xCA },
+  { 0xDC, 0xA5, 0xF4 },
+  { 0xDC, 0xA6, 0x32 },
+  { 0xDC, 0xA7, 0x82 },
+  { 0xDC, 0xA9, 0x04 },
+  { 0xDC, 0xAE, 0xEB },
+  { 0xDC, 0xB5, 0x4F },
+  { 0xDC, 0xB7, 0x2E },
+  { 0xDC, 0xB7, 0xAC },
+  { 0xDC, 0xC6, 0x4B },
+  { 0xDC, 0xCD, 0x18 },
+  { 0xDC, 0xCE, 0xC1 },
+  { 0xDC, 0xD2, 0xFC },
+  { 0xDC, 0xD2, 0xFD },
+  { 0xDC, 0xD3, 0xA2 },
+  { 0xDC, 0xD9, 0x16 },
+  { 0xDC, 0xDA, 0x0C },
+  { 0xDC, 0xDF, 0xD6 },
+  { 0xDC, 0xE5, 0x5B },
+  { 0xDC, 0xE5, 0xD8 },
+  { 0xDC, 0xEA, 0xE7 },
+  { 0xDC, 0xEB, 0x94 },
+  { 0xDC, 0xEE, 0x06 },
+  { 0xDC, 0xEF, 0x09 },
+  { 0xDC, 0xEF, 0x80 },
+  { 0xDC, 0xF4, 0xCA },
+  { 0xDC, 0xF7, 0x19 },
+  { 0xDC, 0xF8, 0xB9 },
+  { 0xDC, 0xFB, 0x02 },
+  { 0xDC, 0xFE, 0x18 },
+  { 0xE0, 0x00, 0x84 },
+  { 0xE0, 0x05, 0xC5 },
+  { 0xE0, 0x06, 0x30 },
+  { 0xE0, 0x08, 0x55 },
+  { 0xE0, 0x0C, 0x7F },
+  { 0xE0, 0x0C, 0xE5 },
+  { 0xE0, 0x0E, 0xDA },
+  { 0xE0, 0x10, 0x7F },
+  { 0xE0, 0x19, 0x1D },
+  { 0xE0, 0x19, 0x54 },
+  { 0xE0, 0x1C, 0xFC },
+  { 0xE0, 0x1F, 0x88 },
+  { 0xE0, 0x23, 0xFF },
+  { 0xE0, 0x24, 0x7F },
+  { 0xE0, 0x24, 0x81 },
+  { 0xE0, 0x28, 0x61 },
+  { 0xE0, 0x28, 0x6D },
+  { 0xE0, 0x2B, 0x96 },
+  { 0xE0, 0x2F, 0x6D },
+  { 0xE0, 0x33, 0x8E },
+  { 0xE0, 0x36, 0x76 },
+  { 0xE0, 0x38, 0x3F },
+  { 0xE0, 0x3F, 0x49 },
+  { 0xE0, 0x41, 0x02 },
+  { 0xE0, 0x46, 0x9A },
+  { 0xE0, 0x46, 0xEE },
+  { 0xE0, 0x4B, 0xA6 },
+  { 0xE0, 0x55, 0x3D },
+  { 0xE0, 0x5A, 0x1B },
+  { 0xE0, 0x5F, 0x45 },
+  { 0xE0, 0x5F, 0xB9 },
+  { 0xE0, 0x62, 0x67 },
+  { 0xE0, 0x63, 0xDA },
+  { 0xE0, 0x66, 0x78 },
+  { 0xE0, 0x69, 0xBA },
+  { 0xE0, 0x6D, 0x17 },
+  { 0xE0, 0x7C, 0x13 },
+  { 0xE0, 0x80, 0x6B },
+  { 0xE0, 0x89, 0x7E },
+  { 0xE0, 0x89, 0x9D },
+  { 0xE0, 0x91, 0xF5 },
+  { 0xE0, 0x92, 0x5C },
+  { 0xE0, 0x97, 0x96 },
+  { 0xE0, 0x98, 0x06 },
+  { 0xE0, 0xA1, 0xCE },
+  { 0xE0, 0xA3, 0xAC },
+  { 0xE0, 0xAC, 0xCB },
+  { 0xE0, 0xAC, 0xF1 },
+  { 0xE0, 0xAE, 0xA2 },
+  { 0xE0, 0xB5, 0x2D },
+  { 0xE0, 0xB5, 0x5F },
+  { 0xE0, 0xB6, 0x68 },
+  { 0xE0, 0xB9, 0xBA },
+  { 0xE0, 0xBD, 0xA0 },
+  { 0xE0, 0xC3, 0xF3 },
+  { 0xE0, 0xC7, 0x67 },
+  { 0xE0, 0xC9, 0x7A },
+  { 0xE0, 0xCB, 0x1D },
+  { 0xE0, 0xCB, 0x4E },
+  { 0xE0, 0xCB, 0xBC },
+  { 0xE0, 0xCC, 0x7A },
+  { 0xE0, 0xCC, 0xF8 },
+  { 0xE0, 0xD1, 0x73 },
+  { 0xE0, 0xD3, 0xB4 },
+  { 0xE0, 0xDA, 0x90 },
+  { 0xE0, 0xDA, 0xD7 },
+  { 0xE0, 0xDC, 0xFF },
+  { 0xE0, 0xE2, 0xE6 },
+  { 0xE0, 0xE7, 0x51 },
+  { 0xE0, 0xEB, 0x40 },
+  { 0xE0, 0xF5, 0xC6 },
+  { 0xE0, 0xF6, 0xB5 },
+  { 0xE0, 0xF7, 0x28 },
+  { 0xE0, 0xF8, 0x47 },
+  { 0xE4, 0x0A, 0x16 },
+  { 0xE4, 0x0E, 0xEE },
+  { 0xE4, 0x18, 0x6B },
+  { 0xE4, 0x19, 0xC1 },
+  { 0xE4, 0x1F, 0x7B },
+  { 0xE4, 0x25, 0xE7 },
+  { 0xE4, 0x2A, 0xAC },
+  { 0xE4, 0x2B, 0x34 },
+  { 0xE4, 0x34, 0x93 },
+  { 0xE4, 0x35, 0xC8 },
+  { 0xE4, 0x37, 0x9F },
+  { 0xE4, 0x38, 0x7E },
+  { 0xE4, 0x38, 0x83 },
+  { 0xE4, 0x3E, 0xC6 },
+  { 0xE4, 0x46, 0xDA },
+  { 0xE4, 0x47, 0xB3 },
+  { 0xE4, 0x48, 0xC7 },
+  { 0xE4, 0x4E, 0x2D },
+  { 0xE4, 0x50, 0xEB },
+  { 0xE4, 0x55, 0xA8 },
+  { 0xE4, 0x5E, 0x1B },
+  { 0xE4, 0x5F, 0x01 },
+  { 0xE4, 0x60, 0x4D },
+  { 0xE4, 0x62, 0xC4 },
+  { 0xE4, 0x65, 0xB8 },
+  { 0xE4, 0x66, 0xAB },
+  { 0xE4, 0x68, 0xA3 },
+  { 0xE4, 0x6F, 0x13 },
+  { 0xE4, 0x72, 0xE2 },
+  { 0xE4, 0x76, 0x84 },
+  { 0xE4, 0x77, 0x23 },
+  { 0xE4, 0x77, 0x27 },
+  { 0xE4, 0x7E, 0x66 },
+  { 0xE4, 0x7E, 0x9A },
+  { 0xE4, 0x82, 0x10 },
+  { 0xE4, 0x83, 0x26 },
+  { 0xE4, 0x84, 0xD3 },
+  { 0xE4, 0x8B, 0x7F },
+  { 0xE4, 0x8D, 0x8C },
+  { 0xE4, 0x90, 0x2A },
+  { 0xE4, 0x90, 0xFD },
+  { 0xE4, 0x98, 0xD6 },
+  { 0xE4, 0x9A, 0x79 },
+  { 0xE4, 0x9A, 0xDC },
+  { 0xE4, 0x9C, 0x67 },
+  { 0xE4, 0xA4, 0x1C },
+  { 0xE4, 0xA7, 0xC5 },
+  { 0xE4, 0xA7, 0xD0 },
+  { 0xE4, 0xA8, 0xB6 },
+  { 0xE4, 0xAA, 0x5D },
+  { 0xE4, 0xAA, 0xE4 },
+  { 0xE4, 0xB2, 0x24 },
+  { 0xE4, 0xB2, 0xFB },
+  { 0xE4, 0xBC, 0xAA },
+  { 0xE4, 0xBD, 0x4B },
+  { 0xE4, 0xBE, 0xFB },
+  { 0xE4, 0xC2, 0xD1 },
+  { 0xE4, 0xC3, 0x2A },
+  { 0xE4, 0xC6, 0x3D },
+  { 0xE4, 0xC7, 0x22 },
+  { 0xE4, 0xCA, 0x12 },
+  { 0xE4, 0xCE, 0x8F },
+  { 0xE4, 0xD3, 0x32 },
+  { 0xE4, 0xD3, 0x73 },
+  { 0xE4, 0xD3, 0xF1 },
+  { 0xE4, 0xDC, 0xCC },
+  { 0xE4, 0xDE, 0x40 },
+  { 0xE4, 0xE0, 0xA6 },
+  { 0xE4, 0xE4, 0xAB },
+  { 0xE4, 0xF0, 0x42 },
+  { 0xE4, 0xF4, 0xC6 },
+  { 0xE4, 0xFA, 0xC4 },
+  { 0xE4, 0xFB, 0x5D },
+  { 0xE4, 0xFD, 0xA1 },
+  { 0xE8, 0x04, 0x0B },
+  { 0xE8, 0x04, 0x62 },
+  { 0xE8, 0x06, 0x88 },
+  { 0xE8, 0x08, 0x8B },
+  { 0xE8, 0x0A, 0xB9 },
+  { 0xE8, 0x10, 0x98 },
+  { 0xE8, 0x13, 0x6E },
+  { 0xE8, 0x1C, 0xBA },
+  { 0xE8, 0x1C, 0xD8 },
+  { 0xE8, 0x1D, 0xA8 },
+  { 0xE8, 0x26, 0x89 },
+  { 0xE8, 0x31, 0xCD },
+  { 0xE8, 0x36, 0x17 },
+  { 0xE8, 0x37, 0x7A },
+  { 0xE8, 0x40, 0x40 },
+  { 0xE8, 0x43, 0x68 },
+  { 0xE8, 0x48, 0xB8 },
+  { 0xE8, 0x4C, 0x4A },
+  { 0xE8, 0x4D, 0x74 },
+  { 0xE8, 0x4D, 0xD0 },
+  { 0xE8, 0x4E, 0xCE },
+  { 0xE8, 0x5A, 0x8B },
+  { 0xE8, 0x5C, 0x0A },
+  { 0xE8, 0x5F, 0x02 },
+  { 0xE8, 0x65, 0x49 },
+  { 0xE8, 0x68, 0x19 },
+  { 0xE8, 0x68, 0xE7 },
+  { 0xE8, 0x6B, 0xEA },
+  { 0xE8, 0x6D, 0xE9 },
+  { 0xE8, 0x6E, 0x44 },
+  { 0xE8, 0x78, 0x65 },
+  { 0xE8, 0x7F, 0x95 },
+  { 0xE8, 0x80, 0x2E },
+  { 0xE8, 0x81, 0x52 },
+  { 0xE8, 0x81, 0x75 },
+  { 0xE8, 0x84, 0xC6 },
+  { 0xE8, 0x85, 0x4B },
+  { 0xE8, 0x88, 0x43 },
+  { 0xE8, 0x8D, 0x28 },
+  { 0xE8, 0x94, 0xF6 },
+  { 0xE8, 0x98, 0x47 },
+  { 0xE8, 0x9C, 0x25 },
+  { 0xE8, 0x9F, 0x6D },
+  { 0xE8, 0x9F, 0x80 },
+  { 0xE8, 0xA0, 0xCD },
+  { 0xE8, 0xA1, 0xF8 },
+  { 0xE8, 0xA3, 0x4E },
+  { 0xE8, 0xA6, 0x60 },
+  { 0xE8, 0xA7, 0x2F },
+  { 0xE8, 0xA7, 0x30 },
+  { 0xE8, 0xAB, 0xF3 },
+  { 0xE8, 0xAC, 0x23 },
+  { 0xE8, 0xAC, 0xAD },
+  { 0xE8, 0xB2, 0xAC },
+  { 0xE8, 0xB5, 0x41 },
+  { 0xE8, 0xB7, 0x48 },
+  { 0xE8, 0xBA, 0x70 },
+  { 0xE8, 0xBD, 0xD1 },
+  { 0xE8, 0xCC, 0x18 },
+  { 0xE8, 0xCD, 0x2D },
+  { 0xE8, 0xD3, 0x22 },
+  { 0xE8, 0xD5, 0x2B },
+  { 0xE8, 0xD7, 0x65 },
+  { 0xE8, 0xD7, 0x75 },
+  { 0xE8, 0xD8, 0x7E },
+  { 0xE8, 0xDA, 0x20 },
+  { 0xE8, 0xDB, 0x84 },
+  { 0xE8, 0xDC, 0x6C },
+  { 0xE8, 0xDE, 0x27 },
+  { 0xE8, 0xDF, 0x70 },
+  { 0xE8, 0xEA, 0x4D },
+  { 0xE8, 0xEB, 0x34 },
+  { 0xE8, 0xED, 0xD6 },
+  { 0xE8, 0xED, 0xF3 },
+  { 0xE8, 0xF0, 0x85 },
+  { 0xE8, 0xF6, 0x54 },
+  { 0xE8, 0xF7, 0x2F },
+  { 0xE8, 0xF7, 0x91 },
+  { 0xE8, 0xF9, 0xD4 },
+  { 0xE8, 0xFB, 0xE9 },
+  { 0xE8, 0xFC, 0xAF },
+  { 0xEC, 0x01, 0xD5 },
+  { 0xEC, 0x02, 0x73 },
+  { 0xEC, 0x08, 0x6B },
+  { 0xEC, 0x0D, 0x51 },
+  { 0xEC, 0x0D, 0xE4 },
+  { 0xEC, 0x17, 0x2F },
+  { 0xEC, 0x19, 0x2E },
+  { 0xEC, 0x1A, 0x02 },
+  { 0xEC, 0x1A, 0x59 },
+  { 0xEC, 0x1D, 0x7F },
+  { 0xEC, 0x1D, 0x8B },
+  { 0xEC, 0x22, 0x80 },
+  { 0xEC, 0x23, 0x3D },
+  { 0xEC, 0x23, 0x7B },
+  { 0xEC, 0x26, 0x51 },
+  { 0xEC, 0x26, 0xCA },
+  { 0xEC, 0x28, 0xD3 },
+  { 0xEC, 0x2B, 0xEB },
+  { 0xEC, 0x2C, 0x73 },
+  { 0xEC, 0x2C, 0xE2 },
+  { 0xEC, 0x30, 0x91 },
+  { 0xEC, 0x30, 0xB3 },
+  { 0xEC, 0x35, 0x86 },
+  { 0xEC, 0x38, 0x8F },
+  { 0xEC, 0x3E, 0xB3 },
+  { 0xEC, 0x42, 0xCC },
+  { 0xEC, 0x43, 0xF6 },
+  { 0xEC, 0x44, 0x76 },
+  { 0xEC, 0x4D, 0x47 },
+  { 0xEC, 0x50, 0xAA },
+  { 0xEC, 0x55, 0x1C },
+  { 0xEC, 0x56, 0x23 },
+  { 0xEC, 0x58, 0xEA },
+  { 0xEC, 0x59, 0xE7 },
+  { 0xEC, 0x60, 0x73 },
+  { 0xEC, 0x62, 0x60 },
+  { 0xEC, 0x64, 0xC9 },
+  { 0xEC, 0x67, 0x94 },
+  { 0xEC, 0x6C, 0xB5 },
+  { 0xEC, 0x73, 0x79 },
+  { 0xEC, 0x75, 0x3E },
+  { 0xEC, 0x7C, 0x2C },
+  { 0xEC, 0x81, 0x50 },
+  { 0xEC, 0x81, 0x9C },
+  { 0xEC, 0x82, 0x63 },
+  { 0xEC, 0x83, 0x50 },
+  { 0xEC, 0x85, 0x2F },
+  { 0xEC, 0x88, 0x8F },
+  { 0xEC, 0x89, 0x14 },
+  { 0xEC, 0x8A, 0x4C },
+  { 0xEC, 0x8A, 0xC4 },
+  { 0xEC, 0x8C, 0x9A },
+  { 0xEC, 0x8C, 0xA2 },
+  { 0xEC, 0x94, 0xCB },
+  { 0xEC, 0xA1, 0x38 },
+  { 0xEC, 0xA1, 0xD1 },
+  { 0xEC, 0xA6, 0x2F },
+  { 0xEC, 0xA9, 0x07 },
+  { 0xEC, 0xAA, 0x8F },
+  { 0xEC, 0xAD, 0xB8 },
+  { 0xEC, 0xAD, 0xE0 },
+  { 0xEC, 0xBD, 0x1D },
+  { 0xEC, 0xC0, 0x18 },
+  { 0xEC, 0xC0, 0x1B },
+  { 0xEC, 0xC3, 0x42 },
+  { 0xEC, 0xC3, 0xB0 },
+  { 0xEC, 0xC4, 0x0D },
+  { 0xEC, 0xC8, 0x82 },
+  { 0xEC, 0xCB, 0x30 },
+  { 0xEC, 0xCE, 0x13 },
+  { 0xEC, 0xCE, 0xD7 },
+  { 0xEC, 0xD0, 0x9F },
+  { 0xEC, 0xDA, 0x3B },
+  { 0xEC, 0xE1, 0xA9 },
+  { 0xEC, 0xF0, 0xFE },
+  { 0xEC, 0xF4, 0x0C },
+  { 0xEC, 0xF8, 0xD0 },
+  { 0xEC, 0xFA, 0xBC },
+  { 0xEC, 0xFC, 0xC6 },
+  { 0xF0, 0x08, 0xD1 },
+  { 0xF0, 0x0F, 0xEC },
+  { 0xF0, 0x18, 0x98 },
+  { 0xF0, 0x1A, 0xA0 },
+  { 0xF0, 0x1B, 0x24 },
+  { 0xF0, 0x1D, 0x2D },
+  { 0xF0, 0x1D, 0xBC },
+  { 0xF0, 0x1F, 0xC7 },
+  { 0xF0, 0x24, 0x75 },
+  { 0xF0, 0x25, 0x72 },
+  { 0xF0, 0x25, 0x8E },
+  { 0xF0, 0x27, 0x2D },
+  { 0xF0, 0x29, 0x29 },
+  { 0xF0, 0x2F, 0x4B },
+  { 0xF0, 0x2F, 0x74 },
+  { 0xF0, 0x2F, 0x9E },
+  { 0xF0, 0x2F, 0xA7 },
+  { 0xF0, 0x33, 0xE5 },
+  { 0xF0, 0x3E, 0x90 },
+  { 0xF0, 0x3F, 0x95 },
+  { 0xF0, 0x43, 0x47 },
+  { 0xF0, 0x4A, 0x02 },
+  { 0xF0, 0x4F, 0x7C },
+  { 0xF0, 0x5C, 0x19 },
+  { 0xF0, 0x5C, 0x77 },
+  { 0xF0, 0x5C, 0xD5 },
+  { 0xF0, 0x61, 0xC0 },
+  { 0xF0, 0x63, 0xF9 },
+  { 0xF0, 0x6C, 0x5D },
+  { 0xF0, 0x6E, 0x0B },
+  { 0xF0, 0x72, 0xEA },
+  { 0xF0, 0x76, 0x6F },
+  { 0xF0, 0x78, 0x07 },
+  { 0xF0, 0x78, 0x16 },
+  { 0xF0, 0x79, 0x59 },
+  { 0xF0, 0x79, 0x60 },
+  { 0xF0, 0x7D, 0x68 },
+  { 0xF0, 0x7F, 0x06 },
+  { 0xF0, 0x81, 0x73 },
+  { 0xF0, 0x84, 0xC9 },
+  { 0xF0, 0x87, 0x56 },
+  { 0xF0, 0x98, 0x38 },
+  { 0xF0, 0x98, 0x9D },
+  { 0xF0, 0x99, 0xB6 },
+  { 0xF0, 0x99, 0xBF },
+  { 0xF0, 0x9B, 0xB8 },
+  { 0xF0, 0x9E, 0x63 },
+  { 0xF0, 0x9F, 0xC2 },
+  { 0xF0, 0xA0, 0xB1 },
+  { 0xF0, 0xA2, 0x25 },
+  { 0xF0, 0xA3, 0x5A },
+  { 0xF0, 0xA7, 0x31 },
+  { 0xF0, 0xA9, 0x51 },
+  { 0xF0, 0xAB, 0x1F },
+  { 0xF0, 0xB0, 0x14 },
+  { 0xF0, 0xB0, 0x52 },
+  { 0xF0, 0xB0, 0xE7 },
+  { 0xF0, 0xB2, 0xE5 },
+  { 0xF0, 0xB3, 0xEC },
+  { 0xF0, 0xB4, 0x29 },
+  { 0xF0, 0xB4, 0x79 },
+  { 0xF0, 0xB4, 0xD2 },
+  { 0xF0, 0xC1, 0xF1 },
+  { 0xF0, 0xC3, 0x71 },
+  { 0xF0, 0xC4, 0x78 },
+  { 0xF0, 0xC7, 0x25 },
+  { 0xF0, 0xC8, 0x50 },
+  { 0xF0, 0xC8, 0xB5 },
+  { 0xF0, 0xCB, 0xA1 },
+  { 0xF0, 0xD1, 0xA9 },
+  { 0xF0, 0xD2, 0xF1 },
+  { 0xF0, 0xD3, 0x1F },
+  { 0xF0, 0xD7, 0x93 },
+  { 0xF0, 0xD8, 0x05 },
+  { 0xF0, 0xDB, 0xE2 },
+  { 0xF0, 0xDB, 0xF8 },
+  { 0xF0, 0xDC, 0xE2 },
+  { 0xF0, 0xE4, 0xA2 },
+  { 0xF0, 0xED, 0x19 },
+  { 0xF0, 0xEE, 0x7A },
+  { 0xF0, 0xEF, 0x86 },
+  { 0xF0, 0xF0, 0xA4 },
+  { 0xF0, 0xF3, 0x36 },
+  { 0xF0, 0xF5, 0xBD },
+  { 0xF0, 0xF6, 0x1C },
+  { 0xF0, 0xF6, 0xC1 },
+  { 0xF0, 0xF7, 0x55 },
+  { 0xF0, 0xF7, 0xE7 },
+  { 0xF0, 0xF7, 0xFC },
+  { 0xF0, 0xF8, 0x4A },
+  { 0xF4, 0x03, 0x04 },
+  { 0xF4, 0x03, 0x2A },
+  { 0xF4, 0x06, 0x16 },
+  { 0xF4, 0x0E, 0x01 },
+  { 0xF4, 0x0F, 0x1B },
+  { 0xF4, 0x0F, 0x24 },
+  { 0xF4, 0x12, 0xDA },
+  { 0xF4, 0x12, 0xFA },
+  { 0xF4, 0x1A, 0x9C },
+  { 0xF4, 0x1B, 0xA1 },
+  { 0xF4, 0x1D, 0x6B },
+  { 0xF4, 0x1F, 0x88 },
+  { 0xF4, 0x1F, 0xC2 },
+  { 0xF4, 0x21, 0xCA },
+  { 0xF4, 0x2A, 0x7D },
+  { 0xF4, 0x2D, 0x06 },
+  { 0xF4, 0x2E, 0x48 },
+  { 0xF4, 0x2E, 0x7F },
+  { 0xF4, 0x30, 0x8B },
+  { 0xF4, 0x31, 0xC3 },
+  { 0xF4, 0x34, 0xF0 },
+  { 0xF4, 0x37, 0xB7 },
+  { 0xF4, 0x39, 0xA6 },
+  { 0xF4, 0x3A, 0x7B },
+  { 0xF4, 0x45, 0x88 },
+  { 0xF4, 0x4B, 0x2A },
+  { 0xF4, 0x4C, 0x7F },
+  { 0xF4, 0x4D, 0x5C },
+  { 0xF4, 0x4E, 0x05 },
+  { 0xF4, 0x55, 0x9C },
+  { 0xF4, 0x5C, 0x89 },
+  { 0xF4, 0x5F, 0xD4 },
+  { 0xF4, 0x60, 0xE2 },
+  { 0xF4, 0x63, 0x1F },
+  { 0xF4, 0x65, 0xA6 },
+  { 0xF4, 0x6A, 0xD7 },
+  { 0xF4, 0x6D, 0x04 },
+  { 0xF4, 0x6D, 0x2F },
+  { 0xF4, 0x6D, 0xE2 },
+  { 0xF4, 0x79, 0x46 },
+  { 0xF4, 0x79, 0x60 },
+  { 0xF4, 0x7F, 0x35 },
+  { 0xF4, 0x83, 0xCD },
+  { 0xF4, 0x84, 0x8D },
+  { 0xF4, 0x8B, 0x32 },
+  { 0xF4, 0x8C, 0xEB },
+  { 0xF4, 0x8E, 0x92 },
+  { 0xF4, 0x92, 0xBF },
+  { 0xF4, 0x9F, 0xF3 },
+  { 0xF4, 0xA4, 0xD6 },
+  { 0xF4, 0xAC, 0xC1 },
+  { 0xF4, 0xAF, 0xE7 },
+  { 0xF4, 0xB5, 0xAA },
+  { 0xF4, 0xB7, 0x8D },
+  { 0xF4, 0xB8, 0xA7 },
+  { 0xF4, 0xBD, 0x9E },
+  { 0xF4, 0xBE, 0xEC },
+  { 0xF4, 0xBF, 0x80 },
+  { 0xF4, 0xC7, 0x14 },
+  { 0xF4, 0xCB, 0x52 },
+  { 0xF4, 0xCF, 0xA2 },
+  { 0xF4, 0xCF, 0xE2 },
+  { 0xF4, 0xD4, 0x88 },
+  { 0xF4, 0xDB, 0xE3 },
+  { 0xF4, 0xDB, 0xE6 },
+  { 0xF4, 0xDC, 0xF9 },
+  { 0xF4, 0xDE, 0xAF },
+  { 0xF4, 0xE2, 0xC6 },
+  { 0xF4, 0xE3, 0xFB },
+  { 0xF4, 0xE4, 0x51 },
+  { 0xF4, 0xE4, 0xAD },
+  { 0xF4, 0xE5, 0xF2 },
+  { 0xF4, 0xE8, 0x4F },
+  { 0xF4, 0xE8, 0xC7 },
+  { 0xF4, 0xEA, 0x67 },
+  { 0xF4, 0xEC, 0x38 },
+  { 0xF4, 0xEE, 0x31 },
+  { 0xF4, 0xF1, 0x5A },
+  { 0xF4, 0xF2, 0x6D },
+  { 0xF4, 0xF2, 0x8A },
+  { 0xF4, 0xF5, 0xD8 },
+  { 0xF4, 0xF5, 0xDB },
+  { 0xF4, 0xF5, 0xE8 },
+  { 0xF4, 0xF6, 0x47 },
+  { 0xF4, 0xF9, 0x51 },
+  { 0xF4, 0xFB, 0xB8 },
+  { 0xF4, 0xFE, 0x3E },
+  { 0xF8, 0x00, 0xA1 },
+  { 0xF8, 0x01, 0x13 },
+  { 0xF8, 0x03, 0x77 },
+  { 0xF8, 0x0B, 0xCB },
+  { 0xF8, 0x0D, 0xA9 },
+  { 0xF8, 0x0D, 0xF0 },
+  { 0xF8, 0x0F, 0x6F },
+  { 0xF8, 0x0F, 0xF9 },
+  { 0xF8, 0x10, 0x93 },
+  { 0xF8, 0x1A, 0x2B },
+  { 0xF8, 0x1A, 0x67 },
+  { 0xF8, 0x1E, 0xDF },
+  { 0xF8, 0x23, 0xB2 },
+  { 0xF8, 0x27, 0x93 },
+  { 0xF8, 0x28, 0xC9 },
+  { 0xF8, 0x2D, 0x7C },
+  { 0xF8, 0x2E, 0x3F },
+  { 0xF8, 0x32, 0xE4 },
+  { 0xF8, 0x38, 0x80 },
+  { 0xF8, 0x39, 0x18 },
+  { 0xF8, 0x3D, 0xFF },
+  { 0xF8, 0x3E, 0x95 },
+  { 0xF8, 0x42, 0x88 },
+  { 0xF8, 0x4A, 0xBF },
+  { 0xF8, 0x4C, 0xDA },
+  { 0xF8, 0x4D, 0x89 },
+  { 0xF8, 0x4E, 0x73 },
+  { 0xF8, 0x4F, 0x57 },
+  { 0xF8, 0x53, 0x29 },
+  { 0xF8, 0x54, 0xB8 },
+  { 0xF8, 0x56, 0xC3 },
+  { 0xF8, 0x60, 0xF0 },
+  { 0xF8, 0x62, 0x14 },
+  { 0xF8, 0x64, 0xB8 },
+  { 0xF8, 0x66, 0x5A },
+  { 0xF8, 0x66, 0xF2 },
+  { 0xF8, 0x6B, 0xD9 },
+  { 0xF8, 0x6E, 0xEE },
+  { 0xF8, 0x6F, 0xB0 },
+  { 0xF8, 0x6F, 0xC1 },
+  { 0xF8, 0x71, 0x0C },
+  { 0xF8, 0x71, 0xA6 },
+  { 0xF8, 0x72, 0xEA },
+  { 0xF8, 0x73, 0x94 },
+  { 0xF8, 0x75, 0x88 },
+  { 0xF8, 0x79, 0x28 },
+  { 0xF8, 0x7A, 0x41 },
+  { 0xF8, 0x7B, 0x20 },
+  { 0xF8, 0x7D, 0x76 },
+  { 0xF8, 0x87, 0xF1 },
+  { 0xF8, 0x8C, 0x21 },
+  { 0xF8, 0x8F, 0xCA },
+  { 0xF8, 0x95, 0x22 },
+  { 0xF8, 0x95, 0xEA },
+  { 0xF8, 0x98, 0xB9 },
+  { 0xF8, 0x98, 0xEF },
+  { 0xF8, 0x9A, 0x25 },
+  { 0xF8, 0x9A, 0x78 },
+  { 0xF8, 0x9E, 0x28 },
+  { 0xF8, 0xA3, 0x4F },
+  { 0xF8, 0xA4, 0x5F },
+  { 0xF8, 0xA5, 0xC5 },
+  { 0xF8, 0xA7, 0x3A },
+  { 0xF8, 0xAB, 0x82 },
+  { 0xF8, 0xB1, 0x32 },
+  { 0xF8, 0xB1, 0xDD },
+  { 0xF8, 0xB7, 0xE2 },
+  { 0xF8, 0xBF, 0x09 },
+  { 0xF8, 0xC2, 0x88 },
+  { 0xF8, 0xC3, 0x9E },
+  { 0xF8, 0xC3, 0xCC },
+  { 0xF8, 0xC6, 0x50 },
+  { 0xF8, 0xD1, 0x11 },
+  { 0xF8, 0xDE, 0x73 },
+  { 0xF8, 0xDF, 0xA8 },
+  { 0xF8, 0xE5, 0x7E },
+  { 0xF8, 0xE5, 0xCE },
+  { 0xF8, 0xE7, 0x1E },
+  { 0xF8, 0xE8, 0x11 },
+  { 0xF8, 0xE9, 0x03 },
+  { 0xF8, 0xE9, 0x4E },
+  { 0xF8, 0xE9, 0x4F },
+  { 0xF8, 0xF7, 0xB9 },
+  { 0xF8, 0xFC, 0xE1 },
+  { 0xF8, 0xFF, 0xC2 },
+  { 0xFC, 0x02, 0x96 },
+  { 0xFC, 0x11, 0x93 },
+  { 0xFC, 0x12, 0x2C },
+  { 0xFC, 0x18, 0x03 },
+  { 0xFC, 0x18, 0x3C },
+  { 0xFC, 0x19, 0x99 },
+  { 0xFC, 0x1B, 0xD1 },
+  { 0xFC, 0x1D, 0x3A },
+  { 0xFC, 0x1D, 0x43 },
+  { 0xFC, 0x22, 0xF4 },
+  { 0xFC, 0x25, 0x3F },
+  { 0xFC, 0x2A, 0x9C },
+  { 0xFC, 0x2D, 0x5E },
+  { 0xFC, 0x31, 0x5D },
+  { 0xFC, 0x34, 0x97 },
+  { 0xFC, 0x3F, 0x7C },
+  { 0xFC, 0x40, 0x09 },
+  { 0xFC, 0x44, 0x9F },
+  { 0xFC, 0x47, 0xD8 },
+  { 0xFC, 0x48, 0xEF },
+  { 0xFC, 0x49, 0x2D },
+  { 0xFC, 0x4D, 0xA6 },
+  { 0xFC, 0x4E, 0xA4 },
+  { 0xFC, 0x51, 0xB5 },
+  { 0xFC, 0x55, 0x57 },
+  { 0xFC, 0x58, 0x9A },
+  { 0xFC, 0x5B, 0x39 },
+  { 0xFC, 0x5B, 0x8C },
+  { 0xFC, 0x5C, 0x45 },
+  { 0xFC, 0x64, 0xBA },
+  { 0xFC, 0x65, 0xDE },
+  { 0xFC, 0x66, 0xCF },
+  { 0xFC, 0x73, 0xFB },
+  { 0xFC, 0x75, 0x16 },
+  { 0xFC, 0x7F, 0xF1 },
+  { 0xFC, 0x87, 0x43 },
+  { 0xFC, 0x8A, 0x3D },
+  { 0xFC, 0x8A, 0xF7 },
+  { 0xFC, 0x8C, 0x11 },
+  { 0xFC, 0x94, 0x35 },
+  { 0xFC, 0x94, 0xCE },
+  { 0xFC, 0x99, 0x47 },
+  { 0xFC, 0x9C, 0xA7 },
+  { 0xFC, 0xA0, 0xF3 },
+  { 0xFC, 0xA1, 0x83 },
+  { 0xFC, 0xA6, 0x67 },
+  { 0xFC, 0xA9, 0xF5 },
+  { 0xFC, 0xAA, 0x81 },
+  { 0xFC, 0xAB, 0x90 },
+  { 0xFC, 0xB4, 0x67 },
+  { 0xFC, 0xB6, 0xD8 },
+  { 0xFC, 0xBC, 0xD1 },
+  { 0xFC, 0xC2, 0x33 },
+  { 0xFC, 0xC8, 0x97 },
+  { 0xFC, 0xD7, 0x33 },
+  { 0xFC, 0xD7, 0x49 },
+  { 0xFC, 0xD8, 0x48 },
+  { 0xFC, 0xD9, 0x08 },
+  { 0xFC, 0xE2, 0x6C },
+  { 0xFC, 0xE3, 0x3C },
+  { 0xFC, 0xE8, 0xC0 },
+  { 0xFC, 0xE9, 0x98 },
+  { 0xFC, 0xE9, 0xD8 },
+  { 0xFC, 0xEC, 0xDA },
+  { 0xFC, 0xF5, 0x28 },
+  { 0xFC, 0xF5, 0xC4 },
+  { 0xFC, 0xF7, 0x38 },
+  { 0xFC, 0xFA, 0x21 },
+  { 0xFC, 0xFB, 0xFB },
+  { 0xFC, 0xFC, 0x48 },
+};
+
+// Index into ouiNameOffsets for each key.
+static const uint8_t ouiNameIdx[OUI_TABLE_LEN] = {
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 3, 7, 7, 7, 7, 7, 7, 15,
+  1, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 3,
+  7, 7, 9, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 11, 7, 7,
+  7, 7, 17, 7, 7, 7, 7, 18, 7, 7, 3, 7, 7, 7, 7, 3,
+  7, 7, 26, 7, 7, 7, 7, 7, 7, 7, 4, 7, 7, 7, 7, 7,
+  7, 14, 22, 0, 7, 7, 7, 7, 11, 6, 7, 7, 21, 7, 7, 9,
+  3, 7, 7, 7, 7, 14, 7, 7, 25, 7, 7, 0, 7, 7, 7, 7,
+  7, 7, 9, 14, 7, 7, 17, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 3, 7, 7, 7, 3, 0, 5, 7, 7, 7,
+  7, 9, 7, 7, 0, 7, 7, 14, 7, 7, 15, 7, 7, 7, 7, 14,
+  7, 7, 9, 30, 7, 7, 7, 7, 23, 7, 7, 0, 7, 7, 3, 7,
+  7, 17, 26, 7, 7, 14, 7, 7, 1, 7, 7, 15, 7, 7, 27, 7,
+  7, 9, 29, 0, 7, 7, 6, 7, 7, 18, 7, 7, 14, 7, 7, 3,
+  7, 7, 0, 7, 5, 7, 7, 7, 7, 9, 18, 7, 7, 3, 15, 8,
+  7, 7, 14, 17, 7, 7, 7, 13, 7, 7, 0, 14, 7, 7, 18, 7,
+  7, 7, 7, 7, 9, 7, 7, 29, 30, 26, 3, 7, 7, 18, 12, 4,
+  7, 7, 1, 7, 7, 14, 0, 7, 7, 7, 7, 18, 7, 7, 9, 7,
+  7, 17, 7, 7, 3, 7, 18, 7, 7, 7, 7, 7, 18, 0, 7, 7,
+  14, 1, 7, 7, 7, 7, 3, 18, 5, 9, 7, 7, 26, 23, 7, 7,
+  3, 0, 7, 7, 6, 14, 7, 7, 18, 15, 7, 7, 13, 7, 7, 17,
+  18, 7, 7, 3, 9, 7, 29, 7, 7, 0, 18, 7, 7, 3, 14, 7,
+  7, 7, 7, 18, 17, 1, 23, 3, 7, 7, 7, 7, 18, 0, 7, 7,
+  3, 7, 7, 26, 14, 18, 7, 7, 9, 7, 7, 18, 7, 7, 7, 3,
+  7, 7, 0, 7, 17, 3, 15, 18, 7, 7, 14, 5, 23, 7, 7, 29,
+  18, 9, 7, 7, 7, 18, 7, 7, 3, 18, 3, 7, 7, 0, 7, 7,
+  14, 3, 7, 7, 7, 18, 26, 3, 7, 7, 30, 9, 7, 7, 18, 3,
+  18, 7, 7, 4, 23, 0, 7, 7, 6, 17, 7, 7, 18, 7, 7, 1,
+  3, 29, 7, 7, 7, 3, 13, 7, 7, 26, 14, 13, 18, 15, 7, 7,
+  3, 23, 3, 7, 7, 0, 3, 7, 7, 18, 9, 7, 7, 3, 3, 7,
+  7, 29, 17, 18, 7, 7, 26, 27, 7, 7, 7, 7, 7, 6, 7, 13,
+  7, 7, 7, 7, 3, 7, 7, 7, 7, 7, 7, 7, 7, 7, 5, 7,
+  26, 7, 23, 13, 7, 7, 7, 7, 7, 7, 7, 7, 7, 16, 3, 7,
+  6, 7, 7, 7, 7, 7, 13, 29, 13, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 9, 7, 7, 7, 3, 7, 7, 3, 7, 7, 13,
+  3, 7, 26, 7, 7, 7, 7, 7, 7, 7, 7, 13, 3, 7, 7, 13,
+  13, 7, 7, 3, 2, 7, 7, 7, 7, 3, 7, 9, 3, 7, 8, 7,
+  7, 3, 3, 7, 7, 17, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 13, 13, 7, 7, 28, 3, 30, 7, 7, 7, 7, 7,
+  7, 7, 7, 9, 7, 7, 7, 7, 7, 7, 7, 3, 7, 7, 7, 2,
+  7, 13, 7, 7, 7, 7, 28, 3, 3, 7, 7, 7, 3, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 3, 7, 7,
+  7, 0, 7, 7, 20, 7, 7, 7, 7, 7, 7, 13, 7, 7, 13, 6,
+  23, 29, 7, 7, 28, 7, 7, 2, 3, 3, 12, 7, 3, 13, 13, 7,
+  13, 2, 7, 7, 7, 13, 18, 3, 28, 13, 3, 13, 27, 29, 3, 29,
+  13, 3, 15, 13, 7, 13, 0, 3, 13, 3, 13, 23, 3, 3, 7, 7,
+  3, 3, 7, 29, 3, 13, 7, 13, 13, 13, 0, 29, 3, 3, 3, 13,
+  17, 7, 13, 13, 28, 1, 9, 3, 13, 4, 7, 30, 13, 7, 28, 13,
+  13, 28, 3, 0, 11, 0, 7, 3, 3, 28, 13, 7, 3, 13, 3, 13,
+  26, 7, 13, 3, 13, 17, 21, 2, 7, 29, 13, 28, 26, 7, 13, 28,
+  3, 30, 3, 13, 13, 17, 10, 10, 29, 29, 7, 13, 7, 7, 22, 26,
+  2, 9, 11, 13, 0, 29, 0, 13, 3, 3, 2, 3, 3, 13, 3, 13,
+  13, 7, 2, 7, 2, 5, 3, 3, 2, 2, 13, 3, 7, 1, 29, 12,
+  13, 2, 29, 12, 10, 17, 0, 13, 2, 3, 7, 7, 7, 10, 29, 3,
+  13, 13, 7, 8, 7, 3, 29, 3, 3, 10, 13, 3, 29, 9, 7, 29,
+  3, 13, 3, 28, 13, 7, 13, 13, 3, 13, 15, 29, 13, 3, 3, 15,
+  13, 2, 13, 2, 26, 3, 13, 3, 3, 3, 13, 7, 3, 13, 26, 1,
+  29, 3, 7, 3, 8, 26, 26, 13, 7, 10, 8, 13, 13, 4, 28, 0,
+  7, 13, 9, 10, 3, 12, 13, 28, 7, 7, 13, 3, 7, 3, 10, 2,
+  3, 13, 15, 2, 28, 23, 7, 13, 3, 13, 7, 10, 7, 2, 17, 17,
+  29, 29, 13, 3, 13, 26, 3, 28, 15, 3, 13, 29, 28, 3, 3, 13,
+  13, 4, 13, 10, 21, 7, 9, 6, 30, 0, 30, 0, 7, 13, 10, 3,
+  3, 2, 10, 3, 3, 3, 13, 7, 2, 13, 7, 7, 7, 3, 3, 7,
+  3, 9, 0, 2, 13, 0, 13, 13, 2, 3, 3, 29, 17, 3, 3, 7,
+  23, 7, 7, 26, 29, 29, 13, 2, 3, 13, 7, 3, 3, 12, 13, 3,
+  10, 3, 13, 30, 13, 29, 13, 13, 28, 13, 17, 3, 13, 29, 3, 13,
+  29, 26, 3, 3, 7, 3, 26, 3, 3, 13, 13, 3, 2, 5, 3, 3,
+  3, 28, 3, 15, 13, 3, 8, 13, 7, 13, 13, 4, 13, 3, 12, 3,
+  3, 29, 15, 26, 26, 3, 13, 13, 3, 9, 26, 0, 0, 26, 13, 26,
+  3, 28, 28, 13, 9, 29, 3, 13, 18, 0, 7, 3, 13, 3, 3, 29,
+  2, 3, 23, 7, 3, 13, 3, 7, 28, 7, 29, 4, 3, 29, 2, 29,
+  4, 23, 3, 7, 3, 28, 10, 7, 7, 7, 3, 26, 3, 3, 6, 13,
+  29, 13, 13, 26, 13, 13, 7, 3, 3, 27, 13, 6, 3, 7, 28, 3,
+  26, 3, 7, 3, 22, 10, 3, 2, 13, 7, 3, 15, 13, 7, 13, 29,
+  4, 3, 23, 26, 13, 13, 13, 26, 18, 2, 12, 3, 13, 3, 9, 26,
+  29, 13, 3, 7, 3, 13, 30, 9, 13, 3, 0, 13, 3, 3, 2, 10,
+  3, 13, 7, 3, 13, 9, 3, 0, 13, 23, 9, 28, 7, 7, 7, 3,
+  13, 3, 13, 7, 7, 1, 12, 26, 7, 2, 3, 29, 13, 7, 13, 18,
+  17, 3, 29, 3, 15, 3, 18, 12, 26, 13, 13, 3, 28, 26, 7, 3,
+  7, 29, 3, 13, 28, 4, 7, 17, 13, 13, 23, 29, 15, 13, 3, 26,
+  3, 3, 3, 3, 28, 13, 29, 13, 3, 3, 4, 2, 3, 3, 28, 13,
+  13, 15, 14, 3, 13, 7, 3, 7, 0, 7, 13, 26, 13, 12, 3, 17,
+  3, 29, 3, 21, 13, 13, 28, 3, 2, 13, 7, 12, 13, 10, 28, 7,
+  13, 7, 3, 3, 13, 3, 13, 12, 7, 13, 26, 13, 7, 7, 13, 13,
+  13, 0, 13, 10, 2, 29, 10, 27, 26, 3, 3, 10, 4, 1, 26, 13,
+  7, 10, 29, 7, 23, 7, 29, 13, 7, 13, 12, 13, 13, 3, 10, 3,
+  27, 13, 29, 3, 10, 3, 7, 13, 29, 23, 2, 3, 28, 29, 7, 7,
+  10, 13, 13, 10, 4, 13, 3, 12, 7, 13, 3, 5, 13, 3, 13, 29,
+  3, 3, 3, 9, 13, 28, 15, 13, 15, 13, 13, 30, 26, 3, 13, 13,
+  7, 3, 3, 9, 13, 13, 13, 13, 7, 13, 3, 13, 13, 3, 3, 13,
+  7, 27, 2, 29, 3, 29, 17, 13, 3, 26, 29, 3, 3, 7, 17, 7,
+  13, 3, 13, 7, 7, 23, 13, 12, 3, 3, 17, 3, 7, 29, 19, 18,
+  3, 3, 4, 29, 13, 3, 3, 28, 13, 13, 3, 15, 3, 3, 3, 26,
+  2, 3, 3, 13, 3, 29, 7, 13, 7, 18, 13, 3, 13, 7, 3, 3,
+  29, 13, 15, 17, 7, 3, 7, 3, 7, 10, 1, 7, 8, 7, 0, 7,
+  13, 7, 15, 13, 0, 7, 3, 13, 7, 23, 3, 13, 29, 2, 7, 3,
+  3, 3, 3, 7, 1, 13, 29, 13, 13, 13, 13, 23, 7, 7, 17, 3,
+  13, 3, 3, 3, 23, 22, 13, 19, 7, 28, 23, 13, 3, 3, 29, 10,
+  24, 7, 0, 28, 29, 3, 13, 29, 5, 10, 3, 7, 13, 3, 29, 29,
+  13, 17, 13, 28, 3, 0, 3, 13, 3, 10, 0, 13, 23, 7, 13, 13,
+  3, 3, 29, 13, 13, 10, 26, 26, 29, 13, 10, 10, 29, 13, 29, 3,
+  3, 3, 3, 29, 26, 3, 7, 13, 29, 13, 7, 3, 13, 26, 12, 13,
+  13, 13, 9, 3, 9, 13, 3, 13, 23, 3, 7, 28, 13, 23, 29, 2,
+  3, 13, 3, 13, 18, 3, 1, 3, 29, 29, 4, 6, 3, 29, 29, 3,
+  8, 13, 7, 21, 26, 7, 13, 29, 13, 13, 7, 7, 29, 13, 3, 25,
+  28, 1, 10, 10, 7, 4, 3, 23, 10, 26, 29, 0, 10, 17, 13, 3,
+  7, 3, 3, 10, 18, 2, 3, 13, 10, 10, 7, 28, 7, 7, 3, 4,
+  12, 13, 2, 29, 7, 29, 29, 3, 26, 7, 3, 26, 7, 23, 3, 3,
+  7, 3, 13, 1, 4, 7, 13, 7, 4, 0, 13, 25, 23, 29, 13, 3,
+  13, 3, 29, 15, 7, 3, 3, 29, 3, 26, 8, 12, 13, 3, 3, 12,
+  13, 7, 29, 7, 17, 3, 29, 28, 3, 13, 4, 11, 28, 7, 3, 3,
+  0, 29, 29, 29, 28, 13, 3, 7, 29, 2, 13, 3, 13, 7, 23, 13,
+  3, 26, 3, 7, 7, 28, 13, 7, 3, 13, 9, 3, 3, 7, 12, 3,
+  3, 13, 12, 9, 13, 1, 17, 3, 7, 23, 26, 13, 3, 7, 26, 13,
+  7, 12, 2, 7, 10, 13, 26, 3, 29, 10, 13, 0, 3, 15, 10, 26,
+  13, 7, 12, 13, 13, 13, 13, 13, 1, 3, 29, 3, 28, 29, 3, 13,
+  3, 13, 7, 3, 29, 7, 13, 3, 2, 13, 10, 29, 13, 29, 15, 13,
+  7, 13, 7, 7, 29, 7, 0, 26, 10, 3, 3, 3, 3, 26, 13, 7,
+  13, 30, 10, 3, 13, 13, 7, 17, 3, 13, 3, 13, 3, 9, 15, 10,
+  3, 3, 9, 3, 2, 3, 7, 2, 26, 0, 13, 3, 2, 7, 23, 3,
+  3, 13, 3, 7, 3, 18, 3, 3, 4, 3, 26, 3, 13, 7, 18, 7,
+  10, 2, 3, 3, 2, 13, 7, 12, 4, 29, 15, 10, 3, 3, 23, 13,
+  3, 7, 13, 29, 3, 2, 29, 2, 3, 3, 1, 13, 7, 29, 13, 4,
+  7, 2, 13, 13, 2, 13, 13, 13, 7, 3, 17, 13, 13, 29, 17, 3,
+  7, 7, 26, 2, 7, 12, 13, 13, 3, 7, 2, 13, 3, 27, 3, 7,
+  7, 3, 13, 3, 3, 29, 3, 29, 29, 4, 13, 7, 26, 13, 13, 7,
+  7, 26, 3, 13, 10, 29, 28, 13, 7, 4, 13, 18, 10, 3, 3, 13,
+  10, 13, 13, 3, 2, 7, 13, 3, 13, 15, 10, 13, 29, 0, 1, 26,
+  29, 3, 13, 13, 7, 3, 2, 13, 26, 7, 15, 28, 7, 13, 22, 7,
+  3, 18, 25, 29, 3, 22, 13, 13, 2, 4, 3, 13, 3, 10, 13, 13,
+  12, 3, 13, 13, 3, 10, 3, 30, 9, 14, 13, 13, 28, 7, 28, 29,
+  26, 10, 29, 2, 13, 3, 3, 3, 15, 7, 29, 28, 29, 7, 2, 13,
+  3, 3, 7, 22, 17, 28, 3, 7, 7, 3, 10, 7, 3, 3, 3, 7,
+  13, 13, 3, 3, 30, 7, 3, 29, 29, 13, 13, 13, 3, 23, 3, 7,
+  30, 8, 29, 13, 13, 13, 4, 13, 28, 7, 7, 6, 3, 10, 7, 0,
+  2, 28, 13, 13, 13, 13, 13, 10, 13, 7, 7, 2, 13, 7, 13, 7,
+  7, 7, 13, 3, 18, 3, 7, 3, 7, 28, 7, 26, 13, 29, 13, 0,
+  7, 17, 3, 7, 7, 29, 13, 29, 7, 13, 7, 30, 13, 17, 13, 29,
+  3, 3, 3, 7, 28, 28, 26, 28, 13, 13, 28, 3, 3, 13, 23, 29,
+  3, 3, 26, 6, 26, 2, 26, 28, 2, 3, 30, 29, 4, 1, 3, 0,
+  3, 3, 2, 7, 26, 13, 0, 17, 3, 29, 13, 13, 13, 29, 13, 29,
+  13, 3, 25, 3, 10, 3, 16, 3, 13, 13, 23, 10, 13, 29, 7, 15,
+  3, 13, 7, 10, 12, 13, 3, 13, 3, 26, 7, 7, 7, 7, 30, 29,
+  7, 7, 13, 7, 13, 3, 3, 7, 0, 7, 13, 26, 3, 26, 13, 9,
+  13, 29, 13, 26, 29, 13, 7, 4, 29, 3, 3, 26, 3, 3, 23, 13,
+  4, 13, 7, 3, 0, 13, 3, 28, 12, 13, 6, 13, 18, 7, 3, 3,
+  26, 28, 3, 3, 7, 13, 29, 13, 3, 3, 14, 13, 3, 3, 13, 7,
+  30, 7, 23, 7, 7, 2, 7, 3, 13, 3, 18, 23, 3, 13, 7, 18,
+  13, 10, 7, 12, 10, 13, 29, 3, 9, 13, 3, 2, 3, 5, 7, 13,
+  13, 23, 29, 13, 13, 3, 13, 18, 29, 13, 3, 3, 7, 12, 29, 7,
+  3, 1, 13, 29, 7, 3, 18, 3, 3, 13, 3, 7, 16, 26, 26, 13,
+  30, 7, 30, 3, 13, 7, 13, 23, 7, 3, 26, 2, 3, 13, 3, 3,
+  3, 3, 4, 7, 29, 7, 26, 13, 25, 3, 13, 7, 13, 13, 15, 29,
+  13, 13, 10, 28, 9, 23, 7, 30, 13, 13, 3, 26, 30, 3, 3, 3,
+  13, 7, 10, 13, 3, 3, 13, 3, 13, 13, 29, 29, 18, 27, 7, 4,
+  26, 7, 13, 3, 30, 26, 3, 5, 26, 13, 3, 0, 13, 13, 10, 3,
+  9, 3, 3, 29, 18, 28, 12, 3, 7, 29, 3, 13, 3, 13, 3, 6,
+  3, 3, 3, 3, 3, 13, 3, 13, 13, 3, 0, 26, 13, 28, 12, 7,
+  3, 3, 13, 23, 3, 13, 3, 3, 13, 13, 26, 29, 13, 13, 3, 3,
+  13, 3, 3, 3, 3, 7, 28, 3, 7, 29, 13, 7, 13, 3, 9, 13,
+  7, 13, 13, 3, 13, 26, 3, 3, 13, 26, 13, 3, 13, 13, 29, 26,
+  26, 3, 3, 29, 7, 3, 7, 7, 28, 3, 3, 13, 7, 3, 28, 18,
+  10, 3, 29, 13, 13, 3, 28, 22, 3, 7, 7, 29, 28, 3, 10, 4,
+  7, 7, 13, 3, 2, 29, 13, 29, 4, 7, 3, 2, 8, 7, 3, 3,
+  13, 8, 13, 28, 2, 3, 3, 10, 15, 7, 27, 26, 29, 7, 7, 14,
+  26, 13, 3, 7, 7, 13, 29, 13, 23, 29, 13, 3, 7, 2, 3, 7,
+  7, 29, 29, 13, 13, 13, 13, 3, 3, 3, 2, 10, 7, 7, 28, 10,
+  3, 7, 13, 27, 13, 3, 3, 2, 26, 28, 6, 13, 7, 7, 3, 7,
+  13, 2, 3, 3, 26, 7, 7, 13, 2, 7, 13, 15, 13, 9, 3, 7,
+  13, 7, 7, 13, 22, 3, 3, 7, 7, 13, 28, 3, 3, 7, 7, 13,
+  2, 26, 15, 7, 13, 13, 7, 3, 7, 13, 9, 3, 3, 8, 29, 7,
+  7, 3, 3, 3, 7, 2, 7, 29, 23, 7, 3, 17, 3, 26, 7, 10,
+  13, 13, 29, 3, 8, 4, 17, 13, 29, 13, 7, 13, 7, 8, 3, 3,
+  26, 13, 13, 8, 4, 28, 7, 7, 10, 10, 7, 7, 7, 29, 3, 3,
+  7, 13, 7, 3, 18, 29, 13, 3, 7, 4, 28, 12, 3, 3, 13, 23,
+  3, 18, 30, 11, 0, 13, 26, 13, 3, 28, 7, 9, 7, 7, 7, 7,
+  3, 7, 2, 13, 3, 13, 3, 13, 7, 13, 13, 7, 7, 3, 13, 0,
+  13, 16, 13, 29, 3, 27, 13, 7, 3, 3, 7, 10, 3, 28, 15, 7,
+  13, 7, 23, 7, 3, 13, 7, 7, 7, 3, 7, 7, 3, 7, 3, 3,
+  3, 3, 18, 7, 7, 15, 13, 6, 26, 3, 7, 28, 3, 3, 28, 7,
+  29, 3, 29, 13, 28, 26, 23, 1, 3, 17, 29, 22, 13, 10, 28, 7,
+  2, 13, 13, 13, 3, 29, 3, 3, 12, 2, 11, 3, 27, 18, 7, 13,
+  13, 7, 3, 3, 7, 23, 29, 13, 13, 4, 3, 7, 13, 7, 13, 3,
+  29, 2, 27, 7, 29, 3, 13, 2, 25, 0, 13, 2, 2, 26, 9, 3,
+  2, 15, 3, 13, 26, 2, 28, 18, 26, 3, 7, 28, 13, 7, 13, 13,
+  11, 29, 13, 18, 10, 0, 25, 13, 29, 29, 3, 9, 3, 26, 27, 3,
+  9, 13, 13, 13, 26, 13, 3, 3, 13, 3, 2, 7, 3, 3, 3, 27,
+  26, 29, 29, 9, 22, 3, 2, 26, 18, 3, 3, 13, 7, 7, 29, 30,
+  3, 13, 3, 17, 13, 3, 28, 7, 13, 2, 10, 3, 29, 13, 7, 13,
+  13, 3, 3, 13, 3, 28, 28, 3, 7, 0, 3, 13, 13, 13, 28, 7,
+  7, 3, 3, 3, 28, 12, 7, 13, 29, 13, 3, 3, 4, 13, 3, 2,
+  2, 13, 21, 7, 3, 3, 10, 13, 30, 13, 10, 26, 13, 7, 3, 10,
+  13, 3, 13, 28, 3, 7, 7, 13, 7, 29, 26, 13, 18, 3, 15, 3,
+  26, 13, 3, 3, 3, 13, 2, 28, 12, 13, 10, 3, 2, 3, 3, 7,
+  3, 3, 28, 1, 3, 23, 3, 3, 2, 13, 7, 9, 7, 27, 29, 7,
+  13, 28, 17, 13, 13, 13, 3, 3, 25, 13, 3, 3, 13, 10, 3, 10,
+  5, 13, 7, 2, 13, 29, 13, 10, 11, 3, 26, 26, 3, 3, 3, 28,
+  26, 3, 29, 13, 13, 3, 23, 3, 15, 17, 13, 18, 13, 3, 7, 13,
+  3, 7, 26, 30, 3, 3, 23, 13, 13, 10, 29, 13, 26, 23, 17, 29,
+  13, 23, 2, 3, 3, 3, 11, 29, 7, 13, 3, 13, 13, 15, 7, 13,
+  15, 13, 3, 29, 29, 13, 3, 7, 7, 3, 3, 3, 7, 3, 7, 3,
+  29, 3, 13, 3, 13, 13, 3, 3, 13, 3, 6, 3, 15, 3, 7, 7,
+  7, 13, 9, 10, 3, 4, 2, 26, 13, 6, 21, 7, 7, 10, 29, 10,
+  3, 10, 3, 13, 13, 8, 3, 7, 3, 3, 3, 4, 26, 13, 4, 12,
+  13, 13, 13, 7, 13, 28, 3, 28, 3, 13, 12, 6, 7, 29, 3, 3,
+  13, 3, 3, 13, 13, 3, 28, 13, 2, 13, 7, 29, 13, 13, 7, 7,
+  13, 13, 3, 3, 30, 3, 3, 13, 3, 3, 13, 13, 3, 29, 13, 3,
+  13, 3, 13, 13, 13, 29, 0, 21, 13, 13, 3, 3, 7, 7, 13, 13,
+  7, 3, 23, 13, 29, 13, 7, 26, 13, 3, 3, 3, 13, 17, 13, 7,
+  21, 10, 18, 3, 30, 7, 13, 29, 13, 4, 29, 23, 28, 3, 3, 3,
+  13, 7, 3, 4, 3, 13, 8, 29, 3, 3, 7, 7, 3, 26, 10, 28,
+  7, 28, 18, 10, 28, 29, 29, 29, 13, 13, 3, 29, 3, 13, 13, 3,
+  23, 13, 13, 12, 2, 13, 13, 13, 13, 29, 4, 2, 13, 3, 28, 13,
+  3, 10, 2, 23, 3, 13, 18, 13, 13, 3, 3, 13, 13, 15, 11, 3,
+  7, 28, 29, 29, 3, 3, 3, 29, 7, 3, 3, 9, 13, 9, 6, 10,
+  26, 3, 3, 3, 13, 2, 26, 3, 3, 3, 3, 29, 29, 12, 29, 29,
+  3, 3, 0, 7, 7, 3, 30, 26, 2, 13, 13, 3, 29, 13, 13, 13,
+  29, 26, 3, 13, 13, 5, 3, 28, 17, 13, 13, 29, 27, 7, 13, 2,
+  10, 3, 13, 5, 12, 13, 18, 2, 3, 4, 4, 13, 28, 13, 28, 13,
+  3, 12, 29, 15, 25, 29, 13, 17, 29, 3, 7, 3, 13, 23, 4, 10,
+  10, 3, 29, 23, 29, 13, 13, 28, 7, 13, 26, 13, 13, 13, 29, 10,
+  13, 3, 3, 12, 11, 23, 3, 3, 13, 11, 29, 3, 3, 3, 30, 3,
+  3, 29, 29, 8, 13, 2, 26, 13, 13, 18, 13, 3, 26, 13, 13, 3,
+  3, 15, 3, 29, 3, 29, 15, 4, 26, 29, 1, 13, 3, 13, 7, 3,
+  3, 18, 3, 3, 2, 10, 12, 13, 3, 7, 26, 3, 26, 3, 13, 18,
+  29, 13, 3, 29, 10, 29, 28, 28, 14, 3, 3, 3, 27, 7, 3, 4,
+  13, 3, 26, 3, 13, 28, 3, 28, 29, 3, 4, 13, 7, 17, 3, 7,
+  12, 3, 13, 26, 7, 7, 3, 3, 28, 0, 29, 29, 3, 13, 15, 29,
+  13, 13, 13, 13, 3, 13, 3, 3, 3, 28, 10, 28, 26, 26, 29, 15,
+  7, 13, 13, 29, 28, 13, 13, 1, 2, 17, 29, 17, 7, 9, 13, 7,
+  8, 3, 13, 18, 3, 29, 21, 3, 3, 3, 3, 3, 2, 17, 13, 29,
+  7, 29, 3, 13, 10, 17, 7, 4, 13, 13, 0, 3, 7, 7, 13, 17,
+  13, 15, 3, 3, 3, 7, 3, 13, 17, 13, 10, 3, 3, 15, 28, 13,
+  13, 29, 7, 3, 9, 4, 3, 13, 10, 9, 9, 13, 3, 7, 10, 7,
+  7, 29, 2, 3, 2, 3, 10, 13, 7, 30, 29, 7, 3, 26, 13, 7,
+  3, 7, 13, 2, 7, 4, 7, 7, 3, 13, 13, 7, 26, 9, 17, 26,
+  3, 18, 29, 28, 28, 7, 28, 7, 28, 7, 18, 3, 3, 13, 7, 13,
+  13, 12, 3, 7, 10, 13, 29, 3, 7, 13, 7, 13, 13, 7, 7, 13,
+  3, 7, 7, 3, 13, 13, 13, 18, 3, 3, 13, 3, 13, 28, 10, 3,
+  3, 3, 3, 3, 13, 13, 28, 10, 3, 3, 29, 3, 3, 3, 29, 10,
+  23, 7, 13, 26, 3, 3, 13, 16, 13, 13, 26, 10, 8, 10, 13, 3,
+  7, 13, 3, 4, 16, 26, 3, 3, 4, 3, 0, 3, 9, 3, 28, 29,
+  13, 3, 13, 3, 3, 3, 15, 3, 3, 3, 3, 3, 28, 7, 29, 3,
+  7, 13, 7, 21, 3, 3, 3, 13, 2, 13, 13, 13, 2, 13, 16, 3,
+  3, 13, 3, 29, 13, 3, 10, 26, 3, 3, 8, 3, 28, 3, 0, 16,
+  3, 7, 7, 21, 3, 12, 2, 3, 3, 7, 7, 13, 13, 13, 13, 13,
+  3, 2, 29, 13, 23, 12, 10, 11, 13, 7, 7, 3, 26, 13, 3, 3,
+  3, 27, 13, 13, 3, 13, 3, 13, 0, 7, 4, 29, 21, 13, 3, 3,
+  7, 28, 3, 2, 3, 13, 10, 8, 13, 3, 13, 13, 3, 13, 9, 7,
+  7, 28, 13, 3, 13, 7, 13, 29, 13, 3, 4, 13, 7, 12, 3, 3,
+  17, 3, 3, 26, 26, 13, 13, 3, 3, 12, 0, 3, 2, 29, 13, 7,
+  17, 13, 29, 7, 7, 3, 7, 7, 26, 26, 13, 28, 3, 13, 7, 10,
+  21, 26, 7, 29, 29, 10, 30, 17, 26, 3, 29, 7, 9, 6, 13, 3,
+  2, 3, 3, 13, 28, 12, 13, 3, 3, 13, 13, 21, 3, 1, 2, 7,
+  2, 7, 29, 28, 13, 7, 13, 13, 3, 3, 3, 29, 13, 13, 9, 13,
+  3, 13, 3, 7, 3, 4, 29, 13, 13, 5, 23, 2, 3, 13, 13, 10,
+  3, 29, 3, 7, 7, 3, 26, 13, 29, 2, 28, 13, 7, 29, 8, 2,
+  10, 7, 3, 13, 3, 3, 27, 13, 13, 29, 8, 13, 3, 7, 3, 3,
+  3, 19, 3, 15, 3, 4, 7, 4, 28, 3, 21, 3, 3, 3, 15, 3,
+  13, 3, 13, 2, 13, 7, 3, 22, 18, 3, 3, 12, 3, 13, 18, 3,
+  3, 13, 28, 13, 21, 7, 9, 8, 18, 3, 13, 7, 3, 13, 3, 29,
+  4, 30, 10, 13, 12, 29, 13, 3, 3, 25, 28, 30, 10, 29, 3, 3,
+  26, 3, 1, 3, 9, 7, 29, 7, 13, 13, 9, 13, 7, 7, 8, 3,
+  3, 13, 13, 26, 7, 13, 13, 3, 3, 3, 7, 28, 13, 29, 7, 3,
+  28, 3, 18, 13, 13, 13, 28, 15, 3, 7, 3, 30, 13, 13, 18, 4,
+  3, 17, 3, 3, 0, 13, 8, 3, 3, 29, 13, 7, 7, 18, 30, 3,
+  7, 26, 13, 7, 4, 21, 8, 10, 12, 3, 13, 7, 3, 0, 7, 29,
+  9, 29, 7, 3, 10, 13, 26, 7, 28, 3, 3, 1, 7, 26, 7, 3,
+  13, 13, 17, 13, 3, 29, 10, 26, 10, 13, 29, 5, 26, 7, 3, 7,
+  7, 13, 7, 3, 13, 23, 13, 7, 7, 2, 2, 29, 29, 3, 3, 3,
+  29, 9, 3, 3, 13, 29, 3, 13, 13, 14, 23, 7, 23, 26, 3, 3,
+  3, 13, 13, 13, 26, 3, 3, 13, 13, 13, 7, 13, 29, 13, 17, 23,
+  17, 13, 13, 13, 7, 3, 28, 13, 23, 3, 13, 9, 3, 7, 8, 13,
+  29, 29, 3, 3, 13, 3, 6, 25, 6, 17, 5, 13, 7, 7, 13, 7,
+  10, 3, 13, 10, 13, 3, 15, 7, 13, 13, 28, 26, 26, 7, 7, 29,
+  13, 7, 7, 3, 13, 8, 3, 2, 3, 15, 13, 29, 13, 9, 13, 3,
+  22, 7, 3, 7, 13, 7, 3, 3, 7, 15, 13, 8, 10, 13, 10, 10,
+  13, 9, 26, 29, 13, 7, 13, 13, 7, 23, 23, 13, 1, 13, 3, 13,
+  7, 3, 12, 10, 10, 3, 13, 21, 3, 28, 15, 7, 7, 29, 13, 13,
+  30, 29, 0, 29, 3, 2, 30, 3, 16, 9, 29, 0, 23, 7, 13, 3,
+  3, 13, 13, 15, 29, 7, 17, 13, 23, 13, 3, 14, 3, 13, 3, 9,
+  13, 13, 10, 3, 13, 13, 9, 14, 3, 13, 29, 10, 3, 7, 7, 8,
+  13, 13, 3, 3, 3, 26, 7, 3, 7, 29, 23, 13, 13, 13, 3, 3,
+  0, 29, 3, 3, 22, 26, 26, 7, 13, 17, 28, 3, 7, 10, 13, 7,
+  18, 30, 3, 15, 13, 3, 26, 3, 3, 7, 21, 7, 3, 7, 29, 10,
+  7, 7, 4, 13, 10, 7, 7, 13, 7, 8, 18, 2, 29, 13, 12, 13,
+  9, 7, 13, 13, 13, 13, 3, 3, 13, 1, 4, 3, 7, 7, 13, 7,
+  7, 10, 6, 28, 7, 7, 12, 2, 18, 3, 7, 3, 1, 29, 4, 13,
+  0, 27, 3, 3, 3, 13, 3, 26, 3, 13, 3, 21, 4, 13, 23, 3,
+  18, 7, 3, 29, 29, 29, 29, 13, 3, 13, 3, 13, 29, 7, 26, 13,
+  3, 3, 15, 13, 28, 7, 3, 29, 3, 7, 3, 13, 29, 7, 26, 13,
+  7, 3, 3, 4, 13, 13, 3, 7, 29, 7, 3, 7, 10, 13, 29, 29,
+  13, 26, 22, 3, 28, 30, 16, 1, 7, 6, 3, 29, 12, 30, 13, 13,
+  3, 13, 3, 0, 13, 13, 3, 3, 13, 7, 23, 3, 7, 13, 13, 7,
+  26, 13, 29, 11, 29, 7, 7, 7, 13, 10, 7, 15, 3, 2, 13, 13,
+  28, 3, 29, 7, 13, 3, 13, 7, 7, 13, 29, 23, 23, 29, 7, 22,
+  10, 13, 7, 13, 16, 3, 4, 21, 7, 7, 18, 3, 12, 29, 10, 13,
+  3, 3, 26, 29, 13, 29, 26, 13, 10, 26, 13, 3, 3, 7, 13, 13,
+  3, 29, 21, 28, 23, 19, 13, 26, 26, 13, 29, 3, 0, 29, 13, 26,
+  28, 7, 13, 18, 29, 12, 13, 29, 13, 13, 29, 12, 3, 30, 3, 13,
+  3, 10, 29, 3, 29, 28, 7, 27, 3, 10, 3, 2, 10, 13, 4, 28,
+  3, 3, 13, 3, 3, 15, 3, 29, 12, 5, 30, 10, 2, 9, 26, 29,
+  7, 3, 13, 7, 3, 3, 1, 13, 13, 3, 3, 22, 29, 3, 1, 7,
+  21, 3, 3, 10, 29, 3, 3, 10, 2, 3, 13, 13, 29, 18, 28, 3,
+  29, 3, 13, 7, 7, 3, 3, 7, 13, 2, 15, 13, 3, 27, 2, 3,
+  7, 19, 13, 3, 23, 3, 28, 4, 13, 18, 7, 13, 13, 3, 13, 10,
+  29, 12, 29, 9, 7, 13, 17, 13, 3, 7, 29, 6, 26, 13, 26, 13,
+  1, 18, 13, 7, 23, 13, 29, 9, 28, 11, 13, 13, 13, 1, 3, 7,
+  3, 13, 29, 0, 29, 17, 17, 13, 8, 10, 3, 7, 28, 27, 3, 7,
+  3, 29, 28, 3, 7, 17, 3, 13, 10, 29, 13, 3, 7, 13, 3, 3,
+  29, 3, 3, 29, 3, 3, 2, 0, 8, 13, 28, 7, 8, 13, 29, 28,
+  10, 18, 3, 3, 18, 2, 3, 13, 13, 30, 13, 7, 3, 15, 3, 13,
+  13, 7, 7, 27, 13, 28, 29, 7, 7, 3, 8, 12, 19, 29, 7, 10,
+  29, 13, 9, 13, 3, 29, 13, 13, 29, 13, 13, 28, 3, 22, 13, 3,
+  3, 3, 3, 3, 7, 13, 13, 13, 7, 28, 13, 3, 28, 29, 13, 13,
+  26, 3, 7, 29, 3, 26, 13, 7, 13, 4, 3, 3, 12, 17, 26, 13,
+  13, 3, 7, 3, 13, 7, 4, 13, 11, 3, 23, 4, 10, 3, 30, 7,
+  29, 26, 2, 13, 13, 18, 28, 7, 3, 7, 13, 10, 10, 13, 29, 3,
+  3, 3, 3, 29, 13, 3, 28, 3, 26, 28, 0, 10, 5, 18, 29, 13,
+  13, 15, 3, 13, 13, 29, 3, 29, 7, 7, 13, 9, 13, 7, 12, 13,
+  13, 2, 18, 10, 7, 26, 1, 13, 7, 11, 7, 13, 13, 13, 28, 13,
+  3, 17, 7, 4, 26, 3, 2, 26, 7, 13, 5, 29, 7, 9, 13, 29,
+  3, 26, 3, 2, 3, 3, 7, 28, 3, 13, 30, 3, 30, 7, 13, 4,
+  13, 13, 23, 15, 26, 10, 10, 4, 29, 3, 13, 13, 3, 13, 29, 15,
+  3, 26, 13, 29, 2, 13, 23, 10, 2, 13, 13, 3, 13, 3, 9, 7,
+  7, 13, 29, 29, 18, 7, 13, 7, 3, 28, 10, 7, 29, 7, 13, 10,
+  4, 10, 13, 3, 4, 29, 7, 15, 3, 3, 7, 13, 2, 7, 3, 0,
+  2, 13, 13, 23, 13, 13, 7, 2, 4, 12, 3, 4, 13, 28, 15, 12,
+  3, 3, 7, 0, 3, 9, 7, 2, 29, 30, 13, 3, 3, 3, 13, 7,
+  27, 13, 2, 3, 26, 13, 29, 1, 23, 3, 7, 3, 28, 3, 9, 3,
+  3, 13, 3, 13, 13, 3, 3, 2, 3, 3, 7, 3, 3, 3, 13, 29,
+  3, 12, 2, 26, 10, 3, 25, 7, 13, 13, 6, 12, 2, 3, 3, 7,
+  3, 29, 10, 28, 3, 13, 29, 7, 3, 26, 29, 29, 4, 28, 3, 3,
+  3, 3, 29, 13, 7, 13, 30, 7, 13, 3, 7, 28, 13, 3, 15, 0,
+  26, 29, 13, 13, 7, 26, 26, 28, 9, 13, 27, 13, 13, 7, 3, 29,
+  13, 29, 7, 3, 13, 13, 13, 10, 7, 3, 3, 7, 13, 13, 27, 13,
+  13, 29, 13, 29, 3, 7, 26, 7, 3, 26, 13, 12, 28, 12, 29, 3,
+  13, 3, 13, 13, 3, 7, 30, 29, 7, 12, 3, 12, 26, 3, 13, 3,
+  13, 3, 13, 0, 3, 7, 13, 13, 3, 13, 13, 3, 3, 7, 13, 2,
+  29, 4, 3, 29, 3, 7, 7, 13, 26, 3, 28, 3, 7, 17, 13, 29,
+  7, 7, 3, 3, 26, 12, 13, 3, 13, 13, 13, 13, 8, 29, 28, 7,
+  7, 28, 13, 3, 7, 13, 7, 13, 3, 7, 26, 13, 29, 7, 3, 23,
+  13, 9, 3, 7, 13, 2, 3, 28, 13, 13, 13, 3, 28, 13, 13, 3,
+  30, 3, 3, 29, 3, 0, 13, 29, 29, 3, 13, 2, 13, 3, 13, 3,
+  7, 7, 28, 23, 28, 2, 3, 13, 9, 4, 13, 29, 29, 15, 13, 29,
+  7, 3, 13, 2, 2, 28, 3, 13, 10, 3, 13, 0, 29, 26, 2, 3,
+  28, 3, 13, 10, 3, 2, 27, 30, 10, 13, 29, 7, 3,
+};
+
+// Offset of each vendor name within ouiNamePool.
+static const uint8_t ouiNameOffsets[] = {
+  0, 8, 12, 19, 25, 31, 38, 46, 52, 65, 72, 82,
+  91, 98, 105, 113, 123, 128, 136, 145, 158, 166, 171, 187,
+  194, 200, 206, 214, 223, 230, 234,
+};
+
+// NUL-terminated vendor names.
+static const char ouiNamePool[] =
+  "ASUSTek\0"
+  "AVM\0"
+  "Amazon\0"
+  "Apple\0"
+  "Aruba\0"
+  "Belkin\0"
+  "Buffalo\0"
+  "Cisco\0"
+  "Cisco Meraki\0"
+  "D-Link\0"
+  "Espressif\0"
+  "Fortinet\0"
+  "Google\0"
+  "Huawei\0"
+  "Linksys\0"
+  "Microsoft\0"
+  "Mist\0"
+  "NETGEAR\0"
+  "Nintendo\0"
+  "Raspberry Pi\0"
+  "Realtek\0"
+  "Roku\0"
+  "Routerboard.com\0"
+  "Ruckus\0"
+  "Seeed\0"
+  "Sonos\0"
+  "TP-Link\0"
+  "Ubiquiti\0"
+  "Xiaomi\0"
+  "ZTE\0"
+  "Zyxel\0"
+  ;
+
+#endif
@@ -0,0 +1,35 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// OUI -> vendor lookup. See oui.h.
+// (Portable; no Arduino dependencies.)
+
+#include <string.h>
+
+#include "oui.h"
+#include "oui-table.h"
+
+// Bit in the first octet of a MAC address that marks it as locally administered.
+static constexpr uint8_t MAC_LOCAL_BIT = 0x02;
+
+const char *ouiVendorName(const uint8_t *bssid) {
+  if (bssid[0] & MAC_LOCAL_BIT) {
+    return NULL;
+  }
+
+  // Binary search over the sorted keys.
+  size_t lo = 0;
+  size_t hi = OUI_TABLE_LEN;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    int cmp = memcmp(ouiKeys[mid], bssid, 3);
+    if (cmp == 0) {
+      return &ouiNamePool[ouiNameOffsets[ouiNameIdx[mid]]];
+    } else if (cmp < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return NULL;
+}
@@ -0,0 +1,21 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Look up the vendor of a station from the OUI (first 3 octets) of its BSSID.
+// (Portable; no Arduino dependencies.)
+//
+// The table is generated from the IEEE registry by tools/gen-oui-table.py into oui-table.h, and
+// lives entirely in flash: sorted 3-byte keys, a 1-byte vendor index per key, and a pool of
+// distinct vendor names.
+
+#ifndef _OUI_H
+#define _OUI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Return the vendor name for a 6-octet BSSID, or NULL if its OUI is not in the table.
+// Locally-administered addresses (e.g., randomized or virtual APs) have no OUI and return NULL.
+// The returned string is in flash and is valid forever.
+extern const char *ouiVendorName(const uint8_t *bssid);
+
+#endif
@@ -0,0 +1,96 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Check scans against the known-AP baseline, and persist the baseline. See rogue-watch.h.
+
+#include "wifi-scanner.h"
+
+static ApBaseline baseline;
+static bool hasBaseline = false;
+static RogueScanCounts counts;
+
+// Holds the encoded baseline while it's loaded or saved.
+static uint8_t baselineBuf[BASELINE_MAX_ENCODED_LEN];
+
+bool rogueWatchBegin() {
+  const sfud_flash *flash = spiFlash();
+  if (flash == NULL || flash->chip.erase_gran < BASELINE_MAX_ENCODED_LEN) {
+    return false;
+  }
+
+  if (sfud_read(flash, BASELINE_FLASH_BASE, sizeof(baselineBuf), baselineBuf) != SFUD_SUCCESS) {
+    return false;
+  }
+
+  hasBaseline = baseline.decode(baselineBuf, sizeof(baselineBuf));
+  if (hasBaseline) {
+    DBGPRINTI("Loaded AP baseline; BSSIDs:", baseline.numBssids());
+  }
+  return hasBaseline;
+}
+
+bool rogueWatchHasBaseline() {
+  return hasBaseline;
+}
+
+const ApBaseline &rogueWatchBaseline() {
+  return baseline;
+}
+
+void rogueWatchStartScan() {
+  memset(&counts, 0, sizeof(counts));
+}
+
+ApStatus rogueWatchCheck(const wifi_ap_record_t *pWifiAPRecord) {
+  ApStatus status = AP_KNOWN;
+  if (hasBaseline) {
+    status = baseline.check(pWifiAPRecord->bssid, pWifiAPRecord->ssid, pWifiAPRecord->primary);
+  }
+
+  switch (status) {
+  case AP_KNOWN:
+    counts.known++;
+    break;
+  case AP_NEW:
+    counts.newAps++;
+    break;
+  case AP_NEW_CLEAN_CHANNEL:
+    counts.newCleanChannel++;
+    break;
+  case AP_ROGUE:
+    counts.rogue++;
+    break;
+  }
+
+  return status;
+}
+
+const RogueScanCounts &rogueWatchCounts() {
+  return counts;
+}
+
+void rogueWatchCaptureStart() {
+  baseline.clear();
+  hasBaseline = true;
+}
+
+void rogueWatchCaptureStation(const wifi_ap_record_t *pWifiAPRecord) {
+  if (!baseline.add(pWifiAPRecord->bssid, pWifiAPRecord->ssid, pWifiAPRecord->primary)) {
+    DBGPRINT("AP baseline full");
+  }
+}
+
+bool rogueWatchCaptureFinish() {
+  const sfud_flash *flash = spiFlash();
+  if (flash == NULL || flash->chip.erase_gran < BASELINE_MAX_ENCODED_LEN) {
+    return false;
+  }
+
+  size_t len = baseline.encode(baselineBuf);
+  if (sfud_erase(flash, BASELINE_FLASH_BASE, flash->chip.erase_gran) != SFUD_SUCCESS
+      || sfud_write(flash, BASELINE_FLASH_BASE, len, baselineBuf) != SFUD_SUCCESS) {
+    DBGPRINT("AP baseline flash write failed");
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,48 @@
+// (c) Copyright 2022 Aaron Kimball
+
+#ifndef _ROGUE_WATCH_H
+#define _ROGUE_WATCH_H
+
+#include "ap-baseline.h"
+
+// With ROGUE_DETECT, each station in a scan is checked against a baseline of the known APs
+// (see ap-baseline.h), captured from a scan and kept in SPI flash (see spi-flash.h) in one erase
+// block at BASELINE_FLASH_BASE.
+constexpr uint32_t BASELINE_FLASH_BASE = 0x010000;
+
+// Hold "Refresh" this long (in ms) to capture a new baseline from the current scan. In
+// SURVEY_MODE the button is "Mark", where a 2 s hold exports the survey, so it takes longer.
+#ifdef SURVEY_MODE
+constexpr uint32_t BASELINE_CAPTURE_HOLD_MILLIS = 5000;
+#else
+constexpr uint32_t BASELINE_CAPTURE_HOLD_MILLIS = 2000;
+#endif
+
+// Number of stations of each ApStatus in the most recent scan.
+struct RogueScanCounts {
+  uint16_t known;
+  uint16_t newAps;
+  uint16_t newCleanChannel;
+  uint16_t rogue;
+};
+
+// Load the baseline saved in flash. Returns false if there is none.
+extern bool rogueWatchBegin();
+// True if a baseline has been loaded or captured.
+extern bool rogueWatchHasBaseline();
+extern const ApBaseline &rogueWatchBaseline();
+
+// Check each station of a scan: call rogueWatchStartScan(), then rogueWatchCheck() for each
+// station. With no baseline, every station is AP_KNOWN.
+extern void rogueWatchStartScan();
+extern ApStatus rogueWatchCheck(const wifi_ap_record_t *pWifiAPRecord);
+extern const RogueScanCounts &rogueWatchCounts();
+
+// Replace the baseline with the stations of a scan: call rogueWatchCaptureStart(), then
+// rogueWatchCaptureStation() for each station, then rogueWatchCaptureFinish() to save it to
+// flash. Returns false if it couldn't be saved (it's still used until the next boot).
+extern void rogueWatchCaptureStart();
+extern void rogueWatchCaptureStation(const wifi_ap_record_t *pWifiAPRecord);
+extern bool rogueWatchCaptureFinish();
+
+#endif
@@ -0,0 +1,70 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Draw a station's recent RSSI. See rssi-sparkline.h.
+
+#include "wifi-scanner.h"
+
+// Same dBm scale as the heatmap power bars.
+static constexpr int SPARK_MAX_DBM = -25;
+static constexpr int SPARK_MIN_DBM = -90;
+
+// Stored in place of a sample when the station wasn't heard.
+static constexpr int8_t SPARK_NOT_HEARD = INT8_MIN;
+
+void RssiSparkline::addSample(int rssi, bool heard) {
+  _samples[_next] = heard ? max(rssi, SPARK_NOT_HEARD + 1) : SPARK_NOT_HEARD;
+  _next = (_next + 1) % RSSI_SPARKLINE_LEN;
+  if (_count < RSSI_SPARKLINE_LEN) {
+    _count++;
+  }
+}
+
+// Bar color by signal strength.
+static uint16_t sparkColor(int rssi) {
+  if (rssi >= -60) {
+    return TFT_GREEN;
+  } else if (rssi >= -75) {
+    return TFT_YELLOW;
+  } else {
+    return TFT_ORANGE;
+  }
+}
+
+void RssiSparkline::render(TFT_eSPI &lcd, uint32_t renderFlags) {
+  drawBackground(lcd, renderFlags);
+  drawBorder(lcd, renderFlags);
+
+  int16_t childX, childY, childW, childH;
+  getChildAreaBoundingBox(childX, childY, childW, childH);
+
+  int plotH = childH - 2; // Leave 2 px at the bottom for not-heard ticks.
+  int baseY = childY + plotH;
+  lcd.drawFastHLine(childX, baseY, childW, TFT_DARKGREY);
+
+  int colWidth = max(childW / static_cast<int>(RSSI_SPARKLINE_LEN), 1);
+  for (size_t i = 0; i < _count; i++) {
+    // Sample i counts back from the newest, at the right edge.
+    int8_t sample = _samples[(_next + RSSI_SPARKLINE_LEN - 1 - i) % RSSI_SPARKLINE_LEN];
+    int x = childX + childW - (i + 1) * childW / RSSI_SPARKLINE_LEN;
+    if (sample == SPARK_NOT_HEARD) {
+      lcd.fillRect(x, baseY, colWidth, 2, TFT_RED);
+      continue;
+    }
+
+    int clamped = min(SPARK_MAX_DBM, max(static_cast<int>(sample), SPARK_MIN_DBM));
+    int barH = plotH * (clamped - SPARK_MIN_DBM) / (SPARK_MAX_DBM - SPARK_MIN_DBM);
+    lcd.fillRect(x, baseY - barH, colWidth, barH, sparkColor(sample));
+  }
+}
+
+int16_t RssiSparkline::getContentWidth(TFT_eSPI &lcd) const {
+  int16_t cx, cy, cw, ch;
+  getChildAreaBoundingBox(cx, cy, cw, ch);
+  return cw;
+}
+
+int16_t RssiSparkline::getContentHeight(TFT_eSPI &lcd) const {
+  int16_t cx, cy, cw, ch;
+  getChildAreaBoundingBox(cx, cy, cw, ch);
+  return ch;
+}
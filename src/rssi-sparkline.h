@@ -0,0 +1,34 @@
+// (c) Copyright 2022 Aaron Kimball
+
+#ifndef _RSSI_SPARKLINE_H
+#define _RSSI_SPARKLINE_H
+
+#include <uiwidgets.h>
+
+// Number of samples shown; the oldest scrolls off the left edge.
+constexpr size_t RSSI_SPARKLINE_LEN = 100;
+
+// Plots the most recent RSSI samples of one station as a bar per sample, newest at the right.
+// Samples where the station wasn't heard are marked with a red tick on the baseline.
+class RssiSparkline : public UIWidget {
+public:
+  RssiSparkline(): UIWidget(), _next(0), _count(0) { };
+
+  virtual void render(TFT_eSPI &lcd, uint32_t renderFlags);
+  virtual int16_t getContentWidth(TFT_eSPI &lcd) const;
+  virtual int16_t getContentHeight(TFT_eSPI &lcd) const;
+  virtual bool redrawChildWidget(UIWidget *widget, TFT_eSPI &lcd, uint32_t renderFlags=0) {
+    return widget == this ? render(lcd, renderFlags), true : false;
+  };
+
+  // Add the next sample: an RSSI in dBm, or `heard`=false if the station wasn't heard.
+  void addSample(int rssi, bool heard);
+  void clear() { _next = 0; _count = 0; };
+
+private:
+  int8_t _samples[RSSI_SPARKLINE_LEN];
+  size_t _next;  // Ring index of the next sample to write.
+  size_t _count; // Valid samples in the ring.
+};
+
+#endif
@@ -0,0 +1,82 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Local copy of the last scan's results. See scan-cache.h.
+
+#include <type_traits>
+#include <utility>
+
+#include "wifi-scanner.h"
+
+// The channel-at-a-time scans (SCAN_SCHEDULER, MULTI_PASS_SCAN and the tracking page) call
+// WiFi.scanNetworks(async, show_hidden, passive, max_ms_per_chan, channel). An rpcWiFi without
+// the last two arguments would otherwise fail in confusing ways, or (with a differently-typed
+// overload) quietly scan the whole band; refuse to build against it.
+template<typename W, typename = void>
+struct HasChannelScan : std::false_type { };
+template<typename W>
+struct HasChannelScan<W, decltype((void)std::declval<W&>().scanNetworks(
+    false, false, false, static_cast<uint32_t>(0), static_cast<uint8_t>(0)))>
+    : std::true_type { };
+static_assert(HasChannelScan<decltype(WiFi)>::value,
+    "rpcWiFi must provide scanNetworks(async, show_hidden, passive, max_ms_per_chan, channel)");
+
+static wifi_ap_record_t cacheRecords[SCAN_MAX_NUMBER];
+static const wifi_ap_record_t emptyRecord = {};
+static int numCached = 0;
+static ScanCacheStats cacheStats;
+
+static uint32_t actionRpcStart = 0;
+static uint32_t actionReadsStart = 0;
+
+int scanCacheFetch(int n) {
+  // rpcWiFi has no bulk getter; fetch each record exactly once.
+  numCached = 0;
+  uint32_t rpcBefore = cacheStats.rpcCalls;
+  for (int i = 0; i < n && i < SCAN_MAX_NUMBER; i++) {
+    const wifi_ap_record_t *pWifiAPRecord =
+        reinterpret_cast<const wifi_ap_record_t*>(WiFi.getScanInfoByIndex(i));
+    cacheStats.rpcCalls++;
+    if (pWifiAPRecord == NULL) {
+      break;
+    }
+
+    cacheRecords[numCached++] = *pWifiAPRecord;
+  }
+
+  cacheStats.lastFetchRpcCalls = cacheStats.rpcCalls - rpcBefore;
+  return numCached;
+}
+
+const wifi_ap_record_t *scanCacheRecord(size_t wifiIdx) {
+  cacheStats.cachedReads++;
+  if (wifiIdx >= static_cast<size_t>(numCached)) {
+    return &emptyRecord;
+  }
+
+  return &cacheRecords[wifiIdx];
+}
+
+void scanCacheCountRpc(uint32_t calls) {
+  cacheStats.rpcCalls += calls;
+}
+
+const ScanCacheStats &scanCacheStats() {
+  return cacheStats;
+}
+
+void scanCacheBeginAction() {
+  actionRpcStart = cacheStats.rpcCalls;
+  actionReadsStart = cacheStats.cachedReads;
+}
+
+bool scanCacheEndAction() {
+  uint32_t rpcCalls = cacheStats.rpcCalls - actionRpcStart;
+  uint32_t cachedReads = cacheStats.cachedReads - actionReadsStart;
+  if (rpcCalls == 0 && cachedReads == 0) {
+    return false;
+  }
+
+  cacheStats.lastActionRpcCalls = rpcCalls;
+  cacheStats.lastActionCachedReads = cachedReads;
+  return true;
+}
@@ -0,0 +1,32 @@
+// (c) Copyright 2022 Aaron Kimball
+
+#ifndef _SCAN_CACHE_H
+#define _SCAN_CACHE_H
+
+// Every rpcWiFi call is a round trip over the eRPC link to the RTL8721D. After each plain
+// WiFi.scanNetworks(), its results are copied into a local array once, and every consumer reads
+// the copies through getScanRecord(). The RPC calls we make are counted here.
+
+struct ScanCacheStats {
+  uint32_t rpcCalls;          // RPC calls made, total.
+  uint32_t cachedReads;       // Records read from the cache, total.
+  uint32_t lastFetchRpcCalls; // RPC calls to fetch the last scan's records.
+  uint32_t lastActionRpcCalls;    // RPC calls made by the last user action...
+  uint32_t lastActionCachedReads; // ...and the records it read from the cache instead.
+};
+
+// Copy the `n` results of the last scan into the cache. Returns the number cached.
+extern int scanCacheFetch(int n);
+// Return cached record `wifiIdx`; an all-zero record if the last scan had no such station.
+extern const wifi_ap_record_t *scanCacheRecord(size_t wifiIdx);
+
+// Count RPC calls made outside the cache (scans, radio mode changes, ...).
+extern void scanCacheCountRpc(uint32_t calls=1);
+extern const ScanCacheStats &scanCacheStats();
+
+// Bracket the handling of a user action (a button press) to count the RPC calls it makes.
+// scanCacheEndAction() returns true if the action made any RPC calls or read any records.
+extern void scanCacheBeginAction();
+extern bool scanCacheEndAction();
+
+#endif
@@ -0,0 +1,118 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Encoder / decoder for the binary scan log format. See scan-log-format.h.
+// (Portable; no Arduino dependencies.)
+
+#include <string.h>
+
+#include "scan-log-format.h"
+
+static const uint8_t SCAN_LOG_MAGIC[4] = { 'W', 'S', 'C', 'N' };
+
+static inline void putU16(uint8_t *buf, uint16_t val) {
+  buf[0] = val & 0xFF;
+  buf[1] = (val >> 8) & 0xFF;
+}
+
+static inline void putU32(uint8_t *buf, uint32_t val) {
+  buf[0] = val & 0xFF;
+  buf[1] = (val >> 8) & 0xFF;
+  buf[2] = (val >> 16) & 0xFF;
+  buf[3] = (val >> 24) & 0xFF;
+}
+
+static inline uint16_t getU16(const uint8_t *buf) {
+  return buf[0] | (buf[1] << 8);
+}
+
+static inline uint32_t getU32(const uint8_t *buf) {
+  return buf[0] | (buf[1] << 8) | (buf[2] << 16) | (static_cast<uint32_t>(buf[3]) << 24);
+}
+
+size_t scanLogEncodeHeader(uint8_t *buf) {
+  memcpy(buf, SCAN_LOG_MAGIC, sizeof(SCAN_LOG_MAGIC));
+  buf[4] = SCAN_LOG_VERSION;
+  buf[5] = SCAN_LOG_HEADER_LEN;
+  buf[6] = 0;
+  buf[7] = 0;
+  return SCAN_LOG_HEADER_LEN;
+}
+
+size_t scanLogDecodeHeader(const uint8_t *buf, size_t len) {
+  if (len < SCAN_LOG_HEADER_LEN || memcmp(buf, SCAN_LOG_MAGIC, sizeof(SCAN_LOG_MAGIC)) != 0) {
+    return 0;
+  }
+
+  if (buf[4] > SCAN_LOG_VERSION || buf[5] < SCAN_LOG_HEADER_LEN) {
+    return 0; // Written by a newer, incompatible version.
+  }
+
+  return buf[5];
+}
+
+size_t scanLogEncodeBlockPrefix(uint8_t *buf, uint32_t timestamp, uint8_t count,
+    size_t entriesLen) {
+  // The length field counts everything after itself.
+  putU16(buf, SCAN_LOG_BLOCK_PREFIX_LEN - 2 + entriesLen);
+  putU32(buf + 2, timestamp);
+  buf[6] = count;
+  return SCAN_LOG_BLOCK_PREFIX_LEN;
+}
+
+size_t scanLogDecodeBlockPrefix(const uint8_t *buf, size_t len, size_t &blockLen,
+    uint32_t &timestamp, uint8_t &count) {
+  if (len < SCAN_LOG_BLOCK_PREFIX_LEN) {
+    return 0;
+  }
+
+  blockLen = getU16(buf) + 2;
+  timestamp = getU32(buf + 2);
+  count = buf[6];
+  return SCAN_LOG_BLOCK_PREFIX_LEN;
+}
+
+size_t scanLogEncodeStation(uint8_t *buf, const ScanLogStation &station) {
+  uint8_t ssidLen = station.ssidLen;
+  if (ssidLen > SCAN_LOG_SSID_MAX_LEN) {
+    ssidLen = SCAN_LOG_SSID_MAX_LEN;
+  }
+
+  buf[0] = SCAN_LOG_ENTRY_FIXED_LEN - 1 + ssidLen;
+  memcpy(buf + 1, station.bssid, 6);
+  buf[7] = station.primary;
+  buf[8] = station.second;
+  buf[9] = static_cast<uint8_t>(station.rssi);
+  buf[10] = station.authmode;
+  buf[11] = station.phyFlags;
+  buf[12] = ssidLen;
+  memcpy(buf + SCAN_LOG_ENTRY_FIXED_LEN, station.ssid, ssidLen);
+  return SCAN_LOG_ENTRY_FIXED_LEN + ssidLen;
+}
+
+size_t scanLogDecodeStation(const uint8_t *buf, size_t len, ScanLogStation &station) {
+  if (len < 1) {
+    return 0;
+  }
+
+  size_t entryLen = buf[0] + 1;
+  if (entryLen > len || entryLen < SCAN_LOG_ENTRY_FIXED_LEN) {
+    return 0;
+  }
+
+  memcpy(station.bssid, buf + 1, 6);
+  station.primary = buf[7];
+  station.second = buf[8];
+  station.rssi = static_cast<int8_t>(buf[9]);
+  station.authmode = buf[10];
+  station.phyFlags = buf[11];
+  station.ssidLen = buf[12];
+  if (station.ssidLen > SCAN_LOG_SSID_MAX_LEN
+      || SCAN_LOG_ENTRY_FIXED_LEN + station.ssidLen > entryLen) {
+    return 0;
+  }
+
+  memcpy(station.ssid, buf + SCAN_LOG_ENTRY_FIXED_LEN, station.ssidLen);
+  station.ssid[station.ssidLen] = '\0';
+
+  return entryLen; // Skips any trailing fields added by a newer format version.
+}
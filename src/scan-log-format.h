@@ -0,0 +1,86 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Binary format for recorded scan results. This header has no Arduino dependencies so that
+// the same codec can be compiled for host-side tools.
+//
+// All multi-byte integers are little-endian. A log file is:
+//
+//   File header (SCAN_LOG_HEADER_LEN bytes):
+//     char[4]  magic = "WSCN"
+//     u8       format version (SCAN_LOG_VERSION)
+//     u8       header length in bytes (readers skip any bytes past what they understand)
+//     u8[2]    reserved (0)
+//
+//   Followed by any number of scan blocks:
+//     u16      block length; number of bytes that follow in this block
+//     u32      timestamp of the scan in milliseconds since boot
+//     u8       number of station entries
+//     entry[]  station entries, each:
+//       u8       entry length; number of bytes that follow in this entry
+//       u8[6]    bssid
+//       u8       primary channel
+//       u8       secondary channel (wifi_second_chan_t)
+//       i8       rssi (dBm)
+//       u8       authmode (wifi_auth_mode_t)
+//       u8       phy flags (SCAN_LOG_PHY_*)
+//       u8       ssid length (0..32)
+//       char[]   ssid (not NUL-terminated)
+//
+// Entries and blocks are length-prefixed so that future versions may append fields; older
+// readers skip over anything they don't recognize.
+
+#ifndef _SCAN_LOG_FORMAT_H
+#define _SCAN_LOG_FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+constexpr uint8_t SCAN_LOG_VERSION = 1;
+constexpr size_t SCAN_LOG_HEADER_LEN = 8;
+constexpr size_t SCAN_LOG_SSID_MAX_LEN = 32;
+
+// Fixed-size prefix of a scan block (length, timestamp, count).
+constexpr size_t SCAN_LOG_BLOCK_PREFIX_LEN = 7;
+// Fixed-size portion of a station entry (length byte through ssid length byte).
+constexpr size_t SCAN_LOG_ENTRY_FIXED_LEN = 13;
+constexpr size_t SCAN_LOG_ENTRY_MAX_LEN = SCAN_LOG_ENTRY_FIXED_LEN + SCAN_LOG_SSID_MAX_LEN;
+
+constexpr uint8_t SCAN_LOG_PHY_11B = 0x01;
+constexpr uint8_t SCAN_LOG_PHY_11G = 0x02;
+constexpr uint8_t SCAN_LOG_PHY_11N = 0x04;
+constexpr uint8_t SCAN_LOG_PHY_LR  = 0x08;
+constexpr uint8_t SCAN_LOG_PHY_WPS = 0x10;
+
+// A station record, trimmed to the fields the scanner uses.
+struct ScanLogStation {
+  uint8_t bssid[6];
+  uint8_t primary;
+  uint8_t second;
+  int8_t rssi;
+  uint8_t authmode;
+  uint8_t phyFlags;
+  uint8_t ssidLen;
+  char ssid[SCAN_LOG_SSID_MAX_LEN + 1]; // NUL-terminated.
+};
+
+// Write the file header into `buf` (at least SCAN_LOG_HEADER_LEN bytes). Returns bytes written.
+extern size_t scanLogEncodeHeader(uint8_t *buf);
+// Validate a file header. Returns the header length to skip, or 0 if this is not a scan log
+// this reader understands.
+extern size_t scanLogDecodeHeader(const uint8_t *buf, size_t len);
+
+// Encode a block prefix for a scan of `count` stations whose entries total `entriesLen` bytes.
+extern size_t scanLogEncodeBlockPrefix(uint8_t *buf, uint32_t timestamp, uint8_t count,
+    size_t entriesLen);
+// Decode a block prefix. Returns SCAN_LOG_BLOCK_PREFIX_LEN on success or 0 if `len` is too
+// short. `blockLen` is the total size of the block, including its u16 length field.
+extern size_t scanLogDecodeBlockPrefix(const uint8_t *buf, size_t len, size_t &blockLen,
+    uint32_t &timestamp, uint8_t &count);
+
+// Encode one station entry into `buf` (at least SCAN_LOG_ENTRY_MAX_LEN bytes).
+// Returns bytes written.
+extern size_t scanLogEncodeStation(uint8_t *buf, const ScanLogStation &station);
+// Decode one station entry from `buf`. Returns bytes consumed or 0 if malformed.
+extern size_t scanLogDecodeStation(const uint8_t *buf, size_t len, ScanLogStation &station);
+
+#endif
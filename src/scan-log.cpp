@@ -0,0 +1,203 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Record raw scan results to the SD card, and replay them in place of a live scan.
+
+#include <SD/Seeed_SD.h>
+
+#include "wifi-scanner.h"
+
+// Write-behind logger for recorded scans.
+static SdLogger scanLogger;
+
+// Holds one encoded scan block; large enough for a full station table of max-length SSIDs.
+static constexpr size_t SCAN_LOG_BLOCK_MAX_LEN =
+    SCAN_LOG_BLOCK_PREFIX_LEN + MAX_STATIONS * SCAN_LOG_ENTRY_MAX_LEN;
+static_assert(SCAN_LOG_BLOCK_MAX_LEN <= UINT16_MAX, "scan block length must fit its u16 field");
+static uint8_t logBlockBuf[SCAN_LOG_BLOCK_MAX_LEN];
+
+// Header written at the start of each recorded log file.
+static uint8_t logFileHeader[SCAN_LOG_HEADER_LEN];
+
+// Recording state for the scan currently being assembled.
+static uint32_t recordTimestamp = 0;
+static size_t recordEntriesLen = 0;
+static uint8_t recordCount = 0;
+
+// Replay state.
+static File replayFile;
+static size_t replayHeaderLen = 0;
+static wifi_ap_record_t replayRecords[MAX_STATIONS];
+
+void scanLogStationFromAPRecord(const wifi_ap_record_t *pWifiAPRecord, ScanLogStation &station) {
+  memcpy(station.bssid, pWifiAPRecord->bssid, 6);
+  station.primary = pWifiAPRecord->primary;
+  station.second = pWifiAPRecord->second;
+  station.rssi = pWifiAPRecord->rssi;
+  station.authmode = pWifiAPRecord->authmode;
+  station.phyFlags = (pWifiAPRecord->phy_11b ? SCAN_LOG_PHY_11B : 0)
+      | (pWifiAPRecord->phy_11g ? SCAN_LOG_PHY_11G : 0)
+      | (pWifiAPRecord->phy_11n ? SCAN_LOG_PHY_11N : 0)
+      | (pWifiAPRecord->phy_lr ? SCAN_LOG_PHY_LR : 0)
+      | (pWifiAPRecord->wps ? SCAN_LOG_PHY_WPS : 0);
+  const char *ssid = reinterpret_cast<const char*>(pWifiAPRecord->ssid);
+  station.ssidLen = strnlen(ssid, SCAN_LOG_SSID_MAX_LEN);
+  memcpy(station.ssid, ssid, station.ssidLen);
+  station.ssid[station.ssidLen] = '\0';
+}
+
+void scanLogStationToAPRecord(const ScanLogStation &station, wifi_ap_record_t *pWifiAPRecord) {
+  memset(pWifiAPRecord, 0, sizeof(wifi_ap_record_t));
+  memcpy(pWifiAPRecord->bssid, station.bssid, 6);
+  memcpy(pWifiAPRecord->ssid, station.ssid, station.ssidLen);
+  pWifiAPRecord->ssid[station.ssidLen] = '\0';
+  pWifiAPRecord->primary = station.primary;
+  pWifiAPRecord->second = static_cast<wifi_second_chan_t>(station.second);
+  pWifiAPRecord->rssi = station.rssi;
+  pWifiAPRecord->authmode = static_cast<wifi_auth_mode_t>(station.authmode);
+  pWifiAPRecord->phy_11b = (station.phyFlags & SCAN_LOG_PHY_11B) != 0;
+  pWifiAPRecord->phy_11g = (station.phyFlags & SCAN_LOG_PHY_11G) != 0;
+  pWifiAPRecord->phy_11n = (station.phyFlags & SCAN_LOG_PHY_11N) != 0;
+  pWifiAPRecord->phy_lr = (station.phyFlags & SCAN_LOG_PHY_LR) != 0;
+  pWifiAPRecord->wps = (station.phyFlags & SCAN_LOG_PHY_WPS) != 0;
+}
+
+
+////////    Recording    ////////
+
+bool scanLogRecordBegin() {
+  size_t headerLen = scanLogEncodeHeader(logFileHeader);
+  return scanLogger.begin(SCAN_LOG_PREFIX, SCAN_LOG_SUFFIX, logFileHeader, headerLen);
+}
+
+void scanLogPoll() {
+  scanLogger.poll();
+}
+
+const SdLogStats &scanLogStats() {
+  return scanLogger.stats();
+}
+
+void scanLogStartScan(uint32_t timestamp) {
+  recordTimestamp = timestamp;
+  recordEntriesLen = 0;
+  recordCount = 0;
+}
+
+void scanLogAddStation(const wifi_ap_record_t *pWifiAPRecord) {
+  if (recordCount >= MAX_STATIONS) {
+    return;
+  }
+
+  ScanLogStation station;
+  scanLogStationFromAPRecord(pWifiAPRecord, station);
+  // Entries are encoded after the space reserved for the block prefix.
+  recordEntriesLen += scanLogEncodeStation(
+      logBlockBuf + SCAN_LOG_BLOCK_PREFIX_LEN + recordEntriesLen, station);
+  recordCount++;
+}
+
+bool scanLogFinishScan() {
+  // While the card is behind, log every other scan, so the ring drains instead of filling up
+  // and dropping whatever scan arrives next.
+  static bool shedLast = false;
+  if (scanLogger.backpressure() && !shedLast) {
+    scanLogger.shed();
+    shedLast = true;
+    return false;
+  }
+  shedLast = false;
+
+  scanLogEncodeBlockPrefix(logBlockBuf, recordTimestamp, recordCount, recordEntriesLen);
+
+  // Queued in RAM; scanLogPoll() writes it to the card later from loop().
+  return scanLogger.append(logBlockBuf, SCAN_LOG_BLOCK_PREFIX_LEN + recordEntriesLen);
+}
+
+
+////////    Replay    ////////
+
+bool scanLogReplayOpen() {
+  if (!sdCardAvailable()) {
+    return false;
+  }
+
+  replayFile = SD.open(SCAN_REPLAY_PATH, FILE_READ);
+  if (!replayFile) {
+    DBGPRINT("No replay log found");
+    return false;
+  }
+
+  uint8_t header[SCAN_LOG_HEADER_LEN];
+  int headerRead = replayFile.read(header, SCAN_LOG_HEADER_LEN);
+  replayHeaderLen = headerRead < 0 ? 0 : scanLogDecodeHeader(header, headerRead);
+  if (replayHeaderLen == 0) {
+    DBGPRINT("Replay log has unrecognized header");
+    replayFile.close();
+    return false;
+  }
+
+  replayFile.seek(replayHeaderLen);
+  return true;
+}
+
+// Read one block from the replay file into logBlockBuf. Returns the block length, or 0 at EOF
+// or on a truncated block.
+static size_t readReplayBlock() {
+  if (replayFile.read(logBlockBuf, 2) != 2) {
+    return 0;
+  }
+
+  size_t blockLen = (logBlockBuf[0] | (logBlockBuf[1] << 8)) + 2;
+  if (blockLen < SCAN_LOG_BLOCK_PREFIX_LEN || blockLen > SCAN_LOG_BLOCK_MAX_LEN) {
+    return 0;
+  }
+
+  size_t remaining = blockLen - 2;
+  if (replayFile.read(logBlockBuf + 2, remaining) != static_cast<int>(remaining)) {
+    return 0;
+  }
+
+  return blockLen;
+}
+
+int scanLogReplayNext() {
+  if (!replayFile) {
+    return -1;
+  }
+
+  size_t blockLen = readReplayBlock();
+  if (blockLen == 0) {
+    // End of the recording; loop back around to the first scan.
+    replayFile.seek(replayHeaderLen);
+    blockLen = readReplayBlock();
+    if (blockLen == 0) {
+      return -1; // Empty or corrupt log.
+    }
+  }
+
+  size_t fullBlockLen;
+  uint32_t timestamp;
+  uint8_t count;
+  scanLogDecodeBlockPrefix(logBlockBuf, blockLen, fullBlockLen, timestamp, count);
+
+  memset(replayRecords, 0, sizeof(replayRecords));
+  size_t pos = SCAN_LOG_BLOCK_PREFIX_LEN;
+  int n = 0;
+  for (uint8_t i = 0; i < count && n < static_cast<int>(MAX_STATIONS); i++) {
+    ScanLogStation station;
+    size_t consumed = scanLogDecodeStation(logBlockBuf + pos, blockLen - pos, station);
+    if (consumed == 0) {
+      DBGPRINT("Malformed station entry in replay log");
+      break;
+    }
+
+    scanLogStationToAPRecord(station, &replayRecords[n++]);
+    pos += consumed;
+  }
+
+  return n;
+}
+
+const wifi_ap_record_t *scanLogReplayRecord(size_t wifiIdx) {
+  return &replayRecords[wifiIdx];
+}
@@ -0,0 +1,43 @@
+// (c) Copyright 2022 Aaron Kimball
+
+#ifndef _SCAN_LOG_H
+#define _SCAN_LOG_H
+
+#include "scan-log-format.h"
+#include "sd-logger.h"
+
+// Scans are appended to files named /scansNNNN.wsl when SCAN_LOG_RECORD is defined; a new file
+// is started periodically (see sd-logger.h).
+#define SCAN_LOG_PREFIX "/scans"
+#define SCAN_LOG_SUFFIX ".wsl"
+// Scans are read from here when SCAN_LOG_REPLAY is defined.
+#define SCAN_REPLAY_PATH "/replay.wsl"
+
+// Convert between the radio's scan record and the trimmed record stored in the log.
+extern void scanLogStationFromAPRecord(const wifi_ap_record_t *pWifiAPRecord,
+    ScanLogStation &station);
+extern void scanLogStationToAPRecord(const ScanLogStation &station,
+    wifi_ap_record_t *pWifiAPRecord);
+
+// Start the write-behind SD logger for recording scans. Call after sdCardBegin().
+extern bool scanLogRecordBegin();
+// Write queued scans to the card. Call from loop().
+extern void scanLogPoll();
+extern const SdLogStats &scanLogStats();
+
+// Record a scan: call scanLogStartScan(), then scanLogAddStation() for each station, then
+// scanLogFinishScan() to queue the block for the SD log. Returns false if it was dropped, or
+// skipped because the card is falling behind (every other scan, under backpressure).
+extern void scanLogStartScan(uint32_t timestamp);
+extern void scanLogAddStation(const wifi_ap_record_t *pWifiAPRecord);
+extern bool scanLogFinishScan();
+
+// Open SCAN_REPLAY_PATH for replay. Returns false if it's missing or not a scan log.
+extern bool scanLogReplayOpen();
+// Load the next recorded scan, wrapping around to the first scan at end of file. Returns the
+// number of stations in the scan or -1 on error.
+extern int scanLogReplayNext();
+// Return a station record from the most recently replayed scan.
+extern const wifi_ap_record_t *scanLogReplayRecord(size_t wifiIdx);
+
+#endif
@@ -0,0 +1,95 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Sweep the band plan one channel at a time with adaptive dwell times. See scan-sweep.h.
+
+#include "wifi-scanner.h"
+
+static DwellScheduler dwellScheduler;
+static ScanSweepStats sweepStats;
+
+// Stations from the most recent sweep.
+static wifi_ap_record_t sweepRecords[SCAN_MAX_NUMBER];
+static int numSweepRecords = 0;
+
+void scanSweepDefineChannel(int channelNum) {
+  dwellScheduler.defineChannel(channelNum);
+}
+
+// Find a station already in this sweep's table, or -1.
+static int findSweepRecord(const uint8_t *bssid) {
+  for (int i = 0; i < numSweepRecords; i++) {
+    if (memcmp(sweepRecords[i].bssid, bssid, sizeof(sweepRecords[i].bssid)) == 0) {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+// Merge the results of a single-channel scan into the sweep table. Returns the number of them
+// whose primary channel is `channelNum`.
+static unsigned int mergeChannelResults(int numResults, int channelNum) {
+  unsigned int onChannel = 0;
+  for (int i = 0; i < numResults; i++) {
+    const wifi_ap_record_t *pWifiAPRecord =
+        reinterpret_cast<const wifi_ap_record_t*>(WiFi.getScanInfoByIndex(i));
+    scanCacheCountRpc();
+    if (pWifiAPRecord == NULL) {
+      continue;
+    }
+
+    if (pWifiAPRecord->primary == channelNum) {
+      onChannel++;
+    }
+
+    // On 2.4 GHz, a station can be heard from the neighboring channels too; keep the strongest
+    // reading.
+    int existing = findSweepRecord(pWifiAPRecord->bssid);
+    if (existing >= 0) {
+      sweepStats.lastDuplicates++;
+      if (pWifiAPRecord->rssi > sweepRecords[existing].rssi) {
+        sweepRecords[existing] = *pWifiAPRecord;
+      }
+    } else if (numSweepRecords < SCAN_MAX_NUMBER) {
+      sweepRecords[numSweepRecords++] = *pWifiAPRecord;
+    }
+  }
+
+  return onChannel;
+}
+
+int scanSweepRun() {
+  uint32_t sweepStart = millis();
+  memset(sweepRecords, 0, sizeof(sweepRecords));
+  numSweepRecords = 0;
+  sweepStats.lastDuplicates = 0;
+
+  dwellScheduler.beginSweep();
+  for (size_t i = 0; i < dwellScheduler.numChannels(); i++) {
+    const ChannelDwell &dwell = dwellScheduler.plan(i);
+    uint32_t chanStart = traceTicks();
+    int n = WiFi.scanNetworks(false, false, dwell.passive, dwell.dwellMs, dwell.channel);
+    scanCacheCountRpc();
+    traceRecord(TRACE_CHANNEL_SCAN, chanStart, dwell.channel);
+    if (n < 0) {
+      DBGPRINTI("Channel scan failed:", dwell.channel);
+      continue;
+    }
+
+    dwellScheduler.recordChannel(i, mergeChannelResults(n, dwell.channel));
+  }
+
+  sweepStats.sweeps++;
+  sweepStats.lastSweepMillis = millis() - sweepStart;
+  sweepStats.lastPlannedMillis = dwellScheduler.plannedMs();
+  sweepStats.lastFullSweep = dwellScheduler.isFullSweep();
+  return numSweepRecords;
+}
+
+const wifi_ap_record_t *scanSweepRecord(size_t wifiIdx) {
+  return &sweepRecords[wifiIdx];
+}
+
+const ScanSweepStats &scanSweepStats() {
+  return sweepStats;
+}
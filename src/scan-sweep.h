@@ -0,0 +1,28 @@
+// (c) Copyright 2022 Aaron Kimball
+
+#ifndef _SCAN_SWEEP_H
+#define _SCAN_SWEEP_H
+
+#include "dwell-scheduler.h"
+
+// When SCAN_SCHEDULER is defined, each scan is a sweep of per-channel scans, with the dwell time
+// and active/passive mode of each channel planned by a DwellScheduler from recent occupancy.
+// The per-channel results are merged into one station table, deduplicated by BSSID.
+
+struct ScanSweepStats {
+  uint32_t sweeps;
+  uint32_t lastSweepMillis;   // Wall time for the last sweep, including per-call overhead.
+  uint32_t lastPlannedMillis; // Sum of the dwell times planned for the last sweep.
+  uint32_t lastDuplicates;    // Stations heard on more than one channel in the last sweep.
+  bool lastFullSweep;
+};
+
+// Add a channel to the sweep. Call for each channel in the band plan, in scan order.
+extern void scanSweepDefineChannel(int channelNum);
+// Sweep all channels. Returns the number of stations found.
+extern int scanSweepRun();
+// Return a station record from the most recent sweep.
+extern const wifi_ap_record_t *scanSweepRecord(size_t wifiIdx);
+extern const ScanSweepStats &scanSweepStats();
+
+#endif
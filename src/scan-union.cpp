@@ -0,0 +1,79 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Merge single-channel scans into a station table larger than one scan's limit.
+// See scan-union.h.
+
+#include "wifi-scanner.h"
+
+static StationTable unionTable;
+static ScanUnionStats unionStats;
+
+static constexpr size_t UNION_MAX_CHANNELS = 64;
+static int unionChannels[UNION_MAX_CHANNELS];
+static size_t numUnionChannels = 0;
+
+void scanUnionDefineChannel(int channelNum) {
+  if (numUnionChannels < UNION_MAX_CHANNELS) {
+    unionChannels[numUnionChannels++] = channelNum;
+  }
+}
+
+int scanUnionRun() {
+  uint32_t passStart = millis();
+  // Passes are numbered from 1, so that a pass number of 0 in the table is never current.
+  uint32_t pass = ++unionStats.passes;
+  size_t sizeBefore = unionTable.size();
+  unionStats.lastCapped = 0;
+
+  for (size_t c = 0; c < numUnionChannels; c++) {
+    int channelNum = unionChannels[c];
+    uint32_t chanStart = traceTicks();
+    // Active scan for the radio's full default dwell, so the pass hears as much as a full scan.
+    int n = WiFi.scanNetworks(false, false, false, DWELL_FULL_MS, channelNum);
+    scanCacheCountRpc();
+    traceRecord(TRACE_CHANNEL_SCAN, chanStart, channelNum);
+    if (n < 0) {
+      DBGPRINTI("Channel scan failed:", channelNum);
+      continue;
+    }
+    if (n >= SCAN_MAX_NUMBER) {
+      unionStats.lastCapped++; // Even one channel is more crowded than a scan can report.
+    }
+
+    for (int i = 0; i < n; i++) {
+      const wifi_ap_record_t *pWifiAPRecord =
+          reinterpret_cast<const wifi_ap_record_t*>(WiFi.getScanInfoByIndex(i));
+      scanCacheCountRpc();
+      if (pWifiAPRecord == NULL) {
+        continue;
+      }
+
+      // On 2.4 GHz, a station is also heard from the neighboring channels, more weakly.
+      if (!unionTable.update(pWifiAPRecord, pass, pWifiAPRecord->primary == channelNum)) {
+        unionStats.tableFull++;
+      }
+    }
+  }
+
+  unionStats.lastNew = unionTable.size() - sizeBefore;
+  unionStats.lastHeard = 0;
+  for (size_t i = 0; i < unionTable.size(); i++) {
+    if (unionTable.lastPass(i) == pass) {
+      unionStats.lastHeard++;
+    }
+  }
+
+  // Drop the stations missed by each of the last SCAN_UNION_MAX_AGE_PASSES passes.
+  unionStats.lastExpired = pass > SCAN_UNION_MAX_AGE_PASSES
+      ? unionTable.expire(pass - SCAN_UNION_MAX_AGE_PASSES + 1) : 0;
+  unionStats.lastPassMillis = millis() - passStart;
+  return unionTable.size();
+}
+
+const wifi_ap_record_t *scanUnionRecord(size_t wifiIdx) {
+  return unionTable.record(wifiIdx);
+}
+
+const ScanUnionStats &scanUnionStats() {
+  return unionStats;
+}
@@ -0,0 +1,30 @@
+// (c) Copyright 2022 Aaron Kimball
+
+#ifndef _SCAN_UNION_H
+#define _SCAN_UNION_H
+
+// When MULTI_PASS_SCAN is defined, each scan is a pass of single-channel scans over the band
+// plan, so no one scanNetworks() call has to return every station in range. Results are merged
+// into a StationTable that persists across passes: each station keeps its freshest reading, and
+// is dropped once it hasn't been heard for SCAN_UNION_MAX_AGE_PASSES passes.
+constexpr uint32_t SCAN_UNION_MAX_AGE_PASSES = 3;
+
+struct ScanUnionStats {
+  uint32_t passes;
+  uint32_t lastPassMillis;  // Wall time for the last pass.
+  uint32_t lastHeard;       // Stations heard in the last pass.
+  uint32_t lastNew;         // Stations first heard in the last pass.
+  uint32_t lastExpired;     // Stations dropped after the last pass.
+  uint32_t lastCapped;      // Channel scans in the last pass that returned SCAN_MAX_NUMBER.
+  uint32_t tableFull;       // Stations not added because the table was full (total).
+};
+
+// Add a channel to the pass. Call for each channel in the band plan, in scan order.
+extern void scanUnionDefineChannel(int channelNum);
+// Scan every channel and merge the results. Returns the number of stations in the table.
+extern int scanUnionRun();
+// Return a station record from the table.
+extern const wifi_ap_record_t *scanUnionRecord(size_t wifiIdx);
+extern const ScanUnionStats &scanUnionStats();
+
+#endif
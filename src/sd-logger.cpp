@@ -0,0 +1,174 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Write-behind logging to the SD card. Records are queued into a RAM ring buffer and written
+// out in 512-byte sectors from loop(), one sector per pass, so a slow card never stalls a scan
+// or a button handler.
+
+#include <SD/Seeed_SD.h>
+
+#include "wifi-scanner.h"
+
+static bool sdAvailable = false;
+
+// Shared by all loggers; only used within a single _writeFromRing() call.
+static uint8_t sectorBuf[SD_LOG_SECTOR_LEN];
+
+bool sdCardBegin() {
+  if (!sdAvailable) {
+    sdAvailable = SD.begin(SDCARD_SS_PIN, SDCARD_SPI);
+    if (!sdAvailable) {
+      DBGPRINT("No SD card found");
+    }
+  }
+
+  return sdAvailable;
+}
+
+bool sdCardAvailable() {
+  return sdAvailable;
+}
+
+void SdLogger::_formatPath(uint16_t idx) {
+  snprintf(_path, PATH_LEN, "%s%04u%s", _prefix, idx, _suffix);
+}
+
+// Copy bytes into the ring. Caller has checked that they fit.
+void SdLogger::_ringPut(const uint8_t *data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    _ring[_ringHead] = data[i];
+    _ringHead = (_ringHead + 1) % SD_LOG_RING_LEN;
+  }
+  _ringUsed += len;
+}
+
+// Open the log file at _stats.fileIndex and queue its header.
+bool SdLogger::_openFile() {
+  _formatPath(_stats.fileIndex);
+  _file = SD.open(_path, FILE_WRITE);
+  _open = (bool)_file;
+  if (!_open) {
+    DBGPRINT("Could not create SD log file");
+    return false;
+  }
+
+  _fileBytes = 0;
+  _fileOpenedMillis = millis();
+  _sectorsSinceSync = 0;
+
+  // The ring is empty whenever a file is opened, so queuing the header here keeps it at the
+  // start of the file and every later sector write aligned.
+  _ringPut(_fileHeader, _fileHeaderLen);
+  _stats.bytesQueued += _fileHeaderLen;
+  return true;
+}
+
+bool SdLogger::begin(const char *prefix, const char *suffix, const uint8_t *fileHeader,
+    size_t fileHeaderLen) {
+  _prefix = prefix;
+  _suffix = suffix;
+  _fileHeader = fileHeader;
+  _fileHeaderLen = fileHeaderLen;
+
+  if (!sdAvailable) {
+    return false;
+  }
+
+  // Don't clobber logs from previous sessions; start at the first unused index.
+  _stats.fileIndex = 0;
+  _formatPath(_stats.fileIndex);
+  while (SD.exists(_path) && _stats.fileIndex < 9999) {
+    _stats.fileIndex++;
+    _formatPath(_stats.fileIndex);
+  }
+
+  return _openFile();
+}
+
+bool SdLogger::append(const uint8_t *data, size_t len) {
+  if (!_open || len > SD_LOG_RING_LEN - _ringUsed) {
+    _stats.recordsDropped++;
+    return false;
+  }
+
+  _ringPut(data, len);
+  _stats.bytesQueued += len;
+  return true;
+}
+
+// Write up to one sector's worth of queued bytes to the card.
+void SdLogger::_writeFromRing(size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    sectorBuf[i] = _ring[(_ringTail + i) % SD_LOG_RING_LEN];
+  }
+
+  uint32_t writeStart = traceTicks();
+  uint32_t startMicros = micros();
+  size_t written = _file.write(sectorBuf, len);
+  _stats.maxWriteMicros = max(_stats.maxWriteMicros, (uint32_t)(micros() - startMicros));
+  traceRecord(TRACE_SD_WRITE, writeStart, len / SD_LOG_SECTOR_LEN);
+
+  if (written != len) {
+    // Card removed or full. Stop logging rather than retrying every loop.
+    DBGPRINT("SD log write failed; logging stopped");
+    _file.close();
+    _open = false;
+    return;
+  }
+
+  _ringTail = (_ringTail + len) % SD_LOG_RING_LEN;
+  _ringUsed -= len;
+  _fileBytes += len;
+  _stats.bytesWritten += len;
+  if (len == SD_LOG_SECTOR_LEN) {
+    _stats.sectorsWritten++;
+  }
+
+  if (++_sectorsSinceSync >= SD_LOG_SYNC_SECTORS) {
+    _file.flush();
+    _sectorsSinceSync = 0;
+  }
+}
+
+void SdLogger::flush() {
+  while (_open && _ringUsed > 0) {
+    _writeFromRing(min(_ringUsed, SD_LOG_SECTOR_LEN));
+  }
+
+  if (_open) {
+    _file.flush();
+    _sectorsSinceSync = 0;
+  }
+}
+
+void SdLogger::poll() {
+  if (!_open) {
+    return;
+  }
+
+  if (!_rotatePending && (_fileBytes >= SD_LOG_ROTATE_BYTES
+      || millis() - _fileOpenedMillis >= SD_LOG_ROTATE_MILLIS)) {
+    _rotatePending = true;
+  }
+
+  if (_rotatePending && _ringUsed < SD_LOG_SECTOR_LEN) {
+    // The ring always holds whole records, so once it's down to less than a sector we can
+    // write out the remainder and start the next file without splitting a record.
+    flush();
+    _file.close();
+    _open = false;
+    _rotatePending = false;
+    _stats.fileIndex++;
+    _stats.filesRotated++;
+    _openFile();
+    return;
+  }
+
+  if (_ringUsed >= SD_LOG_SECTOR_LEN) {
+    _writeFromRing(SD_LOG_SECTOR_LEN);
+  }
+}
+
+const SdLogStats &SdLogger::stats() {
+  _stats.ringUsed = _ringUsed;
+  return _stats;
+}
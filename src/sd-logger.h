@@ -0,0 +1,104 @@
+// (c) Copyright 2022 Aaron Kimball
+
+#ifndef _SD_LOGGER_H
+#define _SD_LOGGER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Seeed_FS.h>
+
+// Writes to the SD card are made in whole sectors, from the RAM ring buffer, during idle time.
+constexpr size_t SD_LOG_SECTOR_LEN = 512;
+constexpr size_t SD_LOG_RING_SECTORS = 16;
+constexpr size_t SD_LOG_RING_LEN = SD_LOG_SECTOR_LEN * SD_LOG_RING_SECTORS;
+
+// backpressure() reports true once the ring is this full (in bytes).
+constexpr size_t SD_LOG_HIGH_WATER = SD_LOG_RING_LEN * 3 / 4;
+
+// Sync the FAT directory entry (file size) every N sectors written, bounding loss on power-off.
+constexpr uint32_t SD_LOG_SYNC_SECTORS = 8;
+
+// Start a new log file when the current one reaches this size, or is this old.
+constexpr uint32_t SD_LOG_ROTATE_BYTES = 4 * 1024 * 1024;
+constexpr uint32_t SD_LOG_ROTATE_MILLIS = 60UL * 60UL * 1000UL; // 1 hour.
+
+struct SdLogStats {
+  uint32_t bytesQueued;    // Bytes accepted by append().
+  uint32_t bytesWritten;   // Bytes written to the card.
+  uint32_t recordsDropped; // Records rejected because the ring was full (or no card).
+  uint32_t recordsShed;    // Records the producer skipped because of backpressure().
+  uint32_t sectorsWritten;
+  uint32_t filesRotated;
+  uint32_t maxWriteMicros; // Longest single sector write.
+  size_t ringUsed;         // Bytes currently queued in RAM.
+  uint16_t fileIndex;      // Numeric suffix of the current log file.
+};
+
+// Mount the SD card. Returns false if no card is present.
+extern bool sdCardBegin();
+extern bool sdCardAvailable();
+
+// A write-behind log of records in a rotating series of files on the SD card.
+class SdLogger {
+public:
+  SdLogger(): _ringHead(0), _ringTail(0), _ringUsed(0), _open(false), _prefix(NULL),
+      _suffix(NULL), _fileHeader(NULL), _fileHeaderLen(0), _fileBytes(0), _fileOpenedMillis(0),
+      _sectorsSinceSync(0), _rotatePending(false), _stats() { };
+
+  // Begin logging to files named `<prefix>NNNN<suffix>` on the SD card (which must already be
+  // mounted), starting with the first unused index. Each new file begins with `fileHeader`.
+  // Returns false if no file could be created.
+  bool begin(const char *prefix, const char *suffix, const uint8_t *fileHeader,
+      size_t fileHeaderLen);
+
+  // Queue a record for writing. Records are accepted whole or not at all: if the ring can't
+  // hold it, it's dropped, counted, and false is returned.
+  bool append(const uint8_t *data, size_t len);
+
+  // True if the ring is above its high-water mark; producers should shed optional work.
+  bool backpressure() const { return _ringUsed >= SD_LOG_HIGH_WATER; };
+  // Count a record that the producer skipped because of backpressure().
+  void shed() { _stats.recordsShed++; };
+
+  // Call from loop() when idle. Writes at most one full sector, and handles rotation.
+  void poll();
+
+  // Write everything queued, including a final partial sector, and sync the file.
+  void flush();
+
+  // Index of the file that the next append() will land in. Changes when the log rotates;
+  // producers whose records depend on earlier ones in the same file use this to start over.
+  uint16_t fileIndex() const { return _stats.fileIndex; };
+
+  const SdLogStats &stats();
+
+private:
+  void _formatPath(uint16_t idx);
+  void _ringPut(const uint8_t *data, size_t len);
+  bool _openFile();
+  void _writeFromRing(size_t len);
+
+  uint8_t _ring[SD_LOG_RING_LEN];
+  size_t _ringHead; // Next byte to fill.
+  size_t _ringTail; // Next byte to write to the card.
+  size_t _ringUsed;
+
+  File _file;
+  bool _open;
+  const char *_prefix;
+  const char *_suffix;
+  const uint8_t *_fileHeader;
+  size_t _fileHeaderLen;
+  uint32_t _fileBytes;
+  uint32_t _fileOpenedMillis;
+  uint32_t _sectorsSinceSync;
+  bool _rotatePending;
+
+  SdLogStats _stats;
+
+  static constexpr size_t PATH_LEN = 32;
+  char _path[PATH_LEN];
+};
+
+#endif
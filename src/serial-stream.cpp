@@ -0,0 +1,129 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Stream scan results over USB serial as COBS-framed binary records. Frames are queued into a
+// ring buffer and drained from loop() a bounded amount at a time so the UI never waits on the
+// serial port.
+
+#include "wifi-scanner.h"
+
+static uint8_t txBuf[SERIAL_STREAM_TX_BUF_LEN];
+static size_t txHead = 0; // Next byte to write into the ring.
+static size_t txTail = 0; // Next byte to send over serial.
+static size_t txUsed = 0;
+
+static uint32_t framesQueued = 0;
+static uint32_t framesDropped = 0;
+
+static uint16_t scanSeq = 0;
+
+// Scratch space for building a frame and then COBS-encoding it.
+static uint8_t frameBuf[STREAM_MAX_FRAME_LEN];
+static uint8_t encodedBuf[cobsMaxEncodedLen(STREAM_MAX_FRAME_LEN) + 2];
+
+// Frame, encode, and enqueue a frame body. The frame is dropped if the ring can't hold it.
+static void enqueueFrame(uint8_t frameType, const uint8_t *body, size_t bodyLen) {
+  size_t frameLen = streamBuildFrame(frameBuf, frameType, scanSeq, body, bodyLen);
+  // Delimit the frame on both sides, so any text debug output that preceded it on the serial
+  // port is terminated as a separate (rejected) frame rather than corrupting this one.
+  encodedBuf[0] = 0;
+  size_t encodedLen = 1 + cobsEncode(frameBuf, frameLen, encodedBuf + 1);
+  encodedBuf[encodedLen++] = 0;
+
+  if (encodedLen > SERIAL_STREAM_TX_BUF_LEN - txUsed) {
+    framesDropped++;
+    return;
+  }
+
+  for (size_t i = 0; i < encodedLen; i++) {
+    txBuf[txHead] = encodedBuf[i];
+    txHead = (txHead + 1) % SERIAL_STREAM_TX_BUF_LEN;
+  }
+  txUsed += encodedLen;
+  framesQueued++;
+}
+
+void serialStreamBeginScan(uint32_t timestamp, uint8_t stationCount) {
+  scanSeq++;
+
+  uint8_t body[5];
+  body[0] = timestamp & 0xFF;
+  body[1] = (timestamp >> 8) & 0xFF;
+  body[2] = (timestamp >> 16) & 0xFF;
+  body[3] = (timestamp >> 24) & 0xFF;
+  body[4] = stationCount;
+  enqueueFrame(STREAM_FRAME_SCAN_HEADER, body, sizeof(body));
+}
+
+void serialStreamStation(const wifi_ap_record_t *pWifiAPRecord) {
+  ScanLogStation station;
+  uint8_t body[SCAN_LOG_ENTRY_MAX_LEN];
+
+  scanLogStationFromAPRecord(pWifiAPRecord, station);
+  enqueueFrame(STREAM_FRAME_STATION, body, scanLogEncodeStation(body, station));
+}
+
+void serialStreamChannelTotals(uint8_t band, const Heatmap &heatmap) {
+  // 2 byte prefix + 3 bytes per channel; must fit in one frame.
+  static constexpr size_t MAX_CHANNELS = (STREAM_MAX_FRAME_LEN - STREAM_FRAME_PREFIX_LEN
+      - STREAM_FRAME_CRC_LEN - 2) / 3;
+  uint8_t body[2 + 3 * MAX_CHANNELS];
+
+  size_t numChannels = min(heatmap.numChannels(), MAX_CHANNELS);
+  body[0] = band;
+  body[1] = numChannels;
+  size_t pos = 2;
+  for (size_t i = 0; i < numChannels; i++) {
+    body[pos++] = heatmap.channelNumAt(i);
+    body[pos++] = min(heatmap.signalCountAt(i), (size_t)0xFF);
+    body[pos++] = static_cast<uint8_t>(static_cast<int8_t>(heatmap.maxRssiAt(i, STREAM_NO_RSSI)));
+  }
+
+  enqueueFrame(STREAM_FRAME_CHANNEL_TOTALS, body, pos);
+}
+
+// Length of the encoded frame at the tail of the ring, including both delimiters.
+static size_t tailFrameLen() {
+  // Frames start with a 0 and COBS-encoded data has no other zeros, so the frame ends at the
+  // next 0 after its first byte.
+  for (size_t len = 1; len < txUsed; len++) {
+    if (txBuf[(txTail + len) % SERIAL_STREAM_TX_BUF_LEN] == 0) {
+      return len + 1;
+    }
+  }
+  return txUsed; // (Not reached; enqueueFrame() only queues whole frames.)
+}
+
+void serialStreamPoll() {
+  // Only whole frames are handed to Serial, so any other output on the port (DBGPRINT, survey
+  // export frames) falls between frames rather than inside one.
+  size_t budget = SERIAL_STREAM_POLL_MAX_BYTES;
+  while (txUsed > 0 && budget > 0) {
+    size_t frameLen = tailFrameLen();
+    if (Serial.availableForWrite() < static_cast<int>(frameLen)) {
+      return; // Host isn't keeping up; try again next loop().
+    }
+
+    // The frame may wrap around the end of the ring.
+    size_t firstLen = min(frameLen, SERIAL_STREAM_TX_BUF_LEN - txTail);
+    Serial.write(txBuf + txTail, firstLen);
+    if (firstLen < frameLen) {
+      Serial.write(txBuf, frameLen - firstLen);
+    }
+
+    txTail = (txTail + frameLen) % SERIAL_STREAM_TX_BUF_LEN;
+    txUsed -= frameLen;
+    budget -= min(budget, frameLen);
+  }
+}
+
+size_t serialStreamPending() {
+  return txUsed;
+}
+
+uint32_t serialStreamFramesQueued() {
+  return framesQueued;
+}
+
+uint32_t serialStreamFramesDropped() {
+  return framesDropped;
+}
@@ -0,0 +1,33 @@
+// (c) Copyright 2022 Aaron Kimball
+
+#ifndef _SERIAL_STREAM_H
+#define _SERIAL_STREAM_H
+
+#include "stream-format.h"
+
+class Heatmap;
+
+// Size of the transmit ring buffer. Frames that don't fit are dropped whole (and counted).
+constexpr size_t SERIAL_STREAM_TX_BUF_LEN = 8192;
+
+// Max bytes handed to Serial per call to serialStreamPoll(), to bound time spent in loop(). Frames
+// are only sent whole, so the last frame sent in a call may go past this.
+constexpr size_t SERIAL_STREAM_POLL_MAX_BYTES = 512;
+
+// Queue the frames describing a completed scan. Call serialStreamStation() for each station
+// after serialStreamBeginScan(), then serialStreamChannelTotals() for each band heatmap.
+extern void serialStreamBeginScan(uint32_t timestamp, uint8_t stationCount);
+extern void serialStreamStation(const wifi_ap_record_t *pWifiAPRecord);
+extern void serialStreamChannelTotals(uint8_t band, const Heatmap &heatmap);
+
+// Move queued bytes to the serial port without blocking. Call from loop().
+extern void serialStreamPoll();
+
+// Number of bytes queued but not yet handed to the serial port.
+extern size_t serialStreamPending();
+
+// Number of frames queued and dropped (for lack of buffer space) since boot.
+extern uint32_t serialStreamFramesQueued();
+extern uint32_t serialStreamFramesDropped();
+
+#endif
@@ -0,0 +1,184 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Spectral mask model for 802.11 signals. See spectrum.h.
+// (Portable; no Arduino dependencies.)
+
+#include "spectrum.h"
+
+////////   802.11 bandwidth spectral masks   ////////
+
+/**
+ * The 802.11b spectral mask specifies that the signal overlaps adjacent channels
+ * in the following way:
+ * at +/- 5 MHz (1 channel away): 0 dBm signal diff
+ * at +/-10 MHz (2 channels out): 0 dBm
+ * at +/-15 MHz (3 channels out): -30 dBm
+ * at +/-20 MHz (4 channels out): -30 dBm
+ * Further out is -50 dBm, effectively no interference.
+ * (See https://www.rfcafe.com/references/electrical/wlan-masks.htm)
+ *
+ * The spectral mask definitions here are one-sided, but are applied symmetrically around
+ * the primary (center) channel.
+ */
+static const int8_t spectralMask80211B[] = { 0, 0, -30, -30 };
+
+// 802.11a and g have the following mask, along with 20 MHz 802.11n:
+// +/-  5 MHz:     0 dBm
+// +/- 10 MHz:   -10 dBm
+// +/- 15 MHz:   -26 dBm (actually -25.9 dBm)
+// +/- 20 MHz:   -28 dBm
+// Further out is -35 dBm or lower; non-interfering.
+static const int8_t spectralMask80211G[] = { 0, -10, -26, -28 };
+
+// 802.11n in 40 MHz mode on 2.4 GHz wifi blocks an enormous number of channels:
+// +/-  5 MHz:    0 dBm
+// +/- 10 MHz:    0 dBm
+// +/- 15 MHz:    0 dBm
+// +/- 20 MHz:  -10 dBm
+// +/- 25 MHz:  -22 dBm
+// +/- 30 MHz:  -25 dBm
+// +/- 35 MHz:  -27 dBm
+// +/- 40 MHz:  -30 dBm
+//
+// This mask array reflects that for a 40 MHz bandwidth true channel, the primary channel num
+// is at -10 MHz and secondary at +10 MHz (or vice versa).
+//
+// The center of the
+// true channel is offset from the reported primary channel and we need to look at the data
+// struct to see whether the true center is above or below the primary channel id.
+//
+// So at +15 MHz from the true channel, we are at +5 MHz in the array below (  0 dBm)
+//    at +20 MHz from the true channel, we are at +10 MHz in array below    (-10 dBm)
+//    ... and so on...
+//
+// See https://www.researchgate.net/figure/80211-spectral-masks_fig3_261382549
+static const int8_t spectralMask80211N40MHz24G[] = { 0, -10, -22, -25, -27, -30 };
+
+// 802.11n in 40 MHz mode on 5 GHz wifi (20 MHz channel spacing):
+// 2x 20 MHz primary channels are consumed at 0 dBm, and the adjacent 20 MHz channel on
+// either shoulder sees interference at -25 dBm.
+//
+// Note this mask is for 20 MHz channel spacing (5 GHz band), whereas all the other
+// 2.4 GHz-band spectral masks above are for 5 MHz channel spacing.
+static const int8_t spectralMask80211N40MHz50G[] = { -25 };
+
+// 20 MHz channel width in 5 GHz band doesn't interfere with any neighbors, so it has no mask.
+
+template<size_t N>
+static inline void setMask(SpectrumFootprint &footprint, const int8_t (&mask)[N]) {
+  footprint.mask = mask;
+  footprint.maskLen = N;
+}
+
+
+bool spectrumIs24GHz(int channelNum) {
+  return channelNum <= max24GHzChannelNum;
+}
+
+void spectrumFootprint(const SpectrumSignal &signal, SpectrumFootprint &footprint) {
+  int channelNum = signal.primary;
+  bool is24GHz = spectrumIs24GHz(channelNum);
+
+  int upperChannelNum = channelNum;
+  int lowerChannelNum = channelNum;
+
+  // How many channels is this station occupying? If 20 MHz, exactly 1; if 40 MHz, it's this
+  // one and the one above or below it.
+  switch (signal.second) {
+  case SPECTRUM_SECOND_ABOVE:
+    if (is24GHz) {
+      // +20 MHz from primary channel = 4x 5 MHz channels away.
+      upperChannelNum = channelNum + 4 * ADJACENT_24_GHZ_CHAN_DELTA;
+    } else {
+      // 5 GHz: channel number for the next 20 MHz bandwidth channel up.
+      upperChannelNum = channelNum + ADJACENT_50_GHZ_CHAN_DELTA;
+    }
+    break;
+  case SPECTRUM_SECOND_BELOW:
+    if (is24GHz) {
+      // -20 MHz from primary channel = 4x 5 MHz channels away.
+      lowerChannelNum = channelNum - 4 * ADJACENT_24_GHZ_CHAN_DELTA;
+    } else {
+      // 5 GHz: channel number for the next 20 MHz bandwidth channel down.
+      lowerChannelNum = channelNum - ADJACENT_50_GHZ_CHAN_DELTA;
+    }
+    break;
+  default:
+    break; // 20 MHz.
+  }
+
+  footprint.lowerChannelNum = lowerChannelNum;
+  footprint.upperChannelNum = upperChannelNum;
+  // How far away is the next channel number? Depends on the frequency band.
+  footprint.channelDelta = is24GHz ? ADJACENT_24_GHZ_CHAN_DELTA : ADJACENT_50_GHZ_CHAN_DELTA;
+  // What is the extent of channel ids in the relevant band?
+  footprint.minBandChannel = is24GHz ? min24GHzChannelNum : min50GHzChannelNum;
+  footprint.maxBandChannel = is24GHz ? max24GHzChannelNum : max50GHzChannelNum;
+
+  // Determine which mode(s) are active and load the appropriate cross-channel interference data.
+  footprint.mask = NULL;
+  footprint.maskLen = 0;
+  if (is24GHz) {
+    if (signal.phy11b) {
+      // We are on 2.4 GHz 802.11b. (g or n may also be enabled, but the mask for 802.11b is
+      // more punishing to nearby channels, so apply this one to the interference chart.)
+      setMask(footprint, spectralMask80211B);
+    } else if (signal.phy11n || lowerChannelNum != upperChannelNum) {
+      // We are on 802.11n.
+      if (signal.second == SPECTRUM_SECOND_NONE) {
+        // 20 MHz 2.4 GHz 802.11n shares spectral mask with 802.11g
+        setMask(footprint, spectralMask80211G);
+      } else {
+        // 40 MHz bandwidth
+        // We are going to interfere with basically all the channels.
+        setMask(footprint, spectralMask80211N40MHz24G);
+      }
+    } else {
+      // We are on 2.4 GHz 802.11g
+      setMask(footprint, spectralMask80211G);
+    }
+  } else {
+    // 5 GHz band. If we're in 40 MHz bandwidth, we use one mask. For 20 MHz, we use the other.
+    // b/g/n flags not relevant.
+    if (lowerChannelNum != upperChannelNum) {
+      // 40 MHz dual-channel mode.
+      setMask(footprint, spectralMask80211N40MHz50G);
+    }
+    // else: 20 MHz 5 GHz 802.11n does not interfere with any adjacent channels.
+  }
+}
+
+void spectrumForEachChannel(const SpectrumSignal &signal, spectrumSink_t sink, void *ctx) {
+  SpectrumFootprint fp;
+  spectrumFootprint(signal, fp);
+  int rssiVal = signal.rssi;
+
+  // First, fill in the range of [lowerChannelId, upperChannelId] (with a stride of 1 or 4
+  // as appropriate) with +0 dBm
+  for (int i = fp.lowerChannelNum; i <= fp.upperChannelNum; i += fp.channelDelta) {
+    if (i >= fp.minBandChannel && i <= fp.maxBandChannel) {
+      sink(i, rssiVal, ctx);
+    }
+  }
+
+  // Add in cross-channel interference.
+  // For a two-sided channel definition (in 2.4 GHz), walk from upperChannelId + 0, 1, 2, 3...
+  // and apply the decay factor, as well as walking down from lowerChannelId - 0, 1, 2, 3...
+  // In 5 GHz, we walk at +/-4, +/-8, etc... `channelDelta` holds the right increment
+  // for the relevant band.
+  int offset = fp.channelDelta;
+  for (size_t m = 0; m < fp.maskLen; m++) {
+    int crosstalkRssi = rssiVal + fp.mask[m];
+    if (crosstalkRssi >= noiseFloorDBm) {
+      if (fp.upperChannelNum + offset <= fp.maxBandChannel) {
+        sink(fp.upperChannelNum + offset, crosstalkRssi, ctx);
+      }
+
+      if (fp.lowerChannelNum - offset >= fp.minBandChannel) {
+        sink(fp.lowerChannelNum - offset, crosstalkRssi, ctx);
+      }
+    }
+
+    offset += fp.channelDelta;
+  }
+}
@@ -0,0 +1,72 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// 802.11 band plan limits and the spectral mask model used to estimate how much of a station's
+// signal lands on each channel. This header has no Arduino dependencies so that host-side tools
+// model interference exactly as the heatmaps on the device do.
+
+#ifndef _SPECTRUM_H
+#define _SPECTRUM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 20 MHz channels in the 5 GHz US channel numbering plan are all 4 apart from each other
+// (preserving room for the 40 and 80 MHz channels in between, where appropriate).
+// See https://en.wikipedia.org/wiki/List_of_WLAN_channels#5_GHz_(802.11a/h/j/n/ac/ax)
+constexpr int ADJACENT_50_GHZ_CHAN_DELTA = 4;
+
+// 2.4 GHz channel numbers with 5 MHz bandwidth are all 1 apart from each other.
+constexpr int ADJACENT_24_GHZ_CHAN_DELTA = 1;
+
+// 2.4 GHz channel ids in the US band plan range from 1 to 11.
+constexpr int min24GHzChannelNum = 1;
+constexpr int max24GHzChannelNum = 11;
+
+// 5 GHz channel ids in the US band plan range from 32 to 177 (U-NII-4)
+constexpr int min50GHzChannelNum = 32;
+constexpr int max50GHzChannelNum = 177;
+
+// Ignore signals with power < -90 dBm when constructing the interference heatmap.
+constexpr int noiseFloorDBm = -90;
+
+// Secondary channel position; same values as the radio's wifi_second_chan_t.
+constexpr uint8_t SPECTRUM_SECOND_NONE = 0;
+constexpr uint8_t SPECTRUM_SECOND_ABOVE = 1;
+constexpr uint8_t SPECTRUM_SECOND_BELOW = 2;
+
+// The attributes of a station's transmission that determine its spectral footprint.
+struct SpectrumSignal {
+  int primary;    // Primary channel number.
+  uint8_t second; // SPECTRUM_SECOND_*
+  int rssi;       // dBm
+  bool phy11b;
+  bool phy11n;
+};
+
+// The channels a signal occupies at full power, and the spectral mask that describes how it
+// decays on channels further out. The mask is one-sided: mask[0] is the attenuation (in dB) one
+// channel step outside [lowerChannelNum, upperChannelNum] on either side, mask[1] two steps out,
+// etc. A step is `channelDelta` channel numbers.
+struct SpectrumFootprint {
+  int lowerChannelNum;
+  int upperChannelNum;
+  int channelDelta;
+  int minBandChannel;
+  int maxBandChannel;
+  const int8_t *mask;
+  size_t maskLen;
+};
+
+extern bool spectrumIs24GHz(int channelNum);
+
+// Work out which channels `signal` occupies and which spectral mask applies to it.
+extern void spectrumFootprint(const SpectrumSignal &signal, SpectrumFootprint &footprint);
+
+typedef void (*spectrumSink_t)(int channelNum, int rssi, void *ctx);
+
+// Call `sink` once for each channel that `signal` reaches in its band: with the full rssi for
+// each occupied channel, then with the attenuated rssi for each channel the spectral mask
+// reaches above the noise floor.
+extern void spectrumForEachChannel(const SpectrumSignal &signal, spectrumSink_t sink, void *ctx);
+
+#endif
@@ -0,0 +1,21 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Shared access to the SPI flash chip. See spi-flash.h.
+
+#include "wifi-scanner.h"
+
+static bool spiFlashInitialized = false;
+static const sfud_flash *spiFlashDevice = NULL;
+
+const sfud_flash *spiFlash() {
+  if (!spiFlashInitialized) {
+    spiFlashInitialized = true;
+    if (sfud_init() != SFUD_SUCCESS) {
+      DBGPRINT("Could not initialize SPI flash");
+      return NULL;
+    }
+    spiFlashDevice = sfud_get_device(SFUD_W25Q32_DEVICE_INDEX);
+  }
+
+  return spiFlashDevice;
+}
@@ -0,0 +1,16 @@
+// (c) Copyright 2022 Aaron Kimball
+
+#ifndef _SPI_FLASH_H
+#define _SPI_FLASH_H
+
+#include <sfud.h>
+
+// The Wio Terminal's 4 MiB SPI flash (W25Q32) is shared by:
+//   0x000000 - 0x00FFFF  boot snapshots of the last scan (boot-snapshot.h)
+//   0x010000 - 0x010FFF  known-AP baseline (rogue-watch.h)
+//   0x100000 - 0x2FFFFF  site survey log (survey.h)
+
+// Return the SPI flash device, initializing it on first use. Returns NULL if it's unavailable.
+extern const sfud_flash *spiFlash();
+
+#endif
@@ -0,0 +1,163 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Station list filters. See station-filter.h.
+// (Portable; no Arduino dependencies.)
+
+#include "spectrum.h"
+#include "station-filter.h"
+
+// A value a field can take, and the attribute it requires.
+struct FilterValue {
+  const char *name;
+  stationAttrs_t required;
+};
+
+static const FilterValue bandValues[] = {
+  { "Any", 0 },
+  { "2.4 GHz", STATION_ATTR_24GHZ },
+  { "5 GHz", STATION_ATTR_50GHZ },
+};
+
+static const FilterValue rssiValues[] = {
+  { "Any", 0 },
+  { ">= -80", STATION_ATTR_RSSI_80 },
+  { ">= -70", STATION_ATTR_RSSI_70 },
+  { ">= -60", STATION_ATTR_RSSI_60 },
+};
+
+static const FilterValue securityValues[] = {
+  { "Any", 0 },
+  { "Open", STATION_ATTR_OPEN },
+  { "WEP", STATION_ATTR_WEP },
+  { "WPA PSK", STATION_ATTR_PSK },
+  { "Enterprise", STATION_ATTR_ENTERPRISE },
+};
+
+static const FilterValue ssidValues[] = {
+  { "Any", 0 },
+  { "Hidden", STATION_ATTR_HIDDEN },
+  { "Named", STATION_ATTR_NAMED },
+};
+
+static const FilterValue widthValues[] = {
+  { "Any", 0 },
+  { "40 MHz", STATION_ATTR_40MHZ },
+  { "20 MHz", STATION_ATTR_20MHZ },
+};
+
+static const FilterValue stateValues[] = {
+  { "Any", 0 },
+  { "Enabled", STATION_ATTR_ENABLED },
+  { "Disabled", STATION_ATTR_DISABLED },
+};
+
+struct FilterFieldDef {
+  const char *name;
+  const FilterValue *values;
+  uint8_t numValues;
+};
+
+template<size_t N>
+static constexpr FilterFieldDef fieldDef(const char *name, const FilterValue (&values)[N]) {
+  return { name, values, N };
+}
+
+// Indexed by StationFilterField.
+static const FilterFieldDef filterFields[FILTER_NUM_FIELDS] = {
+  fieldDef("Band", bandValues),
+  fieldDef("RSSI", rssiValues),
+  fieldDef("Security", securityValues),
+  fieldDef("SSID", ssidValues),
+  fieldDef("Width", widthValues),
+  fieldDef("State", stateValues),
+};
+
+stationAttrs_t stationAttrs(int primary, bool is40MHz, int rssi, StationSecurity security,
+    bool hidden) {
+  stationAttrs_t attrs = STATION_ATTR_ENABLED;
+
+  attrs |= spectrumIs24GHz(primary) ? STATION_ATTR_24GHZ : STATION_ATTR_50GHZ;
+
+  if (rssi >= -80) {
+    attrs |= STATION_ATTR_RSSI_80;
+  }
+  if (rssi >= -70) {
+    attrs |= STATION_ATTR_RSSI_70;
+  }
+  if (rssi >= -60) {
+    attrs |= STATION_ATTR_RSSI_60;
+  }
+
+  switch (security) {
+  case STATION_SECURITY_OPEN:
+    attrs |= STATION_ATTR_OPEN;
+    break;
+  case STATION_SECURITY_WEP:
+    attrs |= STATION_ATTR_WEP;
+    break;
+  case STATION_SECURITY_PSK:
+    attrs |= STATION_ATTR_PSK;
+    break;
+  case STATION_SECURITY_ENTERPRISE:
+    attrs |= STATION_ATTR_ENTERPRISE;
+    break;
+  default:
+    break;
+  }
+
+  attrs |= hidden ? STATION_ATTR_HIDDEN : STATION_ATTR_NAMED;
+  attrs |= is40MHz ? STATION_ATTR_40MHZ : STATION_ATTR_20MHZ;
+
+  return attrs;
+}
+
+stationAttrs_t stationAttrsSetDisabled(stationAttrs_t attrs, bool disabled) {
+  attrs &= ~(STATION_ATTR_ENABLED | STATION_ATTR_DISABLED);
+  return attrs | (disabled ? STATION_ATTR_DISABLED : STATION_ATTR_ENABLED);
+}
+
+StationFilter::StationFilter() {
+  reset();
+}
+
+void StationFilter::reset() {
+  for (size_t i = 0; i < FILTER_NUM_FIELDS; i++) {
+    _value[i] = 0;
+  }
+  _required = 0;
+}
+
+void StationFilter::cycle(StationFilterField field) {
+  _value[field]++;
+  if (_value[field] >= filterFields[field].numValues) {
+    _value[field] = 0;
+  }
+  _updateRequired();
+}
+
+void StationFilter::_updateRequired() {
+  _required = 0;
+  for (size_t i = 0; i < FILTER_NUM_FIELDS; i++) {
+    _required |= filterFields[i].values[_value[i]].required;
+  }
+}
+
+const char *StationFilter::fieldName(StationFilterField field) const {
+  return filterFields[field].name;
+}
+
+const char *StationFilter::valueName(StationFilterField field) const {
+  return filterFields[field].values[_value[field]].name;
+}
+
+size_t StationFilter::apply(const stationAttrs_t *attrs, size_t numStations,
+    uint8_t *matchIdx) const {
+  size_t numMatches = 0;
+  for (size_t i = 0; i < numStations; i++) {
+    if ((attrs[i] & _required) == _required) {
+      matchIdx[numMatches++] = i;
+    }
+  }
+
+  return numMatches;
+}
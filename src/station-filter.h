@@ -0,0 +1,86 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Filters for the station list. (Portable; no Arduino dependencies.)
+//
+// Each station's attributes are evaluated once per scan into a bitmask of STATION_ATTR_* bits.
+// A filter is one required bit (or none) per field; a station matches when it has all of the
+// filter's required bits, so applying a filter is a single AND and compare per station.
+
+#ifndef _STATION_FILTER_H
+#define _STATION_FILTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint16_t stationAttrs_t;
+
+constexpr stationAttrs_t STATION_ATTR_24GHZ = 1 << 0;
+constexpr stationAttrs_t STATION_ATTR_50GHZ = 1 << 1;
+constexpr stationAttrs_t STATION_ATTR_RSSI_80 = 1 << 2; // rssi >= -80 dBm
+constexpr stationAttrs_t STATION_ATTR_RSSI_70 = 1 << 3; // rssi >= -70 dBm
+constexpr stationAttrs_t STATION_ATTR_RSSI_60 = 1 << 4; // rssi >= -60 dBm
+constexpr stationAttrs_t STATION_ATTR_OPEN = 1 << 5;
+constexpr stationAttrs_t STATION_ATTR_WEP = 1 << 6;
+constexpr stationAttrs_t STATION_ATTR_PSK = 1 << 7;        // WPA and/or WPA2 personal.
+constexpr stationAttrs_t STATION_ATTR_ENTERPRISE = 1 << 8; // WPA2 enterprise.
+constexpr stationAttrs_t STATION_ATTR_HIDDEN = 1 << 9;     // Empty SSID.
+constexpr stationAttrs_t STATION_ATTR_NAMED = 1 << 10;
+constexpr stationAttrs_t STATION_ATTR_20MHZ = 1 << 11;
+constexpr stationAttrs_t STATION_ATTR_40MHZ = 1 << 12;
+constexpr stationAttrs_t STATION_ATTR_ENABLED = 1 << 13;
+constexpr stationAttrs_t STATION_ATTR_DISABLED = 1 << 14;
+
+// Station security, as far as the filters are concerned.
+enum StationSecurity : uint8_t {
+  STATION_SECURITY_OPEN = 0,
+  STATION_SECURITY_WEP = 1,
+  STATION_SECURITY_PSK = 2,
+  STATION_SECURITY_ENTERPRISE = 3,
+  STATION_SECURITY_OTHER = 4, // Not matched by any security filter but "Any".
+};
+
+// Evaluate a station's filter attributes. It is marked enabled; see stationAttrsSetDisabled().
+extern stationAttrs_t stationAttrs(int primary, bool is40MHz, int rssi, StationSecurity security,
+    bool hidden);
+
+// Update the enabled/disabled bits of a station's attributes.
+extern stationAttrs_t stationAttrsSetDisabled(stationAttrs_t attrs, bool disabled);
+
+// The independent fields a filter can constrain.
+enum StationFilterField : uint8_t {
+  FILTER_FIELD_BAND = 0,
+  FILTER_FIELD_RSSI = 1,
+  FILTER_FIELD_SECURITY = 2,
+  FILTER_FIELD_SSID = 3,
+  FILTER_FIELD_WIDTH = 4,
+  FILTER_FIELD_STATE = 5,
+  FILTER_NUM_FIELDS = 6
+};
+
+class StationFilter {
+public:
+  StationFilter();
+
+  // Advance `field` to its next value (wrapping back to "Any").
+  void cycle(StationFilterField field);
+  // Remove all constraints.
+  void reset();
+
+  const char *fieldName(StationFilterField field) const;
+  const char *valueName(StationFilterField field) const;
+  bool isActive() const { return _required != 0; };
+
+  bool matches(stationAttrs_t attrs) const { return (attrs & _required) == _required; };
+
+  // Write the index of each of the `numStations` stations that match to `matchIdx`, in order.
+  // Returns the number of matches.
+  size_t apply(const stationAttrs_t *attrs, size_t numStations, uint8_t *matchIdx) const;
+
+private:
+  void _updateRequired();
+
+  uint8_t _value[FILTER_NUM_FIELDS]; // Index into each field's value list; 0 is "Any".
+  stationAttrs_t _required;
+};
+
+#endif
@@ -0,0 +1,96 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// BSSID-keyed station table for merging scans. See station-table.h.
+
+#include "wifi-scanner.h"
+
+StationTable::StationTable() {
+  clear();
+}
+
+void StationTable::clear() {
+  memset(_records, 0, sizeof(_records));
+  memset(_lastPass, 0, sizeof(_lastPass));
+  memset(_onPrimary, 0, sizeof(_onPrimary));
+  memset(_index, 0, sizeof(_index));
+  _numRecords = 0;
+}
+
+// FNV-1a over the 6 BSSID octets.
+size_t StationTable::_hashSlot(const uint8_t *bssid) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < 6; i++) {
+    hash = (hash ^ bssid[i]) * 16777619u;
+  }
+
+  return hash & (STATION_TABLE_SLOTS - 1);
+}
+
+size_t StationTable::_findSlot(const uint8_t *bssid) const {
+  // Linear probing. The index is never more than half full, so there's always an empty slot.
+  size_t slot = _hashSlot(bssid);
+  while (_index[slot] != 0
+      && memcmp(_records[_index[slot] - 1].bssid, bssid, sizeof(_records[0].bssid)) != 0) {
+    slot = (slot + 1) & (STATION_TABLE_SLOTS - 1);
+  }
+
+  return slot;
+}
+
+bool StationTable::update(const wifi_ap_record_t *pWifiAPRecord, uint32_t pass, bool onPrimary) {
+  size_t slot = _findSlot(pWifiAPRecord->bssid);
+  if (_index[slot] != 0) {
+    size_t idx = _index[slot] - 1;
+    if (_lastPass[idx] == pass && _onPrimary[idx] && !onPrimary) {
+      return true; // Keep this pass's reading from the station's own channel.
+    }
+
+    _records[idx] = *pWifiAPRecord;
+    _lastPass[idx] = pass;
+    _onPrimary[idx] = onPrimary;
+    return true;
+  }
+
+  if (_numRecords >= MAX_STATIONS) {
+    return false;
+  }
+
+  _records[_numRecords] = *pWifiAPRecord;
+  _lastPass[_numRecords] = pass;
+  _onPrimary[_numRecords] = onPrimary;
+  _numRecords++;
+  _index[slot] = _numRecords;
+  return true;
+}
+
+size_t StationTable::expire(uint32_t oldestPass) {
+  size_t kept = 0;
+  for (size_t i = 0; i < _numRecords; i++) {
+    if (_lastPass[i] < oldestPass) {
+      continue;
+    }
+
+    if (kept != i) {
+      _records[kept] = _records[i];
+      _lastPass[kept] = _lastPass[i];
+      _onPrimary[kept] = _onPrimary[i];
+    }
+    kept++;
+  }
+
+  size_t removed = _numRecords - kept;
+  if (removed > 0) {
+    memset(&_records[kept], 0, removed * sizeof(_records[0]));
+    _numRecords = kept;
+    _reindex(); // Records moved; linear probing can't delete in place anyway.
+  }
+
+  return removed;
+}
+
+void StationTable::_reindex() {
+  memset(_index, 0, sizeof(_index));
+  for (size_t i = 0; i < _numRecords; i++) {
+    _index[_findSlot(_records[i].bssid)] = i + 1;
+  }
+}
@@ -0,0 +1,61 @@
+// (c) Copyright 2022 Aaron Kimball
+
+#ifndef _STATION_TABLE_H
+#define _STATION_TABLE_H
+
+// A single WiFi.scanNetworks() call returns at most SCAN_MAX_NUMBER stations, set by the RPC
+// library. With MULTI_PASS_SCAN, the station table is filled from several scans and can hold
+// more; this sets its capacity. Station indices are stored in a byte, so it can't exceed 255.
+// Each station in the list costs a row of widgets on the heap (see HEAP_BUDGET_BYTES).
+constexpr size_t MULTI_PASS_MAX_STATIONS = 160;
+
+// Capacity of the station list, filters and heatmap bookkeeping.
+#ifdef MULTI_PASS_SCAN
+constexpr size_t MAX_STATIONS = MULTI_PASS_MAX_STATIONS;
+#else
+constexpr size_t MAX_STATIONS = SCAN_MAX_NUMBER;
+#endif
+static_assert(MAX_STATIONS <= 255, "station indices must fit in a uint8_t");
+
+// Open-addressed hash index slots; a power of two, at least twice MAX_STATIONS.
+constexpr size_t STATION_TABLE_SLOTS = 512;
+static_assert(STATION_TABLE_SLOTS >= 2 * MAX_STATIONS, "station table index too small");
+
+// Stations merged from several scans, deduplicated by BSSID. Records are kept in insertion
+// order (so a station's index is stable until expire() drops something ahead of it) with a
+// hash index from BSSID to record.
+class StationTable {
+public:
+  StationTable();
+
+  // Remove all stations.
+  void clear();
+
+  // Add a station heard in scan pass `pass`, or replace the reading of one already in the table
+  // with this fresher one. `onPrimary` is true if the scan was on the station's own primary
+  // channel; within a pass, such a reading isn't replaced by one from a neighboring channel.
+  // Returns false if the station is new and the table is full.
+  bool update(const wifi_ap_record_t *pWifiAPRecord, uint32_t pass, bool onPrimary);
+
+  // Remove the stations last heard before pass `oldestPass`. Returns the number removed.
+  size_t expire(uint32_t oldestPass);
+
+  size_t size() const { return _numRecords; };
+  const wifi_ap_record_t *record(size_t idx) const { return &_records[idx]; };
+  // The pass in which station `idx` was last heard.
+  uint32_t lastPass(size_t idx) const { return _lastPass[idx]; };
+
+private:
+  static size_t _hashSlot(const uint8_t *bssid);
+  // Return the index slot holding `bssid`, or the empty slot where it would go.
+  size_t _findSlot(const uint8_t *bssid) const;
+  void _reindex();
+
+  wifi_ap_record_t _records[MAX_STATIONS]; // Unused entries are zeroed.
+  uint32_t _lastPass[MAX_STATIONS];
+  bool _onPrimary[MAX_STATIONS];
+  uint8_t _index[STATION_TABLE_SLOTS];     // Record index + 1, or 0 if the slot is empty.
+  size_t _numRecords;
+};
+
+#endif
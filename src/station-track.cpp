@@ -0,0 +1,58 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Fast single-channel scans for one station. See station-track.h.
+
+#include "wifi-scanner.h"
+
+static uint8_t trackBssid[6];
+static int trackChannel = 0;
+static StationTrackStats trackStats;
+
+static uint32_t rateWindowStart = 0; // millis() at the start of the current rate window.
+static uint32_t rateWindowScans = 0;
+
+void stationTrackBegin(const uint8_t *bssid, int channelNum) {
+  memcpy(trackBssid, bssid, sizeof(trackBssid));
+  trackChannel = channelNum;
+  memset(&trackStats, 0, sizeof(trackStats));
+  rateWindowStart = millis();
+  rateWindowScans = 0;
+}
+
+int stationTrackScan() {
+  uint32_t scanStart = millis();
+  uint32_t chanStart = traceTicks();
+  int n = WiFi.scanNetworks(false, false, false, TRACK_DWELL_MILLIS, trackChannel);
+  scanCacheCountRpc();
+  traceRecord(TRACE_CHANNEL_SCAN, chanStart, trackChannel);
+
+  // Read records straight from the radio; the scan cache still holds the last full scan. Stop at
+  // the tracked station, so only the records ahead of it cost an RPC call each.
+  int rssi = TRACK_NO_SIGNAL;
+  for (int i = 0; i < n; i++) {
+    const wifi_ap_record_t *pWifiAPRecord =
+        reinterpret_cast<const wifi_ap_record_t*>(WiFi.getScanInfoByIndex(i));
+    scanCacheCountRpc();
+    if (pWifiAPRecord != NULL && memcmp(pWifiAPRecord->bssid, trackBssid, sizeof(trackBssid)) == 0) {
+      rssi = pWifiAPRecord->rssi;
+      trackStats.heard++;
+      break;
+    }
+  }
+
+  uint32_t now = millis();
+  trackStats.scans++;
+  trackStats.lastScanMillis = now - scanStart;
+  rateWindowScans++;
+  if (now - rateWindowStart >= 1000) {
+    trackStats.scansPerMinute = rateWindowScans * 60000 / (now - rateWindowStart);
+    rateWindowStart = now;
+    rateWindowScans = 0;
+  }
+
+  return rssi;
+}
+
+const StationTrackStats &stationTrackStats() {
+  return trackStats;
+}
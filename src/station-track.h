@@ -0,0 +1,30 @@
+// (c) Copyright 2022 Aaron Kimball
+
+#ifndef _STATION_TRACK_H
+#define _STATION_TRACK_H
+
+// Track one station's signal strength, e.g. to find it by walking toward it. Rather than the
+// whole band plan, each tracking scan covers only the station's primary channel with a short
+// dwell, so its RSSI updates an order of magnitude more often than a full scanWifi() cycle.
+// Tracking scans don't replace the results of the last full scan (or the scan cache).
+
+// Dwell time on the tracked channel per scan. Beacons are usually sent every ~102 ms, so some
+// scans miss the station; those are reported as TRACK_NO_SIGNAL.
+constexpr uint32_t TRACK_DWELL_MILLIS = 60;
+
+constexpr int TRACK_NO_SIGNAL = -128;
+
+struct StationTrackStats {
+  uint32_t scans;          // Tracking scans since stationTrackBegin().
+  uint32_t heard;          // ...and how many of them heard the station.
+  uint32_t lastScanMillis; // Wall time of the last scan, including RPC overhead.
+  uint32_t scansPerMinute; // Scan rate over the last full second, times 60.
+};
+
+// Start tracking the station with this BSSID on `channelNum`.
+extern void stationTrackBegin(const uint8_t *bssid, int channelNum);
+// Scan the tracked channel once. Returns the station's RSSI, or TRACK_NO_SIGNAL if not heard.
+extern int stationTrackScan();
+extern const StationTrackStats &stationTrackStats();
+
+#endif
@@ -0,0 +1,109 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// COBS framing and CRC for the binary scan-result stream. See stream-format.h.
+// (Portable; no Arduino dependencies.)
+
+#include <string.h>
+
+#include "stream-format.h"
+
+uint16_t streamCrc16(const uint8_t *data, size_t len, uint16_t crc) {
+  for (size_t i = 0; i < len; i++) {
+    crc ^= static_cast<uint16_t>(data[i]) << 8;
+    for (int bit = 0; bit < 8; bit++) {
+      if (crc & 0x8000) {
+        crc = (crc << 1) ^ 0x1021;
+      } else {
+        crc <<= 1;
+      }
+    }
+  }
+
+  return crc;
+}
+
+size_t cobsEncode(const uint8_t *in, size_t len, uint8_t *out) {
+  size_t codeIdx = 0; // Where the length code for the current run goes.
+  size_t outIdx = 1;
+  uint8_t code = 1;
+
+  for (size_t i = 0; i < len; i++) {
+    if (in[i] == 0) {
+      out[codeIdx] = code;
+      codeIdx = outIdx++;
+      code = 1;
+    } else {
+      out[outIdx++] = in[i];
+      code++;
+      if (code == 0xFF) {
+        // Maximum run of 254 non-zero bytes; start a new run with no implied zero.
+        out[codeIdx] = code;
+        codeIdx = outIdx++;
+        code = 1;
+      }
+    }
+  }
+
+  out[codeIdx] = code;
+  return outIdx;
+}
+
+size_t cobsDecode(const uint8_t *in, size_t len, uint8_t *out) {
+  size_t inIdx = 0;
+  size_t outIdx = 0;
+
+  while (inIdx < len) {
+    uint8_t code = in[inIdx++];
+    if (code == 0 || inIdx + code - 1 > len) {
+      return 0; // Zero byte inside a frame, or run extends past the end.
+    }
+
+    for (uint8_t i = 1; i < code; i++) {
+      out[outIdx++] = in[inIdx++];
+    }
+
+    if (code != 0xFF && inIdx < len) {
+      out[outIdx++] = 0; // Implied zero between runs.
+    }
+  }
+
+  return outIdx;
+}
+
+size_t streamBuildFrame(uint8_t *out, uint8_t frameType, uint16_t seq,
+    const uint8_t *body, size_t bodyLen) {
+  out[0] = STREAM_PROTOCOL_VERSION;
+  out[1] = frameType;
+  out[2] = seq & 0xFF;
+  out[3] = (seq >> 8) & 0xFF;
+  memcpy(out + STREAM_FRAME_PREFIX_LEN, body, bodyLen);
+
+  size_t crcPos = STREAM_FRAME_PREFIX_LEN + bodyLen;
+  uint16_t crc = streamCrc16(out, crcPos);
+  out[crcPos] = crc & 0xFF;
+  out[crcPos + 1] = (crc >> 8) & 0xFF;
+  return crcPos + STREAM_FRAME_CRC_LEN;
+}
+
+bool streamParseFrame(const uint8_t *frame, size_t len, uint8_t &frameType,
+    uint16_t &seq, const uint8_t *&body, size_t &bodyLen) {
+  if (len < STREAM_FRAME_PREFIX_LEN + STREAM_FRAME_CRC_LEN) {
+    return false;
+  }
+
+  size_t crcPos = len - STREAM_FRAME_CRC_LEN;
+  uint16_t expectedCrc = frame[crcPos] | (frame[crcPos + 1] << 8);
+  if (streamCrc16(frame, crcPos) != expectedCrc) {
+    return false;
+  }
+
+  if (frame[0] != STREAM_PROTOCOL_VERSION) {
+    return false;
+  }
+
+  frameType = frame[1];
+  seq = frame[2] | (frame[3] << 8);
+  body = frame + STREAM_FRAME_PREFIX_LEN;
+  bodyLen = crcPos - STREAM_FRAME_PREFIX_LEN;
+  return true;
+}
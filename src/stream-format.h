@@ -0,0 +1,97 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Framing for the binary scan-result stream sent over USB serial. This header has no Arduino
+// dependencies so that host-side decoders can share it.
+//
+// Each frame is COBS-encoded and surrounded by 0x00 delimiter bytes, so a reader can always
+// resynchronize at the next zero (e.g., after text debug output interleaved on the same port).
+// Empty frames (consecutive delimiters) are ignored.
+//
+// Before COBS encoding, a frame is:
+//
+//   u8       protocol version (STREAM_PROTOCOL_VERSION)
+//   u8       frame type (STREAM_FRAME_*)
+//   u16      scan sequence number; all frames describing the same scan share it
+//   u8[]     body (depends on frame type; see below)
+//   u16      CRC-16/CCITT-FALSE of all preceding bytes in the frame
+//
+// All multi-byte integers are little-endian. Frame bodies:
+//
+//   STREAM_FRAME_SCAN_HEADER:
+//     u32      timestamp of the scan in milliseconds since boot
+//     u8       number of STREAM_FRAME_STATION frames that follow for this scan
+//   STREAM_FRAME_STATION:
+//     one station entry in the scan log encoding (see scan-log-format.h)
+//   STREAM_FRAME_CHANNEL_TOTALS:
+//     u8       band (STREAM_BAND_*)
+//     u8       number of channels
+//     per channel:
+//       u8       channel number
+//       u8       number of signals recorded on the channel in the heatmap
+//       i8       strongest rssi recorded on the channel (dBm), or -128 if none
+//   STREAM_FRAME_SURVEY_CHUNK:
+//     u32      sequence number of the site survey record (see survey-format.h)
+//     u16      offset of this chunk within the record
+//     u8[]     record bytes
+//   STREAM_FRAME_SURVEY_END:
+//     u32      number of survey records sent by this export
+//
+// Survey frames are sent only when exporting a site survey, and their prefix sequence number is
+// the survey session that was current when the export began.
+
+#ifndef _STREAM_FORMAT_H
+#define _STREAM_FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+constexpr uint8_t STREAM_PROTOCOL_VERSION = 1;
+
+constexpr uint8_t STREAM_FRAME_SCAN_HEADER = 1;
+constexpr uint8_t STREAM_FRAME_STATION = 2;
+constexpr uint8_t STREAM_FRAME_CHANNEL_TOTALS = 3;
+constexpr uint8_t STREAM_FRAME_SURVEY_CHUNK = 4;
+constexpr uint8_t STREAM_FRAME_SURVEY_END = 5;
+
+constexpr uint8_t STREAM_BAND_24GHZ = 0;
+constexpr uint8_t STREAM_BAND_50GHZ = 1;
+
+constexpr int8_t STREAM_NO_RSSI = -128;
+
+// Length of the version/type/seq prefix and the trailing CRC.
+constexpr size_t STREAM_FRAME_PREFIX_LEN = 4;
+constexpr size_t STREAM_FRAME_CRC_LEN = 2;
+
+// Largest frame (before COBS encoding) that either side needs to handle.
+constexpr size_t STREAM_MAX_FRAME_LEN = 254;
+
+// Record bytes carried by each STREAM_FRAME_SURVEY_CHUNK frame (except perhaps a record's last).
+constexpr size_t STREAM_SURVEY_CHUNK_LEN = 128;
+
+// Worst-case size of `len` bytes after COBS encoding (not including the 0x00 delimiter).
+constexpr size_t cobsMaxEncodedLen(size_t len) {
+  return len + len / 254 + 1;
+}
+
+// CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF). Pass a previous result as `crc` to continue.
+extern uint16_t streamCrc16(const uint8_t *data, size_t len, uint16_t crc=0xFFFF);
+
+// COBS-encode `len` bytes from `in` to `out`, which must hold cobsMaxEncodedLen(len) bytes.
+// Returns the encoded length. Does not write the trailing 0x00 delimiter.
+extern size_t cobsEncode(const uint8_t *in, size_t len, uint8_t *out);
+
+// Decode a COBS-encoded frame (without its delimiter) from `in` to `out`, which must hold
+// `len` bytes. Returns the decoded length, or 0 if the input is malformed.
+extern size_t cobsDecode(const uint8_t *in, size_t len, uint8_t *out);
+
+// Wrap `body` in a frame prefix and CRC. `out` must hold bodyLen + STREAM_FRAME_PREFIX_LEN +
+// STREAM_FRAME_CRC_LEN bytes. Returns the frame length.
+extern size_t streamBuildFrame(uint8_t *out, uint8_t frameType, uint16_t seq,
+    const uint8_t *body, size_t bodyLen);
+
+// Validate a decoded frame's version and CRC. On success, returns true and sets the frame type,
+// sequence number, and body location.
+extern bool streamParseFrame(const uint8_t *frame, size_t len, uint8_t &frameType,
+    uint16_t &seq, const uint8_t *&body, size_t &bodyLen);
+
+#endif
@@ -0,0 +1,195 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Site survey record codec. See survey-format.h.
+// (Portable; no Arduino dependencies.)
+
+#include <string.h>
+
+#include "stream-format.h"
+#include "survey-format.h"
+
+static const uint8_t SURVEY_MAGIC[4] = { 'W', 'S', 'V', 'Y' };
+
+static inline void putU16(uint8_t *buf, uint16_t val) {
+  buf[0] = val & 0xFF;
+  buf[1] = (val >> 8) & 0xFF;
+}
+
+static inline void putU32(uint8_t *buf, uint32_t val) {
+  buf[0] = val & 0xFF;
+  buf[1] = (val >> 8) & 0xFF;
+  buf[2] = (val >> 16) & 0xFF;
+  buf[3] = (val >> 24) & 0xFF;
+}
+
+static inline uint16_t getU16(const uint8_t *buf) {
+  return buf[0] | (buf[1] << 8);
+}
+
+static inline uint32_t getU32(const uint8_t *buf) {
+  return buf[0] | (buf[1] << 8) | (buf[2] << 16) | (static_cast<uint32_t>(buf[3]) << 24);
+}
+
+bool surveyPeekHeader(const uint8_t *buf, uint32_t &seq, uint16_t &session) {
+  if (memcmp(buf, SURVEY_MAGIC, sizeof(SURVEY_MAGIC)) || buf[4] != SURVEY_VERSION) {
+    return false;
+  }
+
+  seq = getU32(buf + 8);
+  session = getU16(buf + 12);
+  return true;
+}
+
+bool surveyDecodeRecord(const uint8_t *buf, SurveyRecord &record) {
+  if (!surveyPeekHeader(buf, record.seq, record.session)) {
+    return false;
+  }
+  if (streamCrc16(buf, SURVEY_CRC_OFFSET) != getU16(buf + SURVEY_CRC_OFFSET)) {
+    return false;
+  }
+
+  record.numStations = buf[5];
+  record.numChannels = buf[6];
+  record.stationsDropped = buf[7];
+  record.location = getU16(buf + 14);
+  record.timestamp = getU32(buf + 16);
+  record.scans = getU16(buf + 20);
+  if (record.numStations > SURVEY_MAX_STATIONS || record.numChannels > SURVEY_MAX_CHANNELS) {
+    return false;
+  }
+
+  const uint8_t *p = buf + SURVEY_HEADER_LEN;
+  for (size_t i = 0; i < record.numStations; i++, p += SURVEY_STATION_LEN) {
+    SurveyStation &st = record.stations[i];
+    memcpy(st.bssid, p, 6);
+    st.primary = p[6];
+    st.maxRssi = static_cast<int8_t>(p[7]);
+    st.meanRssi = static_cast<int8_t>(p[8]);
+    st.scansSeen = p[9];
+  }
+
+  p = buf + SURVEY_HEADER_LEN + SURVEY_MAX_STATIONS * SURVEY_STATION_LEN;
+  for (size_t i = 0; i < record.numChannels; i++, p += SURVEY_CHANNEL_LEN) {
+    SurveyChannel &ch = record.channels[i];
+    ch.channel = p[0];
+    ch.maxSignals = p[1];
+    ch.meanPowerDeciDbm = static_cast<int16_t>(getU16(p + 2));
+  }
+
+  return true;
+}
+
+void SurveyAccumulator::begin(uint16_t session, uint16_t location) {
+  _session = session;
+  _location = location;
+  _scans = 0;
+  _timestamp = 0;
+  _stationsDropped = 0;
+  _numStations = 0;
+  _numChannels = 0;
+}
+
+void SurveyAccumulator::beginScan() {
+  if (_scans < UINT16_MAX) {
+    _scans++;
+  }
+}
+
+void SurveyAccumulator::addStation(const uint8_t *bssid, uint8_t primary, int rssi) {
+  StationAgg *agg = nullptr;
+  for (size_t i = 0; i < _numStations; i++) {
+    if (!memcmp(_stations[i].bssid, bssid, 6)) {
+      agg = &_stations[i];
+      break;
+    }
+  }
+
+  if (agg == nullptr) {
+    if (_numStations == SURVEY_MAX_STATIONS) {
+      if (_stationsDropped < UINT8_MAX) {
+        _stationsDropped++;
+      }
+      return;
+    }
+
+    agg = &_stations[_numStations++];
+    memcpy(agg->bssid, bssid, 6);
+    agg->maxRssi = INT8_MIN;
+    agg->rssiSum = 0;
+    agg->scansSeen = 0;
+  }
+
+  // Channel changes are rare; keep the latest.
+  agg->primary = primary;
+  if (rssi > agg->maxRssi) {
+    agg->maxRssi = rssi;
+  }
+  agg->rssiSum += rssi;
+  agg->scansSeen++;
+}
+
+void SurveyAccumulator::addChannel(uint8_t channel, uint8_t signals, power_t power) {
+  ChannelAgg *agg = nullptr;
+  for (size_t i = 0; i < _numChannels; i++) {
+    if (_channels[i].channel == channel) {
+      agg = &_channels[i];
+      break;
+    }
+  }
+
+  if (agg == nullptr) {
+    if (_numChannels == SURVEY_MAX_CHANNELS) {
+      return;
+    }
+
+    agg = &_channels[_numChannels++];
+    agg->channel = channel;
+    agg->maxSignals = 0;
+    agg->powerSum = 0;
+  }
+
+  if (signals > agg->maxSignals) {
+    agg->maxSignals = signals;
+  }
+  agg->powerSum += power;
+}
+
+void SurveyAccumulator::endScan(uint32_t timestamp) {
+  _timestamp = timestamp;
+}
+
+void SurveyAccumulator::encode(uint32_t seq, uint8_t *out) const {
+  memset(out, 0, SURVEY_RECORD_LEN);
+  memcpy(out, SURVEY_MAGIC, sizeof(SURVEY_MAGIC));
+  out[4] = SURVEY_VERSION;
+  out[5] = _numStations;
+  out[6] = _numChannels;
+  out[7] = _stationsDropped;
+  putU32(out + 8, seq);
+  putU16(out + 12, _session);
+  putU16(out + 14, _location);
+  putU32(out + 16, _timestamp);
+  putU16(out + 20, _scans);
+
+  uint8_t *p = out + SURVEY_HEADER_LEN;
+  for (size_t i = 0; i < _numStations; i++, p += SURVEY_STATION_LEN) {
+    const StationAgg &agg = _stations[i];
+    memcpy(p, agg.bssid, 6);
+    p[6] = agg.primary;
+    p[7] = static_cast<uint8_t>(agg.maxRssi);
+    p[8] = static_cast<uint8_t>(static_cast<int8_t>(agg.rssiSum / agg.scansSeen));
+    p[9] = agg.scansSeen > UINT8_MAX ? UINT8_MAX : agg.scansSeen;
+  }
+
+  p = out + SURVEY_HEADER_LEN + SURVEY_MAX_STATIONS * SURVEY_STATION_LEN;
+  for (size_t i = 0; i < _numChannels; i++, p += SURVEY_CHANNEL_LEN) {
+    const ChannelAgg &agg = _channels[i];
+    p[0] = agg.channel;
+    p[1] = agg.maxSignals;
+    // Mean of the linear power, not of the dBm readings.
+    power_t mean = _scans ? agg.powerSum / _scans : 0;
+    putU16(p + 2, static_cast<uint16_t>(powerToDeciDbm(mean)));
+  }
+
+  putU16(out + SURVEY_CRC_OFFSET, streamCrc16(out, SURVEY_CRC_OFFSET));
+}
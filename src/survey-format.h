@@ -0,0 +1,140 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Fixed-size per-location site survey summaries, as stored in SPI flash and exported to the
+// host. This header has no Arduino dependencies so that host-side tools can decode them.
+//
+// All multi-byte integers are little-endian. Each record is exactly SURVEY_RECORD_LEN bytes, so
+// that records tile the flash's 4 KiB erase blocks exactly:
+//
+//   char[4]  magic = "WSVY"
+//   u8       format version (SURVEY_VERSION)
+//   u8       number of station entries in use
+//   u8       number of channel entries in use
+//   u8       number of stations dropped because the station table was full
+//   u32      record sequence number; increases by one for each record written
+//   u16      survey session (one per boot or survey restart)
+//   u16      location number within the session (1, 2, ...)
+//   u32      timestamp of the location's last scan, in milliseconds since boot
+//   u16      number of scans aggregated
+//   u8[2]    reserved (0)
+//   station[SURVEY_MAX_STATIONS], each:
+//     u8[6]    bssid
+//     u8       primary channel
+//     i8       max rssi (dBm)
+//     i8       mean rssi (dBm) over the scans that heard it
+//     u8       number of scans that heard it
+//   channel[SURVEY_MAX_CHANNELS], each:
+//     u8       channel number
+//     u8       max number of signals on the channel in any one scan
+//     i16      mean total power on the channel, in tenths of a dBm (POWER_MIN_DBM * 10 if none)
+//   u8[]     padding (0) up to the CRC
+//   u16      CRC-16/CCITT-FALSE of all preceding bytes in the record
+//
+// Unused station and channel entries are zero.
+
+#ifndef _SURVEY_FORMAT_H
+#define _SURVEY_FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "linear-power.h"
+
+constexpr uint8_t SURVEY_VERSION = 1;
+constexpr size_t SURVEY_RECORD_LEN = 1024;
+constexpr size_t SURVEY_HEADER_LEN = 24;
+constexpr size_t SURVEY_STATION_LEN = 10;
+constexpr size_t SURVEY_CHANNEL_LEN = 4;
+constexpr size_t SURVEY_MAX_STATIONS = 64;
+constexpr size_t SURVEY_MAX_CHANNELS = 32;
+constexpr size_t SURVEY_CRC_OFFSET = SURVEY_RECORD_LEN - 2;
+
+static_assert(SURVEY_HEADER_LEN + SURVEY_MAX_STATIONS * SURVEY_STATION_LEN
+    + SURVEY_MAX_CHANNELS * SURVEY_CHANNEL_LEN <= SURVEY_CRC_OFFSET, "Survey record overflow");
+
+struct SurveyStation {
+  uint8_t bssid[6];
+  uint8_t primary;
+  int8_t maxRssi;
+  int8_t meanRssi;
+  uint8_t scansSeen;
+};
+
+struct SurveyChannel {
+  uint8_t channel;
+  uint8_t maxSignals;
+  int16_t meanPowerDeciDbm;
+};
+
+// A decoded record.
+struct SurveyRecord {
+  uint32_t seq;
+  uint16_t session;
+  uint16_t location;
+  uint32_t timestamp;
+  uint16_t scans;
+  uint8_t numStations;
+  uint8_t numChannels;
+  uint8_t stationsDropped;
+  SurveyStation stations[SURVEY_MAX_STATIONS];
+  SurveyChannel channels[SURVEY_MAX_CHANNELS];
+};
+
+// Read just the sequence number and session of a record from its first SURVEY_HEADER_LEN
+// bytes (e.g. to find the end of the log without reading whole records). Returns false if the
+// magic number or version doesn't match; erased flash reads as all 0xFF and never matches.
+extern bool surveyPeekHeader(const uint8_t *buf, uint32_t &seq, uint16_t &session);
+
+// Validate and decode a whole record. Returns false on a bad magic number, version, or CRC.
+extern bool surveyDecodeRecord(const uint8_t *buf, SurveyRecord &record);
+
+// Aggregates the scans taken at one location into a record.
+class SurveyAccumulator {
+public:
+  SurveyAccumulator() { begin(0, 0); };
+
+  // Discard everything and start aggregating for a new location.
+  void begin(uint16_t session, uint16_t location);
+
+  // Call beginScan(), then addStation() for each station and addChannel() for each channel in
+  // the band plan, then endScan().
+  void beginScan();
+  void addStation(const uint8_t *bssid, uint8_t primary, int rssi);
+  void addChannel(uint8_t channel, uint8_t signals, power_t power);
+  void endScan(uint32_t timestamp);
+
+  uint16_t session() const { return _session; };
+  uint16_t location() const { return _location; };
+  uint16_t scans() const { return _scans; };
+  size_t numStations() const { return _numStations; };
+
+  // Encode the aggregate into a SURVEY_RECORD_LEN-byte record.
+  void encode(uint32_t seq, uint8_t *out) const;
+
+private:
+  struct StationAgg {
+    uint8_t bssid[6];
+    uint8_t primary;
+    int8_t maxRssi;
+    int32_t rssiSum;
+    uint16_t scansSeen;
+  };
+
+  struct ChannelAgg {
+    uint8_t channel;
+    uint8_t maxSignals;
+    power_t powerSum;
+  };
+
+  uint16_t _session;
+  uint16_t _location;
+  uint16_t _scans;
+  uint32_t _timestamp;
+  uint8_t _stationsDropped;
+  size_t _numStations;
+  size_t _numChannels;
+  StationAgg _stations[SURVEY_MAX_STATIONS];
+  ChannelAgg _channels[SURVEY_MAX_CHANNELS];
+};
+
+#endif
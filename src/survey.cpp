@@ -0,0 +1,265 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Site survey mode: aggregate the scans taken at each marked location and append a summary
+// record per location to a circular log in SPI flash, then export the log over USB serial.
+//
+// The log is append-only. Each 4 KiB erase block holds a whole number of records; a block is
+// erased when the write position enters it, which also discards the oldest records once the
+// log wraps. At boot the record headers are scanned for the highest sequence number to find
+// where to resume.
+
+#include "wifi-scanner.h"
+
+static const sfud_flash *surveyFlash = NULL;
+
+static SurveyAccumulator surveyAcc;
+static SurveyStats stats;
+
+static uint16_t session = 0;
+static size_t nextSlot = 0;   // Flash slot that the next record goes in.
+static uint32_t nextSeq = 1;  // Sequence number of the next record.
+
+// Holds one record while it's encoded and written.
+static uint8_t recordBuf[SURVEY_RECORD_LEN];
+
+// Export state.
+static bool exporting = false;
+static size_t exportSlot = 0;     // Slot being sent.
+static size_t exportSlotsLeft = 0; // Slots not yet visited, including exportSlot.
+static uint16_t exportOffset = 0; // Next byte of the record in exportSlot to send.
+static uint32_t exportSeq = 0;
+static uint16_t exportSession = 0;
+
+static uint8_t chunkBody[6 + STREAM_SURVEY_CHUNK_LEN];
+static uint8_t frameBuf[STREAM_MAX_FRAME_LEN];
+static uint8_t encodedBuf[cobsMaxEncodedLen(STREAM_MAX_FRAME_LEN) + 2];
+
+static inline uint32_t slotAddr(size_t slot) {
+  return SURVEY_FLASH_BASE + slot * SURVEY_RECORD_LEN;
+}
+
+// Read a slot's header. Returns false if it doesn't hold a record.
+static bool peekSlot(size_t slot, uint32_t &seq, uint16_t &slotSession) {
+  uint8_t header[SURVEY_HEADER_LEN];
+  if (sfud_read(surveyFlash, slotAddr(slot), sizeof(header), header) != SFUD_SUCCESS) {
+    stats.flashErrors++;
+    return false;
+  }
+
+  return surveyPeekHeader(header, seq, slotSession);
+}
+
+bool surveyBegin() {
+  surveyFlash = spiFlash();
+  if (surveyFlash == NULL || surveyFlash->chip.capacity < SURVEY_FLASH_BASE + SURVEY_FLASH_LEN
+      || SURVEY_RECORD_LEN > surveyFlash->chip.erase_gran
+      || surveyFlash->chip.erase_gran % SURVEY_RECORD_LEN != 0) {
+    DBGPRINT("SPI flash too small for survey log");
+    surveyFlash = NULL;
+    return false;
+  }
+
+  // Resume after the newest record.
+  uint32_t maxSeq = 0;
+  uint16_t maxSession = 0;
+  for (size_t slot = 0; slot < SURVEY_FLASH_SLOTS; slot++) {
+    uint32_t seq;
+    uint16_t slotSession;
+    if (!peekSlot(slot, seq, slotSession)) {
+      continue;
+    }
+
+    stats.recordsInFlash++;
+    if (seq >= maxSeq) {
+      maxSeq = seq;
+      nextSlot = (slot + 1) % SURVEY_FLASH_SLOTS;
+    }
+    if (slotSession > maxSession) {
+      maxSession = slotSession;
+    }
+  }
+
+  nextSeq = maxSeq + 1;
+  session = maxSession + 1;
+  surveyAcc.begin(session, 1);
+  DBGPRINTI("Survey session", session);
+  DBGPRINTI("Survey records in flash", stats.recordsInFlash);
+  return true;
+}
+
+void surveyStartScan() {
+  surveyAcc.beginScan();
+}
+
+void surveyAddStation(const wifi_ap_record_t *pWifiAPRecord) {
+  surveyAcc.addStation(pWifiAPRecord->bssid, pWifiAPRecord->primary, pWifiAPRecord->rssi);
+}
+
+void surveyAddChannelTotals(const Heatmap &heatmap) {
+  for (size_t i = 0; i < heatmap.numChannels(); i++) {
+    surveyAcc.addChannel(heatmap.channelNumAt(i), min(heatmap.signalCountAt(i), (size_t)0xFF),
+        heatmap.powerAt(i));
+  }
+}
+
+void surveyFinishScan(uint32_t timestamp) {
+  surveyAcc.endScan(timestamp);
+}
+
+bool surveyMark() {
+  if (surveyAcc.scans() == 0) {
+    return false;
+  }
+
+  bool ok = false;
+  if (surveyFlash != NULL) {
+    uint32_t start = micros();
+    uint32_t addr = slotAddr(nextSlot);
+    surveyAcc.encode(nextSeq, recordBuf);
+
+    ok = true;
+    if (addr % surveyFlash->chip.erase_gran == 0) {
+      // Entering a new erase block; the records it held (if any) are the oldest in the log.
+      size_t slotsPerBlock = surveyFlash->chip.erase_gran / SURVEY_RECORD_LEN;
+      uint32_t seq;
+      uint16_t slotSession;
+      for (size_t slot = nextSlot; slot < nextSlot + slotsPerBlock; slot++) {
+        if (peekSlot(slot, seq, slotSession)) {
+          stats.recordsInFlash--;
+        }
+      }
+      ok = sfud_erase(surveyFlash, addr, surveyFlash->chip.erase_gran) == SFUD_SUCCESS;
+    }
+    ok = ok && sfud_write(surveyFlash, addr, SURVEY_RECORD_LEN, recordBuf) == SFUD_SUCCESS;
+
+    uint32_t elapsed = micros() - start;
+    if (elapsed > stats.maxWriteMicros) {
+      stats.maxWriteMicros = elapsed;
+    }
+
+    if (ok) {
+      nextSlot = (nextSlot + 1) % SURVEY_FLASH_SLOTS;
+      nextSeq++;
+      stats.recordsWritten++;
+      stats.recordsInFlash++;
+    } else {
+      stats.flashErrors++;
+      DBGPRINTI("Survey flash write failed at", addr);
+    }
+  }
+
+  // Even if it couldn't be saved, the next scans belong to the next location.
+  surveyAcc.begin(session, surveyAcc.location() + 1);
+  return ok;
+}
+
+uint16_t surveySession() {
+  return session;
+}
+
+uint16_t surveyLocation() {
+  return surveyAcc.location();
+}
+
+const SurveyAccumulator &surveyCurrent() {
+  return surveyAcc;
+}
+
+const SurveyStats &surveyStats() {
+  return stats;
+}
+
+// Frame, encode, and send a frame if the serial port can take all of it now.
+static bool sendFrame(uint8_t frameType, const uint8_t *body, size_t bodyLen) {
+  size_t frameLen = streamBuildFrame(frameBuf, frameType, exportSession, body, bodyLen);
+  encodedBuf[0] = 0;
+  size_t encodedLen = 1 + cobsEncode(frameBuf, frameLen, encodedBuf + 1);
+  encodedBuf[encodedLen++] = 0;
+
+  if (Serial.availableForWrite() < static_cast<int>(encodedLen)) {
+    return false; // Host isn't keeping up; try again next loop().
+  }
+
+  Serial.write(encodedBuf, encodedLen);
+  return true;
+}
+
+static void nextExportSlot() {
+  exportOffset = 0;
+  exportSlot = (exportSlot + 1) % SURVEY_FLASH_SLOTS;
+  exportSlotsLeft--;
+}
+
+void surveyExportStart() {
+  if (surveyFlash == NULL || exporting) {
+    return;
+  }
+
+  // The oldest record is the first one at or after the write position.
+  exporting = true;
+  exportSlot = nextSlot;
+  exportSlotsLeft = SURVEY_FLASH_SLOTS;
+  exportOffset = 0;
+  exportSession = session;
+  stats.recordsExported = 0;
+}
+
+bool surveyExporting() {
+  return exporting;
+}
+
+void surveyExportPoll() {
+  if (!exporting) {
+    return;
+  }
+
+  if (exportOffset == 0) {
+    // Find the next slot holding a record.
+    size_t skipped = 0;
+    uint16_t slotSession;
+    while (exportSlotsLeft > 0 && !peekSlot(exportSlot, exportSeq, slotSession)) {
+      nextExportSlot();
+      if (++skipped == SURVEY_EXPORT_SKIP_PER_POLL) {
+        return; // Keep loop() responsive while crossing empty flash.
+      }
+    }
+
+    if (exportSlotsLeft == 0) {
+      uint8_t body[4];
+      body[0] = stats.recordsExported & 0xFF;
+      body[1] = (stats.recordsExported >> 8) & 0xFF;
+      body[2] = (stats.recordsExported >> 16) & 0xFF;
+      body[3] = (stats.recordsExported >> 24) & 0xFF;
+      if (sendFrame(STREAM_FRAME_SURVEY_END, body, sizeof(body))) {
+        exporting = false;
+      }
+      return;
+    }
+  }
+
+  // Send the next chunk of this record, straight from flash.
+  size_t len = min(STREAM_SURVEY_CHUNK_LEN, SURVEY_RECORD_LEN - exportOffset);
+  chunkBody[0] = exportSeq & 0xFF;
+  chunkBody[1] = (exportSeq >> 8) & 0xFF;
+  chunkBody[2] = (exportSeq >> 16) & 0xFF;
+  chunkBody[3] = (exportSeq >> 24) & 0xFF;
+  chunkBody[4] = exportOffset & 0xFF;
+  chunkBody[5] = (exportOffset >> 8) & 0xFF;
+  if (sfud_read(surveyFlash, slotAddr(exportSlot) + exportOffset, len, chunkBody + 6)
+      != SFUD_SUCCESS) {
+    // Skip the rest of this record; the host discards the partial record.
+    stats.flashErrors++;
+    nextExportSlot();
+    return;
+  }
+
+  if (!sendFrame(STREAM_FRAME_SURVEY_CHUNK, chunkBody, 6 + len)) {
+    return;
+  }
+
+  exportOffset += len;
+  if (exportOffset == SURVEY_RECORD_LEN) {
+    stats.recordsExported++;
+    nextExportSlot();
+  }
+}
@@ -0,0 +1,60 @@
+// (c) Copyright 2022 Aaron Kimball
+
+#ifndef _SURVEY_H
+#define _SURVEY_H
+
+#include "survey-format.h"
+
+class Heatmap;
+
+// Site survey records are kept in a circular log in this region of the SPI flash (see
+// spi-flash.h).
+constexpr uint32_t SURVEY_FLASH_BASE = 0x100000;
+constexpr uint32_t SURVEY_FLASH_LEN = 0x200000;
+constexpr size_t SURVEY_FLASH_SLOTS = SURVEY_FLASH_LEN / SURVEY_RECORD_LEN;
+
+// In survey mode, scan this often (in ms) while standing at a location.
+constexpr uint32_t SURVEY_SCAN_INTERVAL_MILLIS = 5000;
+
+// Hold "Mark" at least this long (in ms) to export the survey instead of marking a location.
+constexpr uint32_t SURVEY_EXPORT_HOLD_MILLIS = 2000;
+
+// Max empty flash slots skipped per call to surveyExportPoll().
+constexpr size_t SURVEY_EXPORT_SKIP_PER_POLL = 32;
+
+struct SurveyStats {
+  uint32_t recordsWritten;  // Since boot.
+  uint32_t recordsInFlash;  // Including those from earlier sessions.
+  uint32_t flashErrors;
+  uint32_t maxWriteMicros;  // Longest erase + write of one record.
+  uint32_t recordsExported; // By the current or most recent export.
+};
+
+// Open the flash and find the end of the log. Starts a new survey session at location 1.
+extern bool surveyBegin();
+
+// Add a scan to the current location: call surveyStartScan(), then surveyAddStation() for each
+// station and surveyAddChannelTotals() for each band heatmap, then surveyFinishScan().
+extern void surveyStartScan();
+extern void surveyAddStation(const wifi_ap_record_t *pWifiAPRecord);
+extern void surveyAddChannelTotals(const Heatmap &heatmap);
+extern void surveyFinishScan(uint32_t timestamp);
+
+// Save the current location's summary to flash and move on to the next location. Returns false
+// if nothing was written (no scans at this location yet, or a flash error).
+extern bool surveyMark();
+
+extern uint16_t surveySession();
+extern uint16_t surveyLocation();
+extern const SurveyAccumulator &surveyCurrent();
+
+// Send every record in the log, oldest first, over USB serial as STREAM_FRAME_SURVEY_CHUNK
+// frames, followed by STREAM_FRAME_SURVEY_END. Records are read from flash a chunk at a time by
+// surveyExportPoll(), which must be called from loop() until surveyExporting() is false.
+extern void surveyExportStart();
+extern bool surveyExporting();
+extern void surveyExportPoll();
+
+extern const SurveyStats &surveyStats();
+
+#endif
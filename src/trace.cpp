@@ -0,0 +1,144 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Record timing spans for each phase of the scan / render pipeline into a ring buffer that
+// can be dumped over serial, and summarize them as p50/p99 latencies.
+
+#include "wifi-scanner.h"
+
+static TraceSpan traceRing[TRACE_RING_SIZE];
+static size_t traceHead = 0; // Index where the next span will be written.
+static size_t traceCount = 0; // Number of valid spans in the ring (saturates at TRACE_RING_SIZE).
+static unsigned int scansSinceSummary = 0;
+
+// Scratch space for sorting a phase's durations when computing percentiles.
+static uint32_t traceSortBuf[TRACE_RING_SIZE];
+
+static constexpr size_t TRACE_LINE_LEN = 64;
+static char traceLine[TRACE_LINE_LEN];
+
+#ifdef DWT
+static constexpr uint32_t TICKS_PER_MICRO = F_CPU / 1000000;
+#else
+static constexpr uint32_t TICKS_PER_MICRO = 1; // micros() fallback.
+#endif
+
+static const char *phaseNames[TRACE_NUM_PHASES] = {
+  "scanNetworks",
+  "makeWifiRow",
+  "heatmap",
+  "render",
+  "sdWrite",
+  "advise",
+  "chanScan",
+};
+
+const char *tracePhaseName(TracePhase phase) {
+  if (phase >= TRACE_NUM_PHASES) {
+    return "?";
+  }
+
+  return phaseNames[phase];
+}
+
+void traceSetup() {
+#ifdef DWT
+  // Enable the Cortex-M4 DWT cycle counter; 1 tick == 1 cpu clock cycle.
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+uint32_t traceTicks() {
+#ifdef DWT
+  return DWT->CYCCNT;
+#else
+  return micros();
+#endif
+}
+
+uint32_t traceTicksToMicros(uint32_t ticks) {
+  return ticks / TICKS_PER_MICRO;
+}
+
+void traceRecord(TracePhase phase, uint32_t startTicks, uint8_t arg) {
+  TraceSpan &span = traceRing[traceHead];
+  span.start = startTicks;
+  span.duration = traceTicks() - startTicks; // unsigned subtraction handles counter wraparound.
+  span.phase = phase;
+  span.arg = arg;
+
+  traceHead = (traceHead + 1) % TRACE_RING_SIZE;
+  if (traceCount < TRACE_RING_SIZE) {
+    traceCount++;
+  }
+}
+
+void traceScanComplete() {
+  scansSinceSummary++;
+  if (scansSinceSummary >= TRACE_SUMMARY_INTERVAL) {
+    scansSinceSummary = 0;
+    traceSummary();
+  }
+}
+
+static int compareU32(const void *a, const void *b) {
+  uint32_t x = *reinterpret_cast<const uint32_t*>(a);
+  uint32_t y = *reinterpret_cast<const uint32_t*>(b);
+  return (x > y) - (x < y);
+}
+
+bool tracePercentiles(TracePhase phase, uint32_t &p50Micros, uint32_t &p99Micros) {
+  size_t n = 0;
+  for (size_t i = 0; i < traceCount; i++) {
+    if (traceRing[i].phase == phase) {
+      traceSortBuf[n++] = traceRing[i].duration;
+    }
+  }
+
+  if (n == 0) {
+    p50Micros = 0;
+    p99Micros = 0;
+    return false;
+  }
+
+  qsort(traceSortBuf, n, sizeof(uint32_t), compareU32);
+
+  // Nearest-rank percentiles.
+  size_t p50Idx = (n * 50 + 99) / 100 - 1;
+  size_t p99Idx = (n * 99 + 99) / 100 - 1;
+  p50Micros = traceTicksToMicros(traceSortBuf[p50Idx]);
+  p99Micros = traceTicksToMicros(traceSortBuf[p99Idx]);
+  return true;
+}
+
+void traceDump() {
+  // Compact format; one span per line: "phase,arg,start,duration" with start and duration in
+  // raw ticks. The header line gives the tick rate needed to convert to wall time.
+  snprintf(traceLine, TRACE_LINE_LEN, "trace: %u spans; %lu ticks/us", traceCount,
+      (unsigned long)TICKS_PER_MICRO);
+  DBGPRINT(traceLine);
+
+  // Oldest span is at traceHead if the ring has wrapped, otherwise at 0.
+  size_t idx = traceCount < TRACE_RING_SIZE ? 0 : traceHead;
+  for (size_t i = 0; i < traceCount; i++) {
+    const TraceSpan &span = traceRing[idx];
+    snprintf(traceLine, TRACE_LINE_LEN, "%u,%u,%lu,%lu", span.phase, span.arg,
+        (unsigned long)span.start, (unsigned long)span.duration);
+    DBGPRINT(traceLine);
+    idx = (idx + 1) % TRACE_RING_SIZE;
+  }
+}
+
+void traceSummary() {
+  for (uint8_t phase = 0; phase < TRACE_NUM_PHASES; phase++) {
+    uint32_t p50, p99;
+    if (!tracePercentiles(static_cast<TracePhase>(phase), p50, p99)) {
+      continue;
+    }
+
+    snprintf(traceLine, TRACE_LINE_LEN, "%s: p50=%lu us p99=%lu us",
+        tracePhaseName(static_cast<TracePhase>(phase)), (unsigned long)p50, (unsigned long)p99);
+    DBGPRINT(traceLine);
+  }
+}
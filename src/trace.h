@@ -0,0 +1,60 @@
+// (c) Copyright 2022 Aaron Kimball
+
+#ifndef _TRACE_H
+#define _TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Phases of the scan pipeline that we record timing spans for.
+enum TracePhase : uint8_t {
+  TRACE_SCAN_NETWORKS = 0, // WiFi.scanNetworks() call, start to finish.
+  TRACE_MAKE_WIFI_ROW = 1, // Construct the widgets for a single station row.
+  TRACE_HEATMAP = 2,       // Build a band heatmap from the stations, when its page is shown.
+  TRACE_RENDER = 3,        // screen.render() following a scan.
+  TRACE_SD_WRITE = 4,      // Write-behind SD log sector write.
+  TRACE_ADVISE = 5,        // Score candidate channels for both bands after a scan.
+  TRACE_CHANNEL_SCAN = 6,  // Single-channel scan within a SCAN_SCHEDULER sweep; arg is channel.
+  TRACE_NUM_PHASES = 7
+};
+
+// A completed span. Times are in trace ticks (CPU cycles if the DWT cycle counter is available,
+// otherwise microseconds); use traceTicksToMicros() to convert.
+struct TraceSpan {
+  uint32_t start;
+  uint32_t duration;
+  uint8_t phase;
+  uint8_t arg; // Phase-specific argument; e.g., the wifiIdx for per-station phases.
+};
+
+// Number of spans retained in the ring buffer. Once full, the oldest span is overwritten.
+constexpr size_t TRACE_RING_SIZE = 256;
+
+// Print a per-phase p50/p99 summary over serial every N calls to traceScanComplete().
+constexpr unsigned int TRACE_SUMMARY_INTERVAL = 10;
+
+// Enable the cycle counter. Call once from setup().
+extern void traceSetup();
+
+// Return the current time in trace ticks.
+extern uint32_t traceTicks();
+extern uint32_t traceTicksToMicros(uint32_t ticks);
+
+// Record a span for `phase` that began at `startTicks` and ends now.
+extern void traceRecord(TracePhase phase, uint32_t startTicks, uint8_t arg=0);
+
+// Mark the end of a full scan + render cycle. Emits a summary every TRACE_SUMMARY_INTERVAL scans.
+extern void traceScanComplete();
+
+// Compute the p50 and p99 durations (in microseconds) of the spans in the ring buffer for the
+// specified phase. Returns false if no spans for that phase are retained.
+extern bool tracePercentiles(TracePhase phase, uint32_t &p50Micros, uint32_t &p99Micros);
+
+// Print all retained spans, oldest first, over serial.
+extern void traceDump();
+// Print the per-phase p50/p99 summary over serial.
+extern void traceSummary();
+
+extern const char *tracePhaseName(TracePhase phase);
+
+#endif
@@ -6,13 +6,38 @@
 
 // fwd declarations.
 static void scanWifi();
+static void renderScanResults();
 static void displayDetails(size_t wifiIdx);
+static void displayTracking(size_t wifiIdx);
 static void populateStationDetails(size_t wifiIdx);
 static void disableStation(size_t wifiIdx);
 static void enableStation(size_t wifiIdx);
 static void populateHeatmapChannelPlan(Heatmap *heatmap, const tc::const_array<int> &channelPlan);
 static void recordSignalHeatmap(const wifi_ap_record_t *pWifiAPRecord, Heatmap *bandHeatmap);
-static Heatmap *getHeatmapForChannel(int chan);
+static void recordStation(int wifiIdx);
+static void recordCongestionHistory();
+static void updateChannelAdvice();
+static void updateHeatmapDiffs();
+static void updateBandTotals();
+static void buildBandHeatmap(bool is24GHz);
+static const wifi_ap_record_t *getScanRecord(size_t wifiIdx);
+static size_t selectedStationIdx();
+static void bindStationList(bool keepSelection);
+static void setFilterStatusLine();
+#ifdef SURVEY_MODE
+static void setSurveyStatusLine();
+static void surveyMarkReleased(bool longPress);
+#endif
+#ifdef ROGUE_DETECT
+static void captureBaseline();
+static bool setRogueStatusLine();
+static uint16_t apStatusColor(ApStatus status);
+#endif
+static String getBssidStr(size_t wifiIdx);
+static void radioBegin();
+#ifdef FAST_BOOT
+static void waitBootScan();
+#endif
 
 // Button handler functions.
 static void stationDetailsHandler(uint8_t btnId, uint8_t btnState);
@@ -23,7 +48,28 @@ static void scrollUpHandler(uint8_t btnId, uint8_t btnState);
 static void scrollDownHandler(uint8_t btnId, uint8_t btnState);
 static void enableStationHandler(uint8_t btnId, uint8_t btnState);
 static void disableStationHandler(uint8_t btnId, uint8_t btnState);
-
+static void trackStationHandler(uint8_t btnId, uint8_t btnState);
+static void trackBackHandler(uint8_t btnId, uint8_t btnState);
+static void heatmapModeHandler(uint8_t btnId, uint8_t btnState);
+static void heatmapPinHandler(uint8_t btnId, uint8_t btnState);
+static void heatmapUnpinHandler(uint8_t btnId, uint8_t btnState);
+static void historyChannelHandler(uint8_t btnId, uint8_t btnState);
+static void historyRangeHandler(uint8_t btnId, uint8_t btnState);
+static void filterFieldHandler(uint8_t btnId, uint8_t btnState);
+static void filterValueHandler(uint8_t btnId, uint8_t btnState);
+#ifdef DEBUG
+static void dumpTraceHandler(uint8_t btnId, uint8_t btnState);
+static void debugPageFlipHandler(uint8_t btnId, uint8_t btnState);
+#endif
+
+
+// In headless mode no widgets are built and nothing is drawn after boot; scans run back to back
+// and feed only the data model and the serial/SD outputs. Set at boot; see setup().
+static bool headless = false;
+
+bool isHeadless() {
+  return headless;
+}
 
 ////////    GUI widgets and layout   ////////
 
@@ -45,7 +91,16 @@ static Rows rowLayout(4); // 3 rows.
 // the top row (#0) is a set of buttons.
 static Cols topRow(4); // 4 columns
 static const char detailsStr[] = "Details";
+#ifdef SURVEY_MODE
+static const char rescanStr[] = "Mark"; // Scans run continuously; the button marks locations.
+#else
 static const char rescanStr[] = "Refresh";
+#endif
+#if defined(SURVEY_MODE) || defined(ROGUE_DETECT)
+// When the rescan button was pressed. A long press exports the survey (after
+// SURVEY_EXPORT_HOLD_MILLIS) or captures the AP baseline (after BASELINE_CAPTURE_HOLD_MILLIS).
+static uint32_t rescanPressMillis = 0;
+#endif
 static const char heatmapStr[] = "Heatmap";
 static const char backStr[] = "Back";
 static UIButton detailsButton(detailsStr);
@@ -58,11 +113,16 @@ static const char *hdrSsidStr = "SSID";
 static const char *hdrChannelStr = "Chan";
 static const char *hdrRssiStr = "RSSI";
 static const char *hdrBssidStr = "BSSID";
+static const char *hdrVendorStr = "Vendor";
 
 static StrLabel hdrSsid = StrLabel(hdrSsidStr);
 static StrLabel hdrChannel = StrLabel(hdrChannelStr);
 static StrLabel hdrRssi = StrLabel(hdrRssiStr);
+#ifdef STATION_LIST_VENDOR
+static StrLabel hdrBssid = StrLabel(hdrVendorStr);
+#else
 static StrLabel hdrBssid = StrLabel(hdrBssidStr);
+#endif
 static Cols dataHeaderRow(4); // 4 columns.
 
 // Row 2: The main focus of the screen:
@@ -74,6 +134,35 @@ static Panel wifiScrollContainer; // Wrap VScroll in a container for padding.
 
 static Heatmap wifi24GHzHeatmap; // Heatmap of congestion on 2.4 GHz channels
 static Heatmap wifi50GHzHeatmap; // Heatmap of congestion on 5 GHz channels
+// A band heatmap is only built when its page is shown (see buildBandHeatmap()); a scan, or
+// enabling or disabling a station, just marks it stale. The history and baseline diffs use these
+// per-channel totals instead, which are kept current at a few additions per station.
+static bool heatmap24GHzStale = true;
+static bool heatmap50GHzStale = true;
+static HeatmapTotals bandTotals24GHz;
+static HeatmapTotals bandTotals50GHz;
+// Both band heatmaps draw in this mode; the hat "in" button toggles it.
+static HeatmapMode bandHeatmapMode = HEATMAP_BLOCKS;
+// Each band's change since the baseline pinned with hat "up"; drawn in HEATMAP_DIFF mode.
+static HeatmapDiff wifi24GHzDiff;
+static HeatmapDiff wifi50GHzDiff;
+
+// Row 1 on the heatmap pages: the best channels for a new AP in that band.
+static ChannelAdvisor channelAdvisor24GHz(true);
+static ChannelAdvisor channelAdvisor50GHz(false);
+static constexpr size_t ADVICE_TEXT_LEN = 40; // max width of a line in font 2 is ~40 chars.
+static char advice24GHzText[ADVICE_TEXT_LEN + 1];
+static char advice50GHzText[ADVICE_TEXT_LEN + 1];
+static StrLabel advice24GHzLabel(advice24GHzText);
+static StrLabel advice50GHzLabel(advice50GHzText);
+
+// History page: one channel's congestion over time, at a chosen resolution.
+static CongestionHistory congestionHistory;
+static CongestionPlot congestionPlot(congestionHistory);
+static constexpr size_t HISTORY_TITLE_LEN = 40;
+static char historyTitleText[HISTORY_TITLE_LEN + 1];
+static StrLabel historyTitleLabel(historyTitleText);
+static const char historyStr[] = "History";
 
 static Panel detailsPanel;
 /**
@@ -81,7 +170,7 @@ static Panel detailsPanel;
  *
  * 0 StationInfoCols:: ChanHdr:  Chan  (empty) RssiHdr: Rssi
  * 1 SsidCols::        SsidHdr:  SSID
- * 2 BssidCols::       BssidHdr: BSSID
+ * 2 BssidCols::       BssidHdr: BSSID Vendor
  * 3 ModeBwCols::      Modes (empty) Bandwidth
  * 4 SecurityCols::    SecurityHdr: Security
  * 5 (empty row; EQUAL space to bottom-justify detailsHeatmap)
@@ -98,6 +187,7 @@ static StrLabel detailsSsid; // holds actual SSID of selected station.
 
 static StrLabel detailsBssidHdr(hdrBssidStr);
 static StrLabel detailsBssid; // holds actual BSSID str of selected station.
+static StrLabel detailsVendor; // holds vendor name for the BSSID's OUI, if known.
 
 static constexpr size_t MODES_TEXT_LEN = 16;
 static char detailsModesText[MODES_TEXT_LEN]; // Long enough for "802.11: b, g, n"
@@ -128,17 +218,83 @@ static Heatmap detailsHeatmap;
 static Rows detailsRows(8);
 static Cols detailsStationInfoCols(5);
 static Cols detailsSsidCols(2);
-static Cols detailsBssidCols(2);
+static Cols detailsBssidCols(3);
 static Cols detailsModeBwCols(3);
 static Cols detailsSecurityCols(2);
 
+// Tracking page: one station's RSSI, from fast scans of its primary channel only. The title
+// takes the header row; trackPanel holds a large RSSI readout over a sparkline of recent samples.
+static const char trackStr[] = "Track";
+static UIButton detailsTrackBtn(trackStr);
+static UIButton trackBackBtn(backStr);
+static Panel trackPanel;
+static Rows trackRows(2);
+static constexpr size_t TRACK_TITLE_LEN = 40;
+static char trackTitleText[TRACK_TITLE_LEN + 1];
+static StrLabel trackTitleLabel(trackTitleText);
+static constexpr size_t TRACK_RSSI_LEN = 8;
+static char trackRssiText[TRACK_RSSI_LEN + 1];
+static StrLabel trackRssiLabel(trackRssiText);
+static RssiSparkline trackSparkline;
+static bool tracking = false; // True while the tracking page is up; see trackPoll().
+static uint32_t trackStatusMillis = 0; // millis() when the status line last showed the rate.
+static uint32_t fullScanMillis = 0; // Wall time of the last scanWifi() scan, for comparison.
+
+#ifdef DEBUG
+// The debug page is a panel of text lines that report profiling statistics.
+static constexpr size_t DEBUG_PAGE_LINES = 14;
+static constexpr size_t DEBUG_LINE_LEN = 52; // max width of a line in font 0 is ~52 chars.
+static char debugPageText[DEBUG_PAGE_LINES][DEBUG_LINE_LEN + 1];
+static StrLabel debugPageLabels[DEBUG_PAGE_LINES];
+static Rows debugRows(DEBUG_PAGE_LINES);
+static Panel debugPanel;
+static const char debugStr[] = "Debug";
+
+// The statistics don't all fit on one screen, so the page has two; hat up/down flips them.
+// Page 0 has a row per trace phase, five of heap stats and one of RPC counts.
+static constexpr size_t DEBUG_CORE_LINES = TRACE_NUM_PHASES + 6;
+// Page 1 has the tracking row, plus those of each feature compiled in.
+static constexpr size_t DEBUG_FEATURE_LINES = 1
+#ifdef SERIAL_STREAM
+    + 1
+#endif
+#ifdef SCAN_LOG_RECORD
+    + 1
+#endif
+#ifdef SCAN_SCHEDULER
+    + 1
+#endif
+#ifdef MULTI_PASS_SCAN
+    + 2
+#endif
+#ifdef LOW_POWER_MONITOR
+    + 1
+#endif
+#ifdef SURVEY_MODE
+    + 1
+#endif
+#ifdef HISTORY_LOG
+    + 1
+#endif
+    ;
+static_assert(DEBUG_CORE_LINES <= DEBUG_PAGE_LINES, "Debug page 0 has more rows than fit");
+static_assert(DEBUG_FEATURE_LINES <= DEBUG_PAGE_LINES, "Debug page 1 has more rows than fit");
+static uint8_t debugPageNum = 0;
+#endif
 
 // Enumerate all main-area content panels the user can cycle through.
 constexpr unsigned int ContentCarousel_SignalList = 0;  // Show a list of wifi SSIDs
 constexpr unsigned int ContentCarousel_Heatmap24 = 1;   // Show a heatmap of 2.4 GHz channel usage
 constexpr unsigned int ContentCarousel_Heatmap50 = 2;   // Show a heatmap of 5 GHz channel usage
-constexpr unsigned int MaxContentCarousel = ContentCarousel_Heatmap50;
-constexpr unsigned int ContentCarousel_Details = 3; // Show details of a given ssid.
+constexpr unsigned int ContentCarousel_History = 3;     // Plot one channel's congestion over time
+constexpr unsigned int ContentCarousel_Debug = 4;       // Show profiling stats (DEBUG builds only)
+#ifdef DEBUG
+constexpr unsigned int MaxContentCarousel = ContentCarousel_Debug;
+#else
+constexpr unsigned int MaxContentCarousel = ContentCarousel_History;
+#endif
+constexpr unsigned int ContentCarousel_Details = 5; // Show details of a given ssid.
+constexpr unsigned int ContentCarousel_Tracking = 6; // Track one ssid's RSSI (from Details).
 // (Note that detailsPanel isn't accessed through the 'cycle carousel' button, it's activated
 // by pressing the 5-way hat "in" button on a selectable line of the VScroll. Thus, MaxCC is
 // one below that.)
@@ -156,6 +312,8 @@ static tc::vector<uint8_t> buttonGpioPins;
 
 static constexpr uint8_t HAT_UP_DEBOUNCE_ID = 0;
 static constexpr uint8_t HAT_DOWN_DEBOUNCE_ID = 1;
+static constexpr uint8_t HAT_LEFT_DEBOUNCE_ID = 2;
+static constexpr uint8_t HAT_RIGHT_DEBOUNCE_ID = 3;
 static constexpr uint8_t HAT_IN_DEBOUNCE_ID = 4; // debounce id for 5-way hat "IN" / "OK"
 // Btn 1 is the debouncer id for WIO_KEY_C (left-most button on top):
 static constexpr uint8_t TOP_BUTTON_1_DEBOUNCE_ID = 5;
@@ -181,17 +339,36 @@ static inline void setButton3(UIButton *uiButton, buttonHandler_t handlerFn) {
   topRow.setColumn(2, uiButton, 75);
 }
 
+////////    Station list filters    ////////
+
+// Filter attributes of each station in the most recent scan; computed once per scan.
+static stationAttrs_t stationFilterAttrs[MAX_STATIONS];
+static StationFilter stationFilter;
+static StationFilterField stationFilterField = FILTER_FIELD_BAND; // Field changed by hat-right.
+
+static int numScanStations = 0; // Number of stations found by the most recent scan.
+
+// The wifiIdx of each station whose row is bound into wifiListScroll, in order.
+static uint8_t visibleStations[MAX_STATIONS];
+static size_t numVisibleStations = 0;
+
+#ifdef ROGUE_DETECT
+// How each station in the most recent scan compares to the known-AP baseline.
+static ApStatus stationApStatus[MAX_STATIONS];
+#endif
+
+
 ////////    bitfield for suppression of stations in interference chart    ////////
 
-// A bitfield of at least 60 bits where a 1 bit at position i indicates that wifi_idx 'i'
+// A bitfield of MAX_STATIONS bits where a 1 bit at position i indicates that wifi_idx 'i'
 // is a *disabled* SSID that should be ignored in heatmaps.
-static uint32_t stationDisabledBits[2] = {0, 0};
+static uint32_t stationDisabledBits[(MAX_STATIONS + 31) / 32];
 
 static bool isStationDisabled(size_t wifiIdx) {
   size_t arrayOffset = wifiIdx / 32;
   size_t bitPosition = wifiIdx % 32;
 
-  return (stationDisabledBits[arrayOffset] & (1 << bitPosition)) != 0;
+  return (stationDisabledBits[arrayOffset] & (1UL << bitPosition)) != 0;
 }
 
 // Update the bitfield for a particular wifiIdx's disabled status.
@@ -200,15 +377,16 @@ static void setStationDisabledBit(size_t wifiIdx, bool disabled) {
   size_t bitPosition = wifiIdx % 32;
 
   if (disabled) {
-    stationDisabledBits[arrayOffset] |= (1 << bitPosition);
+    stationDisabledBits[arrayOffset] |= (1UL << bitPosition);
   } else {
-    stationDisabledBits[arrayOffset] &= ~(1 << bitPosition);
+    stationDisabledBits[arrayOffset] &= ~(1UL << bitPosition);
   }
+
+  stationFilterAttrs[wifiIdx] = stationAttrsSetDisabled(stationFilterAttrs[wifiIdx], disabled);
 }
 
 void clearDisabledStations() {
-  stationDisabledBits[0] = 0;
-  stationDisabledBits[1] = 0;
+  memset(stationDisabledBits, 0, sizeof(stationDisabledBits));
 }
 
 
@@ -227,21 +405,7 @@ static constexpr tc::const_array<int> wifi50GHzChannelPlan = {
   169, // 173, 177,          // U-NII-4 1W, indoor usage only (since 2020)
 };
 
-// 20 MHz channels in the 5 GHz US channel numbering plan are all 4 apart from each other
-// (preserving room for the 40 and 80 MHz channels in between, where appropriate).
-// See https://en.wikipedia.org/wiki/List_of_WLAN_channels#5_GHz_(802.11a/h/j/n/ac/ax)
-static constexpr int ADJACENT_50_GHZ_CHAN_DELTA = 4;
-
-// 2.4 GHz channel numbers with 5 MHz bandwidth are all 1 apart from each other.
-static constexpr int ADJACENT_24_GHZ_CHAN_DELTA = 1;
-
-// 2.4 GHz channel ids in the US band plan range from 1 to 11.
-static constexpr int min24GHzChannelNum = 1;
-static constexpr int max24GHzChannelNum = 11;
-
-// 5 GHz channel ids in teh US band plan range from 32 to 177 (U-NII-4)
-static constexpr int min50GHzChannelNum = 32;
-static constexpr int max50GHzChannelNum = 177;
+// Band limits and channel spacing are defined in spectrum.h.
 
 
 
@@ -260,41 +424,264 @@ void displayStationList() {
   buttons[HAT_IN_DEBOUNCE_ID].setHandler(stationDetailsHandler); // hat-in enabled.
   buttons[HAT_UP_DEBOUNCE_ID].setHandler(scrollUpHandler); // hat scrolling enabled.
   buttons[HAT_DOWN_DEBOUNCE_ID].setHandler(scrollDownHandler);
+  buttons[HAT_LEFT_DEBOUNCE_ID].setHandler(filterFieldHandler); // hat left/right set filters.
+  buttons[HAT_RIGHT_DEBOUNCE_ID].setHandler(filterValueHandler);
   carouselPos = ContentCarousel_SignalList;
-  setStatusLine("");
+  if (stationFilter.isActive()) {
+    // Stations may have been enabled or disabled since the list was last bound.
+    bindStationList(true);
+    setFilterStatusLine();
+  } else {
+    setStatusLine("");
+  }
+}
+
+// Describe the band heatmap shown in the current mode.
+static const char *bandHeatmapStatus(bool is24GHz) {
+  switch (bandHeatmapMode) {
+  case HEATMAP_POWER_BARS:
+    return is24GHz
+        ? "2.4 GHz total power per channel (dBm)" : "5 GHz total power per channel (dBm)";
+  case HEATMAP_DIFF:
+    return is24GHz ? "2.4 GHz change since baseline (dB)" : "5 GHz change since baseline (dB)";
+  default:
+    return is24GHz ? "2.4 GHz spectrum congestion" : "5 GHz spectrum congestion";
+  }
 }
 
 void displayHeatmap24GHz() {
   carouselPos = ContentCarousel_Heatmap24;
+  buildBandHeatmap(true);
 
-  rowLayout.setRow(1, NULL, 0); // Blank out header row above vscroll.
+  rowLayout.setRow(1, &advice24GHzLabel, 16); // Recommended channels above the heatmap.
   rowLayout.setRow(2, &wifi24GHzHeatmap, EQUAL); // Put in the 2.4 GHz spectrum heatmap
-  setStatusLine("2.4 GHz spectrum congestion");
+  setStatusLine(bandHeatmapStatus(true));
   setButton1(NULL, emptyBtnHandler); // disable 'details' btn.
   setButton2(&rescanButton, refreshHandler);
   setButton3(&heatmapButton, toggleHeatmapButtonHandler);
   heatmapButton.setText(heatmapStr);
-  buttons[HAT_IN_DEBOUNCE_ID].setHandler(emptyBtnHandler); // hat-in disabled.
-  buttons[HAT_UP_DEBOUNCE_ID].setHandler(emptyBtnHandler); // hat scrolling disabled.
-  buttons[HAT_DOWN_DEBOUNCE_ID].setHandler(emptyBtnHandler);
+  buttons[HAT_IN_DEBOUNCE_ID].setHandler(heatmapModeHandler); // hat-in cycles heatmap modes.
+  buttons[HAT_UP_DEBOUNCE_ID].setHandler(heatmapPinHandler); // hat up/down pin/unpin baseline.
+  buttons[HAT_DOWN_DEBOUNCE_ID].setHandler(heatmapUnpinHandler);
+  buttons[HAT_LEFT_DEBOUNCE_ID].setHandler(emptyBtnHandler); // filters disabled.
+  buttons[HAT_RIGHT_DEBOUNCE_ID].setHandler(emptyBtnHandler);
 }
 
 void displayHeatmap50GHz() {
   carouselPos = ContentCarousel_Heatmap50;
+  buildBandHeatmap(false);
 
-  rowLayout.setRow(1, NULL, 0); // Blank out header row above vscroll.
+  rowLayout.setRow(1, &advice50GHzLabel, 16); // Recommended channels above the heatmap.
   rowLayout.setRow(2, &wifi50GHzHeatmap, EQUAL); // Put in the 5 GHz spectrum heatmap
-  setStatusLine("5 GHz spectrum congestion");
+  setStatusLine(bandHeatmapStatus(false));
+  setButton1(NULL, emptyBtnHandler); // disable 'details' btn.
+  setButton2(&rescanButton, refreshHandler);
+  setButton3(&heatmapButton, toggleHeatmapButtonHandler);
+  // heatmapButton, when pressed again, goes to the history page.
+  heatmapButton.setText(historyStr);
+  buttons[HAT_IN_DEBOUNCE_ID].setHandler(heatmapModeHandler); // hat-in cycles heatmap modes.
+  buttons[HAT_UP_DEBOUNCE_ID].setHandler(heatmapPinHandler); // hat up/down pin/unpin baseline.
+  buttons[HAT_DOWN_DEBOUNCE_ID].setHandler(heatmapUnpinHandler);
+  buttons[HAT_LEFT_DEBOUNCE_ID].setHandler(emptyBtnHandler); // filters disabled.
+  buttons[HAT_RIGHT_DEBOUNCE_ID].setHandler(emptyBtnHandler);
+}
+
+// Describe the channel and time range shown on the history page.
+static void setHistoryTitle() {
+  size_t chanIdx = congestionPlot.channelIdx();
+  CongestionLevel level = congestionPlot.level();
+  static const char *rangeUnits[CONGESTION_NUM_LEVELS] = { "scans", "minutes", "hours", "days" };
+  if (chanIdx >= congestionHistory.numChannels()) {
+    historyTitleText[0] = '\0';
+    return;
+  }
+
+  snprintf(historyTitleText, HISTORY_TITLE_LEN + 1, "Channel %d, last %u %s",
+      congestionHistory.channelNumAt(chanIdx), CONGESTION_RING_LEN[level], rangeUnits[level]);
+}
+
+void displayHistoryPage() {
+  carouselPos = ContentCarousel_History;
+
+  setHistoryTitle();
+  rowLayout.setRow(1, &historyTitleLabel, 16);
+  rowLayout.setRow(2, &congestionPlot, EQUAL);
+  setStatusLine("Power min/avg/max (dBm). Hat: channel, range");
   setButton1(NULL, emptyBtnHandler); // disable 'details' btn.
   setButton2(&rescanButton, refreshHandler);
   setButton3(&heatmapButton, toggleHeatmapButtonHandler);
+#ifdef DEBUG
+  // heatmapButton, when pressed again, goes to the debug page.
+  heatmapButton.setText(debugStr);
+#else
   // heatmapButton, when pressed again, goes back to station list.
   heatmapButton.setText(backStr);
-  buttons[HAT_IN_DEBOUNCE_ID].setHandler(emptyBtnHandler); // hat-in disabled.
+#endif
+  buttons[HAT_IN_DEBOUNCE_ID].setHandler(historyRangeHandler); // hat-in changes time range.
   buttons[HAT_UP_DEBOUNCE_ID].setHandler(emptyBtnHandler); // hat scrolling disabled.
   buttons[HAT_DOWN_DEBOUNCE_ID].setHandler(emptyBtnHandler);
+  buttons[HAT_LEFT_DEBOUNCE_ID].setHandler(historyChannelHandler); // hat left/right: channel.
+  buttons[HAT_RIGHT_DEBOUNCE_ID].setHandler(historyChannelHandler);
+}
+
+#ifdef DEBUG
+// Fill debug page 0: scan phase timings, heap and RPC counts. Returns the number of lines used.
+static size_t populateDebugCoreLines() {
+  size_t line = 0;
+  for (uint8_t phase = 0; phase < TRACE_NUM_PHASES && line < DEBUG_PAGE_LINES; phase++) {
+    uint32_t p50, p99;
+    tracePercentiles(static_cast<TracePhase>(phase), p50, p99);
+    snprintf(debugPageText[line++], DEBUG_LINE_LEN + 1, "%-12s p50 %7lu us  p99 %7lu us",
+        tracePhaseName(static_cast<TracePhase>(phase)), (unsigned long)p50, (unsigned long)p99);
+  }
+
+  // Heap accounting as of the end of the last scan.
+  const HeapStats &heap = heapLastScanStats();
+  if (line < DEBUG_PAGE_LINES) {
+    snprintf(debugPageText[line++], DEBUG_LINE_LEN + 1, "heap live %lu B (%lu allocs)",
+        (unsigned long)heap.liveBytes, (unsigned long)heap.liveAllocs);
+  }
+  if (line < DEBUG_PAGE_LINES) {
+    snprintf(debugPageText[line++], DEBUG_LINE_LEN + 1, "heap peak %lu B  budget %lu B%s",
+        (unsigned long)heap.peakBytes, (unsigned long)HEAP_BUDGET_BYTES,
+        heap.budgetExceeded ? " (!)" : "");
+  }
+  if (line < DEBUG_PAGE_LINES) {
+    snprintf(debugPageText[line++], DEBUG_LINE_LEN + 1, "last scan: %lu allocs, %lu frees",
+        (unsigned long)heap.scanAllocs, (unsigned long)heap.scanFrees);
+  }
+  if (line < DEBUG_PAGE_LINES) {
+    snprintf(debugPageText[line++], DEBUG_LINE_LEN + 1, "arena used %lu B  free %lu B",
+        (unsigned long)heap.arenaUsedBytes, (unsigned long)heap.arenaFreeBytes);
+  }
+  if (line < DEBUG_PAGE_LINES) {
+    snprintf(debugPageText[line++], DEBUG_LINE_LEN + 1, "largest free block %lu B",
+        (unsigned long)heap.largestFreeBlock);
+  }
+
+  const ScanCacheStats &cache = scanCacheStats();
+  if (line < DEBUG_PAGE_LINES) {
+    snprintf(debugPageText[line++], DEBUG_LINE_LEN + 1, "rpc %lu fetch %lu action %lu (%lu local)",
+        (unsigned long)cache.rpcCalls, (unsigned long)cache.lastFetchRpcCalls,
+        (unsigned long)cache.lastActionRpcCalls, (unsigned long)cache.lastActionCachedReads);
+  }
+
+  return line;
+}
+
+// Fill debug page 1: station tracking and each optional feature's counters. Returns the number
+// of lines used.
+static size_t populateDebugFeatureLines() {
+  size_t line = 0;
+  const StationTrackStats &track = stationTrackStats();
+  if (line < DEBUG_PAGE_LINES) {
+    snprintf(debugPageText[line++], DEBUG_LINE_LEN + 1, "track %lu scans heard %lu last %lu ms",
+        (unsigned long)track.scans, (unsigned long)track.heard,
+        (unsigned long)track.lastScanMillis);
+  }
+
+#ifdef SERIAL_STREAM
+  if (line < DEBUG_PAGE_LINES) {
+    snprintf(debugPageText[line++], DEBUG_LINE_LEN + 1, "stream frames %lu  dropped %lu",
+        (unsigned long)serialStreamFramesQueued(), (unsigned long)serialStreamFramesDropped());
+  }
+#endif
+
+#ifdef SCAN_LOG_RECORD
+  const SdLogStats &sdLog = scanLogStats();
+  if (line < DEBUG_PAGE_LINES) {
+    snprintf(debugPageText[line++], DEBUG_LINE_LEN + 1,
+        "sdlog #%u q %lu B drop %lu shed %lu max %lu us",
+        sdLog.fileIndex, (unsigned long)sdLog.ringUsed, (unsigned long)sdLog.recordsDropped,
+        (unsigned long)sdLog.recordsShed, (unsigned long)sdLog.maxWriteMicros);
+  }
+#endif
+
+#ifdef SCAN_SCHEDULER
+  const ScanSweepStats &sweep = scanSweepStats();
+  if (line < DEBUG_PAGE_LINES) {
+    snprintf(debugPageText[line++], DEBUG_LINE_LEN + 1, "sweep %lu ms (dwell %lu ms%s) dup %lu",
+        (unsigned long)sweep.lastSweepMillis, (unsigned long)sweep.lastPlannedMillis,
+        sweep.lastFullSweep ? ", full" : "", (unsigned long)sweep.lastDuplicates);
+  }
+#endif
+
+#ifdef MULTI_PASS_SCAN
+  const ScanUnionStats &scanUnion = scanUnionStats();
+  if (line < DEBUG_PAGE_LINES) {
+    snprintf(debugPageText[line++], DEBUG_LINE_LEN + 1, "pass %lu ms heard %lu new %lu exp %lu",
+        (unsigned long)scanUnion.lastPassMillis, (unsigned long)scanUnion.lastHeard,
+        (unsigned long)scanUnion.lastNew, (unsigned long)scanUnion.lastExpired);
+  }
+  if (line < DEBUG_PAGE_LINES) {
+    snprintf(debugPageText[line++], DEBUG_LINE_LEN + 1, "table %d/%u full %lu capped chans %lu",
+        numScanStations, MAX_STATIONS, (unsigned long)scanUnion.tableFull,
+        (unsigned long)scanUnion.lastCapped);
+  }
+#endif
+
+#ifdef LOW_POWER_MONITOR
+  const MonitorStats &monitor = monitorStats();
+  uint32_t dutyPermille = monitorDutyCyclePermille();
+  if (line < DEBUG_PAGE_LINES) {
+    snprintf(debugPageText[line++], DEBUG_LINE_LEN + 1,
+        "lp scans %lu  duty %lu.%lu%%  %lu mJ/scan", (unsigned long)monitor.scans,
+        (unsigned long)(dutyPermille / 10), (unsigned long)(dutyPermille % 10),
+        (unsigned long)(monitorEnergyPerScanMicroJoules() / 1000));
+  }
+#endif
+
+#ifdef SURVEY_MODE
+  const SurveyStats &survey = surveyStats();
+  if (line < DEBUG_PAGE_LINES) {
+    snprintf(debugPageText[line++], DEBUG_LINE_LEN + 1, "survey #%u rec %lu  err %lu  max %lu us",
+        surveySession(), (unsigned long)survey.recordsInFlash, (unsigned long)survey.flashErrors,
+        (unsigned long)survey.maxWriteMicros);
+  }
+#endif
+
+#ifdef HISTORY_LOG
+  const SdLogStats &histLog = historyLogStats();
+  if (line < DEBUG_PAGE_LINES) {
+    snprintf(debugPageText[line++], DEBUG_LINE_LEN + 1,
+        "hist #%u %lu B q %lu B drop %lu shed %lu",
+        histLog.fileIndex, (unsigned long)histLog.bytesQueued, (unsigned long)histLog.ringUsed,
+        (unsigned long)histLog.recordsDropped, (unsigned long)histLog.recordsShed);
+  }
+#endif
+
+  return line;
+}
+
+// Refill the text lines on the debug page from the current profiling statistics.
+static void populateDebugPage() {
+  size_t line = debugPageNum == 0 ? populateDebugCoreLines() : populateDebugFeatureLines();
+  while (line < DEBUG_PAGE_LINES) {
+    debugPageText[line++][0] = '\0';
+  }
 }
 
+void displayDebugPage() {
+  carouselPos = ContentCarousel_Debug;
+
+  populateDebugPage();
+  rowLayout.setRow(1, NULL, 0); // Blank out header row above vscroll.
+  rowLayout.setRow(2, &debugPanel, EQUAL);
+  setStatusLine(debugPageNum == 0 ? "Hat in: dump trace to serial; up/down: feature stats"
+      : "Hat in: dump trace to serial; up/down: timing and heap");
+  setButton1(NULL, emptyBtnHandler); // disable 'details' btn.
+  setButton2(&rescanButton, refreshHandler);
+  setButton3(&heatmapButton, toggleHeatmapButtonHandler);
+  // heatmapButton, when pressed again, goes back to station list.
+  heatmapButton.setText(backStr);
+  buttons[HAT_IN_DEBOUNCE_ID].setHandler(dumpTraceHandler); // hat-in dumps the trace ring.
+  buttons[HAT_UP_DEBOUNCE_ID].setHandler(debugPageFlipHandler); // hat up/down: other page.
+  buttons[HAT_DOWN_DEBOUNCE_ID].setHandler(debugPageFlipHandler);
+  buttons[HAT_LEFT_DEBOUNCE_ID].setHandler(emptyBtnHandler); // filters disabled.
+  buttons[HAT_RIGHT_DEBOUNCE_ID].setHandler(emptyBtnHandler);
+}
+#endif
+
 // Set main display to be the Details page for a particular wifi station idx.
 void displayDetails(size_t wifiIdx) {
   carouselPos = ContentCarousel_Details;
@@ -319,10 +706,17 @@ void displayDetails(size_t wifiIdx) {
     detailsDisableBtn.setText(disableStr);
   }
 
+#ifdef SCAN_LOG_REPLAY
+  // Tracking scans the live radio, which may never hear a station from the replayed log.
   setButton3(NULL, emptyBtnHandler);
+#else
+  setButton3(&detailsTrackBtn, trackStationHandler);
+#endif
   buttons[HAT_IN_DEBOUNCE_ID].setHandler(emptyBtnHandler); // hat-in disabled.
   buttons[HAT_UP_DEBOUNCE_ID].setHandler(scrollUpHandler); // hat scrolling enabled.
   buttons[HAT_DOWN_DEBOUNCE_ID].setHandler(scrollDownHandler);
+  buttons[HAT_LEFT_DEBOUNCE_ID].setHandler(emptyBtnHandler); // filters disabled.
+  buttons[HAT_RIGHT_DEBOUNCE_ID].setHandler(emptyBtnHandler);
 
   carouselPos = ContentCarousel_Details;
 }
@@ -344,6 +738,14 @@ void rotateContentCarousel() {
   case ContentCarousel_Heatmap50:
     displayHeatmap50GHz();
     break;
+  case ContentCarousel_History:
+    displayHistoryPage();
+    break;
+#ifdef DEBUG
+  case ContentCarousel_Debug:
+    displayDebugPage();
+    break;
+#endif
   default:
     // We are not in the ring carousel of pages so cannot go to the 'next' one. Probably
     // because we are on the details page. Go back to the main station list.
@@ -370,6 +772,15 @@ void setStatusLine(const char *in, bool immediateRedraw) {
   }
 }
 
+// Show the filter field that hat-right changes, its value, and how many stations match.
+static void setFilterStatusLine() {
+  char filterMessage[MAX_STATUS_LINE_LEN + 1];
+  snprintf(filterMessage, MAX_STATUS_LINE_LEN + 1, "Filter %s: %s  (%u of %d shown)",
+      stationFilter.fieldName(stationFilterField), stationFilter.valueName(stationFilterField),
+      numVisibleStations, numScanStations);
+  setStatusLine(filterMessage, false);
+}
+
 
 ////////    Enable and disable stations from inclusion in interference heatmap    ////////
 
@@ -379,34 +790,21 @@ char disableMessage[MAX_STATUS_LINE_LEN + 1];
 // Recompute the heatmap without the disabled stations.
 static void disableStation(size_t wifiIdx) {
   const char *disableSSID;
-  const wifi_ap_record_t *pWifiAPRecord =
-      reinterpret_cast<const wifi_ap_record_t*>(WiFi.getScanInfoByIndex(wifiIdx));
+  const wifi_ap_record_t *pWifiAPRecord = getScanRecord(wifiIdx);
   disableSSID = reinterpret_cast<const char*>(pWifiAPRecord->ssid);
 
-  for (size_t i = 0; i < SCAN_MAX_NUMBER; i++) {
-    pWifiAPRecord = reinterpret_cast<const wifi_ap_record_t*>(WiFi.getScanInfoByIndex(i));
+  for (int i = 0; i < numScanStations; i++) {
+    pWifiAPRecord = getScanRecord(i);
     if (strcmp(reinterpret_cast<const char*>(pWifiAPRecord->ssid), disableSSID) == 0) {
       // This SSID should be disabled.
       setStationDisabledBit(i, true);
     }
   }
 
-  // Recompute heatmaps minus all the disabled stations.
-  wifi24GHzHeatmap.clear();
-  wifi50GHzHeatmap.clear();
-
-  // Set up channel plans for global heatmaps.
-  populateHeatmapChannelPlan(&wifi24GHzHeatmap, wifi24GHzChannelPlan);
-  populateHeatmapChannelPlan(&wifi50GHzHeatmap, wifi50GHzChannelPlan);
-
-  for (size_t i = 0; i < SCAN_MAX_NUMBER; i++) {
-    pWifiAPRecord = reinterpret_cast<const wifi_ap_record_t*>(WiFi.getScanInfoByIndex(i));
-    int channelNum = pWifiAPRecord->primary;
-
-    if (!isStationDisabled(i)) {
-      recordSignalHeatmap(pWifiAPRecord, getHeatmapForChannel(channelNum));
-    }
-  }
+  // Recompute totals minus all the disabled stations. (Heatmaps are rebuilt when next shown.)
+  updateBandTotals();
+  updateChannelAdvice();
+  updateHeatmapDiffs();
 
   memset(disableMessage, 0, MAX_STATUS_LINE_LEN + 1);
   snprintf(disableMessage, MAX_STATUS_LINE_LEN, "Disabled station %u: %s",
@@ -415,23 +813,22 @@ static void disableStation(size_t wifiIdx) {
 }
 
 // Set the disabled bit to 'false' for wifiIdx and all other stations with the same SSID.
-// Add the newly-enabled stations to the heatmap.
+// Add the newly-enabled stations back into the band totals.
 static void enableStation(size_t wifiIdx) {
   const char *enableSSID;
-  const wifi_ap_record_t *pWifiAPRecord =
-      reinterpret_cast<const wifi_ap_record_t*>(WiFi.getScanInfoByIndex(wifiIdx));
+  const wifi_ap_record_t *pWifiAPRecord = getScanRecord(wifiIdx);
   enableSSID = reinterpret_cast<const char*>(pWifiAPRecord->ssid);
 
-  for (size_t i = 0; i < SCAN_MAX_NUMBER; i++) {
-    pWifiAPRecord = reinterpret_cast<const wifi_ap_record_t*>(WiFi.getScanInfoByIndex(i));
+  for (int i = 0; i < numScanStations; i++) {
+    pWifiAPRecord = getScanRecord(i);
     if (strcmp(reinterpret_cast<const char*>(pWifiAPRecord->ssid), enableSSID) == 0) {
       // This SSID should be enabled.
       setStationDisabledBit(i, false);
-      // Add it to the heatmap.
-      int channelNum = pWifiAPRecord->primary;
-      recordSignalHeatmap(pWifiAPRecord, getHeatmapForChannel(channelNum));
     }
   }
+  updateBandTotals();
+  updateChannelAdvice();
+  updateHeatmapDiffs();
 
   memset(disableMessage, 0, MAX_STATUS_LINE_LEN + 1);
   snprintf(disableMessage, MAX_STATUS_LINE_LEN, "Enabled station %u: %s",
@@ -453,13 +850,20 @@ static void stationDetailsHandler(uint8_t btnId, uint8_t btnState) {
   // button released; defocus button and do action.
   detailsButton.setFocus(false);
   screen.renderWidget(&detailsButton);
-  displayDetails(wifiListScroll.selectIdx());
+  if (numVisibleStations == 0) {
+    return; // No station selected.
+  }
+  displayDetails(selectedStationIdx());
   screen.render();
 }
 
-// Refresh the list.
+// Refresh the list. (In survey mode: mark a location, or export the survey on a long press.)
+// With ROGUE_DETECT, a long press captures the AP baseline instead.
 static void refreshHandler(uint8_t btnId, uint8_t btnState) {
   if (btnState == BTN_PRESSED) {
+#if defined(SURVEY_MODE) || defined(ROGUE_DETECT)
+    rescanPressMillis = millis();
+#endif
     rescanButton.setFocus(true);
     screen.renderWidget(&rescanButton);
     return;
@@ -468,8 +872,25 @@ static void refreshHandler(uint8_t btnId, uint8_t btnState) {
   // button released; defocus button and do action.
   rescanButton.setFocus(false);
   screen.renderWidget(&rescanButton);
+#ifdef ROGUE_DETECT
+  // Checked first: with SURVEY_MODE too, this is the longer of the two holds.
+  if (millis() - rescanPressMillis >= BASELINE_CAPTURE_HOLD_MILLIS) {
+    captureBaseline();
+    return;
+  }
+#endif
+#ifdef SURVEY_MODE
+  surveyMarkReleased(millis() - rescanPressMillis >= SURVEY_EXPORT_HOLD_MILLIS);
+  return;
+#endif
+#ifdef LOW_POWER_MONITOR
+  monitorScanStart(); // The radio is off between scheduled scans.
   scanWifi();
-  screen.render();
+  monitorScanEnd();
+#else
+  scanWifi();
+#endif
+  renderScanResults();
 }
 
 // Clicking the 'back' button in Station Details goes back to the station list.
@@ -532,7 +953,7 @@ static void scrollUpHandler(uint8_t btnId, uint8_t btnState) {
     }
   } else if (carouselPos == ContentCarousel_Details) {
     // Just flip to the previous 'page' of details.
-    displayDetails(wifiListScroll.selectIdx());
+    displayDetails(selectedStationIdx());
     screen.render();
   }
 }
@@ -580,11 +1001,146 @@ static void scrollDownHandler(uint8_t btnId, uint8_t btnState) {
     }
   } else if (carouselPos == ContentCarousel_Details) {
     // Just flip to the next 'page' of details.
-    displayDetails(wifiListScroll.selectIdx());
+    displayDetails(selectedStationIdx());
     screen.render();
   }
 }
 
+// Draw both band heatmaps in `mode`, and redisplay the current one to update its status line.
+static void setBandHeatmapMode(HeatmapMode mode) {
+  bandHeatmapMode = mode;
+  wifi24GHzHeatmap.setMode(bandHeatmapMode);
+  wifi50GHzHeatmap.setMode(bandHeatmapMode);
+
+  if (carouselPos == ContentCarousel_Heatmap24) {
+    displayHeatmap24GHz();
+  } else {
+    displayHeatmap50GHz();
+  }
+  screen.render();
+}
+
+// 5-way hat "in" on a heatmap page -- cycle both band heatmaps through stacked signal blocks,
+// per-channel total power bars, and (if a baseline is pinned) the change since the baseline.
+static void heatmapModeHandler(uint8_t btnId, uint8_t btnState) {
+  if (btnState == BTN_PRESSED) {
+    return;
+  }
+
+  if (bandHeatmapMode == HEATMAP_BLOCKS) {
+    setBandHeatmapMode(HEATMAP_POWER_BARS);
+  } else if (bandHeatmapMode == HEATMAP_POWER_BARS && wifi24GHzDiff.isPinned()) {
+    setBandHeatmapMode(HEATMAP_DIFF);
+  } else {
+    setBandHeatmapMode(HEATMAP_BLOCKS);
+  }
+}
+
+// 5-way hat "up" on a heatmap page -- pin both bands' current totals as the baseline, and show
+// the change since then.
+static void heatmapPinHandler(uint8_t btnId, uint8_t btnState) {
+  if (btnState == BTN_PRESSED) {
+    return;
+  }
+
+  wifi24GHzDiff.pin(bandTotals24GHz);
+  wifi50GHzDiff.pin(bandTotals50GHz);
+  setBandHeatmapMode(HEATMAP_DIFF);
+}
+
+// 5-way hat "down" on a heatmap page -- discard the baseline.
+static void heatmapUnpinHandler(uint8_t btnId, uint8_t btnState) {
+  if (btnState == BTN_PRESSED) {
+    return;
+  }
+
+  wifi24GHzDiff.unpin();
+  wifi50GHzDiff.unpin();
+  if (bandHeatmapMode == HEATMAP_DIFF) {
+    setBandHeatmapMode(HEATMAP_BLOCKS);
+  } else {
+    setStatusLine("Baseline cleared.");
+  }
+}
+
+// Station list 5-way hat "left" -- choose which filter field hat "right" changes.
+static void filterFieldHandler(uint8_t btnId, uint8_t btnState) {
+  if (btnState == BTN_PRESSED) {
+    return;
+  }
+
+  stationFilterField =
+      static_cast<StationFilterField>((stationFilterField + 1) % FILTER_NUM_FIELDS);
+  setFilterStatusLine();
+  screen.renderWidget(&statusLineLabel);
+}
+
+// Station list 5-way hat "right" -- cycle the value of the current filter field and rebind the
+// station list to the stations that match.
+static void filterValueHandler(uint8_t btnId, uint8_t btnState) {
+  if (btnState == BTN_PRESSED) {
+    return;
+  }
+
+  stationFilter.cycle(stationFilterField);
+  bindStationList(true);
+  setFilterStatusLine();
+  screen.render();
+}
+
+// History page 5-way hat "left" / "right" -- plot the previous / next channel.
+static void historyChannelHandler(uint8_t btnId, uint8_t btnState) {
+  if (btnState == BTN_PRESSED) {
+    return;
+  }
+
+  size_t numChannels = congestionHistory.numChannels();
+  size_t chanIdx = congestionPlot.channelIdx();
+  if (btnId == HAT_LEFT_DEBOUNCE_ID) {
+    chanIdx = (chanIdx + numChannels - 1) % numChannels;
+  } else {
+    chanIdx = (chanIdx + 1) % numChannels;
+  }
+  congestionPlot.setChannelIdx(chanIdx);
+  setHistoryTitle();
+  screen.render();
+}
+
+// History page 5-way hat "in" -- cycle the time range: scans, minutes, hours, days.
+static void historyRangeHandler(uint8_t btnId, uint8_t btnState) {
+  if (btnState == BTN_PRESSED) {
+    return;
+  }
+
+  congestionPlot.setLevel(
+      static_cast<CongestionLevel>((congestionPlot.level() + 1) % CONGESTION_NUM_LEVELS));
+  setHistoryTitle();
+  screen.render();
+}
+
+#ifdef DEBUG
+// Debug page 5-way hat "in" -- dump the trace span ring buffer over serial.
+static void dumpTraceHandler(uint8_t btnId, uint8_t btnState) {
+  if (btnState == BTN_PRESSED) {
+    return;
+  }
+
+  traceDump();
+  traceSummary();
+  setStatusLine("Trace dumped to serial.");
+}
+
+static void debugPageFlipHandler(uint8_t btnId, uint8_t btnState) {
+  if (btnState == BTN_PRESSED) {
+    return;
+  }
+
+  debugPageNum ^= 1;
+  displayDebugPage();
+  screen.render();
+}
+#endif
+
 static void toggleHeatmapButtonHandler(uint8_t btnId, uint8_t btnState) {
   if (btnState == BTN_PRESSED) {
     heatmapButton.setFocus(true);
@@ -614,7 +1170,7 @@ static void enableStationHandler(uint8_t btnId, uint8_t btnState) {
   screen.renderWidget(&detailsDisableBtn);
   buttons[TOP_BUTTON_2_DEBOUNCE_ID].setHandler(disableStationHandler); // Change button handler fn.
 
-  size_t curWifiIdx = wifiListScroll.selectIdx();
+  size_t curWifiIdx = selectedStationIdx();
   enableStation(curWifiIdx);
 }
 
@@ -633,88 +1189,89 @@ static void disableStationHandler(uint8_t btnId, uint8_t btnState) {
   screen.renderWidget(&detailsDisableBtn);
   buttons[TOP_BUTTON_2_DEBOUNCE_ID].setHandler(enableStationHandler); // Change button handler fn.
 
-  size_t curWifiIdx = wifiListScroll.selectIdx();
+  size_t curWifiIdx = selectedStationIdx();
   disableStation(curWifiIdx);
 }
 
+// We are currently on the Details page and the user wants to track this station's RSSI.
+static void trackStationHandler(uint8_t btnId, uint8_t btnState) {
+  if (btnState == BTN_PRESSED) {
+    detailsTrackBtn.setFocus(true);
+    screen.renderWidget(&detailsTrackBtn);
+    return;
+  }
+
+  // Button released; perform action.
+  detailsTrackBtn.setFocus(false);
+  displayTracking(selectedStationIdx());
+  screen.render();
+}
+
+// Clicking the 'back' button on the tracking page stops tracking and goes back to Details.
+static void trackBackHandler(uint8_t btnId, uint8_t btnState) {
+  if (btnState == BTN_PRESSED) {
+    trackBackBtn.setFocus(true);
+    screen.renderWidget(&trackBackBtn);
+    return;
+  }
+
+  // Button released; perform action.
+  trackBackBtn.setFocus(false);
+  tracking = false;
+#ifdef LOW_POWER_MONITOR
+  monitorScanEnd(); // Radio back off; the next scheduled scan is a full interval away.
+#endif
+  displayDetails(selectedStationIdx());
+  screen.render();
+}
+
 static void populateHeatmapChannelPlan(Heatmap *heatmap, const tc::const_array<int> &channelPlan) {
   for (auto channel: channelPlan) {
     heatmap->defineChannel(channel);
   }
 }
 
+static void populateAdvisorChannelPlan(ChannelAdvisor *advisor,
+    const tc::const_array<int> &channelPlan) {
+  for (auto channel: channelPlan) {
+    advisor->defineChannel(channel);
+  }
+}
 
 
-////////   802.11 bandwidth spectral masks   ////////
+////////    Congestion history    ////////
 
-/**
- * The 802.11b spectral mask specifies that the signal overlaps adjacent channels
- * in the following way:
- * at +/- 5 MHz (1 channel away): 0 dBm signal diff
- * at +/-10 MHz (2 channels out): 0 dBm
- * at +/-15 MHz (3 channels out): -30 dBm
- * at +/-20 MHz (4 channels out): -30 dBm
- * Further out is -50 dBm, effectively no interference.
- * (See https://www.rfcafe.com/references/electrical/wlan-masks.htm)
- *
- * The spectral mask definitions here are one-sided, but are applied symmetrically around
- * the primary (center) channel.
- */
-static constexpr tc::const_array<int> spectralMask80211B = { 0, 0, -30, -30 };
-
-// 802.11a and g have the following mask, along with 20 MHz 802.11n:
-// +/-  5 MHz:     0 dBm
-// +/- 10 MHz:   -10 dBm
-// +/- 15 MHz:   -26 dBm (actually -25.9 dBm)
-// +/- 20 MHz:   -28 dBm
-// Further out is -35 dBm or lower; non-interfering.
-static constexpr tc::const_array<int> spectralMask80211G = { 0, -10, -26, -28 };
-
-// 802.11n in 40 MHz mode on 2.4 GHz wifi blocks an enormous number of channels:
-// +/-  5 MHz:    0 dBm
-// +/- 10 MHz:    0 dBm
-// +/- 15 MHz:    0 dBm
-// +/- 20 MHz:  -10 dBm
-// +/- 25 MHz:  -22 dBm
-// +/- 30 MHz:  -25 dBm
-// +/- 35 MHz:  -27 dBm
-// +/- 40 MHz:  -30 dBm
-//
-// This mask array reflects that for a 40 MHz bandwidth true channel, the primary channel num
-// is at -10 MHz and secondary at +10 MHz (or vice versa).
-//
-// The center of the
-// true channel is offset from the reported primary channel and we need to look at the data
-// struct to see whether the true center is above or below the primary channel id.
-//
-// So at +15 MHz from the true channel, we are at +5 MHz in the array below (  0 dBm)
-//    at +20 MHz from the true channel, we are at +10 MHz in array below    (-10 dBm)
-//    ... and so on...
-//
-// See https://www.researchgate.net/figure/80211-spectral-masks_fig3_261382549
-static constexpr tc::const_array<int> spectralMask80211N40MHz24G = { 0, -10, -22, -25, -27, -30 };
-
-// 802.11n in 40 MHz mode on 5 GHz wifi (20 MHz channel spacing):
-// 2x 20 MHz primary channels are consumed at 0 dBm, and the adjacent 20 MHz channel on
-// either shoulder sees interference at -25 dBm.
-//
-// Note this mask is for 20 MHz channel spacing (5 GHz band), whereas all the other
-// 2.4 GHz-band spectral masks above are for 5 MHz channel spacing.
-static constexpr tc::const_array<int> spectralMask80211N40MHz50G = { -25 };
+#ifdef LOW_POWER_MONITOR
+// millis() stops while the SAMD51 is in standby between scans; count on the RTC instead.
+static inline uint32_t historyClockTicks() { return rtcTicks(); }
+static constexpr uint32_t HISTORY_CLOCK_TICKS_PER_SEC = RTC_TICKS_PER_SEC;
+#else
+static inline uint32_t historyClockTicks() { return millis(); }
+static constexpr uint32_t HISTORY_CLOCK_TICKS_PER_SEC = 1000;
+#endif
 
-// 20 MHz channel width in 5 GHz band doesn't interfere with any neighbors.
-static constexpr tc::const_array<int> emptySpectralMask = {};
-
-// Ignore signals with power < -90 dBm when constructing the interference heatmap.
-static constexpr int noiseFloorDBm = -90;
+static uint32_t historyClockLastTicks = 0; // historyClockTicks() at the last whole second counted.
+static uint32_t historyClockSecsCount = 0;
 
+// Seconds since boot. Unlike dividing the tick count, this doesn't wrap when the ticks do (after
+// 48 or 49 days). (Must be called at least that often; it's called after every scan.)
+static uint32_t historyClockSecs() {
+  uint32_t elapsed = historyClockTicks() - historyClockLastTicks;
+  historyClockSecsCount += elapsed / HISTORY_CLOCK_TICKS_PER_SEC;
+  historyClockLastTicks += elapsed - elapsed % HISTORY_CLOCK_TICKS_PER_SEC;
+  return historyClockSecsCount;
+}
 
-/** Return the heatmap associated with a particular channel. */
-static Heatmap *getHeatmapForChannel(int chan) {
-  if (chan <= max24GHzChannelNum) {
-    return &wifi24GHzHeatmap;
-  } else {
-    return &wifi50GHzHeatmap;
+// Add the total power on each channel in the just-completed scan to the congestion history.
+static void recordCongestionHistory() {
+  congestionHistory.beginScan(historyClockSecs());
+  for (size_t i = 0; i < bandTotals24GHz.numChannels; i++) {
+    congestionHistory.addChannel(bandTotals24GHz.channelNum[i],
+        powerToDbm(bandTotals24GHz.power[i]));
+  }
+  for (size_t i = 0; i < bandTotals50GHz.numChannels; i++) {
+    congestionHistory.addChannel(bandTotals50GHz.channelNum[i],
+        powerToDbm(bandTotals50GHz.power[i]));
   }
 }
 
@@ -722,120 +1279,189 @@ static Heatmap *getHeatmapForChannel(int chan) {
 ////////    Spectrum scanning; building the main station list VScroll & heatmap    ////////
 
 static bool hasScanned = false;
-static StrLabel* ssidLabels[SCAN_MAX_NUMBER];
-static IntLabel* chanLabels[SCAN_MAX_NUMBER];
-static IntLabel* rssiLabels[SCAN_MAX_NUMBER];
-static String bssids[SCAN_MAX_NUMBER];
-static StrLabel* bssidLabels[SCAN_MAX_NUMBER];
-static Cols* wifiRows[SCAN_MAX_NUMBER]; // Each row is a Cols for (ssid, chan, rssi, bssid)
-
-// Register a channel's bandwidth usage on an appropriate heatmap.
+#ifdef FAST_BOOT
+// True while the station list and heatmaps show the snapshot from the last boot.
+static bool showingSnapshot = false;
+#endif
+static StrLabel* ssidLabels[MAX_STATIONS];
+static IntLabel* chanLabels[MAX_STATIONS];
+static IntLabel* rssiLabels[MAX_STATIONS];
+static String bssids[MAX_STATIONS];
+static StrLabel* bssidLabels[MAX_STATIONS];
+static Cols* wifiRows[MAX_STATIONS]; // Each row is a Cols for (ssid, chan, rssi, bssid)
+
+// Return the record for station wifiIdx from the most recent scan (live or replayed).
+static const wifi_ap_record_t *getScanRecord(size_t wifiIdx) {
+#ifdef FAST_BOOT
+  if (showingSnapshot) {
+    return snapshotRecord(wifiIdx);
+  }
+#endif
+#ifdef SCAN_LOG_REPLAY
+  return scanLogReplayRecord(wifiIdx);
+#elif defined(SCAN_SCHEDULER)
+  return scanSweepRecord(wifiIdx);
+#elif defined(MULTI_PASS_SCAN)
+  return scanUnionRecord(wifiIdx);
+#else
+  return scanCacheRecord(wifiIdx);
+#endif
+}
+
+// Return the wifiIdx of the station selected in the (possibly filtered) station list.
+static size_t selectedStationIdx() {
+  return visibleStations[wifiListScroll.selectIdx()];
+}
+
+// Return the BSSID of station wifiIdx formatted as a hex string.
+static String getBssidStr(size_t wifiIdx) {
+  const uint8_t *bssid = getScanRecord(wifiIdx)->bssid;
+  char bssidStr[18];
+  snprintf(bssidStr, sizeof(bssidStr), "%02X:%02X:%02X:%02X:%02X:%02X",
+      bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5]);
+  return String(bssidStr);
+}
+
+// Convert a radio scan record to the attributes the spectral mask model needs.
+static void spectrumSignalFromAPRecord(const wifi_ap_record_t *pWifiAPRecord,
+    SpectrumSignal &signal) {
+  signal.primary = pWifiAPRecord->primary;
+  signal.second = pWifiAPRecord->second;
+  signal.rssi = pWifiAPRecord->rssi;
+  signal.phy11b = pWifiAPRecord->phy_11b;
+  signal.phy11n = pWifiAPRecord->phy_11n;
+}
+
+static void addHeatmapSignal(int channelNum, int rssi, void *bandHeatmap) {
+  static_cast<Heatmap*>(bandHeatmap)->addSignal(channelNum, rssi);
+}
+
+// Register a channel's bandwidth usage on an appropriate heatmap: its full power on the
+// channel(s) it occupies, and crosstalk on its neighbors per its 802.11 spectral mask.
 static void recordSignalHeatmap(const wifi_ap_record_t *pWifiAPRecord, Heatmap *bandHeatmap) {
-  int channelNum = pWifiAPRecord->primary;
-  int rssiVal = pWifiAPRecord->rssi;
-
-  bool is24GHz = channelNum <= max24GHzChannelNum;
-  const tc::const_array<int> *pSpectralMask = NULL;
-
-  int upperChannelNum = channelNum;
-  int lowerChannelNum = channelNum;
-
-  // How far away is the next channel number? Depends on the frequency band.
-  int sequentialChannelDelta = is24GHz ? ADJACENT_24_GHZ_CHAN_DELTA : ADJACENT_50_GHZ_CHAN_DELTA;
-  // What is the extent of channel ids in the relevant band?
-  int minBandChannel = is24GHz ? min24GHzChannelNum : min50GHzChannelNum;
-  int maxBandChannel = is24GHz ? max24GHzChannelNum : max50GHzChannelNum;
-
-  // How many channels is this station occupying? If 20 MHz, exactly 1; if 40 MHz, it's this
-  // one and the one above or below it.
-  switch (pWifiAPRecord->second) {
-  case wifi_second_chan_t::WIFI_SECOND_CHAN_NONE:
-    upperChannelNum = channelNum;
-    lowerChannelNum = channelNum;
-    break;
-  case wifi_second_chan_t::WIFI_SECOND_CHAN_ABOVE:
-    if (is24GHz) {
-      // +20 MHz from primary channel = 4x 5 MHz channels away.
-      upperChannelNum = channelNum + 4 * ADJACENT_24_GHZ_CHAN_DELTA;
-    } else {
-      // 5 GHz: channel number for the next 20 MHz bandwidth channel up.
-      upperChannelNum = channelNum + ADJACENT_50_GHZ_CHAN_DELTA;
-    }
-    lowerChannelNum = channelNum;
-    break;
-  case wifi_second_chan_t::WIFI_SECOND_CHAN_BELOW:
-    upperChannelNum = channelNum;
-    if (is24GHz) {
-      // -20 MHz from primary channel = 4x 5 MHz channels away.
-      lowerChannelNum = channelNum - 4 * ADJACENT_24_GHZ_CHAN_DELTA;
-    } else {
-      // 5 GHz: channel number for the next 20 MHz bandwidth channel down.
-      lowerChannelNum = channelNum - ADJACENT_50_GHZ_CHAN_DELTA;
-    }
-    break;
+  SpectrumSignal signal;
+  spectrumSignalFromAPRecord(pWifiAPRecord, signal);
+  spectrumForEachChannel(signal, addHeatmapSignal, bandHeatmap);
+}
+
+// Build one band's heatmap from the enabled stations, if it's stale. Call before it's drawn.
+static void buildBandHeatmap(bool is24GHz) {
+  bool &stale = is24GHz ? heatmap24GHzStale : heatmap50GHzStale;
+  if (!stale) {
+    return;
   }
 
-  // Determine which mode(s) are active and load the appropriate cross-channel interference data.
-  if (is24GHz) {
-    if (pWifiAPRecord->phy_11b) {
-      // We are on 2.4 GHz 802.11b. (g or n may also be enabled, but the mask for 802.11b is
-      // more punishing to nearby channels, so apply this one to the interference chart.)
-      pSpectralMask = &spectralMask80211B;
-    } else if (pWifiAPRecord->phy_11n || lowerChannelNum != upperChannelNum) {
-      // We are on 802.11n.
-      if (pWifiAPRecord->second == wifi_second_chan_t::WIFI_SECOND_CHAN_NONE) {
-        // 20 MHz 2.4 GHz 802.11n shares spectral mask with 802.11g
-        pSpectralMask = &spectralMask80211G;
-      } else {
-        // 40 MHz bandwidth
-        // We are going to interfere with basically all the channels.
-        pSpectralMask = &spectralMask80211N40MHz24G;
-      }
-    } else {
-      // We are on 2.4 GHz 802.11g
-      pSpectralMask = &spectralMask80211G;
-    }
-  } else {
-    // 5 GHz band. If we're in 40 MHz bandwidth, we use one mask. For 20 MHz, we use the other.
-    // b/g/n flags not relevant.
-    if (lowerChannelNum != upperChannelNum) {
-      // 40 MHz dual-channel mode.
-      pSpectralMask = &spectralMask80211N40MHz50G;
-    } else {
-      // 20 MHz 5 GHz 802.11n does not interfere with any adjacent channels.
-      pSpectralMask = &emptySpectralMask;
+  uint32_t heatmapStart = traceTicks();
+  Heatmap &heatmap = is24GHz ? wifi24GHzHeatmap : wifi50GHzHeatmap;
+  heatmap.clear();
+  populateHeatmapChannelPlan(&heatmap, is24GHz ? wifi24GHzChannelPlan : wifi50GHzChannelPlan);
+  for (int i = 0; i < numScanStations; i++) {
+    const wifi_ap_record_t *pWifiAPRecord = getScanRecord(i);
+    if (!isStationDisabled(i) && spectrumIs24GHz(pWifiAPRecord->primary) == is24GHz) {
+      recordSignalHeatmap(pWifiAPRecord, &heatmap);
     }
   }
+  stale = false;
+  traceRecord(TRACE_HEATMAP, heatmapStart, min(numScanStations, 0xFF));
+}
 
-  // Now that we have the spectral mask, record the rssi on the channels
+// Build the heatmap on the current page, if it's a heatmap page. Call before screen.render().
+static void buildVisibleHeatmap() {
+  if (carouselPos == ContentCarousel_Heatmap24) {
+    buildBandHeatmap(true);
+  } else if (carouselPos == ContentCarousel_Heatmap50) {
+    buildBandHeatmap(false);
+  }
+}
+
+static void addBandTotalsSignal(int channelNum, int rssi, void *totals) {
+  heatmapTotalsAddSignal(*static_cast<HeatmapTotals*>(totals), channelNum, rssi);
+}
 
-  // First, fill in the range of [lowerChannelId, upperChannelId] (with a stride of 1 or 4
-  // as appropriate) with +0 dBm
-  for (int i = lowerChannelNum; i <= upperChannelNum; i += sequentialChannelDelta) {
-    if (i >= minBandChannel && i <= maxBandChannel) {
-      bandHeatmap->addSignal(i, rssiVal);
+// Recompute both bands' per-channel totals from the enabled stations, and mark the band heatmaps
+// stale. Unlike building a Heatmap, this keeps no per-signal rssi list and allocates nothing.
+static void updateBandTotals() {
+  heatmapTotalsClear(bandTotals24GHz);
+  heatmapTotalsClear(bandTotals50GHz);
+  for (int i = 0; i < numScanStations; i++) {
+    if (isStationDisabled(i)) {
+      continue;
     }
+
+    SpectrumSignal signal;
+    spectrumSignalFromAPRecord(getScanRecord(i), signal);
+    spectrumForEachChannel(signal, addBandTotalsSignal,
+        spectrumIs24GHz(signal.primary) ? &bandTotals24GHz : &bandTotals50GHz);
   }
+  heatmap24GHzStale = true;
+  heatmap50GHzStale = true;
+}
 
-  // Add in cross-channel interference.
-  // For a two-sided channel definition (in 2.4 GHz), walk from upperChannelId + 0, 1, 2, 3...
-  // and apply the decay factor, as well as walking down from lowerChannelId - 0, 1, 2, 3...
-  // In 5 GHz, we walk at +/-4, +/-8, etc... `sequentialChannelDelta` holds the right increment
-  // for the relevant band.
-  int offset = sequentialChannelDelta;
-  for (int dbm: *pSpectralMask) {
-    int crosstalkRssi = rssiVal + dbm;
-    if (crosstalkRssi >= noiseFloorDBm) {
-      if (upperChannelNum + offset <= maxBandChannel) {
-        bandHeatmap->addSignal(upperChannelNum + offset, crosstalkRssi);
-      }
+// Number of recommendations of each kind shown on the heatmap pages.
+static constexpr size_t ADVICE_PICKS = 3;
 
-      if (lowerChannelNum - offset >= minBandChannel) {
-        bandHeatmap->addSignal(lowerChannelNum - offset, crosstalkRssi);
-      }
+// Format the best 20 MHz picks (and best 1/6/11 pick, on 2.4 GHz) and the best 40 MHz pick.
+// 40 MHz picks are written as primary+secondary.
+static void formatChannelAdvice(const ChannelAdvisor &advisor, bool is24GHz, char *out) {
+  ChannelPick picks[ADVICE_PICKS];
+  size_t numPicks = advisor.recommend(20, CHANNEL_POLICY_ANY, picks, ADVICE_PICKS);
+  if (numPicks == 0) {
+    out[0] = '\0';
+    return;
+  }
+
+  size_t pos = snprintf(out, ADVICE_TEXT_LEN + 1, "Best:");
+  for (size_t i = 0; i < numPicks && pos < ADVICE_TEXT_LEN; i++) {
+    pos += snprintf(out + pos, ADVICE_TEXT_LEN + 1 - pos, " %d", picks[i].primary);
+  }
+
+  if (is24GHz && pos < ADVICE_TEXT_LEN
+      && advisor.recommend(20, CHANNEL_POLICY_1_6_11, picks, 1) > 0) {
+    pos += snprintf(out + pos, ADVICE_TEXT_LEN + 1 - pos, "  1/6/11: %d", picks[0].primary);
+  }
+
+  if (pos < ADVICE_TEXT_LEN && advisor.recommend(40, CHANNEL_POLICY_ANY, picks, 1) > 0) {
+    snprintf(out + pos, ADVICE_TEXT_LEN + 1 - pos, "  40M: %d+%d", picks[0].primary,
+        picks[0].secondary);
+  }
+}
+
+// Score every candidate channel in both bands against the current (enabled) stations, and
+// update the recommendations on the heatmap pages.
+static void updateChannelAdvice() {
+  uint32_t adviseStart = traceTicks();
+  channelAdvisor24GHz.clear();
+  channelAdvisor50GHz.clear();
+
+  for (int i = 0; i < numScanStations; i++) {
+    if (isStationDisabled(i)) {
+      continue;
     }
 
-    offset += sequentialChannelDelta;
+    SpectrumSignal signal;
+    spectrumSignalFromAPRecord(getScanRecord(i), signal);
+    if (spectrumIs24GHz(signal.primary)) {
+      channelAdvisor24GHz.addSignal(signal);
+    } else {
+      channelAdvisor50GHz.addSignal(signal);
+    }
+  }
+
+  formatChannelAdvice(channelAdvisor24GHz, true, advice24GHzText);
+  formatChannelAdvice(channelAdvisor50GHz, false, advice50GHzText);
+  traceRecord(TRACE_ADVISE, adviseStart);
+  DBGPRINT(advice24GHzText);
+  DBGPRINT(advice50GHzText);
+}
+
+// Recompute each band's change since its pinned baseline (if any) from the per-channel totals.
+// This is O(channels); it doesn't revisit the stations.
+static void updateHeatmapDiffs() {
+  if (wifi24GHzDiff.isPinned()) {
+    wifi24GHzDiff.update(bandTotals24GHz);
+  }
+  if (wifi50GHzDiff.isPinned()) {
+    wifi50GHzDiff.update(bandTotals50GHz);
   }
 }
 
@@ -843,13 +1469,14 @@ static void recordSignalHeatmap(const wifi_ap_record_t *pWifiAPRecord, Heatmap *
  * Populate the UI widget fields for the Details page for a particular wifi station.
  */
 static void populateStationDetails(size_t wifiIdx) {
-  const wifi_ap_record_t *pWifiAPRecord =
-      reinterpret_cast<const wifi_ap_record_t*>(WiFi.getScanInfoByIndex(wifiIdx));
+  const wifi_ap_record_t *pWifiAPRecord = getScanRecord(wifiIdx);
 
   detailsChan.setValue(pWifiAPRecord->primary);
   detailsRssi.setValue(pWifiAPRecord->rssi);
   detailsSsid.setText(reinterpret_cast<const char*>(&(pWifiAPRecord->ssid[0])));
   detailsBssid.setText(bssids[wifiIdx]);
+  const char *vendor = ouiVendorName(pWifiAPRecord->bssid);
+  detailsVendor.setText(vendor != NULL ? vendor : "");
 
   // Reformat char buffer that underwrites detailsBandwidth StrLabel.
   memset(detailsBandwidthText, 0, BANDWIDTH_TEXT_LEN);
@@ -933,12 +1560,64 @@ static void populateStationDetails(size_t wifiIdx) {
   recordSignalHeatmap(pWifiAPRecord, &detailsHeatmap);
 }
 
+static StationSecurity stationSecurity(wifi_auth_mode_t authmode) {
+  switch (authmode) {
+  case wifi_auth_mode_t::WIFI_AUTH_OPEN:
+    return STATION_SECURITY_OPEN;
+  case wifi_auth_mode_t::WIFI_AUTH_WEP:
+    return STATION_SECURITY_WEP;
+  case wifi_auth_mode_t::WIFI_AUTH_WPA_PSK:
+  case wifi_auth_mode_t::WIFI_AUTH_WPA2_PSK:
+  case wifi_auth_mode_t::WIFI_AUTH_WPA_WPA2_PSK:
+    return STATION_SECURITY_PSK;
+  case wifi_auth_mode_t::WIFI_AUTH_WPA2_ENTERPRISE:
+    return STATION_SECURITY_ENTERPRISE;
+  default:
+    return STATION_SECURITY_OTHER;
+  }
+}
+
+// Rebuild wifiListScroll from the rows of the stations that match stationFilter. If
+// keepSelection is true and the selected station still matches, it stays selected.
+static void bindStationList(bool keepSelection) {
+  size_t prevWifiIdx = MAX_STATIONS;
+  if (keepSelection && numVisibleStations > 0) {
+    prevWifiIdx = selectedStationIdx();
+  }
+
+  wifiListScroll.clear();
+  numVisibleStations = stationFilter.apply(stationFilterAttrs, numScanStations, visibleStations);
+
+  size_t selection = 0;
+  for (size_t i = 0; i < numVisibleStations; i++) {
+    size_t wifiIdx = visibleStations[i];
+    Cols *wifiRow = wifiRows[wifiIdx];
+    if (i % 2 == 1) {
+      // Every other row should have a non-black bg to zebra-stripe the table.
+      wifiRow->setBackground(TFT_NAVY);
+    } else {
+      wifiRow->setBackground(TFT_BLACK);
+    }
+    wifiListScroll.add(wifiRow);
+
+    if (wifiIdx == prevWifiIdx) {
+      selection = i;
+    }
+  }
+
+  wifiListScroll.setSelection(selection);
+  wifiListScroll.scrollTo(selection);
+}
+
 static void makeWifiRow(int wifiIdx) {
-  const wifi_ap_record_t *pWifiAPRecord =
-      reinterpret_cast<const wifi_ap_record_t*>(WiFi.getScanInfoByIndex(wifiIdx));
+  uint32_t rowStart = traceTicks();
+  const wifi_ap_record_t *pWifiAPRecord = getScanRecord(wifiIdx);
 
   StrLabel *ssid = new StrLabel(reinterpret_cast<const char*>(&(pWifiAPRecord->ssid[0])));
   ssid->setFont(2); // Use larger 16px font for SSID.
+#ifdef ROGUE_DETECT
+  ssid->setColor(apStatusColor(stationApStatus[wifiIdx])); // Set by recordStation().
+#endif
   ssidLabels[wifiIdx] = ssid;
 
   int channelNum = pWifiAPRecord->primary;
@@ -950,8 +1629,13 @@ static void makeWifiRow(int wifiIdx) {
   rssi->setPadding(0, 0, 4, 0);
   rssiLabels[wifiIdx] = rssi;
 
-  bssids[wifiIdx] = String(WiFi.BSSIDstr(wifiIdx)); // Formats 6-octet BSSID to hex str.
+  bssids[wifiIdx] = getBssidStr(wifiIdx); // Formats 6-octet BSSID to hex str.
+#ifdef STATION_LIST_VENDOR
+  const char *vendor = ouiVendorName(pWifiAPRecord->bssid);
+  StrLabel *bssid = vendor != NULL ? new StrLabel(vendor) : new StrLabel(bssids[wifiIdx]);
+#else
   StrLabel *bssid = new StrLabel(bssids[wifiIdx]);
+#endif
   bssid->setPadding(0, 0, 4, 0);
   bssidLabels[wifiIdx] = bssid;
 
@@ -960,32 +1644,38 @@ static void makeWifiRow(int wifiIdx) {
   wifiRow->setColumn(1, chan, CHAN_WIDTH);
   wifiRow->setColumn(2, rssi, RSSI_WIDTH);
   wifiRow->setColumn(3, bssid, BSSID_WIDTH);
-  if (wifiIdx % 2 == 1) {
-    // Every other row should have a non-black bg to zebra-stripe the table.
-    wifiRow->setBackground(TFT_NAVY);
-  } else {
-    wifiRow->setBackground(TFT_BLACK);
-  }
-
-  wifiRows[wifiIdx] = wifiRow;
-  wifiListScroll.add(wifiRow);
-
-  // Get the appropriate heatmap (2.4 GHz or 5 GHz) based on the channel id.
-  Heatmap *bandHeatmap = getHeatmapForChannel(channelNum);
-  // Add this wifi signal to the appropriate heatmap.
-  recordSignalHeatmap(pWifiAPRecord, bandHeatmap);
+  wifiRows[wifiIdx] = wifiRow; // Bound into wifiListScroll by bindStationList(), if it matches.
+  traceRecord(TRACE_MAKE_WIFI_ROW, rowStart, wifiIdx);
 }
 
+// Add a station to the data model: its filter attributes (and AP status). Band totals and
+// heatmaps are computed from all the stations afterward. (Unlike makeWifiRow(), this runs in
+// headless mode too.)
+static void recordStation(int wifiIdx) {
+  const wifi_ap_record_t *pWifiAPRecord = getScanRecord(wifiIdx);
+  int channelNum = pWifiAPRecord->primary;
 
-static void scanWifi() {
-  DBGPRINT("scan start");
+#ifdef ROGUE_DETECT
+  stationApStatus[wifiIdx] = rogueWatchCheck(pWifiAPRecord);
+  if (stationApStatus[wifiIdx] == AP_ROGUE) {
+    DBGPRINTI("Rogue AP; station:", wifiIdx); // Also reported when headless.
+  }
+#endif
+
+  stationFilterAttrs[wifiIdx] = stationAttrs(channelNum,
+      pWifiAPRecord->second != wifi_second_chan_t::WIFI_SECOND_CHAN_NONE, pWifiAPRecord->rssi,
+      stationSecurity(pWifiAPRecord->authmode), pWifiAPRecord->ssid[0] == '\0');
+}
 
-  setStatusLine("Searching for stations...");
 
+// Rebuild the station list, heatmaps and channel advice from the n stations returned by
+// getScanRecord(). If `live`, the scan is also passed on to the logs, history and other outputs;
+// otherwise (a cached snapshot) it's only displayed.
+static void loadScanResults(int n, bool live) {
   // If this has already been called before, free all the existing used memory,
   // by deleting all the pointed-to things from the ptrs in the various arrays.
   if (hasScanned) {
-    for (int i = 0; i < SCAN_MAX_NUMBER; i++) {
+    for (size_t i = 0; i < MAX_STATIONS; i++) {
       delete ssidLabels[i];
       delete chanLabels[i];
       delete rssiLabels[i];
@@ -995,50 +1685,568 @@ static void scanWifi() {
   }
 
   // Initialize all our arrays to have no data / NULL ptrs.
-  for (int i = 0; i < SCAN_MAX_NUMBER; i++) {
+  for (size_t i = 0; i < MAX_STATIONS; i++) {
     bssids[i] = String();
   }
 
-  memset(ssidLabels, 0, sizeof(StrLabel*) * SCAN_MAX_NUMBER);
-  memset(chanLabels, 0, sizeof(IntLabel*) * SCAN_MAX_NUMBER);
-  memset(rssiLabels, 0, sizeof(IntLabel*) * SCAN_MAX_NUMBER);
-  memset(bssidLabels, 0, sizeof(StrLabel*) * SCAN_MAX_NUMBER);
-  memset(wifiRows, 0, sizeof(Cols*) * SCAN_MAX_NUMBER);
+  memset(ssidLabels, 0, sizeof(StrLabel*) * MAX_STATIONS);
+  memset(chanLabels, 0, sizeof(IntLabel*) * MAX_STATIONS);
+  memset(rssiLabels, 0, sizeof(IntLabel*) * MAX_STATIONS);
+  memset(bssidLabels, 0, sizeof(StrLabel*) * MAX_STATIONS);
+  memset(wifiRows, 0, sizeof(Cols*) * MAX_STATIONS);
 
   clearDisabledStations(); // indices of 'disabled' stations are invalid; clear out.
 
   wifiListScroll.clear(); // Wipe scrollbox contents.
+  numVisibleStations = 0;
+
+  hasScanned = true;
+  numScanStations = max(n, 0);
+
+#ifdef SCAN_LOG_RECORD
+  if (live) {
+    scanLogStartScan(millis());
+    for (int i = 0; i < n; i++) {
+      scanLogAddStation(getScanRecord(i));
+    }
+    if (!scanLogFinishScan()) {
+      DBGPRINT("SD log behind; scan not recorded");
+    }
+  }
+#endif
+#ifdef HISTORY_LOG
+  if (live) {
+    historyLogStartScan(millis());
+    for (int i = 0; i < n; i++) {
+      historyLogAddStation(getScanRecord(i));
+    }
+    if (!historyLogFinishScan()) {
+      DBGPRINT("SD history log behind; scan not recorded");
+    }
+  }
+#endif
+
+#ifdef ROGUE_DETECT
+  rogueWatchStartScan();
+#endif
+  if (n <= 0) {
+    DBGPRINT("no networks found");
+  } else {
+    for (int i = 0; i < n; i++) {
+      recordStation(i);
+      if (!headless) {
+        makeWifiRow(i);
+      }
+    }
+  }
+  updateBandTotals();
+  if (live) {
+    recordCongestionHistory();
+  }
+  if (!headless) {
+    updateChannelAdvice(); // Advice is only shown on the heatmap pages.
+    updateHeatmapDiffs();
+  }
 
-  wifi24GHzHeatmap.clear();
-  wifi50GHzHeatmap.clear();
+  if (!live) {
+    return;
+  }
 
-  // Set up channel plans for global heatmaps.
-  populateHeatmapChannelPlan(&wifi24GHzHeatmap, wifi24GHzChannelPlan);
-  populateHeatmapChannelPlan(&wifi50GHzHeatmap, wifi50GHzChannelPlan);
+#ifdef SURVEY_MODE
+  // Fold this scan into the summary for the current survey location.
+  surveyStartScan();
+  for (int i = 0; i < n; i++) {
+    surveyAddStation(getScanRecord(i));
+  }
+  buildBandHeatmap(true); // Survey and stream records need the full heatmaps.
+  buildBandHeatmap(false);
+  surveyAddChannelTotals(wifi24GHzHeatmap);
+  surveyAddChannelTotals(wifi50GHzHeatmap);
+  surveyFinishScan(millis());
+#endif
+
+#ifdef SERIAL_STREAM
+  // Queue the results for the host; they're sent in the background from loop().
+  serialStreamBeginScan(millis(), max(n, 0));
+  for (int i = 0; i < n; i++) {
+    serialStreamStation(getScanRecord(i));
+  }
+  buildBandHeatmap(true);
+  buildBandHeatmap(false);
+  serialStreamChannelTotals(STREAM_BAND_24GHZ, wifi24GHzHeatmap);
+  serialStreamChannelTotals(STREAM_BAND_50GHZ, wifi50GHzHeatmap);
+#endif
+
+#ifdef FAST_BOOT
+  snapshotStartScan(millis());
+  for (int i = 0; i < n; i++) {
+    snapshotAddStation(getScanRecord(i));
+  }
+  snapshotFinishScan(); // Rate-limited; usually a no-op.
+#endif
+}
 
+// Show the results of a live scan in the station list and status line.
+static void bindScanResults() {
+  bindStationList(false);
+#ifdef ROGUE_DETECT
+  if (setRogueStatusLine()) {
+    return; // New and rogue APs take precedence over the filter and scan status.
+  }
+#endif
+  if (stationFilter.isActive()) {
+    setFilterStatusLine();
+  } else {
+#ifdef SURVEY_MODE
+    setSurveyStatusLine();
+#else
+    setStatusLine("Scan complete.", false);
+#endif
+  }
+}
+
+static void scanWifi() {
+#ifdef FAST_BOOT
+  waitBootScan(); // Don't start a scan while the boot scan is still running.
+#endif
+  DBGPRINT("scan start");
+  heapScanBegin();
+
+  if (!headless) {
+    setStatusLine("Searching for stations...");
+  }
+
+  uint32_t scanStart = traceTicks();
+  uint32_t scanStartMillis = millis();
+#ifdef SCAN_LOG_REPLAY
+  // Feed the next recorded scan through the same path as a live one.
+  int n = scanLogReplayNext();
+#elif defined(SCAN_SCHEDULER)
+  // Sweep the channel plan one channel at a time, merging the results.
+  int n = scanSweepRun();
+#elif defined(MULTI_PASS_SCAN)
+  // Scan one channel at a time, merging the results into the persistent station table.
+  int n = scanUnionRun();
+#else
   // WiFi.scanNetworks will return the number of networks found
   int n = WiFi.scanNetworks();
-  hasScanned = true;
-
+  scanCacheCountRpc();
+  n = scanCacheFetch(n); // Every later read is local.
+#endif
+  traceRecord(TRACE_SCAN_NETWORKS, scanStart, max(n, 0));
+  fullScanMillis = millis() - scanStartMillis;
   DBGPRINT("scan done");
-  if (n == 0) {
-    DBGPRINT("no networks found");
+
+  loadScanResults(n, true);
+  if (!headless) {
+    bindScanResults();
+  }
+  heapScanEnd();
+}
+
+// Redraw the entire screen after a scan. Records the render span and closes out the trace
+// for this scan cycle.
+static void renderScanResults() {
+#ifdef DEBUG
+  if (carouselPos == ContentCarousel_Debug) {
+    populateDebugPage(); // Show stats that include the scan we just did.
+  }
+#endif
+
+  buildVisibleHeatmap(); // (Traced separately, as TRACE_HEATMAP.)
+  uint32_t renderStart = traceTicks();
+  screen.render();
+  traceRecord(TRACE_RENDER, renderStart);
+  traceScanComplete();
+}
+
+
+////////    Site survey    ////////
+
+#ifdef SURVEY_MODE
+static uint32_t lastSurveyScanMillis = 0;
+
+static void setSurveyStatusLine() {
+  char surveyMessage[MAX_STATUS_LINE_LEN + 1];
+  const SurveyAccumulator &current = surveyCurrent();
+  snprintf(surveyMessage, MAX_STATUS_LINE_LEN + 1, "Location %u: %u scans, %u stations",
+      surveyLocation(), current.scans(), current.numStations());
+  setStatusLine(surveyMessage, false);
+}
+
+// Short press of "Mark": save the location we're standing at and move on to the next one.
+// Long press: export every saved location over serial.
+static void surveyMarkReleased(bool longPress) {
+  char surveyMessage[MAX_STATUS_LINE_LEN + 1];
+  if (longPress) {
+    surveyExportStart();
+    snprintf(surveyMessage, MAX_STATUS_LINE_LEN + 1, "Exporting %lu survey records...",
+        (unsigned long)surveyStats().recordsInFlash);
+    setStatusLine(surveyMessage);
+    return;
+  }
+
+  uint16_t location = surveyLocation();
+  uint16_t scans = surveyCurrent().scans();
+  size_t stations = surveyCurrent().numStations();
+  if (scans == 0) {
+    snprintf(surveyMessage, MAX_STATUS_LINE_LEN + 1, "No scans at location %u yet", location);
+  } else if (surveyMark()) {
+    snprintf(surveyMessage, MAX_STATUS_LINE_LEN + 1, "Location %u saved (%u scans, %u stations)",
+        location, scans, stations);
   } else {
-    for (int i = 0; i < n; i++) {
-      makeWifiRow(i);
+    snprintf(surveyMessage, MAX_STATUS_LINE_LEN + 1, "Could not save location %u", location);
+  }
+  setStatusLine(surveyMessage);
+}
+
+// Scan every SURVEY_SCAN_INTERVAL_MILLIS, and send the next piece of an export. Call from loop().
+static void surveyPoll() {
+  if (surveyExporting()) {
+    surveyExportPoll();
+    if (!surveyExporting()) {
+      char surveyMessage[MAX_STATUS_LINE_LEN + 1];
+      snprintf(surveyMessage, MAX_STATUS_LINE_LEN + 1, "Exported %lu survey records",
+          (unsigned long)surveyStats().recordsExported);
+      setStatusLine(surveyMessage);
+    }
+    return; // Hold off on scanning until the export is done.
+  }
+
+  if (millis() - lastSurveyScanMillis >= SURVEY_SCAN_INTERVAL_MILLIS) {
+    scanWifi();
+    renderScanResults();
+    lastSurveyScanMillis = millis();
+  }
+}
+#endif
+
+
+////////    New and rogue AP detection    ////////
+
+#ifdef ROGUE_DETECT
+static uint16_t apStatusColor(ApStatus status) {
+  switch (status) {
+  case AP_ROGUE:
+    return TFT_RED;
+  case AP_NEW_CLEAN_CHANNEL:
+    return TFT_ORANGE;
+  case AP_NEW:
+    return TFT_YELLOW;
+  default:
+    return TFT_WHITE;
+  }
+}
+
+// If the last scan found new or rogue APs, say so on the status line and return true.
+static bool setRogueStatusLine() {
+  const RogueScanCounts &counts = rogueWatchCounts();
+  if (counts.rogue == 0 && counts.newAps == 0 && counts.newCleanChannel == 0) {
+    return false;
+  }
+
+  char rogueMessage[MAX_STATUS_LINE_LEN + 1];
+  snprintf(rogueMessage, MAX_STATUS_LINE_LEN + 1, "Rogue APs: %u  New: %u (%u on clean chans)",
+      counts.rogue, counts.newAps + counts.newCleanChannel, counts.newCleanChannel);
+  setStatusLine(rogueMessage, false);
+  return true;
+}
+
+// Replace the known-AP baseline with the stations of the current scan, and recheck them.
+static void captureBaseline() {
+  rogueWatchCaptureStart();
+  for (int i = 0; i < numScanStations; i++) {
+    rogueWatchCaptureStation(getScanRecord(i));
+  }
+  bool saved = rogueWatchCaptureFinish();
+
+  rogueWatchStartScan();
+  for (int i = 0; i < numScanStations; i++) {
+    stationApStatus[i] = rogueWatchCheck(getScanRecord(i));
+    if (ssidLabels[i] != NULL) {
+      ssidLabels[i]->setColor(apStatusColor(stationApStatus[i]));
+    }
+  }
+
+  char rogueMessage[MAX_STATUS_LINE_LEN + 1];
+  const ApBaseline &baseline = rogueWatchBaseline();
+  snprintf(rogueMessage, MAX_STATUS_LINE_LEN + 1, "Baseline: %u APs, %u SSIDs%s",
+      baseline.numBssids(), baseline.numSsids(), saved ? "" : " (not saved to flash)");
+  setStatusLine(rogueMessage, false);
+  screen.render();
+}
+#endif
+
+
+////////    Fast boot from a cached scan    ////////
+
+#ifdef FAST_BOOT
+static bool bootScanPending = false; // The first live scan is running in the background.
+static uint32_t bootScanStart = 0;
+
+// Show the snapshot saved by a previous boot, marked as stale. Returns false if there isn't one.
+static bool showBootSnapshot() {
+  int n = snapshotLoad();
+  if (n < 0) {
+    return false;
+  }
+
+  DBGPRINTI("Showing cached scan; stations:", n);
+  showingSnapshot = true;
+  loadScanResults(n, false);
+  bindStationList(false);
+  setStatusLine("Cached scan from last boot (stale); scanning...", false);
+  return true;
+}
+
+// Start the first live scan without waiting for it; bootScanPoll() picks up the results.
+static void startBootScan() {
+  bootScanStart = traceTicks();
+  WiFi.scanNetworks(true);
+  scanCacheCountRpc();
+  bootScanPending = true;
+}
+
+// Replace the snapshot with the boot scan's results once it finishes. Call from loop().
+static void bootScanPoll() {
+  if (!bootScanPending) {
+    return;
+  }
+
+  int n = WiFi.scanComplete();
+  scanCacheCountRpc();
+  if (n == WIFI_SCAN_RUNNING) {
+    return;
+  }
+  n = scanCacheFetch(n);
+
+  traceRecord(TRACE_SCAN_NETWORKS, bootScanStart, max(n, 0));
+  bootScanPending = false;
+  showingSnapshot = false;
+  DBGPRINT("boot scan done");
+
+  heapScanBegin();
+  loadScanResults(n, true);
+  bindScanResults();
+  heapScanEnd();
+  renderScanResults();
+}
+
+// Block until the boot scan (if any) is done, so that a foreground scan doesn't overlap it.
+static void waitBootScan() {
+  while (bootScanPending) {
+    bootScanPoll();
+    delay(10);
+  }
+}
+#endif
+
+
+////////    Station tracking    ////////
+
+// Set the main display to the tracking page for station wifiIdx, and start tracking it.
+static void displayTracking(size_t wifiIdx) {
+  const wifi_ap_record_t *pWifiAPRecord = getScanRecord(wifiIdx);
+  snprintf(trackTitleText, TRACK_TITLE_LEN + 1, "%s (channel %d)",
+      reinterpret_cast<const char*>(&(pWifiAPRecord->ssid[0])), pWifiAPRecord->primary);
+  stationTrackBegin(pWifiAPRecord->bssid, pWifiAPRecord->primary);
+#ifdef FAST_BOOT
+  waitBootScan(); // Tracking scans can't overlap the boot scan. (This replaces the records.)
+#endif
+#ifdef LOW_POWER_MONITOR
+  monitorScanStart(); // The radio is off between scheduled scans; keep it on while tracking.
+#endif
+
+  carouselPos = ContentCarousel_Tracking;
+  tracking = true;
+  trackStatusMillis = millis();
+  trackSparkline.clear();
+  strcpy(trackRssiText, "--");
+
+  rowLayout.setRow(1, &trackTitleLabel, 16);
+  rowLayout.setRow(2, &trackPanel, EQUAL);
+  setStatusLine("Tracking; scanning one channel only.", false);
+  setButton1(&trackBackBtn, trackBackHandler);
+  setButton2(NULL, emptyBtnHandler);
+  setButton3(NULL, emptyBtnHandler);
+  buttons[HAT_IN_DEBOUNCE_ID].setHandler(emptyBtnHandler); // hat disabled.
+  buttons[HAT_UP_DEBOUNCE_ID].setHandler(emptyBtnHandler);
+  buttons[HAT_DOWN_DEBOUNCE_ID].setHandler(emptyBtnHandler);
+  buttons[HAT_LEFT_DEBOUNCE_ID].setHandler(emptyBtnHandler);
+  buttons[HAT_RIGHT_DEBOUNCE_ID].setHandler(emptyBtnHandler);
+}
+
+// Scan the tracked station's channel once, and redraw only the RSSI readout and sparkline.
+// Called from loop() in place of full scans while the tracking page is up.
+static void trackPoll() {
+  int rssi = stationTrackScan();
+  bool heard = rssi != TRACK_NO_SIGNAL;
+  if (heard) {
+    snprintf(trackRssiText, TRACK_RSSI_LEN + 1, "%d", rssi);
+  } else {
+    strcpy(trackRssiText, "--");
+  }
+  trackSparkline.addSample(rssi, heard);
+  screen.renderWidget(&trackRssiLabel);
+  screen.renderWidget(&trackSparkline);
+
+  // Report the update rate, against a full scan, once a second.
+  if (millis() - trackStatusMillis >= 1000) {
+    const StationTrackStats &stats = stationTrackStats();
+    uint32_t tenthsPerSec = stats.scansPerMinute / 6;
+    char rateMsg[MAX_STATUS_LINE_LEN + 1];
+    snprintf(rateMsg, MAX_STATUS_LINE_LEN + 1, "%lu.%lu updates/s vs. full scan %lu ms",
+        (unsigned long)(tenthsPerSec / 10), (unsigned long)(tenthsPerSec % 10),
+        (unsigned long)fullScanMillis);
+    setStatusLine(rateMsg, true);
+    trackStatusMillis = millis();
+  }
+}
+
+
+////////    Headless high-rate scanning    ////////
+
+// Send queued serial stream frames and write-behind SD log sectors. Each call does a bounded
+// amount of work.
+static void pollOutputs() {
+#ifdef SERIAL_STREAM
+  serialStreamPoll();
+#endif
+#ifdef SCAN_LOG_RECORD
+  scanLogPoll(); // Write-behind: at most one sector to the SD card per pass.
+#endif
+#ifdef HISTORY_LOG
+  historyLogPoll();
+#endif
+}
+
+// True if pollOutputs() still has work queued.
+static bool outputsPending() {
+#ifdef SERIAL_STREAM
+  if (serialStreamPending() > 0) {
+    return true;
+  }
+#endif
+#ifdef SCAN_LOG_RECORD
+  if (scanLogStats().ringUsed >= SD_LOG_SECTOR_LEN) {
+    return true;
+  }
+#endif
+#ifdef HISTORY_LOG
+  if (historyLogStats().ringUsed >= SD_LOG_SECTOR_LEN) {
+    return true;
+  }
+#endif
+  return false;
+}
+
+// Max time spent draining the outputs after each headless scan; if the host or card can't keep
+// up, the rest is left queued (and new frames or records are dropped and counted).
+static constexpr uint32_t HEADLESS_DRAIN_MAX_MILLIS = 2000;
+// Print the scan rate over serial every N headless scans.
+static constexpr uint32_t HEADLESS_REPORT_SCANS = 10;
+
+static uint32_t headlessStartMillis = 0;
+static uint32_t headlessScans = 0;
+
+static void headlessBegin() {
+  lcd.drawString("Headless: scanning continuously.", 4, 64);
+  lcd.drawString("Reset to return to the UI.", 4, 80);
+  DBGPRINT("Headless mode");
+  headlessStartMillis = millis();
+}
+
+// Scan, then drain the outputs before the next scan (they would otherwise get only one pass
+// of loop() per scan and fall behind). Called from loop() in place of the UI.
+static void headlessPoll() {
+  scanWifi();
+  traceScanComplete();
+  headlessScans++;
+
+  uint32_t drainStart = millis();
+  while (outputsPending() && millis() - drainStart < HEADLESS_DRAIN_MAX_MILLIS) {
+    pollOutputs();
+  }
+
+  if (headlessScans % HEADLESS_REPORT_SCANS == 0) {
+    uint32_t elapsed = millis() - headlessStartMillis;
+    char rateMsg[48];
+    snprintf(rateMsg, sizeof(rateMsg), "headless: %lu scans, %lu.%lu scans/min",
+        (unsigned long)headlessScans, (unsigned long)(headlessScans * 60000ULL / elapsed),
+        (unsigned long)(headlessScans * 600000ULL / elapsed % 10));
+    DBGPRINT(rateMsg);
+  }
+}
+
+
+////////    Low-power unattended monitoring    ////////
+
+#ifdef LOW_POWER_MONITOR
+static uint32_t lastInputMillis = 0; // millis() of the last button activity.
+static bool monitorScreenOn = true;
+
+// True if the write-behind SD logs hold full sectors that should reach the card before we sleep.
+static bool monitorLogsPending() {
+#ifdef SCAN_LOG_RECORD
+  if (scanLogStats().ringUsed >= SD_LOG_SECTOR_LEN) {
+    return true;
+  }
+#endif
+#ifdef HISTORY_LOG
+  if (historyLogStats().ringUsed >= SD_LOG_SECTOR_LEN) {
+    return true;
+  }
+#endif
+  return false;
+}
+
+// Run scheduled scans, and sleep in standby between them once the buttons have been idle for
+// MONITOR_AWAKE_MILLIS. Called from loop() in place of delay().
+static void monitorPoll() {
+  for (auto pin: buttonGpioPins) {
+    if (digitalRead(pin) == LOW) {
+      lastInputMillis = millis(); // A button is held; stay awake.
     }
   }
 
-  wifiListScroll.setSelection(0);
-  wifiListScroll.scrollTo(0);
-  setStatusLine("Scan complete.", false);
+  if (monitorScanDue()) {
+    monitorScanStart();
+    scanWifi(); // Results still go into the station list and heatmaps.
+    monitorScanEnd();
+    if (monitorScreenOn) {
+      renderScanResults();
+    } else {
+      traceScanComplete(); // Don't draw to a dark screen; it's redrawn on wake.
+    }
+  }
+
+  if (millis() - lastInputMillis < MONITOR_AWAKE_MILLIS || monitorLogsPending()) {
+    delay(10);
+    return;
+  }
+
+  if (monitorScreenOn) {
+    monitorSetBacklight(false);
+    monitorScreenOn = false;
+  }
+
+  if (monitorSleep()) {
+    // Woken by a button: show the latest results.
+    lastInputMillis = millis();
+    monitorScreenOn = true;
+    buildVisibleHeatmap(); // Scans while the screen was dark left it stale.
+    screen.render();
+    monitorSetBacklight(true);
+  }
 }
+#endif
 
 
 ////////    Arduino main setup & loop    ////////
 
 void setup() {
   DBGSETUP();
+  traceSetup();
   //while (!Serial) { delay(10); }
 
   // Register the pins for the 5-way hat button.
@@ -1058,8 +2266,8 @@ void setup() {
 
   buttons.push_back(Button(HAT_UP_DEBOUNCE_ID, scrollUpHandler));    // hat up
   buttons.push_back(Button(HAT_DOWN_DEBOUNCE_ID, scrollDownHandler));  // hat down
-  buttons.push_back(Button(2, emptyBtnHandler)); // hat left (unused)
-  buttons.push_back(Button(3, emptyBtnHandler)); // hat right (unused)
+  buttons.push_back(Button(HAT_LEFT_DEBOUNCE_ID, filterFieldHandler)); // hat left
+  buttons.push_back(Button(HAT_RIGHT_DEBOUNCE_ID, filterValueHandler)); // hat right
   buttons.push_back(Button(HAT_IN_DEBOUNCE_ID, stationDetailsHandler)); // 4: hat "in"/"OK"
   buttons.push_back(Button(TOP_BUTTON_1_DEBOUNCE_ID, stationDetailsHandler)); // 5: top left "details" button
   buttons.push_back(Button(TOP_BUTTON_2_DEBOUNCE_ID, emptyBtnHandler)); // top middle "refresh" button
@@ -1072,10 +2280,77 @@ void setup() {
   lcd.setTextColor(TFT_WHITE);
   lcd.drawString("Wifi analyzer starting up...", 4, 4);
 
-  // Set WiFi to station mode and disconnect from an AP if it was previously connected
-  WiFi.mode(WIFI_STA);
-  WiFi.disconnect();
-  delay(100);
+#ifndef FAST_BOOT
+  radioBegin();
+#endif
+
+#if defined(SCAN_LOG_RECORD) || defined(SCAN_LOG_REPLAY) || defined(HISTORY_LOG)
+  sdCardBegin();
+#endif
+#ifdef SCAN_LOG_RECORD
+  if (!scanLogRecordBegin()) {
+    lcd.drawString("Could not start SD scan log.", 4, 24);
+  }
+#endif
+#ifdef SCAN_LOG_REPLAY
+  if (!scanLogReplayOpen()) {
+    lcd.drawString("No replay log on SD card.", 4, 24);
+  }
+#endif
+#ifdef HISTORY_LOG
+  if (!historyLogBegin()) {
+    lcd.drawString("Could not start SD history log.", 4, 36);
+  }
+#endif
+#ifdef ROGUE_DETECT
+  if (!rogueWatchBegin()) {
+    DBGPRINT("No AP baseline in flash; hold Refresh to capture one");
+  }
+#endif
+#ifdef SURVEY_MODE
+  if (!surveyBegin()) {
+    lcd.drawString("Could not open SPI flash for survey.", 4, 48);
+  }
+#endif
+
+#ifdef SCAN_SCHEDULER
+  for (auto channel: wifi24GHzChannelPlan) {
+    scanSweepDefineChannel(channel);
+  }
+  for (auto channel: wifi50GHzChannelPlan) {
+    scanSweepDefineChannel(channel);
+  }
+#endif
+#ifdef MULTI_PASS_SCAN
+  for (auto channel: wifi24GHzChannelPlan) {
+    scanUnionDefineChannel(channel);
+  }
+  for (auto channel: wifi50GHzChannelPlan) {
+    scanUnionDefineChannel(channel);
+  }
+#endif
+
+  for (auto channel: wifi24GHzChannelPlan) {
+    congestionHistory.defineChannel(channel);
+    heatmapTotalsDefineChannel(bandTotals24GHz, channel);
+  }
+  for (auto channel: wifi50GHzChannelPlan) {
+    congestionHistory.defineChannel(channel);
+    heatmapTotalsDefineChannel(bandTotals50GHz, channel);
+  }
+
+#ifdef HEADLESS
+  headless = true;
+#else
+  headless = digitalRead(WIO_KEY_C) == LOW; // Top-left button held at boot.
+#endif
+  if (headless) {
+#ifdef FAST_BOOT
+    radioBegin();
+#endif
+    headlessBegin();
+    return; // No widgets, layout or first render.
+  }
 
   // Set up main layout, with nav buttons, status, etc. and the station list vscroll.
   screen.setBackground(TRANSPARENT_COLOR);
@@ -1163,10 +2438,13 @@ void setup() {
   detailsSsid.setFont(2);
 
   detailsBssidCols.setColumn(0, &detailsBssidHdr, 40);
-  detailsBssidCols.setColumn(1, &detailsBssid, EQUAL);
+  detailsBssidCols.setColumn(1, &detailsBssid, 140);
+  detailsBssidCols.setColumn(2, &detailsVendor, EQUAL);
   detailsBssidHdr.setColor(TFT_YELLOW);
   detailsBssidHdr.setFont(2); // larger font size for BSSID.
   detailsBssid.setFont(2);
+  detailsVendor.setFont(2);
+  detailsVendor.setColor(TFT_CYAN);
 
   detailsModeBwCols.setColumn(0, &detailsModes, EQUAL);
   detailsModeBwCols.setColumn(1, &detailsBandwidth, EQUAL);
@@ -1193,18 +2471,128 @@ void setup() {
   detailsDisableBtn.setColor(TFT_BLUE);
   detailsDisableBtn.setPadding(4, 4, 0, 0);
 
+  detailsTrackBtn.setColor(TFT_BLUE);
+  detailsTrackBtn.setPadding(4, 4, 0, 0);
+
+  // Set up tracking page UI widgets.
+  trackPanel.setChild(&trackRows);
+  trackPanel.setBackground(TFT_NAVY);
+  trackPanel.setPadding(4, 4, 4, 4);
+  trackRows.setRow(0, &trackRssiLabel, 56);
+  trackRows.setRow(1, &trackSparkline, EQUAL);
+  trackRssiLabel.setFont(7); // 48px seven-segment digits.
+  trackRssiLabel.setColor(TFT_GREEN);
+  trackRssiLabel.setBackground(TFT_NAVY); // Clear the previous reading on each redraw.
+  trackSparkline.setBackground(TFT_BLACK);
+  trackTitleLabel.setColor(TFT_GREEN);
+  trackBackBtn.setColor(TFT_BLUE);
+  trackBackBtn.setPadding(4, 4, 0, 0);
+
+  wifi24GHzHeatmap.setDiff(&wifi24GHzDiff);
+  wifi50GHzHeatmap.setDiff(&wifi50GHzDiff);
+
+  populateAdvisorChannelPlan(&channelAdvisor24GHz, wifi24GHzChannelPlan);
+  populateAdvisorChannelPlan(&channelAdvisor50GHz, wifi50GHzChannelPlan);
+  advice24GHzLabel.setColor(TFT_GREEN);
+  advice50GHzLabel.setColor(TFT_GREEN);
+  historyTitleLabel.setColor(TFT_GREEN);
+
+#ifdef DEBUG
+  // Set up Debug page UI widgets.
+  debugPanel.setChild(&debugRows);
+  debugPanel.setBackground(TFT_NAVY);
+  debugPanel.setPadding(4, 4, 4, 4);
+  for (size_t i = 0; i < DEBUG_PAGE_LINES; i++) {
+    debugPageText[i][0] = '\0';
+    debugPageLabels[i].setText(debugPageText[i]);
+    debugPageLabels[i].setFont(0);
+    debugPageLabels[i].setColor(TFT_YELLOW);
+    debugRows.setRow(i, &debugPageLabels[i], 12);
+  }
+#endif
+
+#ifdef FAST_BOOT
+  if (showBootSnapshot()) {
+    // Draw the cached results right away; the radio starts up behind them.
+    lcd.fillScreen(TFT_BLACK);
+    screen.render();
+    radioBegin();
+#if defined(SCAN_LOG_REPLAY) || defined(SCAN_SCHEDULER) || defined(MULTI_PASS_SCAN)
+    showingSnapshot = false;
+    scanWifi();
+    renderScanResults();
+#else
+    startBootScan();
+#endif
+  } else {
+    radioBegin();
+    scanWifi();
+    lcd.fillScreen(TFT_BLACK);
+    renderScanResults();
+  }
+#else
   scanWifi(); // Populates VScroll and global heatmap elements.
   lcd.fillScreen(TFT_BLACK); // Clear 'loading' screen msg.
-  screen.render();
+  renderScanResults();
+#endif
+
+#ifdef LOW_POWER_MONITOR
+  for (auto pin: buttonGpioPins) {
+    monitorWakeOnPin(pin);
+  }
+  if (!monitorBegin()) {
+    DBGPRINT("Standby not supported; monitor mode will idle between scans");
+  }
+  lastInputMillis = millis();
+#endif
+}
+
+// Set WiFi to station mode and disconnect from an AP if it was previously connected.
+static void radioBegin() {
+  WiFi.mode(WIFI_STA);
+  WiFi.disconnect();
+  scanCacheCountRpc(2);
+  delay(100);
 }
 
 static void pollButtons() {
   for (unsigned int i = 0; i < buttons.size(); i++) {
+    scanCacheBeginAction();
     buttons[i].update(digitalRead(buttonGpioPins[i]));
+    if (scanCacheEndAction()) {
+      const ScanCacheStats &cache = scanCacheStats();
+      char rpcMsg[64];
+      snprintf(rpcMsg, sizeof(rpcMsg), "button %u: %lu RPC calls, %lu cached record reads", i,
+          (unsigned long)cache.lastActionRpcCalls, (unsigned long)cache.lastActionCachedReads);
+      DBGPRINT(rpcMsg);
+    }
   }
 }
 
 void loop() {
+  if (headless) {
+    headlessPoll();
+    return;
+  }
+
   pollButtons();
+  pollOutputs();
+  if (tracking) {
+    trackPoll(); // Back-to-back tracking scans; no full scans, survey marks or standby.
+#ifdef LOW_POWER_MONITOR
+    lastInputMillis = millis(); // Stay awake after tracking ends, too.
+#endif
+    return;
+  }
+#ifdef FAST_BOOT
+  bootScanPoll();
+#endif
+#ifdef SURVEY_MODE
+  surveyPoll();
+#endif
+#ifdef LOW_POWER_MONITOR
+  monitorPoll();
+#else
   delay(10);
+#endif
 }
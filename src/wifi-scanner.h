@@ -24,11 +24,73 @@
 //#define DBG_START_PAUSED
 #include <dbg.h>
 
+// Uncomment to log each scan's results to files on the SD card (see scan-log.h).
+//#define SCAN_LOG_RECORD
+// Uncomment to replay scans from SCAN_REPLAY_PATH on the SD card instead of using the radio.
+//#define SCAN_LOG_REPLAY
+// Uncomment to append compact long-running scan history to the SD card (see history-format.h).
+//#define HISTORY_LOG
+// Uncomment to stream each scan's results over USB serial as binary frames (see stream-format.h).
+//#define SERIAL_STREAM
+// Uncomment to scan one channel at a time with dwell times adapted to each channel's recent
+// occupancy, instead of one default scanNetworks() call (see dwell-scheduler.h).
+//#define SCAN_SCHEDULER
+// Uncomment to scan one channel at a time and merge the results into a station table that is
+// larger than one scan can return, and persists across scans (see scan-union.h). Not combined
+// with SCAN_SCHEDULER.
+//#define MULTI_PASS_SCAN
+// Uncomment to show each station's vendor (from its BSSID's OUI) in the station list in place of
+// its BSSID. The vendor is always shown on the Details page.
+//#define STATION_LIST_VENDOR
+// Uncomment for unattended low-power monitoring: scan periodically with the screen and radio off
+// and the CPU in standby between scans (see low-power.h).
+//#define LOW_POWER_MONITOR
+// Uncomment for site surveys: scan continuously, and press "Mark" at each location to save a
+// summary of its scans to SPI flash (see survey.h).
+//#define SURVEY_MODE
+// Uncomment to always run headless: back-to-back scans feed only the data model and the serial
+// and SD outputs above, with no UI. Otherwise, hold the top-left button at boot to run headless.
+//#define HEADLESS
+// Uncomment to check each scan against a baseline of known APs saved in SPI flash, and flag new
+// and rogue APs (see rogue-watch.h). Hold "Refresh" to capture the baseline.
+//#define ROGUE_DETECT
+// Uncomment to show the last scan saved in SPI flash at boot, while the first live scan runs in
+// the background (see boot-snapshot.h).
+//#define FAST_BOOT
+
+#include "ap-baseline.h"
+#include "boot-snapshot.h"
+#include "channel-advisor.h"
+#include "congestion-history.h"
+#include "congestion-plot.h"
+#include "heap-stats.h"
+#include "heatmap-diff.h"
 #include "heatmap.h"
+#include "history-log.h"
+#include "low-power.h"
+#include "oui.h"
+#include "rogue-watch.h"
+#include "rssi-sparkline.h"
+#include "scan-cache.h"
+#include "scan-log.h"
+#include "scan-sweep.h"
+#include "scan-union.h"
+#include "sd-logger.h"
+#include "serial-stream.h"
+#include "spectrum.h"
+#include "spi-flash.h"
+#include "station-filter.h"
+#include "station-table.h"
+#include "station-track.h"
+#include "survey.h"
+#include "trace.h"
 
 // Copies the specified text (up to 80 chars) into the status line buffer
 // and renders it to the bottom of the screen. If immediateRedraw=false,
 // the visible widget will not be updated until your next screen.render() call.
 extern void setStatusLine(const char *in, bool immediateRedraw=true);
 
+// True if running headless, with no widgets to draw into (see setup()).
+extern bool isHeadless();
+
 #endif
@@ -0,0 +1,209 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Lock-free multi-device scan aggregation. See aggregator.h.
+
+#include <string.h>
+
+#include "aggregator.h"
+
+// A device's reading of an AP, packed to fit one atomic word:
+//   bits  0..31  number of the device's scan it's from (from 1)
+//   bits 32..39  primary channel
+//   bits 40..47  secondary channel position
+//   bits 48..55  rssi (int8)
+//   bits 56..63  phy flags (SCAN_LOG_PHY_*)
+static inline uint64_t packReading(uint32_t scanNum, const ScanLogStation &station) {
+  return scanNum | static_cast<uint64_t>(station.primary) << 32
+      | static_cast<uint64_t>(station.second) << 40
+      | static_cast<uint64_t>(static_cast<uint8_t>(station.rssi)) << 48
+      | static_cast<uint64_t>(station.phyFlags) << 56;
+}
+
+static inline uint32_t readingScan(uint64_t reading) {
+  return static_cast<uint32_t>(reading);
+}
+
+static inline int8_t readingRssi(uint64_t reading) {
+  return static_cast<int8_t>((reading >> 48) & 0xFF);
+}
+
+static void readingSignal(uint64_t reading, SpectrumSignal &signal) {
+  uint8_t phyFlags = reading >> 56;
+  signal.primary = (reading >> 32) & 0xFF;
+  signal.second = (reading >> 40) & 0xFF;
+  signal.rssi = readingRssi(reading);
+  signal.phy11b = (phyFlags & SCAN_LOG_PHY_11B) != 0;
+  signal.phy11n = (phyFlags & SCAN_LOG_PHY_11N) != 0;
+}
+
+static inline uint64_t bssidKey(const uint8_t *bssid) {
+  uint64_t key = 1ULL << 48; // Never 0, even for an all-zero BSSID.
+  for (size_t i = 0; i < 6; i++) {
+    key |= static_cast<uint64_t>(bssid[i]) << (8 * (5 - i));
+  }
+
+  return key;
+}
+
+static inline size_t keySlot(uint64_t key) {
+  key ^= key >> 29;
+  key *= 0xBF58476D1CE4E5B9ULL;
+  key ^= key >> 32;
+  return key & (AGG_TABLE_SLOTS - 1);
+}
+
+static void addPower(int channelNum, int rssi, void *power) {
+  if (channelNum >= 0 && channelNum < static_cast<int>(AGG_CHANNEL_SLOTS)) {
+    static_cast<power_t*>(power)[channelNum] += dbmToPower(rssi);
+  }
+}
+
+Aggregator::Aggregator(): _numAps(0), _tableFull(0) {
+  for (Slot &slot : _slots) {
+    slot.key.store(0, std::memory_order_relaxed);
+    for (auto &reading : slot.readings) {
+      reading.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  for (Device &device : _devices) {
+    device.scans.store(0, std::memory_order_relaxed);
+    for (auto &power : device.power) {
+      power.store(0, std::memory_order_relaxed);
+    }
+    device.scanNum = 0;
+    device.inScan = false;
+    memset(device.scanPower, 0, sizeof(device.scanPower));
+  }
+}
+
+Aggregator::Slot *Aggregator::_findOrClaim(uint64_t key) {
+  size_t idx = keySlot(key);
+  for (size_t probes = 0; probes < AGG_TABLE_SLOTS; probes++) {
+    Slot &slot = _slots[idx];
+    uint64_t slotKey = slot.key.load(std::memory_order_acquire);
+    if (slotKey == key) {
+      return &slot;
+    }
+
+    if (slotKey == 0) {
+      // Reserve room before claiming, so the table never gets too full to probe quickly.
+      if (_numAps.fetch_add(1, std::memory_order_relaxed) >= AGG_MAX_APS) {
+        _numAps.fetch_sub(1, std::memory_order_relaxed);
+        return NULL;
+      }
+
+      uint64_t expected = 0;
+      if (slot.key.compare_exchange_strong(expected, key, std::memory_order_acq_rel)) {
+        return &slot;
+      }
+
+      // Another device claimed this slot first; it may have been for the same BSSID.
+      _numAps.fetch_sub(1, std::memory_order_relaxed);
+      if (expected == key) {
+        return &slot;
+      }
+    }
+
+    idx = (idx + 1) & (AGG_TABLE_SLOTS - 1);
+  }
+
+  return NULL;
+}
+
+void Aggregator::beginScan(size_t device) {
+  Device &dev = _devices[device];
+  dev.scanNum = dev.scans.load(std::memory_order_relaxed) + 1;
+  dev.inScan = true;
+  memset(dev.scanPower, 0, sizeof(dev.scanPower));
+}
+
+void Aggregator::addStation(size_t device, const ScanLogStation &station) {
+  Device &dev = _devices[device];
+  if (!dev.inScan) {
+    beginScan(device);
+  }
+
+  uint64_t reading = packReading(dev.scanNum, station);
+  SpectrumSignal signal;
+  readingSignal(reading, signal);
+  spectrumForEachChannel(signal, addPower, dev.scanPower);
+
+  Slot *slot = _findOrClaim(bssidKey(station.bssid));
+  if (slot == NULL) {
+    _tableFull.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  slot->readings[device].store(reading, std::memory_order_relaxed);
+}
+
+void Aggregator::endScan(size_t device) {
+  Device &dev = _devices[device];
+  if (!dev.inScan) {
+    return;
+  }
+
+  for (size_t i = 0; i < AGG_CHANNEL_SLOTS; i++) {
+    dev.power[i].store(dev.scanPower[i], std::memory_order_relaxed);
+  }
+  dev.inScan = false;
+  dev.scans.store(dev.scanNum, std::memory_order_release);
+}
+
+uint32_t Aggregator::deviceScans(size_t device) const {
+  return _devices[device].scans.load(std::memory_order_acquire);
+}
+
+void Aggregator::devicePower(size_t device, power_t *power) const {
+  const Device &dev = _devices[device];
+  for (size_t i = 0; i < AGG_CHANNEL_SLOTS; i++) {
+    power[i] = dev.power[i].load(std::memory_order_relaxed);
+  }
+}
+
+AggMergeStats Aggregator::mergedPower(power_t *power) const {
+  AggMergeStats stats = { 0, 0 };
+  memset(power, 0, AGG_CHANNEL_SLOTS * sizeof(power_t));
+
+  uint32_t scans[AGG_MAX_DEVICES];
+  for (size_t d = 0; d < AGG_MAX_DEVICES; d++) {
+    scans[d] = deviceScans(d);
+  }
+
+  for (const Slot &slot : _slots) {
+    if (slot.key.load(std::memory_order_acquire) == 0) {
+      continue;
+    }
+
+    uint64_t best = 0;
+    size_t heardBy = 0;
+    for (size_t d = 0; d < AGG_MAX_DEVICES; d++) {
+      uint64_t reading = slot.readings[d].load(std::memory_order_relaxed);
+      // A reading from the scan in progress is one ahead of the completed scans: age -1.
+      int32_t age = static_cast<int32_t>(scans[d] - readingScan(reading));
+      if (reading == 0 || age >= static_cast<int32_t>(AGG_MAX_AGE_SCANS)) {
+        continue;
+      }
+
+      heardBy++;
+      if (best == 0 || readingRssi(reading) > readingRssi(best)) {
+        best = reading;
+      }
+    }
+
+    if (heardBy == 0) {
+      continue;
+    }
+
+    stats.aps++;
+    if (heardBy > 1) {
+      stats.multiDevice++;
+    }
+
+    SpectrumSignal signal;
+    readingSignal(best, signal);
+    spectrumForEachChannel(signal, addPower, power);
+  }
+
+  return stats;
+}
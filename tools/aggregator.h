@@ -0,0 +1,89 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Merge the scans of several scanners into per-device and building-wide per-channel congestion,
+// using the same spectral mask model (spectrum.h) and linear power sums (linear-power.h) as the
+// heatmaps on the device.
+
+#ifndef _AGGREGATOR_H
+#define _AGGREGATOR_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "linear-power.h"
+#include "scan-log-format.h"
+#include "spectrum.h"
+
+constexpr size_t AGG_MAX_DEVICES = 16;
+
+// Slots in the shared BSSID table; a power of two. It's kept no more than 3/4 full.
+constexpr size_t AGG_TABLE_SLOTS = 8192;
+constexpr size_t AGG_MAX_APS = AGG_TABLE_SLOTS / 4 * 3;
+
+// Per-channel totals are indexed by channel number.
+constexpr size_t AGG_CHANNEL_SLOTS = max50GHzChannelNum + 1;
+
+// An AP counts toward the merged totals while one of the devices has heard it in that device's
+// last AGG_MAX_AGE_SCANS scans.
+constexpr uint32_t AGG_MAX_AGE_SCANS = 3;
+
+struct AggMergeStats {
+  size_t aps;            // Distinct BSSIDs in the merged totals.
+  size_t multiDevice;    // ...of which more than one device heard.
+};
+
+// Each device is fed by a single thread of its own; the devices' threads, and any number of
+// reader threads, run concurrently without locks:
+//
+// * APs are deduplicated in an open-addressed table of BSSIDs, which slots claim with a
+//   compare-and-swap and never give up. Each slot has one reading per device, so a device
+//   thread is the only writer of its own readings.
+// * Each device sums its own per-channel power as it goes, and publishes it at the end of each
+//   scan. Readers may see a mix of two consecutive scans' channels; each channel is whole.
+// * The merged totals are computed by the reader from the table: each AP once, at the strongest
+//   reading any device has of it.
+class Aggregator {
+public:
+  Aggregator();
+
+  // Device side. Calls for one device must all come from the same thread.
+  void beginScan(size_t device);
+  void addStation(size_t device, const ScanLogStation &station);
+  void endScan(size_t device);
+
+  // Reader side; any thread.
+  // Number of scans the device has completed.
+  uint32_t deviceScans(size_t device) const;
+  // Fill `power` (AGG_CHANNEL_SLOTS entries) with the device's most recent complete scan.
+  void devicePower(size_t device, power_t *power) const;
+  // Fill `power` (AGG_CHANNEL_SLOTS entries) with the merged totals of all devices.
+  AggMergeStats mergedPower(power_t *power) const;
+  // Readings dropped because the BSSID table was full.
+  uint64_t tableFull() const { return _tableFull.load(std::memory_order_relaxed); };
+
+private:
+  struct Slot {
+    std::atomic<uint64_t> key; // 48-bit BSSID | 1 << 48; 0 if unclaimed.
+    // Latest reading from each device: see packReading() in aggregator.cpp. 0 if none.
+    std::atomic<uint64_t> readings[AGG_MAX_DEVICES];
+  };
+
+  struct Device {
+    std::atomic<uint32_t> scans;                    // Completed scans; published last.
+    std::atomic<power_t> power[AGG_CHANNEL_SLOTS];  // Totals of the last complete scan.
+    // Owned by the device's thread.
+    uint32_t scanNum;                               // Number of the scan in progress.
+    bool inScan;
+    power_t scanPower[AGG_CHANNEL_SLOTS];
+  };
+
+  Slot *_findOrClaim(uint64_t key);
+
+  Slot _slots[AGG_TABLE_SLOTS];
+  Device _devices[AGG_MAX_DEVICES];
+  std::atomic<size_t> _numAps;
+  std::atomic<uint64_t> _tableFull;
+};
+
+#endif
@@ -0,0 +1,162 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Scan log statistics. See batch-analyzer.h.
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include "batch-analyzer.h"
+#include "scan-log-format.h"
+
+void BatchStats::clear() {
+  memset(this, 0, sizeof(*this));
+}
+
+void BatchStats::merge(const BatchStats &other) {
+  files += other.files;
+  badFiles += other.badFiles;
+  bytes += other.bytes;
+  scans += other.scans;
+  records += other.records;
+  rejected += other.rejected;
+  for (size_t chan = 0; chan < BATCH_CHANNEL_SLOTS; chan++) {
+    BatchChannelStats &mine = channels[chan];
+    const BatchChannelStats &theirs = other.channels[chan];
+    mine.sumPower += theirs.sumPower;
+    mine.peakPower = std::max(mine.peakPower, theirs.peakPower);
+    mine.busyScans += theirs.busyScans;
+    mine.stations += theirs.stations;
+  }
+}
+
+static void addPower(int channelNum, int rssi, void *scanPower) {
+  if (channelNum >= 0 && channelNum < static_cast<int>(BATCH_CHANNEL_SLOTS)) {
+    static_cast<power_t*>(scanPower)[channelNum] += dbmToPower(rssi);
+  }
+}
+
+// Decode the station entries of one block and fold the scan into `stats`.
+static void analyzeBlock(const uint8_t *entries, size_t len, uint8_t count, BatchStats &stats) {
+  power_t scanPower[BATCH_CHANNEL_SLOTS];
+  memset(scanPower, 0, sizeof(scanPower));
+
+  size_t pos = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    ScanLogStation station;
+    size_t consumed = scanLogDecodeStation(entries + pos, len - pos, station);
+    if (consumed == 0) {
+      stats.rejected++;
+      break;
+    }
+    pos += consumed;
+    stats.records++;
+
+    SpectrumSignal signal = { station.primary, station.second, station.rssi,
+        (station.phyFlags & SCAN_LOG_PHY_11B) != 0, (station.phyFlags & SCAN_LOG_PHY_11N) != 0 };
+    spectrumForEachChannel(signal, addPower, scanPower);
+    if (station.primary < BATCH_CHANNEL_SLOTS) {
+      stats.channels[station.primary].stations++;
+    }
+  }
+
+  stats.scans++;
+  for (size_t chan = 0; chan < BATCH_CHANNEL_SLOTS; chan++) {
+    if (scanPower[chan] == 0) {
+      continue;
+    }
+
+    BatchChannelStats &channel = stats.channels[chan];
+    channel.sumPower += static_cast<double>(scanPower[chan]);
+    channel.peakPower = std::max(channel.peakPower, scanPower[chan]);
+    channel.busyScans++;
+  }
+}
+
+// Decode the whole blocks in buf[0..len). Returns the bytes consumed; stops early at a block
+// that runs past `len`. Sets `malformed` if a block is too short to be valid.
+static size_t analyzeBlocks(const uint8_t *buf, size_t len, BatchStats &stats, bool &malformed) {
+  size_t pos = 0;
+  while (len - pos >= SCAN_LOG_BLOCK_PREFIX_LEN) {
+    size_t blockLen;
+    uint32_t timestamp;
+    uint8_t count;
+    scanLogDecodeBlockPrefix(buf + pos, len - pos, blockLen, timestamp, count);
+    if (blockLen < SCAN_LOG_BLOCK_PREFIX_LEN) {
+      malformed = true;
+      break;
+    }
+    if (blockLen > len - pos) {
+      break; // Continued in the next window.
+    }
+
+    analyzeBlock(buf + pos + SCAN_LOG_BLOCK_PREFIX_LEN, blockLen - SCAN_LOG_BLOCK_PREFIX_LEN,
+        count, stats);
+    pos += blockLen;
+  }
+
+  return pos;
+}
+
+bool batchAnalyzeLog(const char *path, BatchStats &stats) {
+  int fd = open(path, O_RDONLY);
+  struct stat st;
+  if (fd < 0 || fstat(fd, &st) != 0) {
+    perror(path);
+    if (fd >= 0) {
+      close(fd);
+    }
+    stats.badFiles++;
+    return false;
+  }
+
+  uint8_t header[SCAN_LOG_HEADER_LEN];
+  size_t fileLen = st.st_size;
+  size_t headerLen = 0;
+  if (pread(fd, header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header))) {
+    headerLen = scanLogDecodeHeader(header, sizeof(header));
+  }
+  if (headerLen == 0 || headerLen > fileLen) {
+    close(fd);
+    stats.badFiles++;
+    return false;
+  }
+
+  // Slide a window over the file. Each window starts at the page holding the first block not yet
+  // decoded; a block cut off at the end of one window is decoded from the next.
+  const size_t pageSize = sysconf(_SC_PAGESIZE);
+  size_t pos = headerLen;
+  bool malformed = false;
+  while (pos < fileLen && !malformed) {
+    size_t mapStart = pos - pos % pageSize;
+    size_t mapLen = std::min(BATCH_WINDOW_BYTES, fileLen - mapStart);
+    void *map = mmap(NULL, mapLen, PROT_READ, MAP_PRIVATE, fd, mapStart);
+    if (map == MAP_FAILED) {
+      perror(path);
+      break;
+    }
+    madvise(map, mapLen, MADV_SEQUENTIAL);
+
+    const uint8_t *window = static_cast<const uint8_t*>(map) + (pos - mapStart);
+    size_t consumed = analyzeBlocks(window, mapStart + mapLen - pos, stats, malformed);
+    munmap(map, mapLen);
+
+    pos += consumed;
+    if (consumed == 0) {
+      break; // Truncated final block. (Any whole block fits in a window.)
+    }
+  }
+
+  if (malformed || pos < fileLen) {
+    stats.rejected++;
+  }
+  stats.files++;
+  stats.bytes += fileLen;
+  close(fd);
+  return true;
+}
@@ -0,0 +1,49 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Per-channel congestion statistics over recorded SD scan logs (scan-log-format.h), using the
+// same spectral mask model (spectrum.h) and linear power sums (linear-power.h) as the heatmaps
+// on the device.
+
+#ifndef _BATCH_ANALYZER_H
+#define _BATCH_ANALYZER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "linear-power.h"
+#include "spectrum.h"
+
+// Per-channel statistics are indexed by channel number.
+constexpr size_t BATCH_CHANNEL_SLOTS = max50GHzChannelNum + 1;
+
+// Logs are mapped this many bytes at a time, so that a log larger than RAM streams through a
+// bounded window instead of being mapped (and kept resident) whole. Must hold the largest block.
+constexpr size_t BATCH_WINDOW_BYTES = 64 << 20;
+
+// One channel's total power (as drawn by the heatmap's power bars) over many scans.
+struct BatchChannelStats {
+  double sumPower;    // Sum over scans of the channel's total power. (Overflows power_t.)
+  power_t peakPower;  // Highest total power in any one scan.
+  uint64_t busyScans; // Scans in which any power reached the channel.
+  uint64_t stations;  // Station records with this primary channel.
+};
+
+// Totals over any number of scan logs. Each worker fills one of its own; they're merged when
+// all the logs are done.
+struct BatchStats {
+  uint64_t files;
+  uint64_t badFiles;  // Not a scan log, or unreadable.
+  uint64_t bytes;
+  uint64_t scans;
+  uint64_t records;   // Station records decoded.
+  uint64_t rejected;  // Malformed or truncated blocks and entries.
+  BatchChannelStats channels[BATCH_CHANNEL_SLOTS];
+
+  void clear();
+  void merge(const BatchStats &other);
+};
+
+// Decode every scan in the log at `path` into `stats`. Returns false if it's not a scan log.
+extern bool batchAnalyzeLog(const char *path, BatchStats &stats);
+
+#endif
@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+# (c) Copyright 2022 Aaron Kimball
+#
+# Generate src/oui-table.h, the flash-resident OUI -> vendor name table used by src/oui.cpp,
+# from the IEEE MA-L registry, in either of the forms IEEE publishes it
+# (https://standards-oui.ieee.org/oui/oui.csv or .../oui/oui.txt).
+#
+# The full registry is ~35,000 assignments (~0.5 MB as a table), which is too large for the Wio
+# Terminal's flash, so only organizations matching a line in the vendor list
+# (tools/oui-vendors.txt by default; a case-insensitive substring of the registered organization
+# name) are kept. Pass `--all` to keep every assignment, e.g. for a host build. Name indices and
+# string pool offsets are 8/16 bits wide when they fit, and wider when they don't.
+#
+# The registry spells one company several ways ("TP-LINK TECHNOLOGIES CO.,LTD." and "TP-Link
+# Corporation Limited"), so each vendor list line maps to one display name: the one given after
+# an `=`, or else the most common short name among the organizations it matches. An organization
+# matching several lines goes with the longest. Names that then differ only by case are merged
+# into their most common spelling, which also covers `--all`.
+#
+# Record where the registry came from with `--source`; it's written into the header.
+#
+# usage: gen-oui-table.py [--vendors FILE] [--all] [--source TEXT] oui.csv|oui.txt \
+#            > ../src/oui-table.h
+
+import argparse
+import collections
+import csv
+import re
+import sys
+
+# Vendor names are shown in a narrow column; longer names are truncated.
+MAX_NAME_LEN = 20
+
+# Words dropped from the end of registered organization names: "Cisco Systems, Inc" -> "Cisco".
+SUFFIXES = {
+  'co', 'company', 'communications', 'computer', 'corp', 'corporation', 'foundation', 'gmbh',
+  'inc', 'international', 'limited', 'llc', 'ltd', 'networks', 'pte', 'semiconductor', 'systems',
+  'technologies', 'technology', 'trading', 'wireless',
+}
+
+
+def short_name(org):
+  """Shorten a registered organization name for display."""
+  # Anything after the first comma is a corporate suffix or a parent company.
+  name = org.split(',')[0]
+  # Also "BUFFALO.INC" -> "BUFFALO", but keep "Routerboard.com".
+  name = re.sub(r'\.(inc|ltd)\.?$', '', name, flags=re.IGNORECASE)
+  # And "Raspberry Pi (Trading) Ltd" -> "Raspberry Pi".
+  name = re.sub(r'\s*\(.*?\)', '', name)
+  words = name.split()
+  while len(words) > 1 and words[-1].rstrip('.').lower() in SUFFIXES:
+    words.pop()
+  return ' '.join(words)[:MAX_NAME_LEN].rstrip()
+
+
+def read_vendors(path):
+  """Return { lowercase pattern: display name or None } from lines of `pattern [= name]`."""
+  vendors = {}
+  with open(path) as f:
+    for line in f:
+      if not line.strip() or line.startswith('#'):
+        continue
+      pattern, _, display = line.partition('=')
+      vendors[pattern.strip().lower()] = display.strip() or None
+  return vendors
+
+
+def most_common(counts):
+  """The most frequent key of a Counter; ties go to the first in sorted order."""
+  return min(counts, key=lambda name: (-counts[name], name))
+
+
+def canonical_names(entries, vendors):
+  """Map each OUI in `entries` ({ oui: (pattern, short name) }) to its one display name."""
+  by_pattern = collections.defaultdict(collections.Counter)
+  for pattern, name in entries.values():
+    by_pattern[pattern][name] += 1
+  pattern_names = { pattern: (vendors or {}).get(pattern) or most_common(counts)
+      for pattern, counts in by_pattern.items() }
+
+  by_folded = collections.defaultdict(collections.Counter)
+  for pattern, _ in entries.values():
+    name = pattern_names[pattern]
+    by_folded[name.casefold()][name] += 1
+  spelling = { folded: most_common(counts) for folded, counts in by_folded.items() }
+
+  return { oui: spelling[pattern_names[pattern].casefold()]
+      for oui, (pattern, _) in entries.items() }
+
+
+def read_registry(path):
+  """Yield (24-bit OUI, organization name) for each assignment in oui.csv or oui.txt."""
+  with open(path, newline='', encoding='utf-8') as f:
+    if path.lower().endswith('.csv'):
+      for row in csv.DictReader(f):
+        yield int(row['Assignment'], 16), row['Organization Name'].strip()
+    else:
+      # Text form: each assignment has a line like "F4F5D8     (base 16)\t\tGoogle, Inc."
+      for line in f:
+        m = re.match(r'^([0-9A-Fa-f]{6})\s+\(base 16\)\s*(.*)$', line)
+        if m:
+          yield int(m.group(1), 16), m.group(2).strip()
+
+
+def c_uint_type(max_value):
+  for bits in (8, 16, 32):
+    if max_value < (1 << bits):
+      return 'uint%d_t' % bits
+  sys.exit('value too large for a 32-bit table entry: %d' % max_value)
+
+
+def c_string(s):
+  return '"' + s.replace('\\', '\\\\').replace('"', '\\"') + '\\0"'
+
+
+def main():
+  parser = argparse.ArgumentParser(description='Generate the OUI vendor table header.')
+  parser.add_argument('--vendors', default=sys.path[0] + '/oui-vendors.txt',
+      help='file listing the organizations to keep, one per line')
+  parser.add_argument('--all', action='store_true', help='keep every organization')
+  parser.add_argument('--source', help='registry version or origin, recorded in the header')
+  parser.add_argument('registry', help='IEEE MA-L registry, as oui.csv or oui.txt')
+  args = parser.parse_args()
+
+  vendors = None if args.all else read_vendors(args.vendors)
+
+  matches = {}  # 24-bit OUI -> (matching vendor pattern, short name of the organization).
+  for oui, org in read_registry(args.registry):
+    name = short_name(org)
+    if not name:
+      continue
+    if vendors is None:
+      matches[oui] = (name.casefold(), name)
+      continue
+    patterns = [ v for v in vendors if v in org.lower() ]
+    if patterns:
+      matches[oui] = (max(patterns, key=len), name)
+  entries = canonical_names(matches, vendors)  # 24-bit OUI -> vendor name.
+
+  # Each distinct name is stored once in the string pool; keys refer to it by index.
+  names = sorted(set(entries.values()))
+  nameIdx = { name: i for i, name in enumerate(names) }
+
+  offsets = []
+  pos = 0
+  for name in names:
+    offsets.append(pos)
+    pos += len(name.encode('utf-8')) + 1
+  idx_type = c_uint_type(len(names) - 1)
+  offset_type = c_uint_type(pos)
+
+  out = sys.stdout
+  out.write('// (c) Copyright 2022 Aaron Kimball\n')
+  out.write('//\n')
+  out.write('// GENERATED by tools/gen-oui-table.py; do not edit. Included only by oui.cpp.\n')
+  if args.source:
+    out.write('// Source: %s\n' % args.source)
+  out.write('// %d OUIs, %d vendor names%s.\n' % (len(entries), len(names),
+      ' (every organization)' if args.all else ''))
+  out.write('\n#ifndef _OUI_TABLE_H\n#define _OUI_TABLE_H\n\n')
+
+  out.write('static constexpr size_t OUI_TABLE_LEN = %d;\n\n' % len(entries))
+
+  out.write('// Sorted 24-bit OUIs, big-endian.\n')
+  out.write('static const uint8_t ouiKeys[OUI_TABLE_LEN][3] = {\n')
+  for oui in sorted(entries):
+    out.write('  { 0x%02X, 0x%02X, 0x%02X },\n' % (oui >> 16, (oui >> 8) & 0xFF, oui & 0xFF))
+  out.write('};\n\n')
+
+  out.write('// Index into ouiNameOffsets for each key.\n')
+  out.write('static const %s ouiNameIdx[OUI_TABLE_LEN] = {\n' % idx_type)
+  keys = sorted(entries)
+  for i in range(0, len(keys), 16):
+    out.write('  ' + ' '.join('%d,' % nameIdx[entries[k]] for k in keys[i:i + 16]) + '\n')
+  out.write('};\n\n')
+
+  out.write('// Offset of each vendor name within ouiNamePool.\n')
+  out.write('static const %s ouiNameOffsets[] = {\n' % offset_type)
+  for i in range(0, len(offsets), 12):
+    out.write('  ' + ' '.join('%d,' % o for o in offsets[i:i + 12]) + '\n')
+  out.write('};\n\n')
+
+  out.write('// NUL-terminated vendor names.\n')
+  out.write('static const char ouiNamePool[] =\n')
+  for name in names:
+    out.write('  %s\n' % c_string(name))
+  out.write('  ;\n\n#endif\n')
+
+
+if __name__ == '__main__':
+  main()
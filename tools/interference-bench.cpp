@@ -0,0 +1,185 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Benchmark the interference accumulators from ../src/interference-kernel.h.
+//
+// usage: interference-bench [stations]
+//
+// Adds the same pseudo-random mix of stations (default 100000, across both bands) to an
+// InterferenceMap four ways: building each station's kernel from its spectral mask, then adding
+// cached kernels one weight at a time, with interferenceAccumulate() (QADD16 on ARM hosts with
+// the DSP extension; otherwise the same scalar code), and through addSignal(). Reports the time
+// per station of each. The accumulators saturate after ~127 stations on a channel, so results
+// are also checked over one scan's worth of stations against a reference summed straight from
+// spectrumForEachChannel(), without kernels; it exits nonzero if any differ.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <vector>
+
+#include "interference-kernel.h"
+#include "linear-power.h"
+
+// Station shapes seen in typical scans. Primary channels are picked from the band plans below.
+static const int channels24GHz[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+static const int channels50GHz[] = {
+  36, 40, 44, 48, 52, 56, 60, 64, 100, 104, 108, 112, 116, 120, 124, 128, 132, 136, 140, 144,
+  149, 153, 157, 161, 165,
+};
+
+template<size_t N>
+static int pick(const int (&channels)[N], uint32_t r) {
+  return channels[r % N];
+}
+
+static std::vector<SpectrumSignal> makeStations(size_t n) {
+  std::vector<SpectrumSignal> stations;
+  uint32_t seed = 12345;
+  for (size_t i = 0; i < n; i++) {
+    seed = seed * 1103515245 + 12345;
+    uint32_t r = seed >> 8;
+    int rssi = -40 - static_cast<int>(r % 50);
+    SpectrumSignal signal = { 0, SPECTRUM_SECOND_NONE, rssi, false, true };
+    if (r & 1) {
+      signal.primary = pick(channels24GHz, r >> 4);
+      signal.phy11b = (r & 2) != 0;
+      if ((r & 12) == 4) {
+        signal.second = signal.primary <= 7 ? SPECTRUM_SECOND_ABOVE : SPECTRUM_SECOND_BELOW;
+      }
+    } else {
+      signal.primary = pick(channels50GHz, r >> 4);
+      if (r & 2) {
+        // 40 MHz pairs are 36+40, 44+48, ...; 165 has no pair.
+        bool lower = ((signal.primary - (signal.primary >= 149 ? 149 : 36)) / 4) % 2 == 0;
+        if (signal.primary != 165) {
+          signal.second = lower ? SPECTRUM_SECOND_ABOVE : SPECTRUM_SECOND_BELOW;
+        }
+      }
+    }
+    stations.push_back(signal);
+  }
+  return stations;
+}
+
+// Stations in the scan used to compare results (about what the device keeps).
+static constexpr size_t COMPARE_STATIONS = 64;
+
+enum Method { BUILD, SCALAR, PACKED, SIGNAL, NUM_METHODS };
+static const char *methodNames[NUM_METHODS] = {
+  "build kernel + add", "cached, scalar", "cached, packed", "addSignal()",
+};
+
+// Add stations [0, n) to `maps` (2.4 and 5 GHz) with one method. `kernels` are filled in by
+// BUILD and used by SCALAR and PACKED.
+static void addStations(Method method, const std::vector<SpectrumSignal> &stations, size_t n,
+    std::vector<InterferenceKernel> &kernels, InterferenceMap *maps) {
+  for (size_t i = 0; i < n; i++) {
+    InterferenceMap &map = maps[spectrumIs24GHz(stations[i].primary) ? 0 : 1];
+    switch (method) {
+    case BUILD:
+      map.makeKernel(stations[i], kernels[i]);
+      map.addKernel(kernels[i], false);
+      break;
+    case SCALAR:
+      map.addKernel(kernels[i], false);
+      break;
+    case PACKED:
+      map.addKernel(kernels[i], true);
+      break;
+    default:
+      map.addSignal(stations[i]);
+      break;
+    }
+  }
+}
+
+// The reference: each station's Q8 weight on every channel spectrumForEachChannel() reports,
+// summed per channel number in 32 bits and clamped to the accumulators' range at the end.
+// (Weights are never negative, so clamping once matches saturating on every add.)
+static constexpr int REFERENCE_FULL_DBM = -30; // Gets INTERFERENCE_FULL_WEIGHT.
+
+struct Reference {
+  int32_t sum[max50GHzChannelNum + 1];
+
+  int weightAt(int chan) const { return sum[chan] > INT16_MAX ? INT16_MAX : sum[chan]; }
+};
+
+static void addReferenceWeight(int channelNum, int rssi, void *ctx) {
+  Reference *ref = static_cast<Reference*>(ctx);
+  power_t fullPower = dbmToPower(REFERENCE_FULL_DBM);
+  if (channelNum >= 0 && channelNum <= max50GHzChannelNum) {
+    ref->sum[channelNum] += (dbmToPower(rssi) * INTERFERENCE_FULL_WEIGHT + fullPower / 2)
+        / fullPower;
+  }
+}
+
+static void makeReference(const std::vector<SpectrumSignal> &stations, size_t n,
+    Reference &ref) {
+  memset(&ref, 0, sizeof(ref));
+  for (size_t i = 0; i < n; i++) {
+    SpectrumSignal signal = stations[i];
+    signal.rssi = REFERENCE_FULL_DBM; // Weights don't depend on rssi; this keeps the whole mask in.
+    spectrumForEachChannel(signal, addReferenceWeight, &ref);
+  }
+}
+
+typedef std::chrono::steady_clock Clock;
+
+static double nsPerStation(Clock::time_point start, size_t n) {
+  return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / n;
+}
+
+static bool matchesReference(const Reference &ref, const InterferenceMap *maps) {
+  for (int chan = min24GHzChannelNum; chan <= max50GHzChannelNum; chan++) {
+    int band = spectrumIs24GHz(chan) ? 0 : 1;
+    if (maps[band].weightAt(chan) != ref.weightAt(chan)) {
+      fprintf(stderr, "channel %d: %d, reference %d\n", chan, maps[band].weightAt(chan),
+          ref.weightAt(chan));
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char **argv) {
+  size_t n = argc > 1 ? strtoul(argv[1], NULL, 10) : 100000;
+  if (n == 0) {
+    fprintf(stderr, "usage: %s [stations]\n", argv[0]);
+    return 1;
+  }
+
+  std::vector<SpectrumSignal> stations = makeStations(n);
+  std::vector<InterferenceKernel> kernels(n);
+
+  printf("%zu stations; interferenceAccumulate() is %s\n", n,
+      interferenceAccumulateIsSimd() ? "QADD16" : "scalar");
+  InterferenceMap maps[NUM_METHODS][2] = {
+    { InterferenceMap(true), InterferenceMap(false) },
+    { InterferenceMap(true), InterferenceMap(false) },
+    { InterferenceMap(true), InterferenceMap(false) },
+    { InterferenceMap(true), InterferenceMap(false) },
+  };
+  for (int m = 0; m < NUM_METHODS; m++) {
+    Method method = static_cast<Method>(m);
+    Clock::time_point start = Clock::now();
+    addStations(method, stations, n, kernels, maps[m]);
+    printf("%-20s %8.1f ns/station\n", methodNames[m], nsPerStation(start, n));
+  }
+
+  size_t compareN = n < COMPARE_STATIONS ? n : COMPARE_STATIONS;
+  Reference ref;
+  makeReference(stations, compareN, ref);
+  for (int m = 0; m < NUM_METHODS; m++) {
+    maps[m][0].clear();
+    maps[m][1].clear();
+    addStations(static_cast<Method>(m), stations, compareN, kernels, maps[m]);
+    if (!matchesReference(ref, maps[m])) {
+      fprintf(stderr, "%s differs from the reference\n", methodNames[m]);
+      return 1;
+    }
+  }
+  printf("results match\n");
+  return 0;
+}
@@ -0,0 +1,108 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Decode the scanner's COBS-framed binary stream. See stream-format.h for the wire format.
+
+#include "stream-decoder.h"
+
+void StreamDecoder::feed(const uint8_t *data, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    uint8_t b = data[i];
+    if (b == 0) {
+      _endFrame();
+      continue;
+    }
+
+    if (_encodedLen < sizeof(_encoded)) {
+      _encoded[_encodedLen++] = b;
+    } else {
+      _overflow = true;
+    }
+  }
+}
+
+void StreamDecoder::_endFrame() {
+  size_t encodedLen = _encodedLen;
+  bool overflow = _overflow;
+  _encodedLen = 0;
+  _overflow = false;
+
+  if (encodedLen == 0) {
+    return; // Back-to-back delimiters; nothing to do.
+  }
+
+  if (overflow) {
+    _framesRejected++;
+    return;
+  }
+
+  size_t frameLen = cobsDecode(_encoded, encodedLen, _frame);
+  uint8_t frameType;
+  uint16_t seq;
+  const uint8_t *body;
+  size_t bodyLen;
+  if (frameLen == 0 || !streamParseFrame(_frame, frameLen, frameType, seq, body, bodyLen)
+      || !_dispatch(frameType, seq, body, bodyLen)) {
+    _framesRejected++;
+    return;
+  }
+
+  _framesDecoded++;
+}
+
+bool StreamDecoder::_dispatch(uint8_t frameType, uint16_t seq, const uint8_t *body,
+    size_t bodyLen) {
+  switch (frameType) {
+  case STREAM_FRAME_SCAN_HEADER: {
+    if (bodyLen < 5) {
+      return false;
+    }
+    uint32_t timestamp = body[0] | (body[1] << 8) | (body[2] << 16)
+        | (static_cast<uint32_t>(body[3]) << 24);
+    _listener.onScanHeader(seq, timestamp, body[4]);
+    return true;
+  }
+  case STREAM_FRAME_STATION: {
+    ScanLogStation station;
+    if (scanLogDecodeStation(body, bodyLen, station) == 0) {
+      return false;
+    }
+    _listener.onStation(seq, station);
+    return true;
+  }
+  case STREAM_FRAME_CHANNEL_TOTALS: {
+    if (bodyLen < 2 || bodyLen < 2 + 3 * static_cast<size_t>(body[1])) {
+      return false;
+    }
+    ChannelTotal totals[STREAM_MAX_FRAME_LEN / 3];
+    size_t numChannels = body[1];
+    for (size_t i = 0; i < numChannels; i++) {
+      totals[i].channel = body[2 + 3 * i];
+      totals[i].signals = body[3 + 3 * i];
+      totals[i].maxRssi = static_cast<int8_t>(body[4 + 3 * i]);
+    }
+    _listener.onChannelTotals(seq, body[0], totals, numChannels);
+    return true;
+  }
+  case STREAM_FRAME_SURVEY_CHUNK: {
+    if (bodyLen < 6) {
+      return false;
+    }
+    uint32_t recordSeq = body[0] | (body[1] << 8) | (body[2] << 16)
+        | (static_cast<uint32_t>(body[3]) << 24);
+    uint16_t offset = body[4] | (body[5] << 8);
+    _listener.onSurveyChunk(seq, recordSeq, offset, body + 6, bodyLen - 6);
+    return true;
+  }
+  case STREAM_FRAME_SURVEY_END: {
+    if (bodyLen < 4) {
+      return false;
+    }
+    uint32_t numRecords = body[0] | (body[1] << 8) | (body[2] << 16)
+        | (static_cast<uint32_t>(body[3]) << 24);
+    _listener.onSurveyEnd(seq, numRecords);
+    return true;
+  }
+  default:
+    return false; // Unknown frame type.
+  }
+}
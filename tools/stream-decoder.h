@@ -0,0 +1,65 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Host-side decoder for the binary scan-result stream sent by the scanner over USB serial.
+// Feed it raw bytes as they arrive; it reassembles COBS frames, validates their CRCs, and
+// calls back into a Listener for each record.
+
+#ifndef _STREAM_DECODER_H
+#define _STREAM_DECODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "scan-log-format.h"
+#include "stream-format.h"
+
+// One channel's entry from a STREAM_FRAME_CHANNEL_TOTALS frame.
+struct ChannelTotal {
+  uint8_t channel;
+  uint8_t signals;
+  int8_t maxRssi; // STREAM_NO_RSSI if no signals.
+};
+
+class StreamDecoder {
+public:
+  class Listener {
+  public:
+    virtual ~Listener() { };
+    virtual void onScanHeader(uint16_t seq, uint32_t timestamp, uint8_t stationCount) = 0;
+    virtual void onStation(uint16_t seq, const ScanLogStation &station) = 0;
+    virtual void onChannelTotals(uint16_t seq, uint8_t band, const ChannelTotal *totals,
+        size_t numChannels) = 0;
+    // Site survey exports; most listeners can ignore them.
+    virtual void onSurveyChunk(uint16_t session, uint32_t recordSeq, uint16_t offset,
+        const uint8_t *data, size_t len) { };
+    virtual void onSurveyEnd(uint16_t session, uint32_t numRecords) { };
+  };
+
+  StreamDecoder(Listener &listener): _listener(listener), _encodedLen(0), _overflow(false),
+      _framesDecoded(0), _framesRejected(0) { };
+
+  // Consume bytes from the stream. May call the listener any number of times.
+  void feed(const uint8_t *data, size_t len);
+
+  uint64_t framesDecoded() const { return _framesDecoded; };
+  // Frames discarded for bad COBS encoding, CRC mismatch, unknown type, or excess length.
+  // (Text debug output interleaved on the port shows up here too.)
+  uint64_t framesRejected() const { return _framesRejected; };
+
+private:
+  void _endFrame();
+  bool _dispatch(uint8_t frameType, uint16_t seq, const uint8_t *body, size_t bodyLen);
+
+  Listener &_listener;
+
+  uint8_t _encoded[cobsMaxEncodedLen(STREAM_MAX_FRAME_LEN)];
+  size_t _encodedLen;
+  bool _overflow; // Current frame is too long to be valid; discard it at the next delimiter.
+
+  uint8_t _frame[cobsMaxEncodedLen(STREAM_MAX_FRAME_LEN)];
+
+  uint64_t _framesDecoded;
+  uint64_t _framesRejected;
+};
+
+#endif
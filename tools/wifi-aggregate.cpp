@@ -0,0 +1,277 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Merge the scans of several scanners into building-wide per-channel congestion.
+//
+// usage: wifi-aggregate [--interval SECS] input [input...]
+//
+// Each input is one scanner: a serial device streaming scans (SERIAL_STREAM; e.g.
+// /dev/ttyACM0), a captured stream file, or an SD scan log (/scansNNNN.wsl). Recorded files
+// stand in for live devices, so an aggregation can be rerun, or tested, from captures.
+//
+// Each input is read by a thread of its own. APs are deduplicated by BSSID across devices.
+// Output goes to stdout as CSV rows of source,band,channel,dbm: the per-channel total power
+// from each device's latest scan, and from the merged view ("merged"), in which each AP counts
+// once, at the strongest RSSI any device heard it. Power is summed with the same spectral
+// masks as the heatmaps on the device.
+//
+// A report is printed every --interval seconds (default 10) while any input is still live,
+// and once more when all inputs have ended.
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "aggregator.h"
+#include "stream-decoder.h"
+
+// Shared by all the input threads; large, so not on the stack.
+static Aggregator aggregator;
+
+struct Input {
+  const char *path;
+  size_t device;
+  uint64_t framesDecoded;
+  uint64_t framesRejected;
+  std::atomic<bool> done;
+  bool failed;
+};
+
+// Feeds one device's stream into the aggregator. A scan ends at its 5 GHz channel totals (the
+// last frame the scanner sends for it), or at the next scan's header if that was lost.
+class AggregateListener : public StreamDecoder::Listener {
+public:
+  AggregateListener(size_t device): _device(device) { };
+
+  virtual void onScanHeader(uint16_t seq, uint32_t timestamp, uint8_t stationCount) {
+    aggregator.endScan(_device);
+    aggregator.beginScan(_device);
+  };
+
+  virtual void onStation(uint16_t seq, const ScanLogStation &station) {
+    aggregator.addStation(_device, station);
+  };
+
+  virtual void onChannelTotals(uint16_t seq, uint8_t band, const ChannelTotal *totals,
+      size_t numChannels) {
+    if (band == STREAM_BAND_50GHZ) {
+      aggregator.endScan(_device);
+    }
+  };
+
+private:
+  size_t _device;
+};
+
+// If `fd` is a tty, put it in raw mode so the binary stream passes through unmodified.
+static void makeRaw(int fd) {
+  struct termios tio;
+  if (!isatty(fd) || tcgetattr(fd, &tio) != 0) {
+    return;
+  }
+
+  cfmakeraw(&tio);
+  tcsetattr(fd, TCSANOW, &tio);
+}
+
+// Read exactly `len` bytes unless the input ends first. Returns the number read.
+static size_t readFully(int fd, uint8_t *buf, size_t len) {
+  size_t pos = 0;
+  while (pos < len) {
+    ssize_t n = read(fd, buf + pos, len - pos);
+    if (n <= 0) {
+      break;
+    }
+    pos += n;
+  }
+
+  return pos;
+}
+
+// Feed an SD scan log, one block per scan, following its header (already read into `header`).
+static void ingestScanLog(Input &input, int fd, const uint8_t *header, size_t headerLen) {
+  size_t skip = scanLogDecodeHeader(header, headerLen);
+  uint8_t discard[256];
+  if (skip > headerLen && readFully(fd, discard, skip - headerLen) != skip - headerLen) {
+    return;
+  }
+
+  uint8_t prefix[SCAN_LOG_BLOCK_PREFIX_LEN];
+  std::vector<uint8_t> entries;
+  while (readFully(fd, prefix, sizeof(prefix)) == sizeof(prefix)) {
+    size_t blockLen;
+    uint32_t timestamp;
+    uint8_t count;
+    scanLogDecodeBlockPrefix(prefix, sizeof(prefix), blockLen, timestamp, count);
+    if (blockLen < SCAN_LOG_BLOCK_PREFIX_LEN) {
+      input.framesRejected++;
+      return;
+    }
+
+    entries.resize(blockLen - SCAN_LOG_BLOCK_PREFIX_LEN);
+    if (readFully(fd, entries.data(), entries.size()) != entries.size()) {
+      input.framesRejected++; // Truncated final block.
+      return;
+    }
+
+    aggregator.beginScan(input.device);
+    size_t pos = 0;
+    for (uint8_t i = 0; i < count; i++) {
+      ScanLogStation station;
+      size_t consumed = scanLogDecodeStation(entries.data() + pos, entries.size() - pos, station);
+      if (consumed == 0) {
+        input.framesRejected++;
+        break;
+      }
+      aggregator.addStation(input.device, station);
+      pos += consumed;
+    }
+    aggregator.endScan(input.device);
+    input.framesDecoded++;
+  }
+}
+
+// Thread body: read one input to its end.
+static void ingest(Input *input) {
+  int fd = open(input->path, O_RDONLY | O_NOCTTY);
+  if (fd < 0) {
+    perror(input->path);
+    input->failed = true;
+    input->done = true;
+    return;
+  }
+  makeRaw(fd);
+
+  // SD scan logs start with a file header; anything else is a stream.
+  uint8_t buf[4096];
+  ssize_t n = read(fd, buf, SCAN_LOG_HEADER_LEN);
+  if (n == static_cast<ssize_t>(SCAN_LOG_HEADER_LEN) && scanLogDecodeHeader(buf, n) > 0) {
+    ingestScanLog(*input, fd, buf, n);
+  } else {
+    AggregateListener listener(input->device);
+    StreamDecoder decoder(listener);
+    while (n > 0) {
+      decoder.feed(buf, n);
+      n = read(fd, buf, sizeof(buf));
+    }
+    aggregator.endScan(input->device); // Count a final scan that was cut short.
+    input->framesDecoded = decoder.framesDecoded();
+    input->framesRejected = decoder.framesRejected();
+  }
+
+  close(fd);
+  input->done = true;
+}
+
+static void printPower(const char *source, const power_t *power) {
+  for (size_t chan = 0; chan < AGG_CHANNEL_SLOTS; chan++) {
+    if (power[chan] == 0) {
+      continue;
+    }
+
+    int deciDbm = powerToDeciDbm(power[chan]);
+    printf("%s,%s,%zu,%s%d.%d\n", source, spectrumIs24GHz(chan) ? "2.4" : "5", chan,
+        deciDbm < 0 ? "-" : "", abs(deciDbm) / 10, abs(deciDbm) % 10);
+  }
+}
+
+static void report(const std::vector<Input*> &inputs) {
+  static power_t power[AGG_CHANNEL_SLOTS];
+  static unsigned int reportNum = 0;
+
+  uint64_t scans = 0;
+  for (const Input *input : inputs) {
+    aggregator.devicePower(input->device, power);
+    printPower(input->path, power);
+    scans += aggregator.deviceScans(input->device);
+  }
+
+  AggMergeStats stats = aggregator.mergedPower(power);
+  printPower("merged", power);
+  fflush(stdout);
+
+  fprintf(stderr, "report %u: %zu devices, %llu scans, %zu APs (%zu heard by more than one)\n",
+      ++reportNum, inputs.size(), (unsigned long long)scans, stats.aps, stats.multiDevice);
+  if (aggregator.tableFull() > 0) {
+    fprintf(stderr, "  %llu readings dropped: more than %zu distinct BSSIDs\n",
+        (unsigned long long)aggregator.tableFull(), AGG_MAX_APS);
+  }
+}
+
+static void usage() {
+  fprintf(stderr, "usage: wifi-aggregate [--interval SECS] input [input...]\n");
+}
+
+int main(int argc, char **argv) {
+  unsigned int intervalSecs = 10;
+  std::vector<Input*> inputs;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--interval") == 0 && i + 1 < argc) {
+      intervalSecs = atoi(argv[++i]);
+    } else if (argv[i][0] == '-') {
+      usage();
+      return 1;
+    } else {
+      Input *input = new Input();
+      input->path = argv[i];
+      input->device = inputs.size();
+      input->framesDecoded = 0;
+      input->framesRejected = 0;
+      input->done = false;
+      input->failed = false;
+      inputs.push_back(input);
+    }
+  }
+
+  if (inputs.empty() || inputs.size() > AGG_MAX_DEVICES || intervalSecs == 0) {
+    usage();
+    fprintf(stderr, "Between 1 and %zu inputs.\n", AGG_MAX_DEVICES);
+    return 1;
+  }
+
+  std::vector<std::thread> threads;
+  for (Input *input : inputs) {
+    threads.emplace_back(ingest, input);
+  }
+
+  printf("source,band,channel,dbm\n");
+
+  // Report periodically while any input is live.
+  auto nextReport = std::chrono::steady_clock::now() + std::chrono::seconds(intervalSecs);
+  while (true) {
+    bool allDone = true;
+    for (const Input *input : inputs) {
+      allDone = allDone && input->done;
+    }
+    if (allDone) {
+      break;
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    if (std::chrono::steady_clock::now() >= nextReport) {
+      report(inputs);
+      nextReport += std::chrono::seconds(intervalSecs);
+    }
+  }
+
+  int status = 0;
+  for (size_t i = 0; i < threads.size(); i++) {
+    threads[i].join();
+    fprintf(stderr, "%s: %llu scans, %llu frames decoded, %llu rejected\n", inputs[i]->path,
+        (unsigned long long)aggregator.deviceScans(i),
+        (unsigned long long)inputs[i]->framesDecoded,
+        (unsigned long long)inputs[i]->framesRejected);
+    status = inputs[i]->failed ? 1 : status;
+  }
+
+  report(inputs);
+  return status;
+}
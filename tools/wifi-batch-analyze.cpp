@@ -0,0 +1,142 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Per-channel congestion statistics over an archive of recorded SD scan logs.
+//
+// usage: wifi-batch-analyze [--threads N] path [path...]
+//
+// Each path is a scan log (/scansNNNN.wsl) or a directory, which is searched recursively for
+// *.wsl files. The logs are memory-mapped a window at a time, so archives (and single logs)
+// larger than RAM are fine, and are decoded in parallel by a work-stealing pool of --threads
+// workers (default: one per CPU). Each scan's per-channel power is summed with the same spectral
+// masks as the heatmaps on the device.
+//
+// Output goes to stdout as CSV rows of band,channel,mean_dbm,peak_dbm,busy_pct,stations: each
+// channel's total power averaged over all scans, its highest in any scan, the share of scans in
+// which it had any power, and the station records heard with it as their primary channel.
+// Throughput, in records per second, is reported on stderr.
+
+#include <ftw.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "batch-analyzer.h"
+#include "work-pool.h"
+
+struct LogFile {
+  std::string path;
+  off_t size;
+};
+
+static std::vector<LogFile> logFiles;
+
+static bool hasLogSuffix(const char *path) {
+  size_t len = strlen(path);
+  return len >= 4 && strcasecmp(path + len - 4, ".wsl") == 0; // FAT names may be upper case.
+}
+
+static int addLogFile(const char *path, const struct stat *st, int type, struct FTW *ftw) {
+  if (type == FTW_F && S_ISREG(st->st_mode) && hasLogSuffix(path)) {
+    logFiles.push_back({ path, st->st_size });
+  }
+  return 0;
+}
+
+// Print a power in dBm with one decimal place.
+static void printDeciDbm(power_t power) {
+  int deciDbm = powerToDeciDbm(power);
+  printf("%s%d.%d", deciDbm < 0 ? "-" : "", abs(deciDbm) / 10, abs(deciDbm) % 10);
+}
+
+static void report(const BatchStats &stats) {
+  printf("band,channel,mean_dbm,peak_dbm,busy_pct,stations\n");
+  for (size_t chan = 0; chan < BATCH_CHANNEL_SLOTS; chan++) {
+    const BatchChannelStats &channel = stats.channels[chan];
+    if (channel.busyScans == 0) {
+      continue;
+    }
+
+    printf("%s,%zu,", spectrumIs24GHz(chan) ? "2.4" : "5", chan);
+    printDeciDbm(static_cast<power_t>(channel.sumPower / stats.scans));
+    printf(",");
+    printDeciDbm(channel.peakPower);
+    printf(",%.1f,%llu\n", 100.0 * channel.busyScans / stats.scans,
+        (unsigned long long)channel.stations);
+  }
+}
+
+static void usage() {
+  fprintf(stderr, "usage: wifi-batch-analyze [--threads N] path [path...]\n");
+}
+
+int main(int argc, char **argv) {
+  size_t numThreads = std::max(std::thread::hardware_concurrency(), 1U);
+
+  for (int i = 1; i < argc; i++) {
+    struct stat st;
+    if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+      numThreads = atoi(argv[++i]);
+    } else if (argv[i][0] == '-') {
+      usage();
+      return 1;
+    } else if (stat(argv[i], &st) != 0) {
+      perror(argv[i]);
+      return 1;
+    } else if (S_ISDIR(st.st_mode)) {
+      nftw(argv[i], addLogFile, 16, FTW_PHYS);
+    } else {
+      logFiles.push_back({ argv[i], st.st_size }); // Named explicitly; any suffix.
+    }
+  }
+
+  if (logFiles.empty() || numThreads == 0) {
+    usage();
+    return 1;
+  }
+
+  // Deal the logs smallest first; see WorkStealingPool.
+  std::sort(logFiles.begin(), logFiles.end(),
+      [](const LogFile &a, const LogFile &b) { return a.size < b.size; });
+
+  WorkStealingPool pool(std::min(numThreads, logFiles.size()));
+  std::vector<BatchStats> workerStats(pool.numWorkers());
+  for (BatchStats &stats : workerStats) {
+    stats.clear();
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  pool.run(logFiles.size(), [&](size_t task, size_t worker) {
+    if (!batchAnalyzeLog(logFiles[task].path.c_str(), workerStats[worker])) {
+      fprintf(stderr, "%s: not a scan log\n", logFiles[task].path.c_str());
+    }
+  });
+
+  // Reduce the workers' statistics.
+  BatchStats total;
+  total.clear();
+  for (const BatchStats &stats : workerStats) {
+    total.merge(stats);
+  }
+  double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  if (total.scans > 0) {
+    report(total);
+  }
+
+  fprintf(stderr, "%llu logs (%llu skipped), %llu scans, %llu records, %llu rejected\n",
+      (unsigned long long)total.files, (unsigned long long)total.badFiles,
+      (unsigned long long)total.scans, (unsigned long long)total.records,
+      (unsigned long long)total.rejected);
+  fprintf(stderr, "%.3f s on %zu threads (%llu steals): %.0f records/s, %.1f MB/s\n", secs,
+      pool.numWorkers(), (unsigned long long)pool.steals(), total.records / secs,
+      total.bytes / secs / 1e6);
+  return total.files > 0 ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Expand the scanner's compact history files (/histNNNN.wsh) back into one CSV row per
+// station per scan.
+//
+// usage: wifi-history-decode file.wsh [file.wsh...]
+//
+// Files are decoded in the order given; pass the rotated files of one session in index order.
+// Output goes to stdout as: timestamp_ms,bssid,ssid,channel,rssi,authmode,phy
+
+#include <stdio.h>
+#include <string.h>
+
+#include "history-format.h"
+
+// Print an SSID as a quoted CSV field.
+static void printCsvString(const char *str) {
+  putchar('"');
+  for (const char *p = str; *p; p++) {
+    if (*p == '"') {
+      putchar('"'); // Quotes are escaped by doubling them.
+    }
+    putchar(*p);
+  }
+  putchar('"');
+}
+
+class CsvListener : public HistoryDecoder::Listener {
+public:
+  CsvListener(): _decoder(NULL), _scans(0), _samples(0) { };
+
+  void setDecoder(const HistoryDecoder *decoder) { _decoder = decoder; };
+
+  virtual void onSegment(uint32_t baseTimestamp) { };
+
+  virtual void onStation(uint8_t id, const HistoryStation &station) { };
+
+  virtual void onScan(uint32_t timestamp, const HistorySample *samples, size_t numSamples) {
+    for (size_t i = 0; i < numSamples; i++) {
+      const HistoryStation &station = _decoder->station(samples[i].id);
+      printf("%u,%02X:%02X:%02X:%02X:%02X:%02X,", timestamp,
+          station.bssid[0], station.bssid[1], station.bssid[2],
+          station.bssid[3], station.bssid[4], station.bssid[5]);
+      printCsvString(station.ssid);
+      printf(",%u,%d,%u,%u\n", samples[i].channel, samples[i].rssi, station.authmode,
+          station.phyFlags);
+    }
+    _scans++;
+    _samples += numSamples;
+  };
+
+  unsigned long long scans() const { return _scans; };
+  unsigned long long samples() const { return _samples; };
+
+private:
+  const HistoryDecoder *_decoder;
+  unsigned long long _scans;
+  unsigned long long _samples;
+};
+
+int main(int argc, char **argv) {
+  if (argc < 2 || argv[1][0] == '-') {
+    fprintf(stderr, "usage: wifi-history-decode file.wsh [file.wsh...]\n");
+    return 1;
+  }
+
+  static char outBuf[1 << 16];
+  setvbuf(stdout, outBuf, _IOFBF, sizeof(outBuf));
+  printf("timestamp_ms,bssid,ssid,channel,rssi,authmode,phy\n");
+
+  CsvListener listener;
+  unsigned long long inputBytes = 0;
+  unsigned long errors = 0;
+  for (int i = 1; i < argc; i++) {
+    FILE *f = fopen(argv[i], "rb");
+    if (f == NULL) {
+      perror(argv[i]);
+      return 1;
+    }
+
+    // Each file starts with its own header and segment, so decode it from a clean state.
+    HistoryDecoder decoder(listener);
+    listener.setDecoder(&decoder);
+
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+      decoder.feed(buf, n);
+      inputBytes += n;
+    }
+    errors += decoder.errors();
+    fclose(f);
+  }
+  fflush(stdout);
+
+  fprintf(stderr, "%llu scans, %llu samples from %llu bytes (%.2f bytes/sample); %lu errors\n",
+      listener.scans(), listener.samples(), inputBytes,
+      listener.samples() ? (double)inputBytes / listener.samples() : 0.0, errors);
+  return errors ? 2 : 0;
+}
@@ -0,0 +1,183 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Convert the scanner's binary serial stream to CSV or JSON lines.
+//
+// usage: wifi-stream-decode [--csv | --csv-channels | --json] [input]
+//
+// `input` is a serial device (e.g. /dev/ttyACM0), a captured stream file, or '-' for stdin
+// (the default). Output goes to stdout:
+//   --csv           one row per station (default)
+//   --csv-channels  one row per channel of each per-scan heatmap total
+//   --json          one JSON object per line for every frame
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "stream-decoder.h"
+
+enum OutputFormat {
+  FORMAT_CSV,
+  FORMAT_CSV_CHANNELS,
+  FORMAT_JSON,
+};
+
+static const char *bandName(uint8_t band) {
+  return band == STREAM_BAND_24GHZ ? "2.4" : "5";
+}
+
+// Print an SSID as a quoted CSV field.
+static void printCsvString(const char *str) {
+  putchar('"');
+  for (const char *p = str; *p; p++) {
+    if (*p == '"') {
+      putchar('"'); // Quotes are escaped by doubling them.
+    }
+    putchar(*p);
+  }
+  putchar('"');
+}
+
+// Print an SSID as a JSON string literal.
+static void printJsonString(const char *str) {
+  putchar('"');
+  for (const unsigned char *p = reinterpret_cast<const unsigned char*>(str); *p; p++) {
+    if (*p == '"' || *p == '\\') {
+      putchar('\\');
+      putchar(*p);
+    } else if (*p < 0x20) {
+      printf("\\u%04x", *p);
+    } else {
+      putchar(*p);
+    }
+  }
+  putchar('"');
+}
+
+static void formatBssid(const uint8_t *bssid, char *out) {
+  snprintf(out, 18, "%02X:%02X:%02X:%02X:%02X:%02X",
+      bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5]);
+}
+
+class OutputListener : public StreamDecoder::Listener {
+public:
+  OutputListener(OutputFormat format): _format(format), _seq(0), _timestamp(0) { };
+
+  virtual void onScanHeader(uint16_t seq, uint32_t timestamp, uint8_t stationCount) {
+    _seq = seq;
+    _timestamp = timestamp;
+    if (_format == FORMAT_JSON) {
+      printf("{\"type\":\"scan\",\"scan\":%u,\"timestamp_ms\":%u,\"stations\":%u}\n",
+          seq, timestamp, stationCount);
+    }
+  };
+
+  virtual void onStation(uint16_t seq, const ScanLogStation &station) {
+    char bssid[18];
+    formatBssid(station.bssid, bssid);
+    uint32_t timestamp = seq == _seq ? _timestamp : 0; // 0 if we missed the scan header.
+
+    if (_format == FORMAT_CSV) {
+      printf("%u,%u,%s,", seq, timestamp, bssid);
+      printCsvString(station.ssid);
+      printf(",%u,%u,%d,%u,%u\n", station.primary, station.second, station.rssi,
+          station.authmode, station.phyFlags);
+    } else if (_format == FORMAT_JSON) {
+      printf("{\"type\":\"station\",\"scan\":%u,\"bssid\":\"%s\",\"ssid\":", seq, bssid);
+      printJsonString(station.ssid);
+      printf(",\"channel\":%u,\"second\":%u,\"rssi\":%d,\"authmode\":%u,\"phy\":%u}\n",
+          station.primary, station.second, station.rssi, station.authmode, station.phyFlags);
+    }
+  };
+
+  virtual void onChannelTotals(uint16_t seq, uint8_t band, const ChannelTotal *totals,
+      size_t numChannels) {
+    uint32_t timestamp = seq == _seq ? _timestamp : 0;
+
+    for (size_t i = 0; i < numChannels; i++) {
+      if (_format == FORMAT_CSV_CHANNELS) {
+        printf("%u,%u,%s,%u,%u,%d\n", seq, timestamp, bandName(band), totals[i].channel,
+            totals[i].signals, totals[i].maxRssi);
+      } else if (_format == FORMAT_JSON) {
+        printf("{\"type\":\"channel\",\"scan\":%u,\"band\":\"%s\",\"channel\":%u,"
+            "\"signals\":%u,\"max_rssi\":%d}\n", seq, bandName(band), totals[i].channel,
+            totals[i].signals, totals[i].maxRssi);
+      }
+    }
+  };
+
+private:
+  OutputFormat _format;
+  uint16_t _seq;
+  uint32_t _timestamp;
+};
+
+// If `fd` is a tty, put it in raw mode so the binary stream passes through unmodified.
+static void makeRaw(int fd) {
+  struct termios tio;
+  if (!isatty(fd) || tcgetattr(fd, &tio) != 0) {
+    return;
+  }
+
+  cfmakeraw(&tio);
+  tcsetattr(fd, TCSANOW, &tio);
+}
+
+static void usage() {
+  fprintf(stderr, "usage: wifi-stream-decode [--csv | --csv-channels | --json] [input]\n");
+}
+
+int main(int argc, char **argv) {
+  OutputFormat format = FORMAT_CSV;
+  const char *inputPath = "-";
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--csv") == 0) {
+      format = FORMAT_CSV;
+    } else if (strcmp(argv[i], "--csv-channels") == 0) {
+      format = FORMAT_CSV_CHANNELS;
+    } else if (strcmp(argv[i], "--json") == 0) {
+      format = FORMAT_JSON;
+    } else if (argv[i][0] == '-' && argv[i][1] != '\0') {
+      usage();
+      return 1;
+    } else {
+      inputPath = argv[i];
+    }
+  }
+
+  int fd = 0;
+  if (strcmp(inputPath, "-") != 0) {
+    fd = open(inputPath, O_RDONLY | O_NOCTTY);
+    if (fd < 0) {
+      perror(inputPath);
+      return 1;
+    }
+  }
+  makeRaw(fd);
+
+  // Block-buffer stdout; flush after each read so live output isn't held back.
+  static char outBuf[1 << 16];
+  setvbuf(stdout, outBuf, _IOFBF, sizeof(outBuf));
+
+  if (format == FORMAT_CSV) {
+    printf("scan,timestamp_ms,bssid,ssid,channel,second,rssi,authmode,phy\n");
+  } else if (format == FORMAT_CSV_CHANNELS) {
+    printf("scan,timestamp_ms,band,channel,signals,max_rssi\n");
+  }
+
+  OutputListener listener(format);
+  StreamDecoder decoder(listener);
+  uint8_t buf[4096];
+  ssize_t n;
+  while ((n = read(fd, buf, sizeof(buf))) > 0) {
+    decoder.feed(buf, n);
+    fflush(stdout);
+  }
+
+  fprintf(stderr, "%llu frames decoded, %llu rejected\n",
+      (unsigned long long)decoder.framesDecoded(), (unsigned long long)decoder.framesRejected());
+  return 0;
+}
@@ -0,0 +1,161 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Convert a site survey exported over USB serial to CSV.
+//
+// usage: wifi-survey-decode [--channels] [input]
+//
+// `input` is a serial device (e.g. /dev/ttyACM0), a captured stream file, or '-' for stdin
+// (the default). Start the export on the scanner (hold "Mark" for two seconds); this exits once
+// the export's end frame arrives. Output goes to stdout:
+//   (default)   one row per station heard at each surveyed location
+//   --channels  one row per channel at each surveyed location
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "stream-decoder.h"
+#include "survey-format.h"
+
+class SurveyListener : public StreamDecoder::Listener {
+public:
+  SurveyListener(bool channels): _channels(channels), _recordSeq(0), _recordLen(0),
+      _numRecords(0), _badRecords(0), _done(false) { };
+
+  // Live scan frames may be interleaved with the export; skip them.
+  virtual void onScanHeader(uint16_t seq, uint32_t timestamp, uint8_t stationCount) { };
+  virtual void onStation(uint16_t seq, const ScanLogStation &station) { };
+  virtual void onChannelTotals(uint16_t seq, uint8_t band, const ChannelTotal *totals,
+      size_t numChannels) { };
+
+  virtual void onSurveyChunk(uint16_t session, uint32_t recordSeq, uint16_t offset,
+      const uint8_t *data, size_t len) {
+    if (offset == 0) {
+      _recordSeq = recordSeq;
+      _recordLen = 0;
+    }
+    if (recordSeq != _recordSeq || offset != _recordLen || _recordLen + len > SURVEY_RECORD_LEN) {
+      return; // Missed a chunk of this record; it's dropped when the next one starts.
+    }
+
+    memcpy(_record + _recordLen, data, len);
+    _recordLen += len;
+    if (_recordLen == SURVEY_RECORD_LEN) {
+      _emit();
+      _recordLen = 0;
+    }
+  };
+
+  virtual void onSurveyEnd(uint16_t session, uint32_t numRecords) {
+    if (numRecords != _numRecords + _badRecords) {
+      fprintf(stderr, "warning: %u records sent but %u received\n", numRecords,
+          _numRecords + _badRecords);
+    }
+    _done = true;
+  };
+
+  bool done() const { return _done; };
+  uint32_t numRecords() const { return _numRecords; };
+  uint32_t badRecords() const { return _badRecords; };
+
+private:
+  void _emit() {
+    SurveyRecord rec;
+    if (!surveyDecodeRecord(_record, rec)) {
+      _badRecords++;
+      return;
+    }
+    _numRecords++;
+
+    if (_channels) {
+      for (size_t i = 0; i < rec.numChannels; i++) {
+        const SurveyChannel &ch = rec.channels[i];
+        printf("%u,%u,%u,%u,%u,%u,%d.%d\n", rec.session, rec.location, rec.timestamp,
+            rec.scans, ch.channel, ch.maxSignals, ch.meanPowerDeciDbm / 10,
+            (ch.meanPowerDeciDbm < 0 ? -ch.meanPowerDeciDbm : ch.meanPowerDeciDbm) % 10);
+      }
+      return;
+    }
+
+    for (size_t i = 0; i < rec.numStations; i++) {
+      const SurveyStation &st = rec.stations[i];
+      printf("%u,%u,%u,%u,%02X:%02X:%02X:%02X:%02X:%02X,%u,%d,%d,%u\n", rec.session,
+          rec.location, rec.timestamp, rec.scans, st.bssid[0], st.bssid[1], st.bssid[2],
+          st.bssid[3], st.bssid[4], st.bssid[5], st.primary, st.maxRssi, st.meanRssi,
+          st.scansSeen);
+    }
+    if (rec.stationsDropped) {
+      fprintf(stderr, "location %u.%u: %u stations didn't fit in the record\n", rec.session,
+          rec.location, rec.stationsDropped);
+    }
+  };
+
+  bool _channels;
+  uint32_t _recordSeq;
+  size_t _recordLen;
+  uint8_t _record[SURVEY_RECORD_LEN];
+  uint32_t _numRecords;
+  uint32_t _badRecords;
+  bool _done;
+};
+
+// If `fd` is a tty, put it in raw mode so the binary stream passes through unmodified.
+static void makeRaw(int fd) {
+  struct termios tio;
+  if (!isatty(fd) || tcgetattr(fd, &tio) != 0) {
+    return;
+  }
+
+  cfmakeraw(&tio);
+  tcsetattr(fd, TCSANOW, &tio);
+}
+
+static void usage() {
+  fprintf(stderr, "usage: wifi-survey-decode [--channels] [input]\n");
+}
+
+int main(int argc, char **argv) {
+  bool channels = false;
+  const char *inputPath = "-";
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--channels") == 0) {
+      channels = true;
+    } else if (argv[i][0] == '-' && argv[i][1] != '\0') {
+      usage();
+      return 1;
+    } else {
+      inputPath = argv[i];
+    }
+  }
+
+  int fd = 0;
+  if (strcmp(inputPath, "-") != 0) {
+    fd = open(inputPath, O_RDONLY | O_NOCTTY);
+    if (fd < 0) {
+      perror(inputPath);
+      return 1;
+    }
+  }
+  makeRaw(fd);
+
+  if (channels) {
+    printf("session,location,timestamp_ms,scans,channel,max_signals,mean_power_dbm\n");
+  } else {
+    printf("session,location,timestamp_ms,scans,bssid,channel,max_rssi,mean_rssi,scans_seen\n");
+  }
+
+  SurveyListener listener(channels);
+  StreamDecoder decoder(listener);
+  uint8_t buf[4096];
+  ssize_t n;
+  while (!listener.done() && (n = read(fd, buf, sizeof(buf))) > 0) {
+    decoder.feed(buf, n);
+  }
+
+  fprintf(stderr, "%u survey records decoded, %u bad\n", listener.numRecords(),
+      listener.badRecords());
+  return 0;
+}
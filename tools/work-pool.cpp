@@ -0,0 +1,66 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// Work-stealing thread pool. See work-pool.h.
+
+#include <thread>
+
+#include "work-pool.h"
+
+WorkStealingPool::WorkStealingPool(size_t numWorkers): _steals(0) {
+  for (size_t i = 0; i < numWorkers; i++) {
+    _workers.emplace_back(new Worker());
+  }
+}
+
+bool WorkStealingPool::_pop(size_t worker, size_t &task) {
+  Worker &w = *_workers[worker];
+  std::lock_guard<std::mutex> guard(w.lock);
+  if (w.tasks.empty()) {
+    return false;
+  }
+
+  task = w.tasks.back();
+  w.tasks.pop_back();
+  return true;
+}
+
+// Take the oldest task of the first other worker that has one, starting with the next worker
+// over so that thieves spread out across victims.
+bool WorkStealingPool::_steal(size_t thief, size_t &task) {
+  for (size_t i = 1; i < _workers.size(); i++) {
+    Worker &victim = *_workers[(thief + i) % _workers.size()];
+    std::lock_guard<std::mutex> guard(victim.lock);
+    if (!victim.tasks.empty()) {
+      task = victim.tasks.front();
+      victim.tasks.pop_front();
+      _steals.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void WorkStealingPool::_work(size_t worker, const TaskFn &fn) {
+  size_t task;
+  while (_pop(worker, task) || _steal(worker, task)) {
+    fn(task, worker);
+  }
+}
+
+void WorkStealingPool::run(size_t numTasks, const TaskFn &fn) {
+  _steals = 0;
+  for (size_t task = 0; task < numTasks; task++) {
+    _workers[task % _workers.size()]->tasks.push_back(task);
+  }
+
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < _workers.size(); i++) {
+    threads.emplace_back(&WorkStealingPool::_work, this, i, std::cref(fn));
+  }
+  _work(0, fn); // The calling thread is worker 0.
+
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+}
@@ -0,0 +1,54 @@
+// (c) Copyright 2022 Aaron Kimball
+//
+// A fixed set of worker threads that run a batch of independent tasks, balanced by work
+// stealing.
+
+#ifndef _WORK_POOL_H
+#define _WORK_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Tasks are numbered 0..numTasks-1 and dealt round-robin to the workers' deques. Each worker
+// takes tasks from the back of its own deque; once that is empty, it steals from the front of
+// the others'. Deal the tasks smallest first, so that each worker starts on its largest task and
+// only the small ones are left to steal near the end.
+//
+// No task adds tasks, so a worker that finds every deque empty is done. Each deque has its own
+// lock, which its owner takes once per task; workers contend only while stealing.
+class WorkStealingPool {
+public:
+  // Runs task `task` on worker `worker` (0..numWorkers-1).
+  typedef std::function<void(size_t task, size_t worker)> TaskFn;
+
+  WorkStealingPool(size_t numWorkers);
+
+  // Run all the tasks, and return once they're done.
+  void run(size_t numTasks, const TaskFn &fn);
+
+  size_t numWorkers() const { return _workers.size(); };
+  // Tasks run by a worker other than the one they were dealt to, in the last run().
+  uint64_t steals() const { return _steals.load(std::memory_order_relaxed); };
+
+private:
+  struct Worker {
+    std::mutex lock;
+    std::deque<size_t> tasks;
+  };
+
+  bool _pop(size_t worker, size_t &task);
+  bool _steal(size_t thief, size_t &task);
+  void _work(size_t worker, const TaskFn &fn);
+
+  std::vector<std::unique_ptr<Worker>> _workers;
+  std::atomic<uint64_t> _steals;
+};
+
+#endif